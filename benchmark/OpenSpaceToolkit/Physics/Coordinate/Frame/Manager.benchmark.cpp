@@ -0,0 +1,77 @@
+/// Apache License 2.0
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Manager.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::physics::time::Instant;
+using ostk::physics::time::Duration;
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Transform;
+
+using FrameManager = ostk::physics::coordinate::frame::Manager;
+
+static const Size InstantCount = 1000;
+
+// Frame lookup through the registry (built-in frame factories)
+
+static void OpenSpaceToolkit_Physics_Coordinate_Frame_Manager_AccessFrame(benchmark::State& aState)
+{
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(Frame::ITRF());
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Coordinate_Frame_Manager_AccessFrame)->ThreadRange(1, 64)->UseRealTime();
+
+// Cached transform lookups, warmed up before timing
+
+static void OpenSpaceToolkit_Physics_Coordinate_Frame_Manager_GetCachedTransform(benchmark::State& aState)
+{
+    const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+    const Shared<const Frame> itrfSPtr = Frame::ITRF();
+
+    for (Size index = 0; index < InstantCount; ++index)
+    {
+        gcrfSPtr->getTransformTo(itrfSPtr, Instant::J2000() + Duration::Seconds(static_cast<double>(index)));
+    }
+
+    Size index = 0;
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(gcrfSPtr->getTransformTo(
+            itrfSPtr, Instant::J2000() + Duration::Seconds(static_cast<double>(index++ % InstantCount))
+        ));
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Coordinate_Frame_Manager_GetCachedTransform)->ThreadRange(1, 64)->UseRealTime();
+
+// Mixed workload: every thread computes and caches transforms at distinct instants
+
+static void OpenSpaceToolkit_Physics_Coordinate_Frame_Manager_AddCachedTransform(benchmark::State& aState)
+{
+    const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+    const Shared<const Frame> itrfSPtr = Frame::ITRF();
+
+    const Instant startInstant = Instant::J2000() + Duration::Days(static_cast<double>(aState.thread_index()));
+
+    Size index = 0;
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(
+            gcrfSPtr->getTransformTo(itrfSPtr, startInstant + Duration::Milliseconds(static_cast<double>(index++)))
+        );
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Coordinate_Frame_Manager_AddCachedTransform)->ThreadRange(1, 64)->UseRealTime();
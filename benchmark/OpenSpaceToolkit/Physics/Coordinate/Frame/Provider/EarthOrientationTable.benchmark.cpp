@@ -0,0 +1,120 @@
+/// Apache License 2.0
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/CIRF.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/EarthOrientationTable.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/ITRF.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::physics::time::Instant;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Interval;
+using ostk::physics::coordinate::frame::provider::EarthOrientationTable;
+using ostk::physics::coordinate::frame::provider::CIRF;
+using ostk::physics::coordinate::frame::provider::ITRF;
+
+static const Size InstantCount = 1000;
+
+static Instant InstantAt(const Size anIndex)
+{
+    return Instant::J2000() + Duration::Seconds(static_cast<double>((anIndex * 86400) / InstantCount) * 10.0);
+}
+
+static Shared<const EarthOrientationTable> AccessTable()
+{
+    static const Shared<const EarthOrientationTable> tableSPtr = std::make_shared<const EarthOrientationTable>(
+        Interval::Closed(Instant::J2000(), Instant::J2000() + Duration::Days(11.0)), Duration::Days(1.0)
+    );
+
+    return tableSPtr;
+}
+
+// CIP X, Y and CIO locator s: IAU 2006/2000A series
+
+static void OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_CIRF_GetTransformAt(benchmark::State& aState)
+{
+    const CIRF provider;
+
+    Size index = 0;
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(provider.getTransformAt(InstantAt(index++ % InstantCount)));
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_CIRF_GetTransformAt);
+
+// CIP X, Y and CIO locator s: interpolated from table
+
+static void OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_CIRF_GetTransformAt_Interpolated(
+    benchmark::State& aState
+)
+{
+    const CIRF provider = {AccessTable()};
+
+    Size index = 0;
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(provider.getTransformAt(InstantAt(index++ % InstantCount)));
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_CIRF_GetTransformAt_Interpolated);
+
+// Table evaluation only
+
+static void OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_EarthOrientationTable_GetCipCoordinatesAt(
+    benchmark::State& aState
+)
+{
+    const Shared<const EarthOrientationTable> tableSPtr = AccessTable();
+
+    Size index = 0;
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(tableSPtr->getCipCoordinatesAt(InstantAt(index++ % InstantCount)));
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_EarthOrientationTable_GetCipCoordinatesAt);
+
+// Polar motion: IERS bulletins vs. interpolated from table
+
+static void OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_ITRF_GetTransformAt(benchmark::State& aState)
+{
+    const ITRF provider;
+
+    Size index = 0;
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(provider.getTransformAt(InstantAt(index++ % InstantCount)));
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_ITRF_GetTransformAt);
+
+static void OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_ITRF_GetTransformAt_Interpolated(
+    benchmark::State& aState
+)
+{
+    const ITRF provider = {AccessTable()};
+
+    Size index = 0;
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(provider.getTransformAt(InstantAt(index++ % InstantCount)));
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_ITRF_GetTransformAt_Interpolated);
@@ -0,0 +1,73 @@
+/// Apache License 2.0
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/EOPTable.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/Finals2000A.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+using ostk::core::type::Size;
+
+using ostk::physics::coordinate::frame::provider::iers::EOPTable;
+using ostk::physics::coordinate::frame::provider::iers::Finals2000A;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+
+static const Size InstantCount = 1000;
+
+static const Finals2000A& AccessFinals2000A()
+{
+    static const Finals2000A finals2000A = Finals2000A::Load(File::Path(
+        Path::Parse("/app/test/OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/finals-2000A/finals2000A.data")
+    ));
+
+    return finals2000A;
+}
+
+static Instant InstantAt(const Size anIndex)
+{
+    return AccessFinals2000A().getInterval().accessStart() +
+           Duration::Hours(static_cast<double>(anIndex % InstantCount) * 7.0 + 0.5);
+}
+
+// Map-based lookup
+
+static void OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Finals2000A_GetDataAt(benchmark::State& aState)
+{
+    const Finals2000A& finals2000A = AccessFinals2000A();
+
+    Size index = 0;
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(finals2000A.getDataAt(InstantAt(index++)));
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Finals2000A_GetDataAt);
+
+// Table-based lookup
+
+static void OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_EOPTable_GetPolarMotionAt(benchmark::State& aState)
+{
+    const EOPTable& table = AccessFinals2000A().accessTable();
+
+    const EOPTable::Interpolation interpolation = static_cast<EOPTable::Interpolation>(aState.range(0));
+
+    Size index = 0;
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(table.getPolarMotionAt(InstantAt(index++), interpolation));
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_EOPTable_GetPolarMotionAt)
+    ->Arg(static_cast<int>(EOPTable::Interpolation::Linear))
+    ->Arg(static_cast<int>(EOPTable::Interpolation::Lagrange));
@@ -0,0 +1,48 @@
+/// Apache License 2.0
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/CSSISpaceWeather.hpp>
+
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+
+using ostk::physics::environment::atmospheric::earth::CSSISpaceWeather;
+
+static const char* DataPath = "/app/test/OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/NRLMSISE00";
+
+// Cold load of a CSSI space weather file in csv format (5 years of observations)
+
+static void OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_CSSISpaceWeather_Load(benchmark::State& aState)
+{
+    const File file = File::Path(Path::Parse(DataPath) + Path::Parse("SW-Last5Years.csv"));
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(CSSISpaceWeather::Load(file));
+    }
+
+    aState.SetBytesProcessed(static_cast<int64_t>(aState.iterations() * file.getContents().getLength()));
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_CSSISpaceWeather_Load)->Unit(benchmark::kMillisecond);
+
+// Cold load of a CSSI space weather file in legacy format (all observations since 1957)
+
+static void OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_CSSISpaceWeather_LoadLegacy(benchmark::State& aState)
+{
+    const File file = File::Path(Path::Parse(DataPath) + Path::Parse("SpaceWeather-All-v1.2.txt"));
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(CSSISpaceWeather::LoadLegacy(file));
+    }
+
+    aState.SetBytesProcessed(static_cast<int64_t>(aState.iterations() * file.getContents().getLength()));
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_CSSISpaceWeather_LoadLegacy)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,172 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Spherical/LLA.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/HarrisPriester.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/NRLMSISE00.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Size;
+
+using ostk::physics::coordinate::spherical::LLA;
+using ostk::physics::environment::atmospheric::earth::HarrisPriester;
+using ostk::physics::environment::atmospheric::earth::NRLMSISE00;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+
+static const Size SampleCount = 1024;
+
+static const Instant& StartInstant()
+{
+    static const Instant instant = Instant::DateTime(DateTime::Parse("2021-01-01 00:00:00"), Scale::UTC);
+
+    return instant;
+}
+
+// Positions along a LEO-like track, over the 200 km - 800 km band
+
+static const Array<LLA>& LLAs()
+{
+    static const Array<LLA> llas = []() -> Array<LLA>
+    {
+        Array<LLA> llaArray = Array<LLA>::Empty();
+
+        for (Size index = 0; index < SampleCount; ++index)
+        {
+            llaArray.add(LLA(
+                Angle::Degrees(80.0 * std::sin(0.01 * static_cast<double>(index))),
+                Angle::Degrees(std::fmod(0.4 * static_cast<double>(index), 360.0) - 180.0),
+                Length::Kilometers(200.0 + 600.0 * static_cast<double>(index) / static_cast<double>(SampleCount))
+            ));
+        }
+
+        return llaArray;
+    }();
+
+    return llas;
+}
+
+// Instants along the track, 10 s apart
+
+static const Array<Instant>& Instants()
+{
+    static const Array<Instant> instants = []() -> Array<Instant>
+    {
+        Array<Instant> instantArray = Array<Instant>::Empty();
+
+        for (Size index = 0; index < SampleCount; ++index)
+        {
+            instantArray.add(StartInstant() + Duration::Seconds(10.0 * static_cast<double>(index)));
+        }
+
+        return instantArray;
+    }();
+
+    return instants;
+}
+
+// Reference: NRLMSISE00 at mean solar activity (F10.7 = F10.7a = 150, Kp = 3), matching the Harris-Priester table
+
+static NRLMSISE00 ReferenceModel()
+{
+    return {NRLMSISE00::InputDataType::ConstantFluxAndGeoMag, 150.0, 150.0, 3.0};
+}
+
+static void OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_HarrisPriester_Reference_GetDensityAt(
+    benchmark::State& aState
+)
+{
+    const NRLMSISE00 nrlmsise = ReferenceModel();
+
+    const Array<LLA>& llas = LLAs();
+    const Array<Instant>& instants = Instants();
+
+    for (auto _ : aState)
+    {
+        for (Size index = 0; index < llas.getSize(); ++index)
+        {
+            benchmark::DoNotOptimize(nrlmsise.getDensityAt(llas[index], instants[index]));
+        }
+    }
+
+    aState.SetItemsProcessed(static_cast<int64_t>(aState.iterations() * llas.getSize()));
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_HarrisPriester_Reference_GetDensityAt);
+
+// Harris-Priester, one position and instant at a time. The counters report the relative difference with respect to
+// NRLMSISE00 over the track.
+
+static void OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_HarrisPriester_GetDensityAt(benchmark::State& aState)
+{
+    const HarrisPriester harrisPriester = {static_cast<double>(aState.range(0))};
+
+    const Array<LLA>& llas = LLAs();
+    const Array<Instant>& instants = Instants();
+
+    for (auto _ : aState)
+    {
+        for (Size index = 0; index < llas.getSize(); ++index)
+        {
+            benchmark::DoNotOptimize(harrisPriester.getDensityAt(llas[index], instants[index]));
+        }
+    }
+
+    aState.SetItemsProcessed(static_cast<int64_t>(aState.iterations() * llas.getSize()));
+
+    const NRLMSISE00 nrlmsise = ReferenceModel();
+
+    double sumOfRelativeErrors = 0.0;
+    double maximumRelativeError = 0.0;
+
+    for (Size index = 0; index < llas.getSize(); ++index)
+    {
+        const double referenceDensity = nrlmsise.getDensityAt(llas[index], instants[index]);
+        const double relativeError =
+            std::abs(harrisPriester.getDensityAt(llas[index], instants[index]) - referenceDensity) / referenceDensity;
+
+        sumOfRelativeErrors += relativeError;
+        maximumRelativeError = std::max(maximumRelativeError, relativeError);
+    }
+
+    aState.counters["MeanRelativeError"] = sumOfRelativeErrors / static_cast<double>(llas.getSize());
+    aState.counters["MaxRelativeError"] = maximumRelativeError;
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_HarrisPriester_GetDensityAt)->Arg(2)->Arg(4)->Arg(6);
+
+// Harris-Priester, all positions at a single instant (the diurnal bulge apex is computed once)
+
+static void OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_HarrisPriester_GetDensitiesAtInstant(
+    benchmark::State& aState
+)
+{
+    const HarrisPriester harrisPriester = {};
+
+    const Array<LLA>& llas = LLAs();
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(harrisPriester.getDensitiesAt(llas, StartInstant()));
+    }
+
+    aState.SetItemsProcessed(static_cast<int64_t>(aState.iterations() * llas.getSize()));
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_HarrisPriester_GetDensitiesAtInstant);
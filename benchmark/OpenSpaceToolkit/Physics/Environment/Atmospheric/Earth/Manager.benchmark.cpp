@@ -0,0 +1,100 @@
+/// Apache License 2.0
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Spherical/LLA.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/CSSISpaceWeather.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/Manager.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/NRLMSISE00.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+using ostk::core::type::Size;
+
+using ostk::physics::coordinate::spherical::LLA;
+using ostk::physics::environment::atmospheric::earth::CSSISpaceWeather;
+using ostk::physics::environment::atmospheric::earth::Manager;
+using ostk::physics::environment::atmospheric::earth::NRLMSISE00;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+
+static const Size InstantCount = 1000;
+
+// Load the test space weather file once, shared by all benchmark threads
+
+static const Instant& StartInstant()
+{
+    static const Instant startInstant = []() -> Instant
+    {
+        Manager& manager = Manager::Get();
+
+        manager.reset();
+        manager.loadCSSISpaceWeather(CSSISpaceWeather::Load(File::Path(Path::Parse(
+            "/app/test/OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/CSSISpaceWeather/SW-Last5Years.test.csv"
+        ))));
+
+        return Instant::DateTime(DateTime::Parse("2023-01-01 00:00:00"), Scale::UTC);
+    }();
+
+    return startInstant;
+}
+
+// Space weather lookups, as done for every NRLMSISE00 density evaluation
+
+static void OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_Manager_GetSpaceWeatherAt(benchmark::State& aState)
+{
+    const Manager& manager = Manager::Get();
+    const Instant startInstant = StartInstant();
+
+    Size index = 0;
+
+    for (auto _ : aState)
+    {
+        const Instant instant = startInstant + Duration::Minutes(static_cast<double>(index++ % InstantCount));
+
+        benchmark::DoNotOptimize(manager.getAp3HourSolarIndicesAt(instant));
+        benchmark::DoNotOptimize(manager.getApDailyIndexAt(instant));
+        benchmark::DoNotOptimize(manager.getF107SolarFluxAt(instant));
+        benchmark::DoNotOptimize(manager.getF107SolarFlux81DayAvgAt(instant));
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_Manager_GetSpaceWeatherAt)
+    ->ThreadRange(1, 32)
+    ->UseRealTime();
+
+// NRLMSISE00 density evaluations, with space weather from the manager
+
+static void OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_Manager_GetDensityAt(benchmark::State& aState)
+{
+    const NRLMSISE00 nrlmsise = {};
+    const Instant startInstant = StartInstant();
+
+    const LLA lla = {Angle::Degrees(35.0), Angle::Degrees(-92.0), Length::Kilometers(400.0)};
+
+    Size index = 0;
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(nrlmsise.getDensityAt(
+            lla, startInstant + Duration::Minutes(static_cast<double>(index++ % InstantCount))
+        ));
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_Manager_GetDensityAt)
+    ->ThreadRange(1, 32)
+    ->UseRealTime();
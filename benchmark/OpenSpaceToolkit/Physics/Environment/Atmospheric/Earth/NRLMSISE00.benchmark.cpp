@@ -0,0 +1,136 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Spherical/LLA.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/NRLMSISE00.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Size;
+
+using ostk::physics::coordinate::spherical::LLA;
+using ostk::physics::environment::atmospheric::earth::NRLMSISE00;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+
+static const Size SampleCount = 1024;
+
+static const Instant& StartInstant()
+{
+    static const Instant instant = Instant::DateTime(DateTime::Parse("2021-01-01 00:00:00"), Scale::UTC);
+
+    return instant;
+}
+
+// Positions along a LEO-like track
+
+static const Array<LLA>& LLAs()
+{
+    static const Array<LLA> llas = []() -> Array<LLA>
+    {
+        Array<LLA> llaArray = Array<LLA>::Empty();
+
+        for (Size index = 0; index < SampleCount; ++index)
+        {
+            llaArray.add(LLA(
+                Angle::Degrees(80.0 * std::sin(0.01 * static_cast<double>(index))),
+                Angle::Degrees(std::fmod(0.4 * static_cast<double>(index), 360.0) - 180.0),
+                Length::Kilometers(400.0 + 0.1 * static_cast<double>(index % 1000))
+            ));
+        }
+
+        return llaArray;
+    }();
+
+    return llas;
+}
+
+// Instants along the track, 10 s apart
+
+static const Array<Instant>& Instants()
+{
+    static const Array<Instant> instants = []() -> Array<Instant>
+    {
+        Array<Instant> instantArray = Array<Instant>::Empty();
+
+        for (Size index = 0; index < SampleCount; ++index)
+        {
+            instantArray.add(StartInstant() + Duration::Seconds(10.0 * static_cast<double>(index)));
+        }
+
+        return instantArray;
+    }();
+
+    return instants;
+}
+
+static void OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_NRLMSISE00_GetDensityAt(benchmark::State& aState)
+{
+    const NRLMSISE00 nrlmsise = {};
+
+    const Array<LLA>& llas = LLAs();
+    const Array<Instant>& instants = Instants();
+
+    for (auto _ : aState)
+    {
+        for (Size index = 0; index < llas.getSize(); ++index)
+        {
+            benchmark::DoNotOptimize(nrlmsise.getDensityAt(llas[index], instants[index]));
+        }
+    }
+
+    aState.SetItemsProcessed(static_cast<int64_t>(aState.iterations() * llas.getSize()));
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_NRLMSISE00_GetDensityAt);
+
+static void OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_NRLMSISE00_GetDensitiesAtInstant(
+    benchmark::State& aState
+)
+{
+    const NRLMSISE00 nrlmsise = {};
+
+    const Array<LLA>& llas = LLAs();
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(nrlmsise.getDensitiesAt(llas, StartInstant()));
+    }
+
+    aState.SetItemsProcessed(static_cast<int64_t>(aState.iterations() * llas.getSize()));
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_NRLMSISE00_GetDensitiesAtInstant);
+
+static void OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_NRLMSISE00_GetDensitiesAtInstants(
+    benchmark::State& aState
+)
+{
+    const NRLMSISE00 nrlmsise = {};
+
+    const Array<LLA>& llas = LLAs();
+    const Array<Instant>& instants = Instants();
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(nrlmsise.getDensitiesAt(llas, instants));
+    }
+
+    aState.SetItemsProcessed(static_cast<int64_t>(aState.iterations() * llas.getSize()));
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_NRLMSISE00_GetDensitiesAtInstants);
@@ -0,0 +1,98 @@
+/// Apache License 2.0
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Ephemeris/Chebyshev.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Ephemeris/SPICE.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::environment::ephemeris::Chebyshev;
+using ostk::physics::environment::ephemeris::SPICE;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+
+static const Instant StartInstant = Instant::DateTime(DateTime(2022, 1, 1, 0, 0, 0), Scale::UTC);
+static const Interval MissionInterval = Interval::Closed(StartInstant, StartInstant + Duration::Days(30.0));
+
+// Position of the Sun and Moon in GCRF, with a distinct instant per iteration (no frame cache hits)
+
+static void BenchmarkPositions(
+    benchmark::State& aState, const Shared<const Frame>& aSunFrameSPtr, const Shared<const Frame>& aMoonFrameSPtr
+)
+{
+    const Position sunOrigin = Position::Meters({0.0, 0.0, 0.0}, aSunFrameSPtr);
+    const Position moonOrigin = Position::Meters({0.0, 0.0, 0.0}, aMoonFrameSPtr);
+
+    Size index = 0;
+
+    for (auto _ : aState)
+    {
+        const Instant instant = StartInstant + Duration::Seconds(static_cast<double>(index++ % 2000000));
+
+        benchmark::DoNotOptimize(sunOrigin.inFrame(Frame::GCRF(), instant));
+        benchmark::DoNotOptimize(moonOrigin.inFrame(Frame::GCRF(), instant));
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * 2);
+}
+
+static void OpenSpaceToolkit_Physics_Environment_Ephemeris_Chebyshev_GetPosition_SPICE(benchmark::State& aState)
+{
+    const SPICE sun = {SPICE::Object::Sun};
+    const SPICE moon = {SPICE::Object::Moon};
+
+    BenchmarkPositions(aState, sun.accessFrame(), moon.accessFrame());
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Environment_Ephemeris_Chebyshev_GetPosition_SPICE);
+
+static void OpenSpaceToolkit_Physics_Environment_Ephemeris_Chebyshev_GetPosition_Chebyshev(benchmark::State& aState)
+{
+    static const Chebyshev sun = {SPICE(SPICE::Object::Sun), MissionInterval};
+    static const Chebyshev moon = {SPICE(SPICE::Object::Moon), MissionInterval};
+
+    aState.counters["SunPositionAccuracy"] = sun.getPositionAccuracy();
+    aState.counters["MoonPositionAccuracy"] = moon.getPositionAccuracy();
+
+    BenchmarkPositions(aState, sun.accessFrame(), moon.accessFrame());
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Environment_Ephemeris_Chebyshev_GetPosition_Chebyshev);
+
+// Fit over a 30 day mission window
+
+static void OpenSpaceToolkit_Physics_Environment_Ephemeris_Chebyshev_Fit(benchmark::State& aState)
+{
+    const SPICE moon = {SPICE::Object::Moon};
+
+    Size index = 0;
+
+    for (auto _ : aState)
+    {
+        // Shift the window on every run, as frames and transforms are cached
+
+        const Instant startInstant = StartInstant + Duration::Days(31.0 * static_cast<double>(++index));
+
+        benchmark::DoNotOptimize(
+            Chebyshev(moon, Interval::Closed(startInstant, startInstant + Duration::Days(30.0)))
+        );
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Environment_Ephemeris_Chebyshev_Fit)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,129 @@
+/// Apache License 2.0
+
+#include <atomic>
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Ephemeris/SPICE.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Ephemeris/SPICE/Engine.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Ephemeris/SPICE/Kernel.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Ephemeris/SPICE/Reader.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::environment::ephemeris::SPICE;
+using ostk::physics::environment::ephemeris::spice::Engine;
+using ostk::physics::environment::ephemeris::spice::Kernel;
+using ostk::physics::environment::ephemeris::spice::Reader;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+
+static const Instant StartInstant = Instant::DateTime(DateTime(2021, 1, 1, 0, 0, 0), Scale::UTC);
+
+// Load the test kernels once, shared by all benchmark threads
+
+static const Reader& AccessReader()
+{
+    static const Reader reader = []() -> Reader
+    {
+        Reader reader;
+
+        for (const auto& kernelName : Array<String> {
+                 "de430.bsp", "pck00010.tpc", "moon_080317.tf", "moon_assoc_me.tf", "moon_pa_de421_1900-2050.bpc"
+             })
+        {
+            reader.loadKernel(Kernel::File(File::Path(
+                Path::Parse("/app/test/OpenSpaceToolkit/Physics/Environment/Ephemeris/SPICE") + Path::Parse(kernelName)
+            )));
+        }
+
+        return reader;
+    }();
+
+    return reader;
+}
+
+// In-process evaluation of the Sun and Moon transforms
+
+static void OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Reader_GetTransformAt(benchmark::State& aState)
+{
+    const Reader& reader = AccessReader();
+
+    // Distinct instants per thread
+
+    Size index = static_cast<Size>(aState.thread_index()) * 1000000;
+
+    for (auto _ : aState)
+    {
+        const Instant instant = StartInstant + Duration::Seconds(static_cast<double>(index++));
+
+        benchmark::DoNotOptimize(reader.getTransformAt(10, "IAU_SUN", instant));
+        benchmark::DoNotOptimize(reader.getTransformAt(301, "MOON_ME", instant));
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * 2);
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Reader_GetTransformAt)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+// Engine frame transforms, with and without the in-process reader (CSPICE only)
+
+static void OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Reader_GetEngineTransform(benchmark::State& aState)
+{
+    Engine& engine = Engine::Get();
+
+    if (aState.thread_index() == 0)
+    {
+        engine.setReaderEnabled(aState.range(0) != 0);
+    }
+
+    const auto sunFrameSPtr = engine.getFrameOf(SPICE::Object::Sun);
+    const auto moonFrameSPtr = engine.getFrameOf(SPICE::Object::Moon);
+
+    // Distinct instants per thread and run, to bypass frame transform caches
+
+    static std::atomic<Size> runIndex {0};
+
+    Size index = (runIndex++ * 64 + static_cast<Size>(aState.thread_index())) * 1000000;
+
+    for (auto _ : aState)
+    {
+        const Instant instant = StartInstant + Duration::Seconds(static_cast<double>(index++));
+
+        benchmark::DoNotOptimize(Frame::GCRF()->getTransformTo(sunFrameSPtr, instant));
+        benchmark::DoNotOptimize(Frame::GCRF()->getTransformTo(moonFrameSPtr, instant));
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * 2);
+
+    if (aState.thread_index() == 0)
+    {
+        engine.setReaderEnabled(true);
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Reader_GetEngineTransform)
+    ->ArgName("Reader")
+    ->Arg(0)
+    ->Arg(1)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
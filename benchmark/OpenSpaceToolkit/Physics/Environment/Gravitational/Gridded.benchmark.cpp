@@ -0,0 +1,107 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Directory.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Gridded.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::filesystem::Directory;
+using ostk::core::filesystem::Path;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::environment::gravitational::Gridded;
+using ostk::physics::time::Instant;
+using ostk::physics::unit::Length;
+using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
+
+static const char* DataPath = "/app/test/OpenSpaceToolkit/Physics/Environment/Gravitational/Earth";
+
+static const Size PositionCount = 1024;
+
+// Positions on a LEO-like shell, spread in latitude and longitude, along a continuous track
+
+static const Array<Vector3d>& Positions()
+{
+    static const Array<Vector3d> positions = []() -> Array<Vector3d>
+    {
+        Array<Vector3d> positionArray = Array<Vector3d>::Empty();
+
+        for (Size index = 0; index < PositionCount; ++index)
+        {
+            const double latitude = 1.5 * std::sin(0.01 * static_cast<double>(index));
+            const double longitude = 0.007 * static_cast<double>(index);
+            const double radius = 6778137.0 + 100.0 * static_cast<double>(index % 1000);
+
+            positionArray.add(
+                {radius * std::cos(latitude) * std::cos(longitude),
+                 radius * std::cos(latitude) * std::sin(longitude),
+                 radius * std::sin(latitude)}
+            );
+        }
+
+        return positionArray;
+    }();
+
+    return positions;
+}
+
+static EarthGravitationalModel LoadModel(const int aDegree)
+{
+    return {EarthGravitationalModel::Type::EGM96, Directory::Path(Path::Parse(DataPath)), aDegree, aDegree};
+}
+
+// Reference: original model, one position at a time
+
+static void OpenSpaceToolkit_Physics_Environment_Gravitational_Gridded_Reference(benchmark::State& aState)
+{
+    const EarthGravitationalModel model = LoadModel(static_cast<int>(aState.range(0)));
+
+    const Array<Vector3d>& positions = Positions();
+
+    for (auto _ : aState)
+    {
+        for (const auto& position : positions)
+        {
+            benchmark::DoNotOptimize(model.getFieldValueAt(position, Instant::J2000()));
+        }
+    }
+
+    aState.SetItemsProcessed(static_cast<int64_t>(aState.iterations() * positions.getSize()));
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Environment_Gravitational_Gridded_Reference)->Arg(20)->Arg(36);
+
+// Gridded model over a 6678 km - 6878 km band, at a 1e-7 m.s-2 tolerance, one position at a time
+
+static void OpenSpaceToolkit_Physics_Environment_Gravitational_Gridded_GetFieldValueAt(benchmark::State& aState)
+{
+    const Gridded gridded = {
+        LoadModel(static_cast<int>(aState.range(0))), Length::Meters(6678137.0), Length::Meters(6878137.0), 1e-7
+    };
+
+    const Array<Vector3d>& positions = Positions();
+
+    for (auto _ : aState)
+    {
+        for (const auto& position : positions)
+        {
+            benchmark::DoNotOptimize(gridded.getFieldValueAt(position, Instant::J2000()));
+        }
+    }
+
+    aState.SetItemsProcessed(static_cast<int64_t>(aState.iterations() * positions.getSize()));
+    aState.counters["GridSize"] = static_cast<double>(gridded.getFieldGrid().getMemorySize());
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Environment_Gravitational_Gridded_GetFieldValueAt)->Arg(20)->Arg(36);
@@ -0,0 +1,200 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+
+#include <GeographicLib/GravityModel.hpp>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/SphericalHarmonics.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+using ostk::core::type::Integer;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::environment::gravitational::SphericalHarmonics;
+
+static const char* DataPath = "/app/test/OpenSpaceToolkit/Physics/Environment/Gravitational/Earth";
+
+static const Size PositionCount = 1024;
+
+// Positions on a LEO-like shell, spread in latitude and longitude
+
+static const Array<Vector3d>& Positions()
+{
+    static const Array<Vector3d> positions = []() -> Array<Vector3d>
+    {
+        Array<Vector3d> positionArray = Array<Vector3d>::Empty();
+
+        for (Size index = 0; index < PositionCount; ++index)
+        {
+            const double latitude = 1.5 * std::sin(0.37 * static_cast<double>(index));
+            const double longitude = 0.11 * static_cast<double>(index);
+            const double radius = 6778137.0 + 1000.0 * static_cast<double>(index % 400);
+
+            positionArray.add(
+                {radius * std::cos(latitude) * std::cos(longitude),
+                 radius * std::cos(latitude) * std::sin(longitude),
+                 radius * std::sin(latitude)}
+            );
+        }
+
+        return positionArray;
+    }();
+
+    return positions;
+}
+
+static SphericalHarmonics LoadModel(const int aDegree)
+{
+    return SphericalHarmonics::Load(File::Path(Path::Parse(std::string(DataPath) + "/egm96.egm")), aDegree, aDegree);
+}
+
+// Reference: GeographicLib, one position at a time
+
+static void OpenSpaceToolkit_Physics_Environment_Gravitational_SphericalHarmonics_GeographicLib(
+    benchmark::State& aState
+)
+{
+    const int degree = static_cast<int>(aState.range(0));
+
+    const GeographicLib::GravityModel gravityModel {"egm96", DataPath, degree, degree};
+
+    const Array<Vector3d>& positions = Positions();
+
+    for (auto _ : aState)
+    {
+        for (const auto& position : positions)
+        {
+            double g_x;
+            double g_y;
+            double g_z;
+
+            benchmark::DoNotOptimize(gravityModel.V(position.x(), position.y(), position.z(), g_x, g_y, g_z));
+            benchmark::DoNotOptimize(g_x);
+            benchmark::DoNotOptimize(g_y);
+            benchmark::DoNotOptimize(g_z);
+        }
+    }
+
+    aState.SetItemsProcessed(static_cast<int64_t>(aState.iterations() * positions.getSize()));
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Environment_Gravitational_SphericalHarmonics_GeographicLib)
+    ->Arg(20)
+    ->Arg(70)
+    ->Arg(360);
+
+// One position at a time
+
+static void OpenSpaceToolkit_Physics_Environment_Gravitational_SphericalHarmonics_GetFieldValueAt(
+    benchmark::State& aState
+)
+{
+    const SphericalHarmonics model = LoadModel(static_cast<int>(aState.range(0)));
+
+    const Array<Vector3d>& positions = Positions();
+
+    for (auto _ : aState)
+    {
+        for (const auto& position : positions)
+        {
+            benchmark::DoNotOptimize(model.getFieldValueAt(position));
+        }
+    }
+
+    aState.SetItemsProcessed(static_cast<int64_t>(aState.iterations() * positions.getSize()));
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Environment_Gravitational_SphericalHarmonics_GetFieldValueAt)
+    ->Arg(20)
+    ->Arg(70)
+    ->Arg(360);
+
+// Batch of positions
+
+static void OpenSpaceToolkit_Physics_Environment_Gravitational_SphericalHarmonics_GetFieldValuesAt(
+    benchmark::State& aState
+)
+{
+    const SphericalHarmonics model = LoadModel(static_cast<int>(aState.range(0)));
+
+    const Array<Vector3d>& positions = Positions();
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(model.getFieldValuesAt(positions));
+    }
+
+    aState.SetItemsProcessed(static_cast<int64_t>(aState.iterations() * positions.getSize()));
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Environment_Gravitational_SphericalHarmonics_GetFieldValuesAt)
+    ->Arg(20)
+    ->Arg(70)
+    ->Arg(360);
+
+// Batch of positions, with gradients
+
+static void OpenSpaceToolkit_Physics_Environment_Gravitational_SphericalHarmonics_GetFieldValuesAndGradientsAt(
+    benchmark::State& aState
+)
+{
+    const SphericalHarmonics model = LoadModel(static_cast<int>(aState.range(0)));
+
+    const Array<Vector3d>& positions = Positions();
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(model.getFieldValuesAndGradientsAt(positions));
+    }
+
+    aState.SetItemsProcessed(static_cast<int64_t>(aState.iterations() * positions.getSize()));
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Environment_Gravitational_SphericalHarmonics_GetFieldValuesAndGradientsAt)
+    ->Arg(20)
+    ->Arg(70)
+    ->Arg(360);
+
+// One position at a time, on shells from LEO to GEO, truncated to the lowest degree meeting a 1e-9 m.s-2 tolerance
+
+static void OpenSpaceToolkit_Physics_Environment_Gravitational_SphericalHarmonics_GetFieldValueAtWithTruncation(
+    benchmark::State& aState
+)
+{
+    const SphericalHarmonics model = LoadModel(static_cast<int>(aState.range(0)));
+
+    Array<Vector3d> positions = Array<Vector3d>::Empty();
+    Array<Integer> degrees = Array<Integer>::Empty();
+
+    for (const auto& position : Positions())
+    {
+        const double radius = position.norm() * std::pow(6.2, static_cast<double>(positions.getSize() % 5) / 4.0);
+
+        positions.add(position.normalized() * radius);
+        degrees.add(model.getTruncationDegreeAt(radius, 1e-9));
+    }
+
+    for (auto _ : aState)
+    {
+        for (Size index = 0; index < positions.getSize(); ++index)
+        {
+            benchmark::DoNotOptimize(model.getFieldValueAt(positions[index], degrees[index]));
+        }
+    }
+
+    aState.SetItemsProcessed(static_cast<int64_t>(aState.iterations() * positions.getSize()));
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Environment_Gravitational_SphericalHarmonics_GetFieldValueAtWithTruncation)
+    ->Arg(70)
+    ->Arg(360);
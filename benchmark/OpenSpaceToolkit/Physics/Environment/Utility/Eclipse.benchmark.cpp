@@ -0,0 +1,71 @@
+/// Apache License 2.0
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Spherical/LLA.hpp>
+#include <OpenSpaceToolkit/Physics/Environment.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Utility/Eclipse.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+using ostk::core::container::Array;
+
+using ostk::physics::Environment;
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::spherical::LLA;
+using ostk::physics::environment::utilities::eclipseIntervalsAtPosition;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
+
+// Eclipse intervals of a ground position over a week, against the maximum search step
+
+static void OpenSpaceToolkit_Physics_Environment_Utility_Eclipse_EclipseIntervalsAtPosition(benchmark::State& aState)
+{
+    const Instant startInstant = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+    const Interval analysisInterval = Interval::Closed(startInstant, startInstant + Duration::Days(7.0));
+
+    const Position position_ITRF = Position::Meters(
+        LLA(Angle::Degrees(0.0), Angle::Degrees(0.0), Length::Meters(10.0))
+            .toCartesian(
+                EarthGravitationalModel::EGM2008.equatorialRadius_, EarthGravitationalModel::EGM2008.flattening_
+            ),
+        Frame::ITRF()
+    );
+    const Environment environment = Environment::Default();
+
+    const Duration maximumStep = Duration::Seconds(static_cast<double>(aState.range(0)));
+
+    Array<Interval> eclipseIntervals = Array<Interval>::Empty();
+
+    for (auto _ : aState)
+    {
+        eclipseIntervals = eclipseIntervalsAtPosition(analysisInterval, position_ITRF, environment, false, maximumStep);
+
+        benchmark::DoNotOptimize(eclipseIntervals);
+    }
+
+    aState.counters["EclipseCount"] = static_cast<double>(eclipseIntervals.getSize());
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Environment_Utility_Eclipse_EclipseIntervalsAtPosition)
+    ->Arg(60)
+    ->Arg(600)
+    ->Arg(3600)
+    ->Unit(benchmark::kMillisecond);
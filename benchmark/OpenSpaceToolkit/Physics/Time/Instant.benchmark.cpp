@@ -0,0 +1,126 @@
+/// Apache License 2.0
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/Manager.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+using ostk::core::type::Size;
+
+using ostk::physics::coordinate::frame::provider::iers::BulletinA;
+using ostk::physics::coordinate::frame::provider::iers::Manager;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+
+static const Size InstantCount = 1000;
+
+static Instant InstantAt(const Size anIndex, const Scale& aTimeScale)
+{
+    static const bool isLoaded = []() -> bool
+    {
+        Manager::Get().loadBulletinA(BulletinA::Load(File::Path(
+            Path::Parse("/app/test/OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/bulletin-A/ser7.dat")
+        )));
+
+        return true;
+    }();
+
+    (void)isLoaded;
+
+    return Instant::DateTime(DateTime(2018, 6, 23, 0, 0, 0), aTimeScale) +
+           Duration::Minutes(static_cast<double>(anIndex % InstantCount) * 17.0);
+}
+
+// Reference: UTC to TT
+
+static void OpenSpaceToolkit_Physics_Time_Instant_GetDateTime_TT(benchmark::State& aState)
+{
+    Size index = 0;
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(InstantAt(index++, Scale::UTC).getDateTime(Scale::TT));
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Time_Instant_GetDateTime_TT);
+
+// UTC to UT1: DUT1 lookup
+
+static void OpenSpaceToolkit_Physics_Time_Instant_GetDateTime_UT1(benchmark::State& aState)
+{
+    Size index = 0;
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(InstantAt(index++, Scale::UTC).getDateTime(Scale::UT1));
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Time_Instant_GetDateTime_UT1);
+
+// UT1 to UTC: inverse DUT1 iteration
+
+static void OpenSpaceToolkit_Physics_Time_Instant_GetDateTime_UT1_Inverse(benchmark::State& aState)
+{
+    Size index = 0;
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(InstantAt(index++, Scale::UT1).getDateTime(Scale::UTC));
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Time_Instant_GetDateTime_UT1_Inverse);
+
+// Repeated conversions of a given instant: cached DUT1
+
+static void OpenSpaceToolkit_Physics_Time_Instant_GetDateTime_UT1_Repeated(benchmark::State& aState)
+{
+    const Instant instant = InstantAt(0, Scale::UTC);
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(instant.getDateTime(Scale::UT1));
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Time_Instant_GetDateTime_UT1_Repeated);
+
+// Reference: Modified Julian Date through date-time decomposition
+
+static void OpenSpaceToolkit_Physics_Time_Instant_GetDateTime_ModifiedJulianDate(benchmark::State& aState)
+{
+    Size index = 0;
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(InstantAt(index++, Scale::UTC).getDateTime(Scale::TT).getModifiedJulianDate());
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Time_Instant_GetDateTime_ModifiedJulianDate);
+
+// Modified Julian Date from count arithmetic
+
+static void OpenSpaceToolkit_Physics_Time_Instant_GetModifiedJulianDateParts(benchmark::State& aState)
+{
+    Size index = 0;
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(InstantAt(index++, Scale::UTC).getModifiedJulianDateParts(Scale::TT));
+    }
+}
+
+BENCHMARK(OpenSpaceToolkit_Physics_Time_Instant_GetModifiedJulianDateParts);
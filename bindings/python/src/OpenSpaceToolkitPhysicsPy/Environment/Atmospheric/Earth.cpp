@@ -7,6 +7,7 @@
 
 #include <OpenSpaceToolkitPhysicsPy/Environment/Atmospheric/Earth/CSSISpaceWeather.cpp>
 #include <OpenSpaceToolkitPhysicsPy/Environment/Atmospheric/Earth/Exponential.cpp>
+#include <OpenSpaceToolkitPhysicsPy/Environment/Atmospheric/Earth/HarrisPriester.cpp>
 #include <OpenSpaceToolkitPhysicsPy/Environment/Atmospheric/Earth/Manager.cpp>
 #include <OpenSpaceToolkitPhysicsPy/Environment/Atmospheric/Earth/NRLMSISE00.cpp>
 
@@ -14,6 +15,7 @@ inline void OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth(pybind11::mo
 {
     using namespace pybind11;
 
+    using ostk::core::container::Array;
     using ostk::core::type::Shared;
     using ostk::core::type::Real;
 
@@ -59,6 +61,13 @@ inline void OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth(pybind11::mo
                 R"doc(
                     Navy Research Lab Mass Spectrometer and Incoherent Scatter Radar Exosphere 2000.
                 )doc"
+            )
+            .value(
+                "HarrisPriester",
+                Earth::Type::HarrisPriester,
+                R"doc(
+                    Harris-Priester atmospheric density model with diurnal bulge, valid from 100 to 1000 km.
+                )doc"
             );
 
         enum_<Earth::InputDataType>(earth_class, "InputDataType")
@@ -193,6 +202,44 @@ inline void OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth(pybind11::mo
                 )doc"
             )
 
+            .def(
+                "get_densities_at",
+                pybind11::overload_cast<const Array<Position>&, const Instant&>(
+                    &Earth::getDensitiesAt, pybind11::const_
+                ),
+                arg("positions"),
+                arg("instant"),
+                R"doc(
+                    Get the atmospheric density values at given positions and a single instant.
+
+                    Args:
+                        positions (list[Position]): Positions.
+                        instant (Instant): An instant.
+
+                    Returns:
+                        list[float]: Atmospheric density values [kg.m^-3].
+                )doc"
+            )
+
+            .def(
+                "get_densities_at",
+                pybind11::overload_cast<const Array<Position>&, const Array<Instant>&>(
+                    &Earth::getDensitiesAt, pybind11::const_
+                ),
+                arg("positions"),
+                arg("instants"),
+                R"doc(
+                    Get the atmospheric density values along a time series of positions.
+
+                    Args:
+                        positions (list[Position]): Positions.
+                        instants (list[Instant]): Instants, one per position.
+
+                    Returns:
+                        list[float]: Atmospheric density values [kg.m^-3].
+                )doc"
+            )
+
             ;
     }
 
@@ -202,5 +249,6 @@ inline void OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth(pybind11::mo
     OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth_CSSISpaceWeather(earth);
     OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth_Manager(earth);
     OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth_Exponential(earth);
+    OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth_HarrisPriester(earth);
     OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth_NRLMSISE00(earth);
 }
@@ -155,6 +155,30 @@ inline void OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth_CSSISpaceWea
                     Reading: Last Reading satisfying predicate.
             )doc"
         )
+        .def(
+            "access_nrlmsise00_ap_interval",
+            &CSSISpaceWeather::accessNRLMSISE00ApInterval,
+            R"doc(
+                Access the interval over which NRLMSISE00 Ap values are precomputed.
+
+                Returns:
+                    Interval: NRLMSISE00 Ap values interval, undefined if the file has missing days.
+            )doc"
+        )
+        .def(
+            "get_nrlmsise00_ap_values_at",
+            &CSSISpaceWeather::getNRLMSISE00ApValuesAt,
+            arg("instant"),
+            R"doc(
+                Get the 7 NRLMSISE00 Ap values at instant, read from the precomputed 3-hourly Ap series.
+
+                Args:
+                    instant (Instant): An instant.
+
+                Returns:
+                    list[float]: Daily Ap, 3-hour Ap at instant, 3, 6 and 9 hours before instant, and averages of 3-hour Ap from 12 to 33 hours and from 36 to 57 hours before instant.
+            )doc"
+        )
 
         .def_static(
             "undefined",
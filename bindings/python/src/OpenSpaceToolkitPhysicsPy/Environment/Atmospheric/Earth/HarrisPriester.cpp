@@ -0,0 +1,104 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/HarrisPriester.hpp>
+
+inline void OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth_HarrisPriester(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Real;
+    using ostk::core::type::Shared;
+
+    using ostk::physics::time::Instant;
+    using ostk::physics::coordinate::Frame;
+    using ostk::physics::coordinate::spherical::LLA;
+    using ostk::physics::environment::object::Celestial;
+    using ostk::physics::environment::atmospheric::earth::HarrisPriester;
+
+    class_<HarrisPriester, Shared<HarrisPriester>>(
+        aModule,
+        "HarrisPriester",
+        R"doc(
+            Harris-Priester atmospheric model.
+
+            Interpolates tabulated minimum and maximum densities (mean solar activity) according to the angle to the
+            apex of the diurnal bulge. Valid from 100 to 1000 km.
+
+        )doc"
+    )
+
+        .def(
+            init<const Real&, const Shared<const Frame>&, const Shared<Celestial>&>(),
+            arg("cosine_exponent") = HarrisPriester::DefaultCosineExponent,
+            arg("earth_frame") = Frame::ITRF(),
+            arg("sun_celestial") = nullptr,
+            R"doc(
+                Constructor.
+
+                Args:
+                    cosine_exponent (float): Exponent of the cosine of the half angle to the bulge apex, from 2 (low
+                        inclination orbits) to 6 (polar orbits). Defaults to 4.
+                    earth_frame (Frame): Earth frame. Defaults to ITRF.
+                    sun_celestial (Celestial): Sun celestial body. If not provided, a low precision analytical Sun
+                        position is used.
+            )doc"
+        )
+
+        .def(
+            "is_defined",
+            &HarrisPriester::isDefined,
+            R"doc(
+                Check if the Harris-Priester atmospheric model is defined.
+
+                Returns:
+                    bool: True if the Harris-Priester atmospheric model is defined.
+            )doc"
+        )
+
+        .def(
+            "get_cosine_exponent",
+            &HarrisPriester::getCosineExponent,
+            R"doc(
+                Get the cosine exponent.
+
+                Returns:
+                    float: Cosine exponent.
+            )doc"
+        )
+
+        .def(
+            "get_density_at",
+            &HarrisPriester::getDensityAt,
+            arg("lla"),
+            arg("instant"),
+            R"doc(
+                Get the atmospheric density value at a given position and instant.
+
+                Args:
+                    lla (LLA): A position, expressed as latitude, longitude, altitude [deg, deg, m].
+                    instant (Instant): An Instant.
+
+                Returns:
+                    float: Atmospheric density value [kg.m^-3].
+            )doc"
+        )
+
+        .def(
+            "get_densities_at",
+            &HarrisPriester::getDensitiesAt,
+            arg("llas"),
+            arg("instant"),
+            R"doc(
+                Get the atmospheric density values at given positions and a single instant.
+
+                Args:
+                    llas (list[LLA]): Positions, expressed as latitude, longitude, altitude [deg, deg, m].
+                    instant (Instant): An Instant.
+
+                Returns:
+                    list[float]: Atmospheric density values [kg.m^-3].
+            )doc"
+        )
+
+        ;
+}
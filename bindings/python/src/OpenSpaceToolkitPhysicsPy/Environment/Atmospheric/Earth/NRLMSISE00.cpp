@@ -8,8 +8,10 @@ inline void OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth_NRLMSISE00(p
 {
     using namespace pybind11;
 
+    using ostk::core::container::Array;
     using ostk::core::type::Shared;
     using ostk::core::type::Real;
+    using ostk::core::type::Size;
 
     using ostk::physics::unit::Length;
     using ostk::physics::time::Instant;
@@ -120,5 +122,49 @@ inline void OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth_NRLMSISE00(p
             )doc"
         )
 
+        .def(
+            "get_densities_at",
+            overload_cast<const Array<LLA>&, const Instant&, const Size&>(&NRLMSISE00::getDensitiesAt, const_),
+            arg("llas"),
+            arg("instant"),
+            arg("thread_count") = 1,
+            R"doc(
+                Get the atmospheric density values at given positions and a single instant.
+
+                The space weather, time and Sun inputs are computed once and shared by all positions.
+
+                Args:
+                    llas (list[LLA]): Positions, expressed as latitude, longitude, altitude [deg, deg, m].
+                    instant (Instant): An instant.
+                    thread_count (int): A number of threads to prepare the inputs over. Defaults to 1.
+
+                Returns:
+                    list[float]: Atmospheric density values [kg.m^-3].
+            )doc"
+        )
+
+        .def(
+            "get_densities_at",
+            overload_cast<const Array<LLA>&, const Array<Instant>&, const Size&>(
+                &NRLMSISE00::getDensitiesAt, const_
+            ),
+            arg("llas"),
+            arg("instants"),
+            arg("thread_count") = 1,
+            R"doc(
+                Get the atmospheric density values along a time series of positions.
+
+                The space weather inputs are reused between consecutive instants within the same 3-hour UTC interval.
+
+                Args:
+                    llas (list[LLA]): Positions, expressed as latitude, longitude, altitude [deg, deg, m].
+                    instants (list[Instant]): Instants, one per position.
+                    thread_count (int): A number of threads to prepare the inputs over. Defaults to 1.
+
+                Returns:
+                    list[float]: Atmospheric density values [kg.m^-3].
+            )doc"
+        )
+
         ;
 }
@@ -9,9 +9,13 @@ inline void OpenSpaceToolkitPhysicsPy_Environment_Gravitational_Earth(pybind11::
     using namespace pybind11;
 
     using ostk::core::type::Integer;
+    using ostk::core::type::Real;
     using ostk::core::type::Shared;
     using ostk::core::filesystem::Directory;
 
+    using ostk::mathematics::object::Vector3d;
+
+    using ostk::physics::time::Instant;
     using ostk::physics::environment::gravitational::Model;
     using ostk::physics::environment::gravitational::Earth;
     using ostk::physics::environment::gravitational::earth::Manager;
@@ -73,6 +77,26 @@ inline void OpenSpaceToolkitPhysicsPy_Environment_Gravitational_Earth(pybind11::
                 )doc"
             )
 
+            .def(
+                init<const Earth::Type&, const Directory&, const Integer&, const Integer&, const Real&>(),
+                arg("type"),
+                arg("directory"),
+                arg("gravitational_model_degree"),
+                arg("gravitational_model_order"),
+                arg("truncation_tolerance"),
+                R"doc(
+                    Construct an Earth gravitational model, evaluated up to the lowest degree meeting a truncation
+                    tolerance at the position radius.
+
+                    Args:
+                        type (Earth.Type): Earth model type.
+                        directory (Directory): Directory containing the gravity model data files.
+                        gravitational_model_degree (int): Degree of the gravitational model.
+                        gravitational_model_order (int): Order of the gravitational model.
+                        truncation_tolerance (Real): RMS truncation error tolerance [m.s^-2].
+                )doc"
+            )
+
             .def(
                 init<const Earth::Type&, const Integer&, const Integer&>(),
                 arg("type"),
@@ -130,10 +154,20 @@ inline void OpenSpaceToolkitPhysicsPy_Environment_Gravitational_Earth(pybind11::
                         int: Earth model order.
                 )doc"
             )
+            .def(
+                "get_truncation_tolerance",
+                &Earth::getTruncationTolerance,
+                R"doc(
+                    Get the RMS truncation error tolerance.
+
+                    Returns:
+                        Real: RMS truncation error tolerance [m.s^-2], undefined if evaluations are not truncated.
+                )doc"
+            )
 
             .def(
                 "get_field_value_at",
-                &Earth::getFieldValueAt,
+                overload_cast<const Vector3d&, const Instant&>(&Earth::getFieldValueAt, const_),
                 arg("position"),
                 arg("instant"),
                 R"doc(
@@ -148,6 +182,30 @@ inline void OpenSpaceToolkitPhysicsPy_Environment_Gravitational_Earth(pybind11::
                 )doc"
             )
 
+            .def(
+                "get_field_value_at",
+                overload_cast<const Vector3d&, const Instant&, const Integer&, const Integer&>(
+                    &Earth::getFieldValueAt, const_
+                ),
+                arg("position"),
+                arg("instant"),
+                arg("degree"),
+                arg("order") = Integer::Undefined(),
+                R"doc(
+                    Get the gravitational field value at a given position and instant, truncated to a given degree
+                    and order.
+
+                    Args:
+                        position (Position): A position.
+                        instant (Instant): An instant.
+                        degree (int): A truncation degree.
+                        order (int): A truncation order. Defaults to the truncation degree.
+
+                    Returns:
+                        np.ndarray: Gravitational field value [m.s^-2].
+                )doc"
+            )
+
             .def_readonly_static(
                 "EGM2008",
                 &Earth::EGM2008,
@@ -88,6 +88,23 @@ inline void OpenSpaceToolkitPhysicsPy_Environment_Magnetic_Earth(pybind11::modul
             )doc"
         )
 
+        .def(
+            "get_field_values_at",
+            &Earth::getFieldValuesAt,
+            arg("positions"),
+            arg("instant"),
+            R"doc(
+                Get the magnetic field values at given positions and instant.
+
+                Args:
+                    positions (list[np.ndarray]): Positions, expressed in the magnetic object frame [m].
+                    instant (Instant): Instant.
+
+                Returns:
+                    list[np.ndarray]: Magnetic field values, expressed in the magnetic object frame [T].
+            )doc"
+        )
+
         ;
 
     enum_<Earth::Type>(earth_magnetic_class, "Type")
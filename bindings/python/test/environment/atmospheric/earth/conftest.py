@@ -14,6 +14,7 @@ from ostk.physics.environment.object.celestial import Sun
 from ostk.physics.environment.atmospheric.earth import Manager
 from ostk.physics.environment.atmospheric.earth import CSSISpaceWeather
 from ostk.physics.environment.atmospheric.earth import Exponential
+from ostk.physics.environment.atmospheric.earth import HarrisPriester
 from ostk.physics.environment.atmospheric.earth import NRLMSISE00
 from ostk.physics.environment.gravitational import Earth as EarthGravityModel
 
@@ -53,6 +54,11 @@ def exponential_model() -> Exponential:
     return Exponential()
 
 
+@pytest.fixture
+def harris_priester_model() -> HarrisPriester:
+    return HarrisPriester()
+
+
 @pytest.fixture
 def nrlmsise00_model() -> NRLMSISE00:
     return NRLMSISE00(
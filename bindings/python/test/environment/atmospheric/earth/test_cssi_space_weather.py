@@ -116,6 +116,20 @@ class TestCSSISpaceWeather:
                 Instant.date_time(datetime(2029, 1, 1, 0, 0, 0), Scale.UTC),
             )
 
+    def test_access_nrlmsise00_ap_interval_success(
+        self, cssi_space_weather: CSSISpaceWeather
+    ):
+        # Test file has missing days
+        assert cssi_space_weather.access_nrlmsise00_ap_interval().is_defined() is False
+
+    def test_get_nrlmsise00_ap_values_at_failure(
+        self, cssi_space_weather: CSSISpaceWeather
+    ):
+        with pytest.raises(RuntimeError):
+            cssi_space_weather.get_nrlmsise00_ap_values_at(
+                Instant.date_time(datetime(2023, 6, 19, 12, 0, 0), Scale.UTC)
+            )
+
     def test_undefined_success(self):
         assert CSSISpaceWeather.undefined() is not None
 
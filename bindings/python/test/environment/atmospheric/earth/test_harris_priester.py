@@ -0,0 +1,66 @@
+# Apache License 2.0
+
+import pytest
+
+from ostk.physics.time import Instant
+from ostk.physics.time import DateTime
+from ostk.physics.time import Scale
+from ostk.physics.unit import Length
+from ostk.physics.unit import Angle
+from ostk.physics.coordinate import Frame
+from ostk.physics.coordinate.spherical import LLA
+from ostk.physics.environment.object.celestial import Sun
+
+from ostk.physics.environment.atmospheric.earth import HarrisPriester
+
+
+class TestHarrisPriester:
+    def test_constructor_success(self, harris_priester_model):
+        assert isinstance(harris_priester_model, HarrisPriester)
+
+        assert isinstance(
+            HarrisPriester(
+                cosine_exponent=6.0,
+                earth_frame=Frame.ITRF(),
+                sun_celestial=Sun.default(),
+            ),
+            HarrisPriester,
+        )
+
+    def test_is_defined_success(self, harris_priester_model):
+        assert harris_priester_model.is_defined() is True
+
+    def test_get_cosine_exponent_success(self, harris_priester_model):
+        assert harris_priester_model.get_cosine_exponent() == 4.0
+
+    def test_get_density_at_success(self, harris_priester_model):
+        lla = LLA(Angle.degrees(0.0), Angle.degrees(0.0), Length.meters(500e3))
+
+        density = harris_priester_model.get_density_at(
+            lla, Instant.date_time(DateTime.parse("2021-01-01 00:00:00"), Scale.UTC)
+        )
+
+        # between the tabulated minimum and maximum densities at 500 km
+        assert 0.3916e-12 <= density <= 2.042e-12
+
+    def test_get_densities_at_success(self, harris_priester_model):
+        instant = Instant.date_time(DateTime.parse("2021-01-01 00:00:00"), Scale.UTC)
+
+        llas = [
+            LLA(Angle.degrees(0.0), Angle.degrees(longitude), Length.meters(500e3))
+            for longitude in (0.0, 90.0, 180.0)
+        ]
+
+        densities = harris_priester_model.get_densities_at(llas, instant)
+
+        assert densities == [
+            harris_priester_model.get_density_at(lla, instant) for lla in llas
+        ]
+
+    def test_get_density_at_failure(self, harris_priester_model):
+        lla = LLA(Angle.degrees(0.0), Angle.degrees(0.0), Length.meters(50e3))
+
+        with pytest.raises(RuntimeError):
+            harris_priester_model.get_density_at(
+                lla, Instant.date_time(DateTime.parse("2021-01-01 00:00:00"), Scale.UTC)
+            )
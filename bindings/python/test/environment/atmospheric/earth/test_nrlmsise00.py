@@ -32,3 +32,31 @@ class TestNRLMSISE00:
 
         # assert sensible number for density
         assert 1.0e-15 < density < 1.0e-12
+
+    def test_get_densities_at_success(self, nrlmsise00_model):
+        instant = Instant.date_time(DateTime.parse("2021-01-01 00:00:00"), Scale.UTC)
+        llas = [
+            LLA(Angle.degrees(0.0), Angle.degrees(0.0), Length.meters(500e3)),
+            LLA(Angle.degrees(45.0), Angle.degrees(90.0), Length.meters(400e3)),
+            LLA(Angle.degrees(-30.0), Angle.degrees(-120.0), Length.meters(300e3)),
+        ]
+
+        densities = nrlmsise00_model.get_densities_at(llas, instant)
+
+        assert len(densities) == len(llas)
+
+        for lla, density in zip(llas, densities):
+            assert density == nrlmsise00_model.get_density_at(lla, instant)
+
+        instants = [
+            instant,
+            Instant.date_time(DateTime.parse("2021-01-01 01:00:00"), Scale.UTC),
+            Instant.date_time(DateTime.parse("2021-01-01 04:00:00"), Scale.UTC),
+        ]
+
+        densities = nrlmsise00_model.get_densities_at(llas, instants)
+
+        assert len(densities) == len(llas)
+
+        for lla, instant, density in zip(llas, instants, densities):
+            assert density == nrlmsise00_model.get_density_at(lla, instant)
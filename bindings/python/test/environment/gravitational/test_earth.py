@@ -99,5 +99,39 @@ class TestEarth:
             ]
         )
 
+    def test_get_field_value_at_success_with_truncation(
+        self, earth_gravitational_model: EarthGravitationalModel
+    ):
+        position = np.array([7000e3, 0.0, 0.0])
+
+        grav_acceleration = earth_gravitational_model.get_field_value_at(
+            position, Instant.J2000(), 0
+        )
+
+        assert np.allclose(
+            grav_acceleration, np.array([-398600441500000.0 / 7000e3**2, 0.0, 0.0])
+        )
+
+        assert np.allclose(
+            earth_gravitational_model.get_field_value_at(
+                position, Instant.J2000(), 20, 20
+            ),
+            earth_gravitational_model.get_field_value_at(position, Instant.J2000(), 20),
+        )
+
+    def test_get_truncation_tolerance_success(self):
+        earth_gravitational_model = EarthGravitationalModel(
+            EarthGravitationalModel.Type.EGM2008, Directory.undefined(), 70, 70, 1e-9
+        )
+
+        assert earth_gravitational_model.get_truncation_tolerance() == 1e-9
+
+        assert (
+            EarthGravitationalModel(EarthGravitationalModel.Type.EGM2008)
+            .get_truncation_tolerance()
+            .is_defined()
+            is False
+        )
+
     def test_gravity_constant(self):
         assert EarthGravitationalModel.gravity_constant is not None
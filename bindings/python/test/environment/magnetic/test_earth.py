@@ -2,10 +2,14 @@
 
 import pytest
 
+from datetime import datetime
+
 import numpy as np
 
 from ostk.core.filesystem import Directory
 
+from ostk.physics.time import Instant
+from ostk.physics.time import Scale
 from ostk.physics.environment.magnetic import Earth as EarthMagneticModel
 from ostk.physics.environment.object.celestial import Earth
 
@@ -36,3 +40,26 @@ class TestEarth:
 
     def test_is_defined_success(self, earth_magnetic_model: EarthMagneticModel):
         assert earth_magnetic_model.is_defined() == True
+
+    def test_get_field_values_at_success(
+        self,
+        earth_magnetic_model: EarthMagneticModel,
+    ):
+        instant = Instant.date_time(datetime(2015, 1, 1, 0, 0, 0), Scale.UTC)
+        positions = [
+            np.array([7000e3, 0.0, 0.0]),
+            np.array([0.0, 7000e3, 0.0]),
+            np.array([0.0, 0.0, 7000e3]),
+        ]
+
+        field_values = earth_magnetic_model.get_field_values_at(positions, instant)
+
+        assert len(field_values) == len(positions)
+
+        for position, field_value in zip(positions, field_values):
+            assert np.allclose(
+                field_value,
+                earth_magnetic_model.get_field_value_at(position, instant),
+                rtol=0.0,
+                atol=1e-18,
+            )
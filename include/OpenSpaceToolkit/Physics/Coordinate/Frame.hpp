@@ -5,9 +5,11 @@
 
 #include <memory>
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
@@ -29,9 +31,11 @@ namespace coordinate
 namespace iau = ostk::physics::coordinate::frame::provider::iau;
 
 using ostk::core::type::Uint8;
+using ostk::core::type::Size;
 using ostk::core::type::Shared;
 using ostk::core::type::Real;
 using ostk::core::type::String;
+using ostk::core::container::Array;
 
 using ostk::mathematics::object::Vector3d;
 
@@ -74,6 +78,15 @@ class Frame : public std::enable_shared_from_this<Frame>
 
     String getName() const;
 
+    /// @brief              Get frame identifier
+    ///
+    ///                     Identifiers are unique over the lifetime of the process, and never reused once a frame is
+    ///                     destructed: unlike addresses, they can key memoized data without outliving the frame.
+    ///
+    /// @return             Frame identifier
+
+    Size getId() const;
+
     Position getOriginIn(const Shared<const Frame>& aFrame, const Instant& anInstant) const;
 
     Velocity getVelocityIn(const Shared<const Frame>& aFrame, const Instant& anInstant) const;
@@ -82,6 +95,20 @@ class Frame : public std::enable_shared_from_this<Frame>
 
     Transform getTransformTo(const Shared<const Frame>& aFrame, const Instant& anInstant) const;
 
+    /// @brief              Get transforms to another frame at multiple instants
+    ///
+    ///                     The provider chain is resolved once, then each provider is evaluated over all instants.
+    ///                     Transforms computed in batch bypass the transform cache.
+    ///
+    /// @param              [in] aFrame A shared pointer to the destination frame
+    /// @param              [in] anInstantArray An array of instants
+    /// @param              [in] aThreadCount (optional) A number of threads to split the instants over
+    /// @return             Array of transforms, one per instant
+
+    Array<Transform> getTransformsTo(
+        const Shared<const Frame>& aFrame, const Array<Instant>& anInstantArray, const Size& aThreadCount = 1
+    ) const;
+
     static Shared<const Frame> Undefined();
 
     static Shared<const Frame> GCRF();
@@ -135,6 +162,7 @@ class Frame : public std::enable_shared_from_this<Frame>
     Frame& operator=(const Frame& aFrame) = default;
 
    private:
+    Size id_;
     String name_;
     bool quasiInertial_;
     Shared<const Frame> parentFrameSPtr_;
@@ -148,10 +176,6 @@ class Frame : public std::enable_shared_from_this<Frame>
         const Shared<const Frame>& aParentFrame,
         const Shared<const Provider>& aProvider
     );
-
-    static Shared<const Frame> FindCommonAncestor(
-        const Shared<const Frame>& aFirstFrameSPtr, const Shared<const Frame>& aSecondFrameSPtr
-    );
 };
 
 }  // namespace coordinate
@@ -3,16 +3,26 @@
 #ifndef __OpenSpaceToolkit_Physics_Coordinate_Frame_Manager__
 #define __OpenSpaceToolkit_Physics_Coordinate_Frame_Manager__
 
+#include <array>
+#include <atomic>
+#include <memory>
 #include <mutex>
+#include <shared_mutex>
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Map.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
+#define OSTK_PHYSICS_COORDINATE_FRAME_MANAGER_TRANSFORM_CACHE_CAPACITY 100000
+#define OSTK_PHYSICS_COORDINATE_FRAME_MANAGER_TRANSFORM_CACHE_BYTE_BUDGET 67108864
+
 namespace ostk
 {
 namespace physics
@@ -22,19 +32,59 @@ namespace coordinate
 namespace frame
 {
 
+using ostk::core::type::Index;
+using ostk::core::type::Size;
 using ostk::core::type::Shared;
 using ostk::core::type::String;
+using ostk::core::container::Array;
 using ostk::core::container::Map;
 
 using ostk::physics::time::Instant;
 using ostk::physics::coordinate::Frame;
 using ostk::physics::coordinate::Transform;
+using ostk::physics::coordinate::frame::Provider;
 
 /// @brief                      Reference frame manager (thread-safe)
+///
+///                             The frame registry is published as an immutable snapshot, swapped atomically on
+///                             insertion and removal, so that frame lookups never take a lock.
+///
+///                             Transforms computed between frames are cached in a size-bounded cache, evicted using
+///                             the CLOCK (second chance) policy once the capacity is reached. The cache is split into
+///                             shards, selected by frame pair and instant, each guarded by a reader-writer lock:
+///                             concurrent lookups only contend with insertions into the same shard.
+///
+///                             The chain of providers linking two frames is resolved once per frame pair and memoized,
+///                             so that a cache miss only costs the provider evaluations.
+///
+///                             Cached transforms and provider chains are keyed by frame identifier, which is never
+///                             reused: destructing a frame does not touch the manager. Cached transforms of destructed
+///                             frames are never looked up again, and are evicted first. Provider chains of destructed
+///                             frames are pruned when memoizing another chain.
+///
+///                             The following environment variables can be defined:
+///
+///                             - "OSTK_PHYSICS_COORDINATE_FRAME_MANAGER_TRANSFORM_CACHE_CAPACITY" will override
+///                             "DefaultTransformCacheCapacity"
+///                             - "OSTK_PHYSICS_COORDINATE_FRAME_MANAGER_TRANSFORM_CACHE_BYTE_BUDGET" will override
+///                             "DefaultTransformCacheByteBudget"
 
 class Manager
 {
    public:
+    /// @brief              Providers linking an origin frame to a destination frame, through their common ancestor
+    ///
+    ///                     Chains are memoized by frame identifier: the origin and destination frames are held
+    ///                     weakly, so that chains outliving their frames can be pruned.
+
+    struct ProviderChain
+    {
+        std::weak_ptr<const Frame> originFrameWPtr;       ///< Origin frame
+        std::weak_ptr<const Frame> destinationFrameWPtr;  ///< Destination frame
+        Array<Shared<const Provider>> originProviders;       ///< From origin frame to common ancestor (excluded)
+        Array<Shared<const Provider>> destinationProviders;  ///< From destination frame to common ancestor (excluded)
+    };
+
     Manager(const Manager& aManager) = delete;
 
     Manager& operator=(const Manager& aManager) = delete;
@@ -43,14 +93,85 @@ class Manager
 
     Shared<const Frame> accessFrameWithName(const String& aFrameName) const;
 
-    const Transform* accessCachedTransform(
+    /// @brief              Access memoized provider chain
+    ///
+    /// @param              [in] aFromFrameSPtr A shared pointer to the origin frame
+    /// @param              [in] aToFrameSPtr A shared pointer to the destination frame
+    /// @return             Shared pointer to provider chain, nullptr if not memoized
+
+    Shared<const ProviderChain> accessProviderChain(
+        const Shared<const Frame>& aFromFrameSPtr, const Shared<const Frame>& aToFrameSPtr
+    ) const;
+
+    /// @brief              Get cached transform
+    ///
+    /// @param              [in] aFromFrameSPtr A shared pointer to the origin frame
+    /// @param              [in] aToFrameSPtr A shared pointer to the destination frame
+    /// @param              [in] anInstant An instant
+    /// @return             Cached transform, undefined if not cached
+
+    Transform getCachedTransform(
         const Shared<const Frame>& aFromFrameSPtr, const Shared<const Frame>& aToFrameSPtr, const Instant& anInstant
     ) const;
 
+    /// @brief              Returns true if transform cache is enabled
+    ///
+    /// @return             True if transform cache is enabled
+
+    bool isTransformCacheEnabled() const;
+
+    /// @brief              Get transform cache capacity
+    ///
+    /// @return             Maximum number of cached transforms
+
+    Size getTransformCacheCapacity() const;
+
+    /// @brief              Get transform cache byte budget
+    ///
+    /// @return             [B] Maximum memory footprint of cached transforms
+
+    Size getTransformCacheByteBudget() const;
+
+    /// @brief              Get transform cache size
+    ///
+    /// @return             Number of cached transforms
+
+    Size getTransformCacheSize() const;
+
+    /// @brief              Get transform cache hit count
+    ///
+    /// @return             Number of cache lookups that returned a transform
+
+    Size getTransformCacheHitCount() const;
+
+    /// @brief              Get transform cache miss count
+    ///
+    /// @return             Number of cache lookups that did not return a transform
+
+    Size getTransformCacheMissCount() const;
+
+    /// @brief              Get transform cache eviction count
+    ///
+    /// @return             Number of cached transforms evicted to make room for new ones
+
+    Size getTransformCacheEvictionCount() const;
+
     void addFrame(const Shared<const Frame>& aFrameSPtr);
 
     void removeFrameWithName(const String& aFrameName);
 
+    /// @brief              Memoize provider chain
+    ///
+    /// @param              [in] aFromFrameSPtr A shared pointer to the origin frame
+    /// @param              [in] aToFrameSPtr A shared pointer to the destination frame
+    /// @param              [in] aProviderChainSPtr A shared pointer to the provider chain
+
+    void addProviderChain(
+        const Shared<const Frame>& aFromFrameSPtr,
+        const Shared<const Frame>& aToFrameSPtr,
+        const Shared<const ProviderChain>& aProviderChainSPtr
+    );
+
     void addCachedTransform(
         const Shared<const Frame>& aFromFrameSPtr,
         const Shared<const Frame>& aToFrameSPtr,
@@ -58,16 +179,127 @@ class Manager
         const Transform& aTransform
     );
 
+    /// @brief              Enable or disable transform cache
+    ///
+    ///                     Disabling the cache flushes it.
+    ///
+    /// @param              [in] isEnabled True to enable transform cache
+
+    void setTransformCacheEnabled(const bool isEnabled);
+
+    /// @brief              Set transform cache capacity
+    ///
+    ///                     Shrinking the capacity evicts cached transforms (CLOCK) down to the new capacity. Changing
+    ///                     the number of shards, which happens for capacities below the shard count, flushes the cache.
+    ///
+    /// @param              [in] aCapacity A maximum number of cached transforms
+
+    void setTransformCacheCapacity(const Size& aCapacity);
+
+    /// @brief              Set transform cache byte budget
+    ///
+    ///                     Shrinking the budget evicts cached transforms (CLOCK) down to the new capacity. Changing
+    ///                     the number of shards, which happens for capacities below the shard count, flushes the cache.
+    ///
+    /// @param              [in] aByteBudget [B] A maximum memory footprint of cached transforms
+
+    void setTransformCacheByteBudget(const Size& aByteBudget);
+
+    /// @brief              Clear transform cache
+    ///
+    ///                     Remove all cached transforms and reset hit, miss and eviction counters.
+
+    void clearTransformCache();
+
     static Manager& Get();
 
+    /// @brief              Get default transform cache capacity
+    ///
+    ///                     Overriden by: OSTK_PHYSICS_COORDINATE_FRAME_MANAGER_TRANSFORM_CACHE_CAPACITY
+    ///
+    /// @return             Default transform cache capacity
+
+    static Size DefaultTransformCacheCapacity();
+
+    /// @brief              Get default transform cache byte budget
+    ///
+    ///                     Overriden by: OSTK_PHYSICS_COORDINATE_FRAME_MANAGER_TRANSFORM_CACHE_BYTE_BUDGET
+    ///
+    /// @return             [B] Default transform cache byte budget
+
+    static Size DefaultTransformCacheByteBudget();
+
+    /// @brief              Get estimated memory footprint of a single cached transform
+    ///
+    /// @return             [B] Memory footprint of a cached transform, including its index
+
+    static Size TransformCacheEntryByteSize();
+
    private:
-    Map<String, Shared<const Frame>> frameMap_;
+    static constexpr Size TransformCacheShardCount = 64;
+
+    struct CachedTransform
+    {
+        Size fromFrameId;
+        Size toFrameId;
+        Instant instant;
+        Transform transform;
+        mutable std::atomic<bool> referenced;
+
+        CachedTransform(
+            const Size& aFromFrameId, const Size& aToFrameId, const Instant& anInstant, const Transform& aTransform
+        );
 
-    Map<const Frame*, Map<const Frame*, Map<Instant, Transform>>> transformCache_;
+        CachedTransform(const CachedTransform& aCachedTransform);
+
+        CachedTransform& operator=(const CachedTransform& aCachedTransform);
+    };
+
+    struct TransformCacheShard
+    {
+        Map<Size, Map<Size, Map<Instant, Index>>> index;
+        Array<CachedTransform> entries;
+        Index hand = 0;
+        Size capacity = 0;
+
+        mutable std::atomic<Size> hitCount {0};
+        mutable std::atomic<Size> missCount {0};
+        std::atomic<Size> evictionCount {0};
+
+        mutable std::shared_mutex mutex;
+
+        Size getSize() const;
+        Index evict();
+        void shrink();
+        void clear();
+    };
+
+    std::atomic<Shared<const Map<String, Shared<const Frame>>>> frameMapSPtr_;
+    std::atomic<Shared<const Map<Size, Map<Size, Shared<const ProviderChain>>>>> providerChainMapSPtr_;
+
+    std::array<TransformCacheShard, TransformCacheShardCount> transformCacheShards_;
+
+    std::atomic<bool> transformCacheEnabled_;
+    std::atomic<Size> transformCacheActiveShardCount_;
+    Size transformCacheCapacity_;
+    Size transformCacheByteBudget_;
 
     mutable std::mutex mutex_;
 
-    Manager() = default;
+    Manager();
+
+    ~Manager();
+
+    // none of these are mutex-protected, but are called exclusively by methods that are
+    void resizeTransformCache_(const bool isFlushRequired);
+
+    const TransformCacheShard& accessTransformCacheShard_(
+        const Size& aFromFrameId, const Size& aToFrameId, const Instant& anInstant
+    ) const;
+
+    TransformCacheShard& accessTransformCacheShard_(
+        const Size& aFromFrameId, const Size& aToFrameId, const Instant& anInstant
+    );
 };
 
 }  // namespace frame
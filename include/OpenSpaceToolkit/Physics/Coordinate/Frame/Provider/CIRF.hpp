@@ -3,7 +3,10 @@
 #ifndef __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_CIRF__
 #define __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_CIRF__
 
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/EarthOrientationTable.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
@@ -18,9 +21,12 @@ namespace frame
 namespace provider
 {
 
+using ostk::core::type::Shared;
+
 using ostk::physics::time::Instant;
 using ostk::physics::coordinate::frame::Provider;
 using ostk::physics::coordinate::Transform;
+using ostk::physics::coordinate::frame::provider::EarthOrientationTable;
 
 /// @brief                      Celestial Intermediate Reference Frame (CIRF) provider
 ///
@@ -34,6 +40,15 @@ class CIRF : public Provider
    public:
     CIRF();
 
+    /// @brief              Constructor
+    ///
+    ///                     Interpolate CIP coordinates and CIO locator from an Earth orientation table, falling back to the
+    ///                     exact model outside of the table interval.
+    ///
+    /// @param              [in] anEarthOrientationTableSPtr A shared pointer to an Earth orientation table
+
+    CIRF(const Shared<const EarthOrientationTable>& anEarthOrientationTableSPtr);
+
     virtual ~CIRF() override;
 
     virtual CIRF* clone() const override;
@@ -41,6 +56,9 @@ class CIRF : public Provider
     virtual bool isDefined() const override;
 
     virtual Transform getTransformAt(const Instant& anInstant) const override;
+
+   private:
+    Shared<const EarthOrientationTable> earthOrientationTableSPtr_;
 };
 
 }  // namespace provider
@@ -0,0 +1,184 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_EarthOrientationTable__
+#define __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_EarthOrientationTable__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace coordinate
+{
+namespace frame
+{
+namespace provider
+{
+
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+using ostk::core::container::Array;
+
+using ostk::mathematics::object::Vector2d;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::time::Instant;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Interval;
+
+/// @brief                      Interpolated Earth orientation table
+///
+///                             Precomputes the CIP coordinates X, Y and the CIO locator s (IAU 2006/2000A), as well as
+///                             the polar motion (IERS), on a regular grid over an interval. Values are then
+///                             interpolated piecewise, each segment of the grid holding its own polynomial:
+///
+///                             - Hermite: cubic polynomial matching values and rates at both ends of the segment.
+///                             Error is bounded by h^4 max|f''''| / 384, about 10 µas on X and Y for a 1 day step.
+///                             - Chebyshev: degree 7 polynomial fitted on Chebyshev nodes of the segment.
+///                             Error is well below 1 µas on X and Y for a 1 day step.
+///
+///                             The interpolation error is also estimated at construction, by comparing against the
+///                             exact model at each segment midpoint.
+///
+///                             Evaluating the table costs a few dozen floating point operations, instead of the ~1300
+///                             terms of the IAU 2006/2000A nutation series.
+///
+/// @ref                        https://www.iers.org/IERS/EN/Publications/TechnicalNotes/tn36.html (5.5.4)
+
+class EarthOrientationTable
+{
+   public:
+    enum class Interpolation
+    {
+
+        Hermite,   ///< Cubic Hermite interpolation
+        Chebyshev  ///< Chebyshev polynomial interpolation
+
+    };
+
+    /// @brief              Constructor
+    ///
+    /// @code
+    ///                     EarthOrientationTable table = {
+    ///                         Interval::Closed(Instant::J2000(), Instant::J2000() + Duration::Days(30.0)),
+    ///                         Duration::Days(1.0),
+    ///                         EarthOrientationTable::Interpolation::Chebyshev
+    ///                     } ;
+    /// @endcode
+    ///
+    /// @param              [in] anInterval An interval to be covered by the table
+    /// @param              [in] aStep A grid step
+    /// @param              [in] anInterpolation An interpolation type
+
+    EarthOrientationTable(
+        const Interval& anInterval,
+        const Duration& aStep,
+        const EarthOrientationTable::Interpolation& anInterpolation = EarthOrientationTable::Interpolation::Chebyshev
+    );
+
+    /// @brief              Check if table is defined
+    ///
+    /// @return             True if table is defined
+
+    bool isDefined() const;
+
+    /// @brief              Check if table covers a given instant
+    ///
+    /// @param              [in] anInstant An instant
+    /// @return             True if table covers instant
+
+    bool covers(const Instant& anInstant) const;
+
+    /// @brief              Access interval
+    ///
+    /// @return             Reference to interval
+
+    const Interval& accessInterval() const;
+
+    /// @brief              Get grid step
+    ///
+    /// @return             Grid step
+
+    Duration getStep() const;
+
+    /// @brief              Get interpolation type
+    ///
+    /// @return             Interpolation type
+
+    EarthOrientationTable::Interpolation getInterpolation() const;
+
+    /// @brief              Get estimated interpolation error on CIP coordinates and CIO locator
+    ///
+    /// @return             [rad] Maximum interpolation error, sampled at segment midpoints
+
+    Real getCipAccuracy() const;
+
+    /// @brief              Get estimated interpolation error on polar motion
+    ///
+    /// @return             [asec] Maximum interpolation error, sampled at segment midpoints
+
+    Real getPolarMotionAccuracy() const;
+
+    /// @brief              Get CIP coordinates and CIO locator at instant
+    ///
+    /// @param              [in] anInstant An instant
+    /// @return             [rad] CIP coordinates X, Y and CIO locator s
+
+    Vector3d getCipCoordinatesAt(const Instant& anInstant) const;
+
+    /// @brief              Get polar motion at instant
+    ///
+    /// @param              [in] anInstant An instant
+    /// @return             [asec] Polar motion
+
+    Vector2d getPolarMotionAt(const Instant& anInstant) const;
+
+    /// @brief              Constructs an undefined table
+    ///
+    /// @return             Undefined table
+
+    static EarthOrientationTable Undefined();
+
+    /// @brief              Get string from interpolation type
+    ///
+    /// @param              [in] anInterpolation An interpolation type
+    /// @return             String
+
+    static String StringFromInterpolation(const EarthOrientationTable::Interpolation& anInterpolation);
+
+   private:
+    static constexpr Size ChannelCount = 5;  // X, Y, s, xp, yp
+
+    Interval interval_;
+    Duration step_;
+    EarthOrientationTable::Interpolation interpolation_;
+
+    double stepSeconds_;
+    Size segmentCount_;
+    Size coefficientCount_;
+    Array<double> coefficients_;  // [segment][channel][coefficient]
+
+    Real cipAccuracy_;
+    Real polarMotionAccuracy_;
+
+    void evaluateAt_(const Instant& anInstant, double (&aChannelArray)[ChannelCount]) const;
+};
+
+}  // namespace provider
+}  // namespace frame
+}  // namespace coordinate
+}  // namespace physics
+}  // namespace ostk
+
+#endif
@@ -8,6 +8,7 @@
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/EOPTable.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Date.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
@@ -142,6 +143,20 @@ class BulletinA
 
     const Interval& accessPredictionInterval() const;
 
+    /// @brief                  Access observation EOP table
+    ///
+    ///                         Covers the observation Interval, the last day being linearly extrapolated.
+    ///
+    /// @return                 Observation EOP table
+
+    const EOPTable& accessObservationTable() const;
+
+    /// @brief                  Access prediction EOP table
+    ///
+    /// @return                 Prediction EOP table
+
+    const EOPTable& accessPredictionTable() const;
+
     /// @brief                  Get release Date of Bulletin A
     ///
     /// @return                 Release Date of Bulletin A
@@ -208,9 +223,11 @@ class BulletinA
 
     Interval observationInterval_;
     Map<Integer, BulletinA::Observation> observations_;
+    EOPTable observationTable_;
 
     Interval predictionInterval_;
     Map<Integer, BulletinA::Prediction> predictions_;
+    EOPTable predictionTable_;
 
     BulletinA();
 };
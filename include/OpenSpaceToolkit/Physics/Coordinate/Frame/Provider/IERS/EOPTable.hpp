@@ -0,0 +1,193 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_EOPTable__
+#define __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_EOPTable__
+
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace coordinate
+{
+namespace frame
+{
+namespace provider
+{
+namespace iers
+{
+
+using ostk::core::type::Integer;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+using ostk::core::container::Array;
+
+using ostk::mathematics::object::Vector2d;
+
+using ostk::physics::time::Instant;
+
+/// @brief                      Earth Orientation Parameters (EOP) table
+///
+///                             Daily EOP values stored contiguously, one array per parameter, indexed by MJD (UTC):
+///                             locating the samples around an instant is a subtraction, instead of a tree lookup.
+///                             Each parameter is interpolated on its own, undefined values propagating to the result.
+///
+///                             Lagrange interpolation uses four consecutive samples, as in the IERS Gazette #13 INTERP
+///                             routine. UT1 - UTC samples are made continuous across leap seconds before being
+///                             interpolated. Daily samples do not resolve the diurnal and semidiurnal ocean tidal
+///                             effects on polar motion, which can be added back as in the PMUT1_OCEANS routine.
+///
+/// @ref                        https://hpiers.obspm.fr/iers/models/interp.f
+
+class EOPTable
+{
+   public:
+    enum class Interpolation
+    {
+
+        Linear,   ///< Linear interpolation between the two surrounding samples
+        Lagrange  ///< Cubic Lagrange interpolation over the four surrounding samples
+
+    };
+
+    /// @brief              Constructor
+    ///
+    ///                     Arrays hold one value per day, starting at the first MJD. Parameters that are not
+    ///                     available can be given as empty arrays.
+    ///
+    /// @param              [in] aFirstMjd A first MJD (UTC)
+    /// @param              [in] aPolarMotionXArray [asec] An array of PM-x
+    /// @param              [in] aPolarMotionYArray [asec] An array of PM-y
+    /// @param              [in] aUt1MinusUtcArray [s] An array of UT1 - UTC
+    /// @param              [in] aLodArray [ms] An array of length of day
+
+    EOPTable(
+        const Integer& aFirstMjd,
+        const Array<Real>& aPolarMotionXArray,
+        const Array<Real>& aPolarMotionYArray,
+        const Array<Real>& aUt1MinusUtcArray,
+        const Array<Real>& aLodArray
+    );
+
+    /// @brief              Check if table is defined
+    ///
+    /// @return             True if table is defined
+
+    bool isDefined() const;
+
+    /// @brief              Get first MJD
+    ///
+    /// @return             First MJD (UTC)
+
+    Integer getFirstMjd() const;
+
+    /// @brief              Get last MJD
+    ///
+    /// @return             Last MJD (UTC)
+
+    Integer getLastMjd() const;
+
+    /// @brief              Get number of days in table
+    ///
+    /// @return             Number of days
+
+    Size getSize() const;
+
+    /// @brief              Check if table covers a given instant
+    ///
+    /// @param              [in] anInstant An instant
+    /// @return             True if table covers instant
+
+    bool covers(const Instant& anInstant) const;
+
+    /// @brief              Get polar motion at instant
+    ///
+    /// @param              [in] anInstant An instant
+    /// @param              [in] anInterpolation An interpolation type
+    /// @return             [asec] Polar motion, undefined if not available
+
+    Vector2d getPolarMotionAt(
+        const Instant& anInstant, const EOPTable::Interpolation& anInterpolation = EOPTable::Interpolation::Linear
+    ) const;
+
+    /// @brief              Get UT1 - UTC at instant
+    ///
+    /// @param              [in] anInstant An instant
+    /// @param              [in] anInterpolation An interpolation type
+    /// @return             [s] UT1 - UTC, undefined if not available
+
+    Real getUt1MinusUtcAt(
+        const Instant& anInstant, const EOPTable::Interpolation& anInterpolation = EOPTable::Interpolation::Linear
+    ) const;
+
+    /// @brief              Get length of day at instant
+    ///
+    /// @param              [in] anInstant An instant
+    /// @param              [in] anInterpolation An interpolation type
+    /// @return             [ms] Length of day, undefined if not available
+
+    Real getLodAt(
+        const Instant& anInstant, const EOPTable::Interpolation& anInterpolation = EOPTable::Interpolation::Linear
+    ) const;
+
+    /// @brief              Get diurnal and semidiurnal ocean tidal correction to polar motion at instant
+    ///
+    ///                     Sum of the 71 tidal terms of the IERS Gazette #13 PMUT1_OCEANS routine, to be added to
+    ///                     interpolated polar motion.
+    ///
+    /// @param              [in] anInstant An instant
+    /// @return             [asec] Polar motion correction
+
+    static Vector2d OceanTidalPolarMotionCorrectionAt(const Instant& anInstant);
+
+    /// @brief              Constructs an undefined table
+    ///
+    /// @return             Undefined table
+
+    static EOPTable Undefined();
+
+    /// @brief              Get string from interpolation type
+    ///
+    /// @param              [in] anInterpolation An interpolation type
+    /// @return             String
+
+    static String StringFromInterpolation(const EOPTable::Interpolation& anInterpolation);
+
+   private:
+    Integer firstMjd_;
+
+    std::vector<double> polarMotionX_;
+    std::vector<double> polarMotionY_;
+    std::vector<double> ut1MinusUtc_;
+    std::vector<double> lod_;
+
+    double getElapsedDays_(const Instant& anInstant) const;
+
+    static double Interpolate(
+        const std::vector<double>& aValueArray,
+        const double& anElapsedDays,
+        const EOPTable::Interpolation& anInterpolation,
+        const bool isLeapSecondAware
+    );
+};
+
+}  // namespace iers
+}  // namespace provider
+}  // namespace frame
+}  // namespace coordinate
+}  // namespace physics
+}  // namespace ostk
+
+#endif
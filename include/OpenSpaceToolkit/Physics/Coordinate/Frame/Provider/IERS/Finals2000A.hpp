@@ -11,6 +11,7 @@
 
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/EOPTable.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Date.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
@@ -111,6 +112,12 @@ class Finals2000A
 
     Interval getInterval() const;
 
+    /// @brief                  Access EOP table
+    ///
+    /// @return                 EOP table
+
+    const EOPTable& accessTable() const;
+
     /// @brief                  Get polar motion at Instant
     ///
     /// @param                  [in] anInstant An Instant
@@ -156,6 +163,7 @@ class Finals2000A
     Instant lastModifiedTimestamp_;
     Interval span_;
     Map<Real, Finals2000A::Data> data_;
+    EOPTable table_;
 
     Finals2000A();
 
@@ -3,16 +3,21 @@
 #ifndef __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager__
 #define __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager__
 
+#include <atomic>
+#include <memory>
 #include <mutex>
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/Directory.hpp>
 #include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/BulletinA.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/EOPTable.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/Finals2000A.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
@@ -37,6 +42,8 @@ namespace iers
 
 using ostk::core::type::Index;
 using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::container::Array;
 using ostk::core::filesystem::Directory;
 
@@ -46,13 +53,22 @@ using ostk::physics::time::Instant;
 using ostk::physics::time::Duration;
 using ostk::physics::coordinate::frame::provider::iers::BulletinA;
 using ostk::physics::coordinate::frame::provider::iers::Finals2000A;
+using ostk::physics::coordinate::frame::provider::iers::EOPTable;
 
 /// @brief                      IERS bulletins manager (thread-safe)
 ///
+///                             Loaded bulletins are immutable, and published as snapshots swapped atomically on
+///                             (re)load and reset: once a bulletin is loaded, lookups never take a lock.
+///
+///                             A bulletin found missing is not looked up again until it is loaded, or until the mode,
+///                             the local repository or the manager is reset: lookups then fail without taking a lock.
+///
 ///                             The following environment variables can be defined:
 ///
 ///                             - "OSTK_PHYSICS_COORDINATE_FRAME_PROVIDER_IERS_MANAGER_MODE" will override
 ///                             "DefaultMode"
+///                             - "OSTK_PHYSICS_COORDINATE_FRAME_PROVIDER_IERS_MANAGER_INTERPOLATION" will override
+///                             "DefaultInterpolation"
 ///                             - "OSTK_PHYSICS_COORDINATE_FRAME_PROVIDER_IERS_MANAGER_LOCAL_REPOSITORY" will override
 ///                             "DefaultLocalRepository"
 ///                             - "OSTK_PHYSICS_COORDINATE_FRAME_PROVIDER_IERS_MANAGER_LOCAL_REPOSITORY_LOCK_TIMEOUT"
@@ -128,6 +144,27 @@ class Manager
 
     Real getLodAt(const Instant& anInstant) const;
 
+    /// @brief              Get interpolation of daily EOP values
+    ///
+    /// @return             Interpolation type
+
+    EOPTable::Interpolation getInterpolation() const;
+
+    /// @brief              Returns true if polar motion is corrected for diurnal and semidiurnal ocean tides
+    ///
+    /// @return             True if ocean tidal correction is enabled
+
+    bool isOceanTidalCorrectionEnabled() const;
+
+    /// @brief              Get data revision
+    ///
+    ///                     Incremented every time bulletins are loaded or reset, so that values derived from them
+    ///                     can be cached by callers.
+    ///
+    /// @return             Data revision
+
+    Size getRevision() const;
+
     /// @brief              Set manager mode
     ///
     /// @param              [in] aMode A manager mode
@@ -140,6 +177,23 @@ class Manager
 
     void setLocalRepository(const Directory& aDirectory);
 
+    /// @brief              Set interpolation of daily EOP values
+    ///
+    ///                     Applies to Bulletin A observations and predictions, and to Finals 2000A.
+    ///
+    /// @param              [in] anInterpolation An interpolation type
+
+    void setInterpolation(const EOPTable::Interpolation& anInterpolation);
+
+    /// @brief              Enable or disable ocean tidal correction of polar motion
+    ///
+    ///                     Adds the diurnal and semidiurnal ocean tidal terms of the IERS Gazette #13 to
+    ///                     interpolated polar motion. Disabled by default.
+    ///
+    /// @param              [in] isEnabled True to enable ocean tidal correction
+
+    void setOceanTidalCorrectionEnabled(const bool isEnabled);
+
     /// @brief              Load Bulletin A
     ///
     /// @param              [in] aBulletinA A Bulletin A
@@ -190,6 +244,14 @@ class Manager
 
     static Manager::Mode DefaultMode();
 
+    /// @brief              Get default interpolation of daily EOP values
+    ///
+    ///                     Overriden by: OSTK_PHYSICS_COORDINATE_FRAME_PROVIDER_IERS_MANAGER_INTERPOLATION
+    ///
+    /// @return             Default interpolation type
+
+    static EOPTable::Interpolation DefaultInterpolation();
+
     /// @brief              Get default local repository
     ///
     ///                     Overriden by: OSTK_PHYSICS_COORDINATE_FRAME_PROVIDER_IERS_MANAGER_LOCAL_REPOSITORY
@@ -213,8 +275,16 @@ class Manager
     Directory localRepository_;
     Duration localRepositoryLockTimeout_;
 
-    mutable BulletinA bulletinA_;
-    mutable Finals2000A finals2000A_;
+    mutable std::atomic<Shared<const BulletinA>> bulletinASPtr_;
+    mutable std::atomic<Shared<const Finals2000A>> finals2000ASPtr_;
+
+    mutable std::atomic<bool> bulletinAMissing_;
+    mutable std::atomic<bool> finals2000AMissing_;
+
+    std::atomic<EOPTable::Interpolation> interpolation_;
+    std::atomic<bool> oceanTidalCorrectionEnabled_;
+
+    mutable std::atomic<Size> revision_;
 
     mutable std::mutex mutex_;
 
@@ -232,11 +302,17 @@ class Manager
     void loadBulletinA_(const BulletinA& aBulletinA) const;
     void loadFinals2000A_(const Finals2000A& aFinals2000A) const;
 
-    const BulletinA* accessBulletinA_() const;
-    const Finals2000A* accessFinals2000A_() const;
+    Shared<const BulletinA> accessBulletinA_() const;
+    Shared<const Finals2000A> accessFinals2000A_() const;
 
     File fetchLatestBulletinA_() const;
     File fetchLatestFinals2000A_() const;
+
+    Vector2d getInterpolatedPolarMotionAt_(const Instant& anInstant) const;
+
+    // lock-free when a bulletin is already loaded or found missing, otherwise mutex-protected
+    Shared<const BulletinA> accessBulletinASnapshot_() const;
+    Shared<const Finals2000A> accessFinals2000ASnapshot_() const;
 };
 
 }  // namespace iers
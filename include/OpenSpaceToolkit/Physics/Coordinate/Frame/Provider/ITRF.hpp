@@ -3,7 +3,10 @@
 #ifndef __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_ITRF__
 #define __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_ITRF__
 
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/EarthOrientationTable.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
@@ -18,9 +21,12 @@ namespace frame
 namespace provider
 {
 
+using ostk::core::type::Shared;
+
 using ostk::physics::time::Instant;
 using ostk::physics::coordinate::frame::Provider;
 using ostk::physics::coordinate::Transform;
+using ostk::physics::coordinate::frame::provider::EarthOrientationTable;
 
 /// @brief                      International Terrestrial Reference System (ITRF) provider
 ///
@@ -31,6 +37,15 @@ class ITRF : public Provider
    public:
     ITRF();
 
+    /// @brief              Constructor
+    ///
+    ///                     Interpolate polar motion from an Earth orientation table, falling back to the IERS
+    ///                     bulletins outside of the table interval.
+    ///
+    /// @param              [in] anEarthOrientationTableSPtr A shared pointer to an Earth orientation table
+
+    ITRF(const Shared<const EarthOrientationTable>& anEarthOrientationTableSPtr);
+
     virtual ~ITRF() override;
 
     virtual ITRF* clone() const override;
@@ -38,6 +53,9 @@ class ITRF : public Provider
     virtual bool isDefined() const override;
 
     virtual Transform getTransformAt(const Instant& anInstant) const override;
+
+   private:
+    Shared<const EarthOrientationTable> earthOrientationTableSPtr_;
 };
 
 }  // namespace provider
@@ -3,8 +3,10 @@
 #ifndef __OpenSpaceToolkit_Physics_Coordinate_Position__
 #define __OpenSpaceToolkit_Physics_Coordinate_Position__
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
@@ -25,7 +27,9 @@ namespace coordinate
 
 using ostk::core::type::Integer;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
+using ostk::core::container::Array;
 
 using ostk::mathematics::geometry::d3::object::Point;
 using ostk::mathematics::object::Vector3d;
@@ -151,6 +155,22 @@ class Position
     /// @return                 Position in meters
     static Position Meters(const Vector3d& aCoordinateSet, const Shared<const Frame>& aFrameSPtr);
 
+    /// @brief                  Convert positions to a different frame, each at a given instant
+    ///
+    ///                         When all positions share the same frame, the transforms are computed in batch.
+    ///
+    /// @param                  [in] aPositionArray An array of positions
+    /// @param                  [in] aFrameSPtr A shared pointer to a frame
+    /// @param                  [in] anInstantArray An array of instants, one per position
+    /// @param                  [in] aThreadCount (optional) A number of threads to split the transforms over
+    /// @return                 Array of positions in the specified frame
+    static Array<Position> InFrame(
+        const Array<Position>& aPositionArray,
+        const Shared<const Frame>& aFrameSPtr,
+        const Array<Instant>& anInstantArray,
+        const Size& aThreadCount = 1
+    );
+
    private:
     Vector3d coordinates_;
     Position::Unit unit_;
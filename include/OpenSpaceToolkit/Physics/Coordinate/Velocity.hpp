@@ -3,8 +3,10 @@
 #ifndef __OpenSpaceToolkit_Physics_Coordinate_Velocity__
 #define __OpenSpaceToolkit_Physics_Coordinate_Velocity__
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
@@ -24,7 +26,9 @@ namespace coordinate
 
 using ostk::core::type::Shared;
 using ostk::core::type::Integer;
+using ostk::core::type::Size;
 using ostk::core::type::String;
+using ostk::core::container::Array;
 
 using ostk::mathematics::object::Vector3d;
 
@@ -75,6 +79,25 @@ class Velocity
 
     static Velocity MetersPerSecond(const Vector3d& aCoordinateSet, const Shared<const Frame>& aFrameSPtr);
 
+    /// @brief              Convert velocities to a different frame, each at a given position and instant
+    ///
+    ///                     When all velocities share the same frame, the transforms are computed in batch.
+    ///
+    /// @param              [in] aVelocityArray An array of velocities
+    /// @param              [in] aPositionArray An array of positions, one per velocity
+    /// @param              [in] aFrameSPtr A shared pointer to a frame
+    /// @param              [in] anInstantArray An array of instants, one per velocity
+    /// @param              [in] aThreadCount (optional) A number of threads to split the transforms over
+    /// @return             Array of velocities in the specified frame
+
+    static Array<Velocity> InFrame(
+        const Array<Velocity>& aVelocityArray,
+        const Array<Position>& aPositionArray,
+        const Shared<const Frame>& aFrameSPtr,
+        const Array<Instant>& anInstantArray,
+        const Size& aThreadCount = 1
+    );
+
     static String StringFromUnit(const Velocity::Unit& aUnit);
 
    private:
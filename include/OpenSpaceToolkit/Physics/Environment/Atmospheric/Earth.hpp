@@ -3,6 +3,7 @@
 #ifndef __OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth__
 #define __OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth__
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/Directory.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
@@ -28,6 +29,7 @@ namespace atmospheric
 using ostk::core::type::Unique;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::container::Array;
 using ostk::core::filesystem::Directory;
 
 using ostk::physics::time::Instant;
@@ -46,9 +48,10 @@ class Earth : public Model
    public:
     enum class Type
     {
-        Undefined,    ///< Undefined
-        Exponential,  ///< Exponential atmospheric density model, valid up to 1000 km
-        NRLMSISE00,   ///< Navy Research Lab Mass Spectrometer and Incoherent Scatter Radar Exosphere 2000
+        Undefined,       ///< Undefined
+        Exponential,     ///< Exponential atmospheric density model, valid up to 1000 km
+        NRLMSISE00,      ///< Navy Research Lab Mass Spectrometer and Incoherent Scatter Radar Exosphere 2000
+        HarrisPriester,  ///< Harris-Priester atmospheric density model with diurnal bulge, valid from 100 to 1000 km
     };
 
     enum class InputDataType
@@ -140,6 +143,22 @@ class Earth : public Model
 
     Real getDensityAt(const LLA& aLLA, const Instant& anInstant) const;
 
+    /// @brief              Get the atmospheric density values at given positions and a single instant
+    ///
+    /// @param              [in] aPositionArray An array of positions
+    /// @param              [in] anInstant An Instant
+    /// @return             Atmospheric density values [kg.m^-3]
+
+    Array<Real> getDensitiesAt(const Array<Position>& aPositionArray, const Instant& anInstant) const;
+
+    /// @brief              Get the atmospheric density values along a time series of positions
+    ///
+    /// @param              [in] aPositionArray An array of positions
+    /// @param              [in] anInstantArray An array of instants, of the same size as the array of positions
+    /// @return             Atmospheric density values [kg.m^-3]
+
+    Array<Real> getDensitiesAt(const Array<Position>& aPositionArray, const Array<Instant>& anInstantArray) const;
+
     static constexpr double defaultF107ConstantValue = 150.0;   // 10⁻²² W⋅m⁻²⋅Hz⁻¹
     static constexpr double defaultF107AConstantValue = 150.0;  // 10⁻²² W⋅m⁻²⋅Hz⁻¹
     static constexpr double defaultKpConstantValue = 3.0;       // dimensionless
@@ -150,6 +169,7 @@ class Earth : public Model
     class Impl;
     class ExponentialImpl;
     class NRLMSISE00Impl;
+    class HarrisPriesterImpl;
 
     Unique<Impl> implUPtr_;
 
@@ -163,6 +163,24 @@ class CSSISpaceWeather
         const std::function<bool(const Reading&)>& aPredicate, const Instant& anInstant
     ) const;
 
+    /// @brief                  Access the Interval over which NRLMSISE00 Ap values are precomputed.
+    ///                         Undefined if the file has gaps, or not enough 3-hourly Ap indices.
+    ///
+    /// @return                 NRLMSISE00 Ap values Interval of Instants.
+
+    const Interval& accessNRLMSISE00ApInterval() const;
+
+    /// @brief                  Get NRLMSISE00 Ap values at Instant, read from the precomputed 3-hourly Ap series.
+    ///                         Undefined Ap indices are replaced by the last reading where they are all defined.
+    ///
+    ///                         Values are: daily Ap, 3-hour Ap at Instant, 3, 6 and 9 hours before Instant, average
+    ///                         of eight 3-hour Ap from 12 to 33 hours and from 36 to 57 hours before Instant.
+    ///
+    /// @param                  [in] anInstant An Instant.
+    /// @return                 Array of the 7 NRLMSISE00 Ap values.
+
+    Array<Real> getNRLMSISE00ApValuesAt(const Instant& anInstant) const;
+
     /// @brief                  Undefined factory function
     ///
     /// @return                 Undefined CSSI Space Weather object.
@@ -186,16 +204,38 @@ class CSSISpaceWeather
    private:
     Date lastObservationDate_;
 
+    // Readings are stored contiguously, indexed by MJD (or month number) offset from the first reading
+
     Interval observationInterval_;
-    Map<Integer, CSSISpaceWeather::Reading> observations_;
+    Integer firstObservationMjd_;
+    Array<CSSISpaceWeather::Reading> observations_;
 
     Interval dailyPredictionInterval_;
-    Map<Integer, CSSISpaceWeather::Reading> dailyPredictions_;
+    Integer firstDailyPredictionMjd_;
+    Array<CSSISpaceWeather::Reading> dailyPredictions_;
 
     Interval monthlyPredictionInterval_;
-    Map<Integer, CSSISpaceWeather::Reading> monthlyPredictions_;
+    Integer firstMonthlyPredictionMonth_;
+    Array<CSSISpaceWeather::Reading> monthlyPredictions_;
+
+    // Ap series over observations and daily predictions, indexed by MJD offset from the first day (8 values per day
+    // for 3-hourly series)
+
+    Interval NRLMSISE00ApInterval_;
+    Integer firstApMjd_;
+    Array<Real> apDailyIndices_;
+    Array<Real> ap3HourIndices_;
+    Array<Real> ap3HourIndexAverages_;  /// Average of the eight 3-hourly Ap indices ending at each index
 
     CSSISpaceWeather();
+
+    void setReadings_(
+        const Map<Integer, CSSISpaceWeather::Reading>& anObservationMap,
+        const Map<Integer, CSSISpaceWeather::Reading>& aDailyPredictionMap,
+        const Map<Integer, CSSISpaceWeather::Reading>& aMonthlyPredictionMap
+    );
+
+    void computeApIndices_();
 };
 
 }  // namespace earth
@@ -0,0 +1,117 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_HarrisPriester__
+#define __OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_HarrisPriester__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Spherical/LLA.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace environment
+{
+namespace atmospheric
+{
+namespace earth
+{
+
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::container::Array;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::time::Instant;
+using ostk::physics::coordinate::spherical::LLA;
+using ostk::physics::coordinate::Frame;
+using ostk::physics::environment::object::Celestial;
+
+/// @brief                      Harris-Priester atmospheric model
+///
+///                             Analytical model, interpolating tabulated minimum and maximum densities (for mean solar
+///                             activity) according to the angle to the apex of the diurnal bulge. It is much cheaper
+///                             to evaluate than NRLMSISE00, at the cost of accuracy, and is valid from 100 to 1000 km.
+///
+/// @ref                        Montenbruck O., Gill E., Satellite Orbits, Springer, 2000, p. 89-91
+
+class HarrisPriester
+{
+   public:
+    /// @brief              Constructor
+    ///
+    /// @param              [in] aCosineExponent An exponent for the cosine of the half angle to the bulge apex, from 2
+    ///                     (low inclination orbits) to 6 (polar orbits)
+    /// @param              [in] anEarthFrameSPtr A shared pointer to the Earth frame, used with the Sun celestial
+    /// @param              [in] aSunCelestialSPtr A shared pointer to the Sun celestial body. If not provided, a low
+    ///                     precision analytical Sun position is used.
+
+    HarrisPriester(
+        const Real& aCosineExponent = HarrisPriester::DefaultCosineExponent,
+        const Shared<const Frame>& anEarthFrameSPtr = Frame::ITRF(),
+        const Shared<Celestial>& aSunCelestialSPtr = nullptr
+    );
+
+    /// @brief              Clone the Harris-Priester atmospheric model
+    ///
+    /// @return             Pointer to Harris-Priester atmospheric model
+
+    virtual HarrisPriester* clone() const;
+
+    /// @brief              Check if the Harris-Priester atmospheric model is defined
+    ///
+    /// @return             True if the Harris-Priester atmospheric model is defined
+
+    bool isDefined() const;
+
+    /// @brief              Get the cosine exponent
+    ///
+    /// @return             Cosine exponent
+
+    Real getCosineExponent() const;
+
+    /// @brief              Get the atmospheric density value at a given position and instant
+    ///
+    /// @param              [in] aLLA A position, expressed as latitude, longitude, altitude [deg, deg, m]
+    /// @param              [in] anInstant An instant
+    /// @return             Atmospheric density value [kg.m^-3]
+
+    Real getDensityAt(const LLA& aLLA, const Instant& anInstant) const;
+
+    /// @brief              Get the atmospheric density values at given positions and a single instant.
+    ///                     The diurnal bulge apex is computed once and shared by all positions.
+    ///
+    /// @param              [in] anLLAArray An array of positions, expressed as latitude, longitude, altitude
+    /// @param              [in] anInstant An instant
+    /// @return             Atmospheric density values [kg.m^-3]
+
+    Array<Real> getDensitiesAt(const Array<LLA>& anLLAArray, const Instant& anInstant) const;
+
+    static constexpr double DefaultCosineExponent = 4.0;
+
+   private:
+    Real cosineExponent_;
+    Shared<const Frame> earthFrameSPtr_;
+    Shared<Celestial> sunCelestialSPtr_;
+
+    Vector3d computeBulgeApexDirectionAt(const Instant& anInstant) const;
+
+    Real computeDensityAt(const LLA& aLLA, const Vector3d& aBulgeApexDirection) const;
+};
+
+}  // namespace earth
+}  // namespace atmospheric
+}  // namespace environment
+}  // namespace physics
+}  // namespace ostk
+
+#endif
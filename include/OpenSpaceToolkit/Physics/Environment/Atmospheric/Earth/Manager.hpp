@@ -3,12 +3,15 @@
 #ifndef __OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_Manager__
 #define __OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_Manager__
 
+#include <atomic>
+#include <memory>
 #include <mutex>
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/Directory.hpp>
 #include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 
 #include <OpenSpaceToolkit/IO/URL.hpp>
 
@@ -38,6 +41,7 @@ using ostk::core::container::Array;
 using ostk::core::filesystem::Directory;
 using ostk::core::type::Index;
 using ostk::core::type::Real;
+using ostk::core::type::Shared;
 
 using ostk::io::URL;
 
@@ -49,6 +53,9 @@ using ostk::physics::time::Instant;
 
 /// @brief                      CSSI space weather manager (thread-safe)
 ///
+///                             Loaded space weather data is immutable, and published as a snapshot swapped atomically
+///                             on load and reset: once space weather data is loaded, lookups never take a lock.
+///
 ///                             The following environment variables can be defined:
 ///
 ///                             - "OSTK_PHYSICS_ENVIRONMENT_ATMOSPHERIC_EARTH_MANAGER_MODE" will override
@@ -103,6 +110,16 @@ class Manager
 
     CSSISpaceWeather getCSSISpaceWeatherAt(const Instant& anInstant) const;
 
+    /// @brief                  Access CSSI Space Weather at instant, without copying it
+    ///
+    ///                         The returned snapshot is immutable, and remains valid if other space weather data is
+    ///                         loaded in the meantime.
+    ///
+    /// @param                  [in] anInstant An instant
+    /// @return                 Shared pointer to CSSI Space Weather
+
+    Shared<const CSSISpaceWeather> accessCSSISpaceWeatherAt(const Instant& anInstant) const;
+
     /// @brief                  Get an Array of 8 3-hourly Kp solar indices for the day containing instant.
     ///
     /// @param                  [in] anInstant An instant
@@ -110,6 +127,17 @@ class Manager
 
     Array<Integer> getKp3HourSolarIndicesAt(const Instant& anInstant) const;
 
+    /// @brief                  Access the reading holding the 8 3-hourly Kp solar indices for the day containing
+    ///                         instant, without copying them.
+    ///
+    ///                         The returned pointer shares ownership of the loaded snapshot, and remains valid if
+    ///                         other space weather data is loaded in the meantime.
+    ///
+    /// @param                  [in] anInstant An instant
+    /// @return                 Shared pointer to reading, with defined Kp1 to Kp8
+
+    Shared<const CSSISpaceWeather::Reading> accessKp3HourSolarIndexReadingAt(const Instant& anInstant) const;
+
     /// @brief                  Get an Array of 8 3-hourly Ap solar indices for the day containing instant.
     ///
     /// @param                  [in] anInstant An instant
@@ -117,6 +145,17 @@ class Manager
 
     Array<Integer> getAp3HourSolarIndicesAt(const Instant& anInstant) const;
 
+    /// @brief                  Access the reading holding the 8 3-hourly Ap solar indices for the day containing
+    ///                         instant, without copying them.
+    ///
+    ///                         The returned pointer shares ownership of the loaded snapshot, and remains valid if
+    ///                         other space weather data is loaded in the meantime.
+    ///
+    /// @param                  [in] anInstant An instant
+    /// @return                 Shared pointer to reading, with defined Ap1 to Ap8
+
+    Shared<const CSSISpaceWeather::Reading> accessAp3HourSolarIndexReadingAt(const Instant& anInstant) const;
+
     /// @brief                  Get daily Ap index for the day containing instant.
     ///
     /// @param                  [in] anInstant An instant
@@ -212,7 +251,7 @@ class Manager
     Directory localRepository_;
     Duration localRepositoryLockTimeout_;
 
-    CSSISpaceWeather CSSISpaceWeather_;
+    mutable std::atomic<Shared<const CSSISpaceWeather>> CSSISpaceWeatherSPtr_;
 
     mutable std::mutex mutex_;
 
@@ -222,13 +261,15 @@ class Manager
 
     File getLocalRepositoryLockFile() const;
 
-    const CSSISpaceWeather* accessCSSISpaceWeatherAt(const Instant& anInstant) const;
-
     File getLatestCSSISpaceWeatherFile() const;
 
     void setup();
 
-    void loadCSSISpaceWeather_(const CSSISpaceWeather& aCSSISpaceWeather);
+    // const private methods that modify mutable members
+    // none of these are mutex-protected, but are called exclusively by methods that are
+    void loadCSSISpaceWeather_(const CSSISpaceWeather& aCSSISpaceWeather) const;
+
+    Shared<const CSSISpaceWeather> accessCSSISpaceWeather_() const;
 
     File fetchLatestCSSISpaceWeather_();
 
@@ -8,9 +8,11 @@
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 #include <OpenSpaceToolkit/Core/Type/Unique.hpp>
 
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Spherical/LLA.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Model.hpp>
@@ -35,11 +37,13 @@ using ostk::core::type::Real;
 using ostk::core::type::String;
 using ostk::core::type::Unique;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::container::Tuple;
 using ostk::core::container::Array;
 
 using ostk::physics::time::Instant;
 using ostk::physics::unit::Length;
+using ostk::physics::coordinate::Position;
 using ostk::physics::coordinate::spherical::LLA;
 using ostk::physics::coordinate::Frame;
 using ostk::physics::environment::object::Celestial;
@@ -120,6 +124,33 @@ class NRLMSISE00
 
     Real getDensityAt(const LLA& aLLA, const Instant& anInstant) const;
 
+    /// @brief              Get the atmospheric density values at given positions and a single instant.
+    ///                     The space weather, time and Sun inputs are computed once and shared by all positions.
+    ///
+    /// @param              [in] anLLAArray An array of positions, expressed as latitude, longitude, altitude
+    /// @param              [in] anInstant An instant
+    /// @param              [in] aThreadCount (optional) A number of threads to split the positions over. Only the
+    ///                     inputs are prepared concurrently: the NRLMSISE-00 evaluations themselves are serialized.
+    /// @return             Atmospheric density values [kg.m^-3]
+
+    Array<Real> getDensitiesAt(const Array<LLA>& anLLAArray, const Instant& anInstant, const Size& aThreadCount = 1)
+        const;
+
+    /// @brief              Get the atmospheric density values along a time series of positions (e.g. a trajectory).
+    ///                     The space weather inputs are reused between consecutive instants falling within the same
+    ///                     3-hour UTC interval.
+    ///
+    /// @param              [in] anLLAArray An array of positions, expressed as latitude, longitude, altitude
+    /// @param              [in] anInstantArray An array of instants, of the same size as the array of positions
+    /// @param              [in] aThreadCount (optional) A number of threads to split the time series over, in
+    ///                     contiguous chunks. Only the inputs (space weather, Sun position) are prepared
+    ///                     concurrently: the NRLMSISE-00 evaluations themselves are serialized.
+    /// @return             Atmospheric density values [kg.m^-3]
+
+    Array<Real> getDensitiesAt(
+        const Array<LLA>& anLLAArray, const Array<Instant>& anInstantArray, const Size& aThreadCount = 1
+    ) const;
+
    protected:
     // redefine input structs from NRLMSISE-00.h to avoid including it in this header
 
@@ -143,6 +174,21 @@ class NRLMSISE00
         struct ap_array* ap_a;  // array of 7 values of AP. [see computeApArray below]
     };
 
+    // NRLMSISE input values which only depend on the instant, shared by all positions at that instant
+
+    struct instant_input
+    {
+        int year;                                      // year
+        int doy;                                       // day of year
+        double sec;                                    // seconds in day [0-86400]
+        double f107A;                                  // 81 day average of F10.7 flux (centered on doy)
+        double f107;                                   // daily F10.7 flux for previous day
+        double ap;                                     // AP magnetic index(daily)
+        struct ap_array apValues;                      // array of 7 values of AP, if hasApValues
+        bool hasApValues;                              // true if apValues are set
+        Position sunPosition = Position::Undefined();  // Sun position in the Earth frame, if a Sun is provided
+    };
+
     /// @brief              Get the atmospheric density value by directly provided NRLMSISE input values.
     ///
     /// @param              [in] NRLMSISE input struct
@@ -180,6 +226,41 @@ class NRLMSISE00
         const Unique<NRLMSISE00::ap_array>& apValues, const LLA& aLLA, const Instant& anInstant
     ) const;
 
+    /// @brief              Compute the NRLMSISE00 input values which only depend on the instant
+    ///
+    /// @param              [in] anInstant An instant
+    /// @return             Instant input values
+
+    NRLMSISE00::instant_input computeInstantInput(const Instant& anInstant) const;
+
+    /// @brief              Compute the time input values (year, day of year, seconds in day) and the Sun position
+    ///
+    /// @param              [in] anInstant An instant
+    /// @param              [out] anInstantInput Instant input values to populate
+
+    void computeTimeInput(const Instant& anInstant, NRLMSISE00::instant_input& anInstantInput) const;
+
+    /// @brief              Compute the space weather input values (F10.7, F10.7a and AP values)
+    ///
+    /// @param              [in] apValues Pointer to AP values struct, or nullptr to use the constant Kp value
+    /// @param              [in] anInstant An instant
+    /// @param              [out] anInstantInput Instant input values to populate
+
+    void computeSpaceWeatherInput(
+        const Unique<NRLMSISE00::ap_array>& apValues,
+        const Instant& anInstant,
+        NRLMSISE00::instant_input& anInstantInput
+    ) const;
+
+    /// @brief              Compute the NRLMSISE00 input at a given position from precomputed instant input values.
+    ///                     The returned input points to the AP values of the instant input.
+    ///
+    /// @param              [in] anInstantInput Instant input values
+    /// @param              [in] aLLA A position, expressed as latitude, longitude, altitude [deg, deg, m]
+    /// @return             NRLMSISE00 input
+
+    NRLMSISE00::nrlmsise_input computeNRLMSISE00Input(NRLMSISE00::instant_input& anInstantInput, const LLA& aLLA) const;
+
     /// @brief            Convert Kp index to Ap index
     ///
     /// @param            [in] aKp Kp index
@@ -18,7 +18,9 @@ namespace environment
 
 using ostk::core::type::Shared;
 
+using ostk::physics::time::Instant;
 using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
 
 /// @brief
 ///
@@ -36,6 +38,17 @@ class Ephemeris
     virtual bool isDefined() const = 0;
 
     virtual Shared<const Frame> accessFrame() const = 0;
+
+    /// @brief              Get position of the ephemeris frame origin in a given frame
+    ///
+    ///                     Defaults to the origin of the full frame transform. Implementations may override this to
+    ///                     skip the evaluation of the frame orientation.
+    ///
+    /// @param              [in] aFrameSPtr A frame
+    /// @param              [in] anInstant An instant
+    /// @return             Position of the ephemeris frame origin
+
+    virtual Position getPositionIn(const Shared<const Frame>& aFrameSPtr, const Instant& anInstant) const;
 };
 
 }  // namespace environment
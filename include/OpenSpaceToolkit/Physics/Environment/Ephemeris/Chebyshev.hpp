@@ -0,0 +1,181 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Physics_Environment_Ephemeris_Chebyshev__
+#define __OpenSpaceToolkit_Physics_Environment_Ephemeris_Chebyshev__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Ephemeris.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace environment
+{
+namespace ephemeris
+{
+
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+using ostk::core::container::Array;
+
+using ostk::physics::time::Instant;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Interval;
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::environment::Ephemeris;
+
+/// @brief                      Chebyshev-fitted ephemeris
+///
+///                             Wraps another ephemeris (e.g. SPICE or Analytical), and fits piecewise Chebyshev
+///                             polynomials to the transform from GCRF to its frame (translation, velocity, orientation
+///                             and angular velocity) over an interval. Each segment of the grid holds its own
+///                             polynomials, fitted on Chebyshev nodes of the segment.
+///
+///                             Evaluating the fit costs a few hundred floating point operations, instead of a full
+///                             SPICE evaluation. Outside of the interval, the wrapped ephemeris is used.
+///
+///                             The fitting error is estimated at construction, by comparing against the wrapped
+///                             ephemeris at each segment midpoint.
+///
+///                             The fitted frame is registered globally, under a name built from the wrapped frame name
+///                             and the fit parameters. Fits with the same parameters share their coefficients and
+///                             frame, and are only computed once. The frame is destructed along with the last
+///                             ephemeris sharing it: frames still held elsewhere then fall back to the wrapped
+///                             ephemeris.
+
+class Chebyshev : public Ephemeris
+{
+   public:
+    /// @brief              Constructor
+    ///
+    /// @code
+    ///                     Chebyshev chebyshev = {
+    ///                         SPICE(SPICE::Object::Moon),
+    ///                         Interval::Closed(Instant::J2000(), Instant::J2000() + Duration::Days(30.0)),
+    ///                         Duration::Days(1.0)
+    ///                     } ;
+    /// @endcode
+    ///
+    /// @param              [in] anEphemeris An ephemeris to be fitted
+    /// @param              [in] anInterval An interval to be covered by the fit
+    /// @param              [in] aStep A segment duration
+    /// @param              [in] aDegree A polynomial degree
+
+    Chebyshev(
+        const Ephemeris& anEphemeris,
+        const Interval& anInterval,
+        const Duration& aStep = Chebyshev::DefaultStep(),
+        const Size& aDegree = Chebyshev::DefaultDegree
+    );
+
+    /// @brief              Destructor
+
+    virtual ~Chebyshev() override;
+
+    /// @brief              Clone
+    ///
+    /// @return             Pointer to Chebyshev ephemeris
+
+    virtual Chebyshev* clone() const override;
+
+    /// @brief              Returns true if Chebyshev ephemeris is defined
+    ///
+    /// @return             True if Chebyshev ephemeris is defined
+
+    virtual bool isDefined() const override;
+
+    /// @brief              Access frame
+    ///
+    /// @return             Shared pointer to frame
+
+    virtual Shared<const Frame> accessFrame() const override;
+
+    /// @brief              Get position of the frame origin in a given frame
+    ///
+    ///                     Within the fitted interval, only the translation polynomials are evaluated.
+    ///
+    /// @param              [in] aFrameSPtr A frame
+    /// @param              [in] anInstant An instant
+    /// @return             Position of the frame origin
+
+    virtual Position getPositionIn(const Shared<const Frame>& aFrameSPtr, const Instant& anInstant) const override;
+
+    /// @brief              Check if fit covers a given instant
+    ///
+    /// @param              [in] anInstant An instant
+    /// @return             True if fit covers instant
+
+    bool covers(const Instant& anInstant) const;
+
+    /// @brief              Access interval
+    ///
+    /// @return             Reference to interval
+
+    const Interval& accessInterval() const;
+
+    /// @brief              Get segment duration
+    ///
+    /// @return             Segment duration
+
+    Duration getStep() const;
+
+    /// @brief              Get polynomial degree
+    ///
+    /// @return             Polynomial degree
+
+    Size getDegree() const;
+
+    /// @brief              Get estimated fitting error on position
+    ///
+    /// @return             [m] Maximum fitting error, sampled at segment midpoints
+
+    Real getPositionAccuracy() const;
+
+    /// @brief              Get estimated fitting error on orientation
+    ///
+    /// @return             [rad] Maximum fitting error, sampled at segment midpoints
+
+    Real getOrientationAccuracy() const;
+
+    /// @brief              Get transform from GCRF to the frame of the fitted ephemeris
+    ///
+    /// @param              [in] anInstant An instant
+    /// @return             Transform
+
+    Transform getTransformAt(const Instant& anInstant) const;
+
+    /// @brief              Get default segment duration
+    ///
+    /// @return             Default segment duration (1 day)
+
+    static Duration DefaultStep();
+
+    static constexpr Size DefaultDegree = 12;
+
+   private:
+    class Fit;
+
+    Shared<const Fit> fitSPtr_;
+    Shared<const Frame> frameSPtr_;
+};
+
+}  // namespace ephemeris
+}  // namespace environment
+}  // namespace physics
+}  // namespace ostk
+
+#endif
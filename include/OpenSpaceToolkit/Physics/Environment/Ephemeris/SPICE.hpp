@@ -7,6 +7,7 @@
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Ephemeris.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
@@ -24,6 +25,7 @@ using ostk::core::type::String;
 
 using ostk::physics::time::Instant;
 using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
 using ostk::physics::environment::Ephemeris;
 
 /// @brief                      SPICE Toolkit ephemeris
@@ -80,6 +82,16 @@ class SPICE : public Ephemeris
 
     virtual Shared<const Frame> accessFrame() const override;
 
+    /// @brief              Get position of SPICE object in a given frame
+    ///
+    ///                     Only the object state is evaluated: the orientation of the object frame is not needed.
+    ///
+    /// @param              [in] aFrameSPtr A frame
+    /// @param              [in] anInstant An instant
+    /// @return             Position of SPICE object
+
+    virtual Position getPositionIn(const Shared<const Frame>& aFrameSPtr, const Instant& anInstant) const override;
+
     /// @brief              Convert SPICE object to string
     ///
     /// @param              [in] anObject A SPICE object
@@ -3,6 +3,7 @@
 #ifndef __OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Engine__
 #define __OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Engine__
 
+#include <atomic>
 #include <mutex>
 #include <unordered_set>
 
@@ -13,12 +14,17 @@
 #include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
 #include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Ephemeris/SPICE.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Ephemeris/SPICE/Kernel.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Ephemeris/SPICE/Reader.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
 
@@ -36,6 +42,7 @@ namespace spice
 {
 
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using IndexType = ostk::core::type::Index;
 using ostk::core::type::String;
 using ostk::core::container::Pair;
@@ -44,18 +51,32 @@ using ostk::core::filesystem::Path;
 using ostk::core::filesystem::File;
 using ostk::core::filesystem::Directory;
 
+using ostk::mathematics::object::Vector3d;
+
 using ostk::physics::time::Instant;
 using ostk::physics::time::Interval;
 using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
 using ostk::physics::coordinate::Transform;
 using ostk::physics::environment::ephemeris::SPICE;
 using ostk::physics::environment::ephemeris::spice::Kernel;
+using ostk::physics::environment::ephemeris::spice::Reader;
 
 /// @brief                      SPICE Toolkit engine
 ///
 ///                             The following environment variables can be defined:
 ///
 ///                             - "OSTK_PHYSICS_ENVIRONMENT_EPHEMERIS_SPICE_ENGINE_MODE" will override "DefaultMode"
+///
+///                             CSPICE is not thread-safe. Loaded SPK and PCK kernels are therefore also read by an
+///                             in-process reader, published as an immutable snapshot, which answers most transform
+///                             queries without locking. Queries it cannot answer fall back to CSPICE, under the engine
+///                             lock.
+///
+///                             In automatic mode, the coverage windows of loaded Earth orientation kernels are kept in
+///                             an index sorted by start. The latest Earth orientation kernels are fetched when an
+///                             instant is not covered, and fetched again for uncovered instants only once an hour, as
+///                             newer kernels may have been published since.
 
 class Engine
 {
@@ -111,6 +132,20 @@ class Engine
 
     void setMode(const Engine::Mode& aMode);
 
+    /// @brief              Returns true if the in-process kernel reader is enabled
+    ///
+    /// @return             True if the in-process kernel reader is enabled
+
+    bool isReaderEnabled() const;
+
+    /// @brief              Enable or disable the in-process kernel reader
+    ///
+    ///                     When disabled, all transforms are computed by CSPICE.
+    ///
+    /// @param              [in] aBoolean True to enable the in-process kernel reader
+
+    void setReaderEnabled(const bool aBoolean);
+
     /// @brief              Get default engine mode
     ///
     ///                     Overriden by: OSTK_PHYSICS_ENVIRONMENT_EPHEMERIS_SPICE_ENGINE_MODE
@@ -126,6 +161,16 @@ class Engine
 
     Shared<const Frame> getFrameOf(const SPICE::Object& aSpiceObject) const;
 
+    /// @brief              Get position of SPICE object, in GCRF
+    ///
+    ///                     Only the body state is evaluated: orientation kernels are not used.
+    ///
+    /// @param              [in] aSpiceObject A SPICE object
+    /// @param              [in] anInstant An instant
+    /// @return             Position of SPICE object, in GCRF
+
+    Position getPositionOf(const SPICE::Object& aSpiceObject, const Instant& anInstant) const;
+
     /// @brief              Returns true if kernel is loaded
     ///
     /// @param              [in] aKernel A kernel
@@ -145,6 +190,35 @@ class Engine
 
     void unloadKernel(const Kernel& aKernel);
 
+    /// @brief              Prefetch kernels covering an analysis interval
+    ///
+    ///                     In automatic mode, fetches and loads every Earth orientation kernel intersecting the
+    ///                     interval up-front, so that no kernel is fetched or loaded while the interval is being
+    ///                     evaluated.
+    ///                     Kernels stay loaded until they are explicitly unloaded, or until the engine is reset.
+    ///
+    /// @param              [in] anInterval An analysis interval
+
+    void prefetchKernels(const Interval& anInterval);
+
+    /// @brief              Get kernel load count
+    ///
+    /// @return             Number of kernels loaded since engine construction
+
+    Size getKernelLoadCount() const;
+
+    /// @brief              Get kernel unload count
+    ///
+    /// @return             Number of kernels unloaded since engine construction
+
+    Size getKernelUnloadCount() const;
+
+    /// @brief              Get kernel fetch count
+    ///
+    /// @return             Number of automatic fetches of Earth orientation kernels since engine construction
+
+    Size getKernelFetchCount() const;
+
     /// @brief              Get default kernels
     ///
     /// @return             Default kernels
@@ -152,30 +226,49 @@ class Engine
     static Array<Kernel> DefaultKernels();
 
    private:
-    Engine::Mode mode_;
+    class CoverageIndex;
+
+    std::atomic<Engine::Mode> mode_;  // Also read without the lock, on the lookup path
 
     std::unordered_set<Kernel> kernelSet_;
 
-    Array<Pair<Interval, const Kernel*>> earthKernelCache_;
-    mutable IndexType earthKernelCacheIndex_;
+    std::atomic<Shared<const CoverageIndex>> earthKernelIndexSPtr_;
+    mutable std::atomic<Shared<const Instant>> earthKernelFetchInstantSPtr_;
 
     mutable std::mutex mutex_;
 
+    std::atomic<Shared<const Reader>> readerSPtr_;
+    std::atomic<bool> readerEnabled_;
+
+    std::atomic<Size> kernelLoadCount_;
+    std::atomic<Size> kernelUnloadCount_;
+    mutable std::atomic<Size> kernelFetchCount_;
+
     Engine(const Engine::Mode& aMode = Engine::DefaultMode());
 
     bool isKernelLoaded_(const Kernel& aKernel) const;
 
     Transform getTransformAt(const String& aSpiceIdentifier, const String& aFrameName, const Instant& anInstant) const;
 
+    Transform getTransformAt_(const String& aSpiceIdentifier, const String& aFrameName, const Instant& anInstant) const;
+
+    Vector3d getPositionAt_(const String& aSpiceIdentifier, const Instant& anInstant) const;
+
     void setup();
 
+    bool isEarthKernelFetchNeeded(const Instant& anInstant) const;
+
     void manageKernels(const String& aSpiceIdentifier, const Instant& anInstant) const;
 
+    void fetchEarthKernels(const Interval& anInterval) const;
+
     void loadKernel_(const Kernel& aKernel);
 
     void unloadKernel_(const Kernel& aKernel);
 
-    void updateEarthKernelCache();
+    void updateEarthKernelIndex();
+
+    static Interval EarthKernelCoverage(const Kernel& aKernel);
 
     static String SpiceIdentifierFromSpiceObject(const SPICE::Object& aSpiceObject);
 
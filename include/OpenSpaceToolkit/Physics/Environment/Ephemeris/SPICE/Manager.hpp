@@ -3,9 +3,12 @@
 #ifndef __OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Manager__
 #define __OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Manager__
 
+#include <filesystem>
 #include <mutex>
+#include <regex>
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Map.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/Directory.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
@@ -36,6 +39,7 @@ namespace spice
 {
 
 using ostk::core::container::Array;
+using ostk::core::container::Map;
 using ostk::core::filesystem::Directory;
 using ostk::core::filesystem::File;
 using ostk::core::filesystem::Path;
@@ -53,6 +57,9 @@ using ManifestManager = ostk::physics::data::Manager;
 ///
 ///                             Fetches and manages necessary SPICE kernels.
 ///
+///                             Kernel lookups are answered from an in-memory catalog of the local repository, which is
+///                             only rebuilt when the repository directory changes (or on refresh).
+///
 ///                             The following environment variables can be defined:
 ///
 ///                             - "OSTK_PHYSICS_ENVIRONMENT_EPHEMERIS_SPICE_MANAGER_LOCAL_REPOSITORY" will override
@@ -111,6 +118,9 @@ class Manager
     /// @brief              Find kernels matching regular expression. Search locally first, then remotely.
     ///                     Always return the first found.
     ///
+    ///                     The local search runs against the catalog of the local repository, and compiled regular
+    ///                     expressions are cached.
+    ///
     /// @param              [in] aRegexString A regular expression
     /// @return             An array of kernels
 
@@ -118,18 +128,29 @@ class Manager
 
     /// @brief              Refresh manager
     ///
-    ///                     This will re-fetch a new index.
+    ///                     Drops the catalog of the local repository and the cached regular expressions. The catalog
+    ///                     is rebuilt on the next lookup.
 
     void refresh();
 
    private:
     Directory localRepository_;
 
+    mutable Array<String> localCatalog_;
+    mutable std::filesystem::file_time_type localCatalogTimestamp_;
+    mutable bool localCatalogIsStale_;
+
+    mutable Map<String, std::regex> regexCache_;
+
     mutable std::mutex mutex_;
 
     Manager();
 
     void setup();
+
+    const Array<String>& accessLocalCatalog_() const;
+
+    const std::regex& accessRegex_(const String& aRegexString) const;
 };
 
 }  // namespace spice
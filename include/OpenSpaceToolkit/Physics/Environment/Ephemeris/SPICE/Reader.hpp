@@ -0,0 +1,132 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Reader__
+#define __OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Reader__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Ephemeris/SPICE/Kernel.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace environment
+{
+namespace ephemeris
+{
+namespace spice
+{
+
+using ostk::core::type::Integer;
+using ostk::core::type::Shared;
+using ostk::core::type::String;
+using ostk::core::container::Array;
+
+using ostk::physics::time::Instant;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::environment::ephemeris::spice::Kernel;
+
+/// @brief                      In-process SPICE kernel reader
+///
+///                             Evaluates the Chebyshev segments of SPK (types 2 and 3) and binary PCK (type 2) kernels
+///                             directly from memory-mapped DAF files, and resolves body-fixed frames from the frame
+///                             definitions (PCK and TK frames) and body orientation constants of loaded text kernels.
+///
+///                             A reader is only modified while it is being built. Once built, all queries are const
+///                             and reentrant, so a reader can be shared between threads without locking.
+///
+///                             Queries that cannot be answered from the loaded kernels (unsupported segment types or
+///                             frame classes, non-native byte order, missing coverage) return an undefined result, in
+///                             which case CSPICE should be used instead.
+
+class Reader
+{
+   public:
+    /// @brief              Constructor (empty reader)
+
+    Reader();
+
+    /// @brief              Returns true if no kernel is loaded
+    ///
+    /// @return             True if no kernel is loaded
+
+    bool isEmpty() const;
+
+    /// @brief              Returns true if kernel is loaded
+    ///
+    /// @param              [in] aKernel A kernel
+    /// @return             True if kernel is loaded
+
+    bool isKernelLoaded(const Kernel& aKernel) const;
+
+    /// @brief              Load kernel
+    ///
+    ///                     SPK, binary PCK, text PCK and FK kernels are read. Other kernel types, and DAF files which
+    ///                     are not in native byte order, are ignored.
+    ///
+    /// @param              [in] aKernel A kernel
+
+    void loadKernel(const Kernel& aKernel);
+
+    /// @brief              Unload kernel
+    ///
+    /// @param              [in] aKernel A kernel
+
+    void unloadKernel(const Kernel& aKernel);
+
+    /// @brief              Get transform from GCRF to the body-fixed frame of a SPICE body
+    ///
+    ///                     Equivalent to the CSPICE evaluation of the SPICE engine: geometric state of the body with
+    ///                     respect to the Earth in J2000, and orientation of the body-fixed frame with respect to
+    ///                     J2000, TDB being approximated by TT.
+    ///
+    /// @param              [in] aBodyIdentifier A SPICE body identifier (e.g. 10 for the Sun)
+    /// @param              [in] aFrameName A SPICE frame name (e.g. IAU_SUN)
+    /// @param              [in] anInstant An instant
+    /// @return             Transform, undefined if it cannot be computed from the loaded kernels
+
+    Transform getTransformAt(const Integer& aBodyIdentifier, const String& aFrameName, const Instant& anInstant) const;
+
+    /// @brief              Get translation-only transform from GCRF to a GCRF-aligned frame centered on a SPICE body
+    ///
+    ///                     Only SPK kernels are evaluated. Orientation is identity.
+    ///
+    /// @param              [in] aBodyIdentifier A SPICE body identifier (e.g. 10 for the Sun)
+    /// @param              [in] anInstant An instant
+    /// @return             Transform, undefined if it cannot be computed from the loaded kernels
+
+    Transform getTranslationAt(const Integer& aBodyIdentifier, const Instant& anInstant) const;
+
+    /// @brief              Get rotation-only transform from GCRF to a SPICE frame
+    ///
+    ///                     Only orientation kernels are evaluated. Translation is zero.
+    ///
+    /// @param              [in] aFrameName A SPICE frame name (e.g. IAU_SUN)
+    /// @param              [in] anInstant An instant
+    /// @return             Transform, undefined if it cannot be computed from the loaded kernels
+
+    Transform getRotationAt(const String& aFrameName, const Instant& anInstant) const;
+
+   private:
+    class Source;
+    class Index;
+
+    Array<Shared<const Source>> sources_;
+    Shared<const Index> indexSPtr_;
+
+    void updateIndex();
+};
+
+}  // namespace spice
+}  // namespace ephemeris
+}  // namespace environment
+}  // namespace physics
+}  // namespace ostk
+
+#endif
@@ -3,12 +3,16 @@
 #ifndef __OpenSpaceToolkit_Physics_Environment_Gravitational_Earth__
 #define __OpenSpaceToolkit_Physics_Environment_Gravitational_Earth__
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/Directory.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Unique.hpp>
 
 #include <OpenSpaceToolkit/IO/URL.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+
 #include <OpenSpaceToolkit/Physics/Environment/Gravitational/Model.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
@@ -24,16 +28,28 @@ namespace gravitational
 using ostk::core::type::Unique;
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
+using ostk::core::container::Array;
+using ostk::core::container::Pair;
 using ostk::core::filesystem::Directory;
 
 using ostk::io::URL;
 
+using ostk::mathematics::object::Matrix3d;
+
 using ostk::physics::time::Instant;
 using ostk::physics::environment::gravitational::Model;
 
 /// @brief                      Earth gravitational model
 ///
-///                             The gravitational potential is expanded as sum of spherical harmonics.
+///                             The gravitational potential is expanded as sum of spherical harmonics, evaluated
+///                             by SphericalHarmonics. Loaded coefficients are shared between instances.
+///
+///                             Evaluations can be truncated per call, or adapted to the distance from the Earth given
+///                             a truncation tolerance: the lowest degree meeting the tolerance is then precomputed
+///                             over geometric radius bands, so that far from the Earth only low degrees are evaluated.
+///                             The tolerance applies to the root mean square over the sphere of the omitted terms,
+///                             estimated from the degree variances of the model: it is not a bound on the error at
+///                             any given position, which can be several times larger over strong gravity anomalies.
 ///
 /// @ref                        https://en.wikipedia.org/wiki/Spherical_harmonics
 /// @ref                        https://geographiclib.sourceforge.io/html/gravity.html
@@ -68,12 +84,15 @@ class Earth : public Model
     /// @param              [in] (optional) aDataDirectory A gravitational model data directory
     /// @param              [in] (optional) aGravityModelDegree A gravitational model degree
     /// @param              [in] (optional) aGravityModelOrder A gravitational model order
+    /// @param              [in] (optional) aTruncationTolerance An RMS truncation error tolerance [m.s-2], for
+    ///                     altitude adaptive evaluation
 
     Earth(
         const Earth::Type& aType,
         const Directory& aDataDirectory = Directory::Undefined(),
         const Integer& aGravityModelDegree = Integer::Undefined(),
-        const Integer& aGravityModelOrder = Integer::Undefined()
+        const Integer& aGravityModelOrder = Integer::Undefined(),
+        const Real& aTruncationTolerance = Real::Undefined()
     );
 
     /// @brief              Constructor with max degree and order variables
@@ -81,8 +100,15 @@ class Earth : public Model
     /// @param              [in] aType A gravitational model type
     /// @param              [in] aGravityModelDegree A gravitational model degree
     /// @param              [in] aGravityModelOrder A gravitational model order
+    /// @param              [in] (optional) aTruncationTolerance An RMS truncation error tolerance [m.s-2], for
+    ///                     altitude adaptive evaluation
 
-    Earth(const Earth::Type& aType, const Integer& aGravityModelDegree, const Integer& aGravityModelOrder);
+    Earth(
+        const Earth::Type& aType,
+        const Integer& aGravityModelDegree,
+        const Integer& aGravityModelOrder,
+        const Real& aTruncationTolerance = Real::Undefined()
+    );
 
     /// @brief              Copy constructor
     ///
@@ -131,6 +157,13 @@ class Earth : public Model
 
     virtual Integer getOrder() const;
 
+    /// @brief              Get truncation tolerance
+    ///
+    /// @return             RMS truncation error tolerance [m.s-2], undefined if evaluations are not truncated
+    /// @ref                SphericalHarmonics::getTruncationErrorAt
+
+    Real getTruncationTolerance() const;
+
     /// @brief              Get the gravitational field value at a given position and instant
     ///
     /// @param              [in] aPosition A position, expressed in the gravitational object frame [m]
@@ -139,6 +172,44 @@ class Earth : public Model
 
     virtual Vector3d getFieldValueAt(const Vector3d& aPosition, const Instant& anInstant) const override;
 
+    /// @brief              Get the gravitational field value at a given position and instant, truncated to a given
+    ///                     degree and order
+    ///
+    ///                     The truncation tolerance, if any, does not apply. Has no effect on the spherical model.
+    ///
+    /// @param              [in] aPosition A position, expressed in the gravitational object frame [m]
+    /// @param              [in] anInstant An instant
+    /// @param              [in] aDegree A truncation degree, up to the gravitational model degree
+    /// @param              [in] anOrder (optional) A truncation order, up to the truncation degree if undefined
+    /// @return             Gravitational field value, expressed in the gravitational object frame [m.s-2]
+
+    Vector3d getFieldValueAt(
+        const Vector3d& aPosition,
+        const Instant& anInstant,
+        const Integer& aDegree,
+        const Integer& anOrder = Integer::Undefined()
+    ) const;
+
+    /// @brief              Get the gravitational field values at given positions and instant
+    ///
+    /// @param              [in] aPositionArray An array of positions, expressed in the gravitational object frame [m]
+    /// @param              [in] anInstant An instant
+    /// @return             Array of gravitational field values, expressed in the gravitational object frame [m.s-2]
+
+    Array<Vector3d> getFieldValuesAt(const Array<Vector3d>& aPositionArray, const Instant& anInstant) const;
+
+    /// @brief              Get the gravitational field value and its gradient at a given position and instant
+    ///
+    ///                     The gradient is the partial derivative of the field with respect to position, as used in
+    ///                     state transition matrix and covariance propagation.
+    ///
+    /// @param              [in] aPosition A position, expressed in the gravitational object frame [m]
+    /// @param              [in] anInstant An instant
+    /// @return             Gravitational field value [m.s-2] and gradient [s-2], expressed in the gravitational
+    ///                     object frame
+
+    Pair<Vector3d, Matrix3d> getFieldValueAndGradientAt(const Vector3d& aPosition, const Instant& anInstant) const;
+
     static Model::Parameters ParametersFromType(const Earth::Type& aType);
 
     static constexpr double gravityConstant = 9.80665;  /// Standard gravity [m.s-2]
@@ -154,7 +225,8 @@ class Earth : public Model
         const Earth::Type& aType,
         const Directory& aDataDirectory,
         const Integer& aGravityModelDegree,
-        const Integer& aGravityModelOrder
+        const Integer& aGravityModelOrder,
+        const Real& aTruncationTolerance
     );
 };
 
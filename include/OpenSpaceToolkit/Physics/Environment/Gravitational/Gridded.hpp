@@ -0,0 +1,130 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Physics_Environment_Gravitational_Gridded__
+#define __OpenSpaceToolkit_Physics_Environment_Gravitational_Gridded__
+
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Model.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Utility/FieldGrid.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace environment
+{
+namespace gravitational
+{
+
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::physics::environment::gravitational::Model;
+using ostk::physics::environment::utilities::FieldGrid;
+using ostk::physics::time::Instant;
+using ostk::physics::unit::Length;
+
+/// @brief                      Gridded gravitational model
+///
+///                             Caches a gravitational model on an interpolation grid over an altitude band, in the
+///                             gravitational object frame. The grid tabulates the residual of the model with respect
+///                             to the point mass and J2 field of its parameters, which is smooth and small compared
+///                             to the full field. Positions outside the band are evaluated with the original model.
+
+class Gridded : public Model
+{
+   public:
+    /// @brief              Default memory budget of the grid [B]
+
+    static const Size DefaultMemoryBudget;
+
+    /// @brief              Constructor
+    ///
+    /// @code
+    ///                     const Earth earth = {Earth::Type::EGM2008, 120, 120};
+    ///                     const Gridded gridded = {earth, Length::Kilometers(6678.0), Length::Kilometers(7378.0),
+    ///                     1e-9};
+    /// @endcode
+    ///
+    /// @param              [in] aModel A gravitational model
+    /// @param              [in] aMinimumRadius A minimum radius of the altitude band
+    /// @param              [in] aMaximumRadius A maximum radius of the altitude band
+    /// @param              [in] aTolerance An interpolation error tolerance [m.s-2]
+    /// @param              [in] aMemoryBudget A maximum size of the grid [B]
+
+    Gridded(
+        const Model& aModel,
+        const Length& aMinimumRadius,
+        const Length& aMaximumRadius,
+        const Real& aTolerance,
+        const Size& aMemoryBudget = DefaultMemoryBudget
+    );
+
+    /// @brief              Constructor, from a grid built for the same model (e.g. loaded with FieldGrid::Load)
+    ///
+    /// @param              [in] aModel A gravitational model
+    /// @param              [in] aFieldGrid A field grid, obtained from Gridded::getFieldGrid
+
+    Gridded(const Model& aModel, const FieldGrid& aFieldGrid);
+
+    /// @brief              Clone the gridded gravitational model
+    ///
+    /// @return             Pointer to gridded gravitational model
+
+    virtual Gridded* clone() const override;
+
+    /// @brief              Check if the gridded gravitational model is defined
+    ///
+    /// @return             True if the gridded gravitational model is defined
+
+    virtual bool isDefined() const override;
+
+    /// @brief              Get the original gravitational model
+    ///
+    /// @return             Reference to gravitational model
+
+    const Model& accessModel() const;
+
+    /// @brief              Get the field grid
+    ///
+    /// @return             Field grid
+
+    FieldGrid getFieldGrid() const;
+
+    /// @brief              Get the error bound of the interpolated field values
+    ///
+    /// @return             Error bound [m.s-2]
+
+    Real getErrorBound() const;
+
+    /// @brief              Get the gravitational field value at a given position and instant
+    ///
+    /// @param              [in] aPosition A position, expressed in the gravitational object frame [m]
+    /// @param              [in] anInstant An instant
+    /// @return             Gravitational field value, expressed in the gravitational object frame [m.s-2]
+
+    virtual Vector3d getFieldValueAt(const Vector3d& aPosition, const Instant& anInstant) const override;
+
+   private:
+    Shared<const Model> modelSPtr_;
+    FieldGrid fieldGrid_;
+
+    Real gravitationalParameter_SI_;
+    Real equatorialRadius_SI_;
+    Real J2_;
+
+    Vector3d getReferenceFieldValueAt(const Vector3d& aPosition) const;
+};
+
+}  // namespace gravitational
+}  // namespace environment
+}  // namespace physics
+}  // namespace ostk
+
+#endif
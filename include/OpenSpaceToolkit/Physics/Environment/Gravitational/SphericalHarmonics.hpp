@@ -0,0 +1,259 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Physics_Environment_Gravitational_SphericalHarmonics__
+#define __OpenSpaceToolkit_Physics_Environment_Gravitational_SphericalHarmonics__
+
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/Type/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#define OSTK_PHYSICS_ENVIRONMENT_GRAVITATIONAL_SPHERICAL_HARMONICS_LANE_COUNT 8
+
+namespace ostk
+{
+namespace physics
+{
+namespace environment
+{
+namespace gravitational
+{
+
+using ostk::core::container::Array;
+using ostk::core::container::Pair;
+using ostk::core::filesystem::File;
+using ostk::core::type::Integer;
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Matrix3d;
+using ostk::mathematics::object::Vector3d;
+
+/// @brief                      Spherical harmonic expansion of a gravitational potential
+///
+///                             Fully normalized coefficients, evaluated with the Cunningham recursion of the solid
+///                             harmonics V_nm, W_nm, and their derivative relations for the field and its gradient.
+///
+///                             Orders are processed one at a time, keeping only the few columns of V_nm, W_nm in
+///                             use, and positions are processed in blocks of
+///                             OSTK_PHYSICS_ENVIRONMENT_GRAVITATIONAL_SPHERICAL_HARMONICS_LANE_COUNT, so that the
+///                             recursion coefficients are computed once per block and the inner loops vectorize across
+///                             positions. Sectoral terms are carried with a scale factor, so that high degree and
+///                             order models do not underflow at high latitudes.
+///
+///                             Evaluations can be truncated to a lower degree and order than loaded, and the
+///                             truncation error estimated from degree variances, so that the degree can be adapted to
+///                             the distance from the body.
+///
+///                             Coefficients are immutable and shared between copies.
+///
+/// @ref                        Montenbruck O., Gill E., Satellite Orbits, Springer (2000), 3.2.4 - 3.2.5
+/// @ref                        Cunningham L. E., On the computation of the spherical harmonic terms needed during
+///                             the numerical integration of the orbital motion of an artificial satellite (1970)
+/// @ref                        https://geographiclib.sourceforge.io/html/gravity.html
+
+class SphericalHarmonics
+{
+   public:
+    /// @brief              Constructor
+    ///
+    ///                     Coefficients are stored by order, then by degree: C_00, C_10, ..., C_N0, C_11, ..., C_NM
+    ///                     for cosine coefficients and S_11, ..., S_N1, S_22, ..., S_NM for sine coefficients (same
+    ///                     layout as GeographicLib coefficient files).
+    ///
+    /// @param              [in] aGravitationalParameter A gravitational parameter [m^3/s^2]
+    /// @param              [in] aReferenceRadius A reference radius [m]
+    /// @param              [in] aDegree A maximum degree
+    /// @param              [in] anOrder A maximum order
+    /// @param              [in] aCosineCoefficientArray A fully normalized cosine coefficient array
+    /// @param              [in] aSineCoefficientArray A fully normalized sine coefficient array
+
+    SphericalHarmonics(
+        const Real& aGravitationalParameter,
+        const Real& aReferenceRadius,
+        const Integer& aDegree,
+        const Integer& anOrder,
+        const std::vector<double>& aCosineCoefficientArray,
+        const std::vector<double>& aSineCoefficientArray
+    );
+
+    /// @brief              Check if spherical harmonic expansion is defined
+    ///
+    /// @return             True if spherical harmonic expansion is defined
+
+    bool isDefined() const;
+
+    /// @brief              Get maximum degree
+    ///
+    /// @return             Maximum degree
+
+    Integer getDegree() const;
+
+    /// @brief              Get maximum order
+    ///
+    /// @return             Maximum order
+
+    Integer getOrder() const;
+
+    /// @brief              Get gravitational parameter
+    ///
+    /// @return             Gravitational parameter [m^3/s^2]
+
+    Real getGravitationalParameter() const;
+
+    /// @brief              Get reference radius
+    ///
+    /// @return             Reference radius [m]
+
+    Real getReferenceRadius() const;
+
+    /// @brief              Get fully normalized cosine coefficient
+    ///
+    /// @param              [in] aDegree A degree
+    /// @param              [in] anOrder An order
+    /// @return             Cosine coefficient
+
+    Real getCosineCoefficient(const Integer& aDegree, const Integer& anOrder) const;
+
+    /// @brief              Get fully normalized sine coefficient
+    ///
+    /// @param              [in] aDegree A degree
+    /// @param              [in] anOrder An order
+    /// @return             Sine coefficient
+
+    Real getSineCoefficient(const Integer& aDegree, const Integer& anOrder) const;
+
+    /// @brief              Get gravitational field value at position
+    ///
+    /// @param              [in] aPosition A position, expressed in the body-fixed frame [m]
+    /// @param              [in] aDegree (optional) A truncation degree, maximum degree if undefined
+    /// @param              [in] anOrder (optional) A truncation order, up to truncation degree if undefined
+    /// @return             Gravitational field value, expressed in the body-fixed frame [m.s-2]
+
+    Vector3d getFieldValueAt(
+        const Vector3d& aPosition,
+        const Integer& aDegree = Integer::Undefined(),
+        const Integer& anOrder = Integer::Undefined()
+    ) const;
+
+    /// @brief              Get gravitational field values at positions
+    ///
+    /// @param              [in] aPositionArray An array of positions, expressed in the body-fixed frame [m]
+    /// @param              [in] aDegree (optional) A truncation degree, maximum degree if undefined
+    /// @param              [in] anOrder (optional) A truncation order, up to truncation degree if undefined
+    /// @return             Array of gravitational field values, expressed in the body-fixed frame [m.s-2]
+
+    Array<Vector3d> getFieldValuesAt(
+        const Array<Vector3d>& aPositionArray,
+        const Integer& aDegree = Integer::Undefined(),
+        const Integer& anOrder = Integer::Undefined()
+    ) const;
+
+    /// @brief              Get gravitational field value and gradient at position
+    ///
+    /// @param              [in] aPosition A position, expressed in the body-fixed frame [m]
+    /// @param              [in] aDegree (optional) A truncation degree, maximum degree if undefined
+    /// @param              [in] anOrder (optional) A truncation order, up to truncation degree if undefined
+    /// @return             Gravitational field value [m.s-2] and its gradient with respect to position [s-2]
+
+    Pair<Vector3d, Matrix3d> getFieldValueAndGradientAt(
+        const Vector3d& aPosition,
+        const Integer& aDegree = Integer::Undefined(),
+        const Integer& anOrder = Integer::Undefined()
+    ) const;
+
+    /// @brief              Get gravitational field values and gradients at positions
+    ///
+    /// @param              [in] aPositionArray An array of positions, expressed in the body-fixed frame [m]
+    /// @param              [in] aDegree (optional) A truncation degree, maximum degree if undefined
+    /// @param              [in] anOrder (optional) A truncation order, up to truncation degree if undefined
+    /// @return             Arrays of gravitational field values [m.s-2] and gradients [s-2]
+
+    Pair<Array<Vector3d>, Array<Matrix3d>> getFieldValuesAndGradientsAt(
+        const Array<Vector3d>& aPositionArray,
+        const Integer& aDegree = Integer::Undefined(),
+        const Integer& anOrder = Integer::Undefined()
+    ) const;
+
+    /// @brief              Get truncation error at radius
+    ///
+    ///                     Root mean square, over the sphere of given radius, of the field of the terms of degree
+    ///                     above the truncation degree. Since solid harmonics of different degrees are orthogonal
+    ///                     over the sphere, this follows from the degree variances sigma_n^2 = sum_m (C_nm^2 +
+    ///                     S_nm^2): the field of degree n has a mean square of (n + 1) (2n + 1) (GM / r^2)^2
+    ///                     (R / r)^2n sigma_n^2.
+    ///
+    /// @param              [in] aRadius A radius [m]
+    /// @param              [in] aDegree A truncation degree
+    /// @return             RMS truncation error [m.s-2]
+
+    Real getTruncationErrorAt(const Real& aRadius, const Integer& aDegree) const;
+
+    /// @brief              Get the lowest truncation degree meeting a tolerance at radius
+    ///
+    ///                     The truncation error decreasing with radius, the degree returned for a radius also meets
+    ///                     the tolerance above it.
+    ///
+    /// @param              [in] aRadius A radius [m]
+    /// @param              [in] aTolerance An RMS truncation error tolerance [m.s-2]
+    /// @return             Truncation degree, between 0 and maximum degree
+    /// @ref                getTruncationErrorAt
+
+    Integer getTruncationDegreeAt(const Real& aRadius, const Real& aTolerance) const;
+
+    /// @brief              Constructs an undefined spherical harmonic expansion
+    ///
+    /// @return             Undefined spherical harmonic expansion
+
+    static SphericalHarmonics Undefined();
+
+    /// @brief              Load spherical harmonic expansion from GeographicLib gravity model files
+    ///
+    ///                     Reads model radius, model mass and identifier from the model file (.egm), and
+    ///                     coefficients from the coefficient file next to it (.egm.cof).
+    ///
+    /// @param              [in] aFile A gravity model file (.egm)
+    /// @param              [in] aDegree (optional) A maximum degree, all degrees if undefined
+    /// @param              [in] anOrder (optional) A maximum order, up to degree if undefined
+    /// @return             Spherical harmonic expansion
+
+    static SphericalHarmonics Load(
+        const File& aFile, const Integer& aDegree = Integer::Undefined(), const Integer& anOrder = Integer::Undefined()
+    );
+
+   private:
+    struct Coefficients;
+
+    Real gravitationalParameter_;
+    Real referenceRadius_;
+    Integer degree_;
+    Integer order_;
+
+    Shared<const Coefficients> coefficientsSPtr_;
+
+    template <Size laneCount, bool hasGradient>
+    void evaluate(
+        const Vector3d* aPositionPtr,
+        const Size aPositionCount,
+        const Integer& aDegree,
+        const Integer& anOrder,
+        Vector3d* aFieldValuePtr,
+        Matrix3d* aGradientPtr
+    ) const;
+};
+
+}  // namespace gravitational
+}  // namespace environment
+}  // namespace physics
+}  // namespace ostk
+
+#endif
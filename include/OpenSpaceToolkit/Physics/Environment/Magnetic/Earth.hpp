@@ -3,6 +3,7 @@
 #ifndef __OpenSpaceToolkit_Physics_Environment_Magnetic_Earth__
 #define __OpenSpaceToolkit_Physics_Environment_Magnetic_Earth__
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/Directory.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Unique.hpp>
@@ -22,6 +23,7 @@ namespace environment
 namespace magnetic
 {
 
+using ostk::core::container::Array;
 using ostk::core::type::Unique;
 using ostk::core::type::Real;
 using ostk::core::filesystem::Directory;
@@ -34,6 +36,11 @@ using ostk::physics::environment::magnetic::Model;
 
 /// @brief                      Earth magnetic model
 ///
+///                             Models are read from GeographicLib magnetic model files, and their coefficients shared
+///                             between instances and copies. The coefficients at an instant (main field, secular
+///                             variation and constant fields combined) are cached, and evaluated directly in the
+///                             magnetic object frame.
+///
 /// @ref                        https://geographiclib.sourceforge.io/html/magnetic.html
 
 class Earth : public Model
@@ -109,6 +116,14 @@ class Earth : public Model
 
     virtual Vector3d getFieldValueAt(const Vector3d& aPosition, const Instant& anInstant) const override;
 
+    /// @brief              Get the magnetic field values at given positions and instant
+    ///
+    /// @param              [in] aPositionArray An array of positions, expressed in the magnetic object frame [m]
+    /// @param              [in] anInstant An instant
+    /// @return             Magnetic field values, expressed in the magnetic object frame [T]
+
+    Array<Vector3d> getFieldValuesAt(const Array<Vector3d>& aPositionArray, const Instant& anInstant) const;
+
    private:
     class Impl;
 
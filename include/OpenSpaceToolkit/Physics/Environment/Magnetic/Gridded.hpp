@@ -0,0 +1,154 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Physics_Environment_Magnetic_Gridded__
+#define __OpenSpaceToolkit_Physics_Environment_Magnetic_Gridded__
+
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Magnetic/Model.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Utility/FieldGrid.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace environment
+{
+namespace magnetic
+{
+
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::physics::environment::magnetic::Model;
+using ostk::physics::environment::utilities::FieldGrid;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::unit::Length;
+
+/// @brief                      Gridded magnetic model
+///
+///                             Caches a magnetic model, frozen at an epoch, on an interpolation grid over an altitude
+///                             band, in the magnetic object frame. The grid tabulates the field scaled by the cube of
+///                             the radius, which varies slowly with radius. Positions outside the band are evaluated
+///                             with the original model.
+///
+///                             The grid is only used at instants within a validity duration of the epoch, short
+///                             compared to the secular variation of the model. At other instants, or outside the band,
+///                             the field is evaluated with the original model.
+
+class Gridded : public Model
+{
+   public:
+    /// @brief              Default memory budget of the grid [B]
+
+    static const Size DefaultMemoryBudget;
+
+    /// @brief              Default validity duration of the grid, on either side of the epoch
+
+    static const Duration DefaultValidityDuration;
+
+    /// @brief              Constructor
+    ///
+    /// @param              [in] aModel A magnetic model
+    /// @param              [in] anEpoch An epoch, at which the model is evaluated
+    /// @param              [in] aMinimumRadius A minimum radius of the altitude band
+    /// @param              [in] aMaximumRadius A maximum radius of the altitude band
+    /// @param              [in] aTolerance An interpolation error tolerance [T]
+    /// @param              [in] aMemoryBudget A maximum size of the grid [B]
+    /// @param              [in] aValidityDuration A validity duration of the grid, on either side of the epoch
+
+    Gridded(
+        const Model& aModel,
+        const Instant& anEpoch,
+        const Length& aMinimumRadius,
+        const Length& aMaximumRadius,
+        const Real& aTolerance,
+        const Size& aMemoryBudget = DefaultMemoryBudget,
+        const Duration& aValidityDuration = DefaultValidityDuration
+    );
+
+    /// @brief              Constructor, from a grid built for the same model and epoch (e.g. loaded with
+    ///                     FieldGrid::Load)
+    ///
+    /// @param              [in] aModel A magnetic model
+    /// @param              [in] anEpoch An epoch
+    /// @param              [in] aFieldGrid A field grid, obtained from Gridded::getFieldGrid
+    /// @param              [in] aValidityDuration A validity duration of the grid, on either side of the epoch
+
+    Gridded(
+        const Model& aModel,
+        const Instant& anEpoch,
+        const FieldGrid& aFieldGrid,
+        const Duration& aValidityDuration = DefaultValidityDuration
+    );
+
+    /// @brief              Clone the gridded magnetic model
+    ///
+    /// @return             Pointer to gridded magnetic model
+
+    virtual Gridded* clone() const override;
+
+    /// @brief              Check if the gridded magnetic model is defined
+    ///
+    /// @return             True if the gridded magnetic model is defined
+
+    virtual bool isDefined() const override;
+
+    /// @brief              Get the original magnetic model
+    ///
+    /// @return             Reference to magnetic model
+
+    const Model& accessModel() const;
+
+    /// @brief              Get the epoch
+    ///
+    /// @return             Epoch
+
+    Instant getEpoch() const;
+
+    /// @brief              Get the validity duration of the grid, on either side of the epoch
+    ///
+    /// @return             Validity duration
+
+    Duration getValidityDuration() const;
+
+    /// @brief              Get the field grid
+    ///
+    /// @return             Field grid
+
+    FieldGrid getFieldGrid() const;
+
+    /// @brief              Get the error bound of the interpolated field values
+    ///
+    /// @return             Error bound [T]
+
+    Real getErrorBound() const;
+
+    /// @brief              Get the magnetic field value at a given position and instant
+    ///
+    /// @param              [in] aPosition A position, expressed in the magnetic object frame [m]
+    /// @param              [in] anInstant An instant, the grid being used within the validity duration of the epoch
+    /// @return             Magnetic field value, expressed in the magnetic object frame [T]
+
+    virtual Vector3d getFieldValueAt(const Vector3d& aPosition, const Instant& anInstant) const override;
+
+   private:
+    Shared<const Model> modelSPtr_;
+    Instant epoch_;
+    FieldGrid fieldGrid_;
+    Duration validityDuration_;
+};
+
+}  // namespace magnetic
+}  // namespace environment
+}  // namespace physics
+}  // namespace ostk
+
+#endif
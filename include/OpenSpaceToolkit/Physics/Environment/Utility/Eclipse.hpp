@@ -4,9 +4,12 @@
 #define __OpenSpaceToolkit_Physics_Environment_Utility_Eclipse__
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
 #include <OpenSpaceToolkit/Physics/Environment.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
 
 namespace ostk
@@ -19,20 +22,62 @@ namespace utilities
 {
 
 using ostk::core::container::Array;
+using ostk::core::type::Real;
 
 using ostk::physics::coordinate::Position;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
 using ostk::physics::time::Interval;
 using ostk::physics::Environment;
 
+/// @brief                      Calculate shadow function for a given position
+///
+///                             Angular margin between the Sun disk and the shadow region of the closest occulting body,
+///                             as seen from the position: negative in the shadow region, positive outside of it, and
+///                             continuous in time.
+///
+///                             Occulting bodies are the celestial objects of the environment (other than the Sun),
+///                             modeled as oblate spheroids, and the Sun is modeled as a sphere of its equatorial
+///                             radius. The umbra is the region where the Sun disk is fully occulted, the penumbra the
+///                             region where it is at least partially occulted.
+///
+/// @param                      [in] anInstant An instant
+/// @param                      [in] aPosition A position
+/// @param                      [in] anEnvironment An environment (its instant is not used)
+/// @param                      [in] includePenumbra If true, the shadow region includes the penumbra
+/// @return                     [rad] Shadow function
+
+Real shadowFunctionAtPosition(
+    const Instant& anInstant,
+    const Position& aPosition,
+    const Environment& anEnvironment,
+    const bool& includePenumbra = false
+);
+
 /// @brief                      Calculate eclipse intervals for a given position
 ///
+///                             Eclipse boundaries are the roots of the shadow function, bracketed by stepping through
+///                             the analysis interval and refined with Brent's method. Steps are sized from the current
+///                             value and rate of change of the shadow function (the time it would take to reach the
+///                             shadow boundary, with a safety factor), between 1 [s] and the maximum step.
+///
+///                             Eclipses shorter than the steps taken around them may be missed.
+///
 /// @param                      [in] anAnalysisInterval An analysis interval
 /// @param                      [in] aPosition A position
 /// @param                      [in] anEnvironment An environment
+/// @param                      [in] includePenumbra If true, eclipses include the penumbra
+/// @param                      [in] aMaximumStep A maximum search step
+/// @param                      [in] aTolerance A tolerance on eclipse boundaries
 /// @return                     Array of eclipse intervals for a given position
 
 Array<Interval> eclipseIntervalsAtPosition(
-    const Interval& anAnalysisInterval, const Position& aPosition, const Environment& anEnvironment
+    const Interval& anAnalysisInterval,
+    const Position& aPosition,
+    const Environment& anEnvironment,
+    const bool& includePenumbra = false,
+    const Duration& aMaximumStep = Duration::Minutes(10.0),
+    const Duration& aTolerance = Duration::Milliseconds(1.0)
 );
 
 }  // namespace utilities
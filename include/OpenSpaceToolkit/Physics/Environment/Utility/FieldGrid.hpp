@@ -0,0 +1,149 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Physics_Environment_Utility_FieldGrid__
+#define __OpenSpaceToolkit_Physics_Environment_Utility_FieldGrid__
+
+#include <functional>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace environment
+{
+namespace utilities
+{
+
+using ostk::core::container::Array;
+using ostk::core::filesystem::File;
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Vector3d;
+
+/// @brief                      Interpolation grid of a vector field over a spherical shell
+///
+///                             Field values are tabulated at the nodes of a regular grid in radius, latitude and
+///                             longitude, and interpolated with tricubic Lagrange polynomials (64 nodes per
+///                             position). The grid is refined, one axis at a time, until the interpolation error at
+///                             cell midpoints meets the requested tolerance, within a memory budget.
+///
+///                             Nodes are immutable and shared between copies. Grids can be saved to and loaded from
+///                             a binary file, to skip their construction.
+
+class FieldGrid
+{
+   public:
+    /// @brief              Field function: field values at an array of positions
+    typedef std::function<Array<Vector3d>(const Array<Vector3d>&)> FieldFunction;
+
+    /// @brief              Constructor
+    ///
+    /// @param              [in] aFieldFunction A field function
+    /// @param              [in] aMinimumRadius A minimum radius [m]
+    /// @param              [in] aMaximumRadius A maximum radius [m]
+    /// @param              [in] aTolerance An interpolation error tolerance, in field units
+    /// @param              [in] aMemoryBudget A maximum size of the grid nodes [B]
+
+    FieldGrid(
+        const FieldFunction& aFieldFunction,
+        const Real& aMinimumRadius,
+        const Real& aMaximumRadius,
+        const Real& aTolerance,
+        const Size& aMemoryBudget
+    );
+
+    /// @brief              Check if field grid is defined
+    ///
+    /// @return             True if field grid is defined
+
+    bool isDefined() const;
+
+    /// @brief              Check if field grid contains position
+    ///
+    /// @param              [in] aPosition A position [m]
+    /// @return             True if position radius is within grid radii
+
+    bool contains(const Vector3d& aPosition) const;
+
+    /// @brief              Get minimum radius
+    ///
+    /// @return             Minimum radius [m]
+
+    Real getMinimumRadius() const;
+
+    /// @brief              Get maximum radius
+    ///
+    /// @return             Maximum radius [m]
+
+    Real getMaximumRadius() const;
+
+    /// @brief              Get error bound
+    ///
+    ///                     Largest interpolation error found at cell midpoints during construction.
+    ///
+    /// @return             Error bound, in field units
+
+    Real getErrorBound() const;
+
+    /// @brief              Get grid node counts
+    ///
+    /// @return             Node counts in radius, latitude and longitude
+
+    Array<Size> getNodeCounts() const;
+
+    /// @brief              Get memory size of the grid nodes
+    ///
+    /// @return             Memory size [B]
+
+    Size getMemorySize() const;
+
+    /// @brief              Get interpolated field value at position
+    ///
+    /// @param              [in] aPosition A position, within grid radii [m]
+    /// @return             Field value
+
+    Vector3d getValueAt(const Vector3d& aPosition) const;
+
+    /// @brief              Save field grid to file
+    ///
+    /// @param              [in] aFile A file
+
+    void save(const File& aFile) const;
+
+    /// @brief              Constructs an undefined field grid
+    ///
+    /// @return             Undefined field grid
+
+    static FieldGrid Undefined();
+
+    /// @brief              Load field grid from file
+    ///
+    /// @param              [in] aFile A file, written by FieldGrid::save
+    /// @return             Field grid
+
+    static FieldGrid Load(const File& aFile);
+
+   private:
+    struct Nodes;
+
+    Shared<const Nodes> nodesSPtr_;
+
+    FieldGrid(const Shared<const Nodes>& aNodesSPtr);
+};
+
+}  // namespace utilities
+}  // namespace environment
+}  // namespace physics
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,71 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Physics_Time_DUT1Provider__
+#define __OpenSpaceToolkit_Physics_Time_DUT1Provider__
+
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace time
+{
+
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+/// @brief                      UT1 - UTC (DUT1) provider
+///
+///                             Source of the UT1 - UTC values used by Instant for UT1 conversions, so that the time
+///                             layer does not depend on where Earth orientation data comes from. The IERS manager
+///                             registers itself as the active provider when the library is loaded.
+
+class DUT1Provider
+{
+   public:
+    DUT1Provider();
+
+    virtual ~DUT1Provider() = 0;
+
+    /// @brief              Get UT1 - UTC at instant
+    ///
+    /// @param              [in] anInstant An instant
+    /// @return             [s] UT1 - UTC, undefined if not available
+
+    virtual Real getUt1MinusUtcAt(const Instant& anInstant) const = 0;
+
+    /// @brief              Get revision
+    ///
+    ///                     Changes whenever the values provided may have changed, so that values cached by callers
+    ///                     can be invalidated.
+    ///
+    /// @return             Revision
+
+    virtual Size getRevision() const = 0;
+
+    /// @brief              Access active provider
+    ///
+    /// @return             Pointer to active provider, nullptr if none is set
+
+    static const DUT1Provider* Access();
+
+    /// @brief              Set active provider
+    ///
+    ///                     Replaced providers are retained, so that pointers held by concurrent readers remain valid.
+    ///
+    /// @param              [in] aDUT1ProviderSPtr A shared pointer to a provider
+
+    static void Set(const Shared<const DUT1Provider>& aDUT1ProviderSPtr);
+};
+
+}  // namespace time
+}  // namespace physics
+}  // namespace ostk
+
+#endif
@@ -3,8 +3,10 @@
 #ifndef __OpenSpaceToolkit_Physics_Time_Instant__
 #define __OpenSpaceToolkit_Physics_Time_Instant__
 
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
 #include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
@@ -19,9 +21,11 @@ namespace physics
 namespace time
 {
 
+using ostk::core::container::Pair;
 using ostk::core::type::Int64;
 using ostk::core::type::Uint64;
 using ostk::core::type::Real;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 using ostk::physics::time::Scale;
 using ostk::physics::time::Duration;
@@ -220,6 +224,16 @@ class Instant
 
     bool isNear(const Instant& anInstant, const Duration& aTolerance) const;
 
+    /// @brief              Get hash of the instant representation
+    ///
+    ///                     Hashes the stored count and time scale, without any time scale conversion: equal instants
+    ///                     expressed in different time scales may hash differently. Suited to spread instants over
+    ///                     buckets cheaply, not to test instants for equality.
+    ///
+    /// @return             Hash of the instant representation
+
+    Size getRepresentationHash() const;
+
     /// @brief              Get date-time expressed in given time scale
     ///
     /// @code
@@ -253,6 +267,31 @@ class Instant
 
     Real getModifiedJulianDate(const Scale& aTimeScale) const;
 
+    /// @brief              Get two-part Julian Date expressed in given time scale
+    ///
+    ///                     Computed from the nanosecond count, without date-time decomposition. The fraction keeps
+    ///                     the full count resolution, and both parts can be passed as is to SOFA two-part dates.
+    ///
+    /// @code
+    ///                     Instant::J2000().getJulianDateParts(Scale::TT) ; // {2451545.0, 0.0}
+    /// @endcode
+    ///
+    /// @param              [in] aTimeScale A time scale
+    /// @return             Integer part and fraction of day [0, 1) of Julian Date
+
+    Pair<Real, Real> getJulianDateParts(const Scale& aTimeScale) const;
+
+    /// @brief              Get two-part Modified Julian Date expressed in given time scale
+    ///
+    /// @code
+    ///                     Instant::J2000().getModifiedJulianDateParts(Scale::TT) ; // {51544.0, 0.5}
+    /// @endcode
+    ///
+    /// @param              [in] aTimeScale A time scale
+    /// @return             Integer part and fraction of day [0, 1) of Modified Julian Date
+
+    Pair<Real, Real> getModifiedJulianDateParts(const Scale& aTimeScale) const;
+
     /// @brief              Get Leap Second count
     ///
     ///                     The Leap Second count is the number of seconds between TAI and UTC scales.
@@ -0,0 +1,177 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Physics_Time_LeapSecondTable__
+#define __OpenSpaceToolkit_Physics_Time_LeapSecondTable__
+
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/Type/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Date.hpp>
+
+#define OSTK_PHYSICS_TIME_LEAP_SECOND_TABLE_FILE ""
+
+namespace ostk
+{
+namespace physics
+{
+namespace time
+{
+
+using ostk::core::type::Int64;
+using ostk::core::type::Integer;
+using ostk::core::type::Size;
+using ostk::core::container::Array;
+using ostk::core::container::Pair;
+using ostk::core::filesystem::File;
+
+/// @brief                      Leap second table (TAI - UTC)
+///
+///                             Sorted flat table of the dates at which TAI - UTC changes, searched by bisection.
+///                             The last table entry hit is cached per thread, so that monotonic sequences of queries
+///                             (propagation, sampling) are answered without searching.
+///
+///                             The first entry applies back to 1970-01-01 UTC: lookups before that date throw, as
+///                             TAI - UTC was not an integer number of seconds then.
+///
+///                             The active table is used for all UTC conversions. It defaults to the table loaded from
+///                             the default NAIF leapseconds kernel (LSK) file, if any, falling back to the built-in
+///                             table (valid up to the 2017-01-01 leap second). Installing another table, for instance
+///                             one loaded from a leapseconds kernel fetched by the SPICE manager, is an explicit call
+///                             to "Set".
+///
+///                             The following environment variable can be defined:
+///
+///                             - "OSTK_PHYSICS_TIME_LEAP_SECOND_TABLE_FILE" will override
+///                             "DefaultFile" with the path to a NAIF leapseconds kernel
+///
+/// @ref                        https://hpiers.obspm.fr/iers/bul/bulc/Leap_Second.dat
+/// @ref                        https://naif.jpl.nasa.gov/pub/naif/generic_kernels/lsk/
+
+class LeapSecondTable
+{
+   public:
+    /// @brief              Constructor
+    ///
+    /// @code
+    ///                     LeapSecondTable table = {{{Date(1972, 1, 1), 10}, {Date(1972, 7, 1), 11}}} ;
+    /// @endcode
+    ///
+    /// @param              [in] anEntryArray An array of (UTC date, TAI - UTC [s]) pairs, TAI - UTC applying from
+    ///                     the beginning of the date
+
+    LeapSecondTable(const Array<Pair<Date, Integer>>& anEntryArray);
+
+    /// @brief              Check if table is defined
+    ///
+    /// @return             True if table is defined
+
+    bool isDefined() const;
+
+    /// @brief              Get number of entries
+    ///
+    /// @return             Number of entries
+
+    Size getSize() const;
+
+    /// @brief              Get date of last entry
+    ///
+    /// @return             Date of last leap second
+
+    Date getLastDate() const;
+
+    /// @brief              Get TAI - UTC at UTC count
+    ///
+    ///                     Throws before 1970-01-01 UTC.
+    ///
+    /// @param              [in] aNanosecondCountFromJ2000_UTC A signed number of UTC nanoseconds from J2000
+    /// @return             [ns] TAI - UTC
+
+    Int64 getTAIMinusUTCAtUTC(const Int64& aNanosecondCountFromJ2000_UTC) const;
+
+    /// @brief              Get TAI - UTC at TAI count
+    ///
+    ///                     Throws before 1970-01-01 UTC.
+    ///
+    /// @param              [in] aNanosecondCountFromJ2000_TAI A signed number of TAI nanoseconds from J2000
+    /// @return             [ns] TAI - UTC
+
+    Int64 getTAIMinusUTCAtTAI(const Int64& aNanosecondCountFromJ2000_TAI) const;
+
+    /// @brief              Constructs an undefined table
+    ///
+    /// @return             Undefined table
+
+    static LeapSecondTable Undefined();
+
+    /// @brief              Built-in table, up to the 2017-01-01 leap second
+    ///
+    /// @return             Built-in table
+
+    static LeapSecondTable BuiltIn();
+
+    /// @brief              Load table from NAIF leapseconds kernel (DELTET/DELTA_AT)
+    ///
+    /// @param              [in] aFile A leapseconds kernel file (.tls)
+    /// @return             Table
+
+    static LeapSecondTable Load(const File& aFile);
+
+    /// @brief              Default table
+    ///
+    ///                     Loaded from the default file if it exists and holds more leap seconds than the built-in
+    ///                     table, otherwise the built-in table.
+    ///
+    /// @return             Default table
+
+    static LeapSecondTable Default();
+
+    /// @brief              Access active table
+    ///
+    /// @return             Reference to active table
+
+    static const LeapSecondTable& Access();
+
+    /// @brief              Set active table
+    ///
+    ///                     Replaced tables are retained, so that references held by concurrent readers remain valid.
+    ///
+    /// @param              [in] aLeapSecondTable A leap second table
+
+    static void Set(const LeapSecondTable& aLeapSecondTable);
+
+    /// @brief              Get default leapseconds kernel file
+    ///
+    ///                     Set at build time with OSTK_PHYSICS_TIME_LEAP_SECOND_TABLE_FILE.
+    ///
+    ///                     Overriden by: OSTK_PHYSICS_TIME_LEAP_SECOND_TABLE_FILE
+    ///
+    /// @return             Default leapseconds kernel file, which may not exist, undefined if not set
+
+    static File DefaultFile();
+
+   private:
+    Array<Date> dates_;
+
+    std::vector<Int64> utcStarts_;  // [ns] UTC count from J2000 at which each entry applies
+    std::vector<Int64> taiStarts_;  // [ns] TAI count from J2000 at which each entry applies
+    std::vector<Int64> values_;     // [ns] TAI - UTC
+
+    static Int64 Lookup(
+        const std::vector<Int64>& aStartArray,
+        const std::vector<Int64>& aValueArray,
+        const Int64& aNanosecondCount,
+        const Int64& aLowerBound,
+        Size& aHintIndex
+    );
+};
+
+}  // namespace time
+}  // namespace physics
+}  // namespace ostk
+
+#endif
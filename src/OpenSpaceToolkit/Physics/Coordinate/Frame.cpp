@@ -1,5 +1,9 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <atomic>
+#include <future>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
@@ -22,8 +26,131 @@ namespace physics
 namespace coordinate
 {
 
+using ostk::core::type::Index;
+
 using FrameManager = ostk::physics::coordinate::frame::Manager;
 
+static std::atomic<Size> NextFrameId {0};
+
+namespace
+{
+
+Shared<const FrameManager::ProviderChain> AccessProviderChain(
+    const Shared<const Frame>& aFromFrameSPtr, const Shared<const Frame>& aToFrameSPtr
+)
+{
+    const Shared<const FrameManager::ProviderChain> providerChainSPtr =
+        FrameManager::Get().accessProviderChain(aFromFrameSPtr, aToFrameSPtr);
+
+    if (providerChainSPtr != nullptr)
+    {
+        return providerChainSPtr;
+    }
+
+    // Find common ancestor, walking up from the destination frame until reaching an ancestor of the origin frame
+
+    Array<Shared<const Frame>> originAncestors = {aFromFrameSPtr};
+
+    while (originAncestors.back()->hasParent())
+    {
+        originAncestors.add(originAncestors.back()->accessParent());
+    }
+
+    const auto findOriginAncestorIndex = [&originAncestors](const Shared<const Frame>& aFrameSPtr) -> Index
+    {
+        for (Index index = 0; index < originAncestors.getSize(); ++index)
+        {
+            if ((originAncestors[index].get() == aFrameSPtr.get()) || ((*originAncestors[index]) == (*aFrameSPtr)))
+            {
+                return index;
+            }
+        }
+
+        return originAncestors.getSize();
+    };
+
+    FrameManager::ProviderChain providerChain;
+
+    providerChain.originFrameWPtr = aFromFrameSPtr;
+    providerChain.destinationFrameWPtr = aToFrameSPtr;
+
+    Shared<const Frame> frameSPtr = aToFrameSPtr;
+    Index commonAncestorIndex = findOriginAncestorIndex(frameSPtr);
+
+    while (commonAncestorIndex == originAncestors.getSize())
+    {
+        if (!frameSPtr->hasParent())
+        {
+            throw ostk::core::error::RuntimeError(
+                "No common ancestor between [{}] and [{}].", aFromFrameSPtr->getName(), aToFrameSPtr->getName()
+            );
+        }
+
+        providerChain.destinationProviders.add(frameSPtr->accessProvider());
+
+        frameSPtr = frameSPtr->accessParent();
+        commonAncestorIndex = findOriginAncestorIndex(frameSPtr);
+    }
+
+    for (Index index = 0; index < commonAncestorIndex; ++index)
+    {
+        providerChain.originProviders.add(originAncestors[index]->accessProvider());
+    }
+
+    const Shared<const FrameManager::ProviderChain> newProviderChainSPtr =
+        std::make_shared<const FrameManager::ProviderChain>(providerChain);
+
+    FrameManager::Get().addProviderChain(aFromFrameSPtr, aToFrameSPtr, newProviderChainSPtr);
+
+    return newProviderChainSPtr;
+}
+
+void ComputeTransforms(
+    const FrameManager::ProviderChain& aProviderChain,
+    const Array<Instant>& anInstantArray,
+    const Index& aBeginIndex,
+    const Index& anEndIndex,
+    Array<Transform>& aTransformArray
+)
+{
+    // Evaluate each provider over the whole range before moving to the next one, so that its state stays hot
+
+    Array<Transform> transforms_origin_common = Array<Transform>::Empty();
+    transforms_origin_common.reserve(anEndIndex - aBeginIndex);
+
+    for (Index index = aBeginIndex; index < anEndIndex; ++index)
+    {
+        transforms_origin_common.add(Transform::Identity(anInstantArray[index]));
+    }
+
+    Array<Transform> transforms_destination_common = transforms_origin_common;
+
+    for (const Shared<const Provider>& providerSPtr : aProviderChain.originProviders)
+    {
+        for (Index index = aBeginIndex; index < anEndIndex; ++index)
+        {
+            transforms_origin_common[index - aBeginIndex] *= providerSPtr->getTransformAt(anInstantArray[index]);
+        }
+    }
+
+    for (const Shared<const Provider>& providerSPtr : aProviderChain.destinationProviders)
+    {
+        for (Index index = aBeginIndex; index < anEndIndex; ++index)
+        {
+            transforms_destination_common[index - aBeginIndex] *=
+                providerSPtr->getTransformAt(anInstantArray[index]);
+        }
+    }
+
+    for (Index index = aBeginIndex; index < anEndIndex; ++index)
+    {
+        aTransformArray[index] = transforms_destination_common[index - aBeginIndex] *
+                                 transforms_origin_common[index - aBeginIndex].getInverse();
+    }
+}
+
+}  // namespace
+
 // https://stackoverflow.com/questions/8147027/how-do-i-call-stdmake-shared-on-a-class-with-only-protected-or-private-const
 
 struct SharedFrameEnabler : public Frame
@@ -168,6 +295,11 @@ String Frame::getName() const
     return name_;
 }
 
+Size Frame::getId() const
+{
+    return id_;
+}
+
 Position Frame::getOriginIn(const Shared<const Frame>& aFrameSPtr, const Instant& anInstant) const
 {
     if (!anInstant.isDefined())
@@ -237,46 +369,40 @@ Transform Frame::getTransformTo(const Shared<const Frame>& aFrameSPtr, const Ins
         throw ostk::core::error::runtime::Undefined("Frame");
     }
 
-    if ((*this) == (*aFrameSPtr))
+    if ((this == aFrameSPtr.get()) || ((*this) == (*aFrameSPtr)))
     {
         return Transform::Identity(anInstant);
     }
 
     const Shared<const Frame> thisSPtr = this->shared_from_this();
 
-    if (auto transformPtr = FrameManager::Get().accessCachedTransform(thisSPtr, aFrameSPtr, anInstant))
+    const Transform cachedTransform = FrameManager::Get().getCachedTransform(thisSPtr, aFrameSPtr, anInstant);
+
+    if (cachedTransform.isDefined())
     {
-        return *transformPtr;
+        return cachedTransform;
     }
 
-    // Find common ancestor
+    // Resolve provider chain, once per frame pair
 
-    const Shared<const Frame> commonAncestorSPtr = Frame::FindCommonAncestor(thisSPtr, aFrameSPtr);
-
-    if ((commonAncestorSPtr == nullptr) || (!commonAncestorSPtr->isDefined()))
-    {
-        throw ostk::core::error::RuntimeError(
-            "No common ancestor between [{}] and [{}].", this->getName(), aFrameSPtr->getName()
-        );
-    }
+    const Shared<const FrameManager::ProviderChain> providerChainSPtr = AccessProviderChain(thisSPtr, aFrameSPtr);
 
     // Compute transform from common ancestor to origin
 
     Transform transform_origin_common = Transform::Identity(anInstant);
 
-    for (auto framePtr = this; framePtr != commonAncestorSPtr.get(); framePtr = framePtr->accessParent().get())
+    for (const Shared<const Provider>& providerSPtr : providerChainSPtr->originProviders)
     {
-        transform_origin_common *= framePtr->accessProvider()->getTransformAt(anInstant);
+        transform_origin_common *= providerSPtr->getTransformAt(anInstant);
     }
 
     // Compute transform from destination to common ancestor
 
     Transform transform_destination_common = Transform::Identity(anInstant);
 
-    for (auto framePtr = aFrameSPtr.get(); framePtr != commonAncestorSPtr.get();
-         framePtr = framePtr->accessParent().get())
+    for (const Shared<const Provider>& providerSPtr : providerChainSPtr->destinationProviders)
     {
-        transform_destination_common *= framePtr->accessProvider()->getTransformAt(anInstant);
+        transform_destination_common *= providerSPtr->getTransformAt(anInstant);
     }
 
     // Compute transform from origin to destination
@@ -288,6 +414,79 @@ Transform Frame::getTransformTo(const Shared<const Frame>& aFrameSPtr, const Ins
     return transform_destination_origin;
 }
 
+Array<Transform> Frame::getTransformsTo(
+    const Shared<const Frame>& aFrameSPtr, const Array<Instant>& anInstantArray, const Size& aThreadCount
+) const
+{
+    if ((!this->isDefined()) || (aFrameSPtr == nullptr) || (!aFrameSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    for (const Instant& instant : anInstantArray)
+    {
+        if (!instant.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Instant");
+        }
+    }
+
+    Array<Transform> transforms = Array<Transform>::Empty();
+    transforms.reserve(anInstantArray.getSize());
+
+    if ((this == aFrameSPtr.get()) || ((*this) == (*aFrameSPtr)))
+    {
+        for (const Instant& instant : anInstantArray)
+        {
+            transforms.add(Transform::Identity(instant));
+        }
+
+        return transforms;
+    }
+
+    const Shared<const FrameManager::ProviderChain> providerChainSPtr =
+        AccessProviderChain(this->shared_from_this(), aFrameSPtr);
+
+    transforms.resize(anInstantArray.getSize(), Transform::Undefined());
+
+    const Size threadCount = std::max<Size>(1, std::min<Size>(aThreadCount, anInstantArray.getSize()));
+
+    if (threadCount == 1)
+    {
+        ComputeTransforms(*providerChainSPtr, anInstantArray, 0, anInstantArray.getSize(), transforms);
+
+        return transforms;
+    }
+
+    // Split instants into contiguous chunks, each thread writing to its own range of the output
+
+    const Size chunkSize = (anInstantArray.getSize() + threadCount - 1) / threadCount;
+
+    Array<std::future<void>> futures = Array<std::future<void>>::Empty();
+
+    for (Index beginIndex = 0; beginIndex < anInstantArray.getSize(); beginIndex += chunkSize)
+    {
+        const Index endIndex = std::min<Index>(beginIndex + chunkSize, anInstantArray.getSize());
+
+        futures.add(std::async(
+            std::launch::async,
+            ComputeTransforms,
+            std::cref(*providerChainSPtr),
+            std::cref(anInstantArray),
+            beginIndex,
+            endIndex,
+            std::ref(transforms)
+        ));
+    }
+
+    for (std::future<void>& future : futures)
+    {
+        future.get();
+    }
+
+    return transforms;
+}
+
 Shared<const Frame> Frame::Undefined()
 {
     return std::make_shared<const SharedFrameEnabler>(String::Empty(), false, nullptr, nullptr);
@@ -448,6 +647,7 @@ Frame::Frame(
     const Shared<const Provider>& aProvider
 )
     : std::enable_shared_from_this<ostk::physics::coordinate::Frame>(),
+      id_(NextFrameId.fetch_add(1, std::memory_order_relaxed)),
       name_(aName),
       quasiInertial_(isQuasiInertial),
       parentFrameSPtr_(aParentFrame),
@@ -496,29 +696,6 @@ Shared<const Frame> Frame::Emplace(
     return frameSPtr;
 }
 
-Shared<const Frame> Frame::FindCommonAncestor(
-    const Shared<const Frame>& aFirstFrameSPtr, const Shared<const Frame>& aSecondFrameSPtr
-)
-{
-    const Uint8 firstFrameDepth = aFirstFrameSPtr->getDepth();
-    const Uint8 secondFrameDepth = aSecondFrameSPtr->getDepth();
-
-    Shared<const Frame> currentFSPtr = (firstFrameDepth > secondFrameDepth)
-                                         ? aFirstFrameSPtr->accessAncestor(firstFrameDepth - secondFrameDepth)
-                                         : aFirstFrameSPtr;
-    Shared<const Frame> currentTSPtr = (firstFrameDepth > secondFrameDepth)
-                                         ? aSecondFrameSPtr
-                                         : aSecondFrameSPtr->accessAncestor(secondFrameDepth - firstFrameDepth);
-
-    while ((*currentFSPtr) != (*currentTSPtr))
-    {
-        currentFSPtr = currentFSPtr->accessParent();
-        currentTSPtr = currentTSPtr->accessParent();
-    }
-
-    return currentFSPtr;
-}
-
 }  // namespace coordinate
 }  // namespace physics
 }  // namespace ostk
@@ -1,5 +1,10 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <string>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
@@ -14,20 +19,23 @@ namespace coordinate
 namespace frame
 {
 
+using FrameMap = Map<String, Shared<const Frame>>;
+using ProviderChainMap = Map<Size, Map<Size, Shared<const Manager::ProviderChain>>>;
+
 bool Manager::hasFrameWithName(const String& aFrameName) const
 {
-    const std::lock_guard<std::mutex> lock {mutex_};
+    const Shared<const FrameMap> frameMapSPtr = frameMapSPtr_.load();
 
-    return frameMap_.find(aFrameName) != frameMap_.end();
+    return frameMapSPtr->find(aFrameName) != frameMapSPtr->end();
 }
 
 Shared<const Frame> Manager::accessFrameWithName(const String& aFrameName) const
 {
-    const std::lock_guard<std::mutex> lock {mutex_};
+    const Shared<const FrameMap> frameMapSPtr = frameMapSPtr_.load();
 
-    const auto frameMapIt = frameMap_.find(aFrameName);
+    const auto frameMapIt = frameMapSPtr->find(aFrameName);
 
-    if (frameMapIt != frameMap_.end())
+    if (frameMapIt != frameMapSPtr->end())
     {
         return frameMapIt->second;
     }
@@ -37,17 +45,58 @@ Shared<const Frame> Manager::accessFrameWithName(const String& aFrameName) const
     return nullptr;
 }
 
-const Transform* Manager::accessCachedTransform(
+Shared<const Manager::ProviderChain> Manager::accessProviderChain(
+    const Shared<const Frame>& aFromFrameSPtr, const Shared<const Frame>& aToFrameSPtr
+) const
+{
+    if ((aFromFrameSPtr == nullptr) || (aToFrameSPtr == nullptr))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    const Shared<const ProviderChainMap> providerChainMapSPtr = providerChainMapSPtr_.load();
+
+    const auto providerChainFromFrameIt = providerChainMapSPtr->find(aFromFrameSPtr->getId());
+
+    if (providerChainFromFrameIt != providerChainMapSPtr->end())
+    {
+        const auto providerChainToFrameIt = providerChainFromFrameIt->second.find(aToFrameSPtr->getId());
+
+        if (providerChainToFrameIt != providerChainFromFrameIt->second.end())
+        {
+            return providerChainToFrameIt->second;
+        }
+    }
+
+    return nullptr;
+}
+
+Transform Manager::getCachedTransform(
     const Shared<const Frame>& aFromFrameSPtr, const Shared<const Frame>& aToFrameSPtr, const Instant& anInstant
 ) const
 {
-    const std::lock_guard<std::mutex> lock {mutex_};
+    if ((aFromFrameSPtr == nullptr) || (aToFrameSPtr == nullptr))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    if (!transformCacheEnabled_.load(std::memory_order_relaxed))
+    {
+        return Transform::Undefined();
+    }
 
-    const auto transformCacheFromFrameIt = transformCache_.find(aFromFrameSPtr.get());
+    const Size fromFrameId = aFromFrameSPtr->getId();
+    const Size toFrameId = aToFrameSPtr->getId();
 
-    if (transformCacheFromFrameIt != transformCache_.end())
+    const TransformCacheShard& shard = this->accessTransformCacheShard_(fromFrameId, toFrameId, anInstant);
+
+    const std::shared_lock<std::shared_mutex> lock {shard.mutex};
+
+    const auto transformCacheFromFrameIt = shard.index.find(fromFrameId);
+
+    if (transformCacheFromFrameIt != shard.index.end())
     {
-        const auto transformCacheToFrameIt = transformCacheFromFrameIt->second.find(aToFrameSPtr.get());
+        const auto transformCacheToFrameIt = transformCacheFromFrameIt->second.find(toFrameId);
 
         if (transformCacheToFrameIt != transformCacheFromFrameIt->second.end())
         {
@@ -55,12 +104,89 @@ const Transform* Manager::accessCachedTransform(
 
             if (transformCacheInstantIt != transformCacheToFrameIt->second.end())
             {
-                return &(transformCacheInstantIt->second);
+                const CachedTransform& cachedTransform = shard.entries[transformCacheInstantIt->second];
+
+                cachedTransform.referenced.store(true, std::memory_order_relaxed);
+
+                shard.hitCount.fetch_add(1, std::memory_order_relaxed);
+
+                return cachedTransform.transform;
             }
         }
     }
 
-    return nullptr;
+    shard.missCount.fetch_add(1, std::memory_order_relaxed);
+
+    return Transform::Undefined();
+}
+
+bool Manager::isTransformCacheEnabled() const
+{
+    return transformCacheEnabled_.load();
+}
+
+Size Manager::getTransformCacheCapacity() const
+{
+    const std::lock_guard<std::mutex> lock {mutex_};
+
+    return transformCacheCapacity_;
+}
+
+Size Manager::getTransformCacheByteBudget() const
+{
+    const std::lock_guard<std::mutex> lock {mutex_};
+
+    return transformCacheByteBudget_;
+}
+
+Size Manager::getTransformCacheSize() const
+{
+    Size size = 0;
+
+    for (const TransformCacheShard& shard : transformCacheShards_)
+    {
+        const std::shared_lock<std::shared_mutex> lock {shard.mutex};
+
+        size += shard.getSize();
+    }
+
+    return size;
+}
+
+Size Manager::getTransformCacheHitCount() const
+{
+    Size hitCount = 0;
+
+    for (const TransformCacheShard& shard : transformCacheShards_)
+    {
+        hitCount += shard.hitCount.load(std::memory_order_relaxed);
+    }
+
+    return hitCount;
+}
+
+Size Manager::getTransformCacheMissCount() const
+{
+    Size missCount = 0;
+
+    for (const TransformCacheShard& shard : transformCacheShards_)
+    {
+        missCount += shard.missCount.load(std::memory_order_relaxed);
+    }
+
+    return missCount;
+}
+
+Size Manager::getTransformCacheEvictionCount() const
+{
+    Size evictionCount = 0;
+
+    for (const TransformCacheShard& shard : transformCacheShards_)
+    {
+        evictionCount += shard.evictionCount.load(std::memory_order_relaxed);
+    }
+
+    return evictionCount;
 }
 
 void Manager::addFrame(const Shared<const Frame>& aFrameSPtr)
@@ -72,48 +198,79 @@ void Manager::addFrame(const Shared<const Frame>& aFrameSPtr)
 
     const std::lock_guard<std::mutex> lock {mutex_};
 
-    if (frameMap_.find(aFrameSPtr->getName()) == frameMap_.end())
+    const Shared<const FrameMap> frameMapSPtr = frameMapSPtr_.load();
+
+    if (frameMapSPtr->find(aFrameSPtr->getName()) == frameMapSPtr->end())
     {
-        frameMap_.insert({aFrameSPtr->getName(), aFrameSPtr});
+        Shared<FrameMap> newFrameMapSPtr = std::make_shared<FrameMap>(*frameMapSPtr);
+
+        newFrameMapSPtr->insert({aFrameSPtr->getName(), aFrameSPtr});
+
+        frameMapSPtr_.store(newFrameMapSPtr);
     }
 }
 
 void Manager::removeFrameWithName(const String& aFrameName)
 {
+    // Provider chains and cached transforms of the frame stay valid for as long as it is referenced
+
     const std::lock_guard<std::mutex> lock {mutex_};
 
-    const auto frameMapIt = frameMap_.find(aFrameName);
+    const Shared<const FrameMap> frameMapSPtr = frameMapSPtr_.load();
 
-    if (frameMapIt != frameMap_.end())
+    if (frameMapSPtr->find(aFrameName) == frameMapSPtr->end())
     {
-        const Frame* framePtr = frameMapIt->second.get();
+        throw ostk::core::error::RuntimeError("No frame with name [{}].", aFrameName);
+    }
 
-        // Delete related cached transforms
+    Shared<FrameMap> newFrameMapSPtr = std::make_shared<FrameMap>(*frameMapSPtr);
 
-        const auto transformCacheFromFrameIt = transformCache_.find(framePtr);
+    newFrameMapSPtr->erase(aFrameName);
 
-        if (transformCacheFromFrameIt != transformCache_.end())
-        {
-            transformCache_.erase(transformCacheFromFrameIt);
-        }
+    frameMapSPtr_.store(newFrameMapSPtr);
+}
 
-        for (auto& transformCacheIt : transformCache_)
-        {
-            const auto transformCacheToFrameIt = transformCacheIt.second.find(framePtr);
+void Manager::addProviderChain(
+    const Shared<const Frame>& aFromFrameSPtr,
+    const Shared<const Frame>& aToFrameSPtr,
+    const Shared<const ProviderChain>& aProviderChainSPtr
+)
+{
+    if ((aFromFrameSPtr == nullptr) || (aToFrameSPtr == nullptr))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    if (aProviderChainSPtr == nullptr)
+    {
+        throw ostk::core::error::runtime::Undefined("Provider chain");
+    }
+
+    Shared<const ProviderChainMap> previousProviderChainMapSPtr = nullptr;
+
+    {
+        const std::lock_guard<std::mutex> lock {mutex_};
+
+        // Chains of destructed frames are pruned while copying the map, which is required anyway
 
-            if (transformCacheToFrameIt != transformCacheIt.second.end())
+        Shared<ProviderChainMap> newProviderChainMapSPtr = std::make_shared<ProviderChainMap>();
+
+        for (const auto& providerChainFromFrameIt : *providerChainMapSPtr_.load())
+        {
+            for (const auto& providerChainToFrameIt : providerChainFromFrameIt.second)
             {
-                transformCacheIt.second.erase(transformCacheToFrameIt);
+                const Shared<const ProviderChain>& providerChainSPtr = providerChainToFrameIt.second;
+
+                if (!providerChainSPtr->originFrameWPtr.expired() && !providerChainSPtr->destinationFrameWPtr.expired())
+                {
+                    (*newProviderChainMapSPtr)[providerChainFromFrameIt.first].insert(providerChainToFrameIt);
+                }
             }
         }
 
-        // Delete frame
+        (*newProviderChainMapSPtr)[aFromFrameSPtr->getId()][aToFrameSPtr->getId()] = aProviderChainSPtr;
 
-        frameMap_.erase(frameMapIt);
-    }
-    else
-    {
-        throw ostk::core::error::RuntimeError("No frame with name [{}].", aFrameName);
+        previousProviderChainMapSPtr = providerChainMapSPtr_.exchange(newProviderChainMapSPtr);
     }
 }
 
@@ -123,14 +280,104 @@ void Manager::addCachedTransform(
     const Instant& anInstant,
     const Transform& aTransform
 )
+{
+    if ((aFromFrameSPtr == nullptr) || (aToFrameSPtr == nullptr))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    if (!transformCacheEnabled_.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    const Size fromFrameId = aFromFrameSPtr->getId();
+    const Size toFrameId = aToFrameSPtr->getId();
+
+    TransformCacheShard& shard = this->accessTransformCacheShard_(fromFrameId, toFrameId, anInstant);
+
+    const std::unique_lock<std::shared_mutex> lock {shard.mutex};
+
+    if (shard.capacity == 0)
+    {
+        return;
+    }
+
+    const auto transformCacheFromFrameIt = shard.index.find(fromFrameId);
+
+    if (transformCacheFromFrameIt != shard.index.end())
+    {
+        const auto transformCacheToFrameIt = transformCacheFromFrameIt->second.find(toFrameId);
+
+        if ((transformCacheToFrameIt != transformCacheFromFrameIt->second.end()) &&
+            (transformCacheToFrameIt->second.find(anInstant) != transformCacheToFrameIt->second.end()))
+        {
+            return;
+        }
+    }
+
+    const CachedTransform cachedTransform = {fromFrameId, toFrameId, anInstant, aTransform};
+
+    Index slot;
+
+    if (shard.entries.getSize() < shard.capacity)
+    {
+        slot = shard.entries.getSize();
+
+        shard.entries.add(cachedTransform);
+    }
+    else
+    {
+        slot = shard.evict();
+
+        shard.entries[slot] = cachedTransform;
+    }
+
+    shard.index[fromFrameId][toFrameId].insert({anInstant, slot});
+}
+
+void Manager::setTransformCacheEnabled(const bool isEnabled)
 {
     const std::lock_guard<std::mutex> lock {mutex_};
 
-    const auto transformCacheFromFrameIt = transformCache_.insert({aFromFrameSPtr.get(), {}}).first;
-    const auto transformCacheToFrameIt = transformCacheFromFrameIt->second.insert({aToFrameSPtr.get(), {}}).first;
-    const auto transformCacheToInstantIt = transformCacheToFrameIt->second.insert({anInstant, aTransform}).first;
+    transformCacheEnabled_.store(isEnabled);
 
-    (void)transformCacheToInstantIt;
+    if (!isEnabled)
+    {
+        this->resizeTransformCache_(true);
+    }
+}
+
+void Manager::setTransformCacheCapacity(const Size& aCapacity)
+{
+    const std::lock_guard<std::mutex> lock {mutex_};
+
+    transformCacheCapacity_ = aCapacity;
+
+    this->resizeTransformCache_(false);
+}
+
+void Manager::setTransformCacheByteBudget(const Size& aByteBudget)
+{
+    const std::lock_guard<std::mutex> lock {mutex_};
+
+    transformCacheByteBudget_ = aByteBudget;
+
+    this->resizeTransformCache_(false);
+}
+
+void Manager::clearTransformCache()
+{
+    for (TransformCacheShard& shard : transformCacheShards_)
+    {
+        const std::unique_lock<std::shared_mutex> lock {shard.mutex};
+
+        shard.clear();
+
+        shard.hitCount.store(0);
+        shard.missCount.store(0);
+        shard.evictionCount.store(0);
+    }
 }
 
 Manager& Manager::Get()
@@ -140,6 +387,270 @@ Manager& Manager::Get()
     return manager;
 }
 
+Size Manager::DefaultTransformCacheCapacity()
+{
+    static const Size defaultTransformCacheCapacity = OSTK_PHYSICS_COORDINATE_FRAME_MANAGER_TRANSFORM_CACHE_CAPACITY;
+
+    if (const char* capacityString = std::getenv("OSTK_PHYSICS_COORDINATE_FRAME_MANAGER_TRANSFORM_CACHE_CAPACITY"))
+    {
+        try
+        {
+            return static_cast<Size>(std::stoull(capacityString));
+        }
+        catch (const std::exception&)
+        {
+            throw ostk::core::error::runtime::Wrong("Transform cache capacity", capacityString);
+        }
+    }
+
+    return defaultTransformCacheCapacity;
+}
+
+Size Manager::DefaultTransformCacheByteBudget()
+{
+    static const Size defaultTransformCacheByteBudget =
+        OSTK_PHYSICS_COORDINATE_FRAME_MANAGER_TRANSFORM_CACHE_BYTE_BUDGET;
+
+    if (const char* byteBudgetString =
+            std::getenv("OSTK_PHYSICS_COORDINATE_FRAME_MANAGER_TRANSFORM_CACHE_BYTE_BUDGET"))
+    {
+        try
+        {
+            return static_cast<Size>(std::stoull(byteBudgetString));
+        }
+        catch (const std::exception&)
+        {
+            throw ostk::core::error::runtime::Wrong("Transform cache byte budget", byteBudgetString);
+        }
+    }
+
+    return defaultTransformCacheByteBudget;
+}
+
+Size Manager::TransformCacheEntryByteSize()
+{
+    // Slot, plus instant index node (key, value, and red-black tree node overhead)
+
+    return sizeof(CachedTransform) + sizeof(Instant) + sizeof(Index) + 4 * sizeof(void*);
+}
+
+Manager::CachedTransform::CachedTransform(
+    const Size& aFromFrameId, const Size& aToFrameId, const Instant& anInstant, const Transform& aTransform
+)
+    : fromFrameId(aFromFrameId),
+      toFrameId(aToFrameId),
+      instant(anInstant),
+      transform(aTransform),
+      referenced(false)
+{
+}
+
+Manager::CachedTransform::CachedTransform(const CachedTransform& aCachedTransform)
+    : fromFrameId(aCachedTransform.fromFrameId),
+      toFrameId(aCachedTransform.toFrameId),
+      instant(aCachedTransform.instant),
+      transform(aCachedTransform.transform),
+      referenced(aCachedTransform.referenced.load(std::memory_order_relaxed))
+{
+}
+
+Manager::CachedTransform& Manager::CachedTransform::operator=(const CachedTransform& aCachedTransform)
+{
+    if (this != &aCachedTransform)
+    {
+        fromFrameId = aCachedTransform.fromFrameId;
+        toFrameId = aCachedTransform.toFrameId;
+        instant = aCachedTransform.instant;
+        transform = aCachedTransform.transform;
+        referenced.store(aCachedTransform.referenced.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    return *this;
+}
+
+Size Manager::TransformCacheShard::getSize() const
+{
+    return entries.getSize();
+}
+
+Index Manager::TransformCacheShard::evict()
+{
+    // CLOCK: sweep slots, giving referenced ones a second chance
+
+    while (true)
+    {
+        if (hand >= entries.getSize())
+        {
+            hand = 0;
+        }
+
+        CachedTransform& cachedTransform = entries[hand];
+
+        if (cachedTransform.referenced.exchange(false, std::memory_order_relaxed))
+        {
+            hand++;
+
+            continue;
+        }
+
+        const auto transformCacheFromFrameIt = index.find(cachedTransform.fromFrameId);
+        const auto transformCacheToFrameIt = transformCacheFromFrameIt->second.find(cachedTransform.toFrameId);
+
+        transformCacheToFrameIt->second.erase(cachedTransform.instant);
+
+        if (transformCacheToFrameIt->second.empty())
+        {
+            transformCacheFromFrameIt->second.erase(transformCacheToFrameIt);
+
+            if (transformCacheFromFrameIt->second.empty())
+            {
+                index.erase(transformCacheFromFrameIt);
+            }
+        }
+
+        evictionCount.fetch_add(1, std::memory_order_relaxed);
+
+        return hand++;
+    }
+}
+
+void Manager::TransformCacheShard::shrink()
+{
+    if (entries.getSize() <= capacity)
+    {
+        return;
+    }
+
+    // CLOCK: sweep slots from the hand, giving referenced ones a second chance, until down to capacity
+
+    Array<bool> isEvicted = Array<bool>::Empty();
+    isEvicted.resize(entries.getSize(), false);
+
+    Size remainingEvictionCount = entries.getSize() - capacity;
+
+    while (remainingEvictionCount > 0)
+    {
+        if (hand >= entries.getSize())
+        {
+            hand = 0;
+        }
+
+        if (!isEvicted[hand] && !entries[hand].referenced.exchange(false, std::memory_order_relaxed))
+        {
+            isEvicted[hand] = true;
+            remainingEvictionCount--;
+
+            evictionCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        hand++;
+    }
+
+    // Compact surviving entries, and re-index them
+
+    Array<CachedTransform> survivingEntries = Array<CachedTransform>::Empty();
+    survivingEntries.reserve(capacity);
+
+    index.clear();
+
+    for (Index slot = 0; slot < entries.getSize(); ++slot)
+    {
+        if (!isEvicted[slot])
+        {
+            const CachedTransform& cachedTransform = entries[slot];
+
+            index[cachedTransform.fromFrameId][cachedTransform.toFrameId].insert(
+                {cachedTransform.instant, survivingEntries.getSize()}
+            );
+
+            survivingEntries.add(cachedTransform);
+        }
+    }
+
+    entries = survivingEntries;
+    hand = 0;
+}
+
+void Manager::TransformCacheShard::clear()
+{
+    index.clear();
+    entries.clear();
+    hand = 0;
+}
+
+Manager::Manager()
+    : frameMapSPtr_(std::make_shared<const FrameMap>()),
+      providerChainMapSPtr_(std::make_shared<const ProviderChainMap>()),
+      transformCacheShards_(),
+      transformCacheEnabled_(true),
+      transformCacheActiveShardCount_(1),
+      transformCacheCapacity_(Manager::DefaultTransformCacheCapacity()),
+      transformCacheByteBudget_(Manager::DefaultTransformCacheByteBudget())
+{
+    this->resizeTransformCache_(true);
+}
+
+Manager::~Manager() {}
+
+void Manager::resizeTransformCache_(const bool isFlushRequired)
+{
+    const Size capacity =
+        std::min(transformCacheCapacity_, transformCacheByteBudget_ / Manager::TransformCacheEntryByteSize());
+
+    // Small caches use fewer shards, so that the overall capacity is honored
+
+    const Size activeShardCount = std::max<Size>(1, std::min(TransformCacheShardCount, capacity));
+    const Size shardCapacity = capacity / activeShardCount;
+
+    const bool isShardCountChanged = (activeShardCount != transformCacheActiveShardCount_.load());
+
+    for (Index shardIndex = 0; shardIndex < TransformCacheShardCount; ++shardIndex)
+    {
+        TransformCacheShard& shard = transformCacheShards_[shardIndex];
+
+        const std::unique_lock<std::shared_mutex> lock {shard.mutex};
+
+        shard.capacity = (shardIndex < activeShardCount) ? shardCapacity : 0;
+
+        // Entries are spread by shard count: changing it moves them to other shards, so they are flushed instead
+
+        if (isFlushRequired || isShardCountChanged)
+        {
+            shard.clear();
+        }
+        else
+        {
+            shard.shrink();
+        }
+    }
+
+    transformCacheActiveShardCount_.store(activeShardCount);
+}
+
+const Manager::TransformCacheShard& Manager::accessTransformCacheShard_(
+    const Size& aFromFrameId, const Size& aToFrameId, const Instant& anInstant
+) const
+{
+    // The instant is hashed as stored, without scale conversion: equal instants expressed in different scales may use
+    // different shards, and then simply be cached twice
+
+    Size hash = std::hash<Size> {}(aFromFrameId);
+
+    hash ^= std::hash<Size> {}(aToFrameId) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= anInstant.getRepresentationHash() + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+
+    return transformCacheShards_[hash % transformCacheActiveShardCount_.load(std::memory_order_relaxed)];
+}
+
+Manager::TransformCacheShard& Manager::accessTransformCacheShard_(
+    const Size& aFromFrameId, const Size& aToFrameId, const Instant& anInstant
+)
+{
+    return const_cast<TransformCacheShard&>(
+        static_cast<const Manager*>(this)->accessTransformCacheShard_(aFromFrameId, aToFrameId, anInstant)
+    );
+}
+
 }  // namespace frame
 }  // namespace coordinate
 }  // namespace physics
@@ -27,7 +27,15 @@ namespace frame
 namespace provider
 {
 
-CIRF::CIRF() {}
+CIRF::CIRF()
+    : earthOrientationTableSPtr_(nullptr)
+{
+}
+
+CIRF::CIRF(const Shared<const EarthOrientationTable>& anEarthOrientationTableSPtr)
+    : earthOrientationTableSPtr_(anEarthOrientationTableSPtr)
+{
+}
 
 CIRF::~CIRF() {}
 
@@ -38,11 +46,13 @@ CIRF* CIRF::clone() const
 
 bool CIRF::isDefined() const
 {
-    return true;
+    return (earthOrientationTableSPtr_ == nullptr) || earthOrientationTableSPtr_->isDefined();
 }
 
 Transform CIRF::getTransformAt(const Instant& anInstant) const
 {
+    using ostk::core::container::Pair;
+
     using ostk::mathematics::geometry::d3::transformation::rotation::RotationMatrix;
 
     using ostk::physics::time::Scale;
@@ -60,18 +70,29 @@ Transform CIRF::getTransformAt(const Instant& anInstant) const
 
     // http://www.iausofa.org/2018_0130_C/sofa/sofa_pn_c.pdf
 
-    // Time (TT)
-
-    static const Real djmjd0 = 2400000.5;
-    const Real tt = anInstant.getDateTime(Scale::TT).getModifiedJulianDate();
-
     // CIP and CIO, IAU 2006/2000A
 
     double x;
     double y;
     double s;
 
-    iauXys06a(djmjd0, tt, &x, &y, &s);
+    if ((earthOrientationTableSPtr_ != nullptr) && earthOrientationTableSPtr_->covers(anInstant))
+    {
+        const Vector3d xys = earthOrientationTableSPtr_->getCipCoordinatesAt(anInstant);
+
+        x = xys.x();
+        y = xys.y();
+        s = xys.z();
+    }
+    else
+    {
+        // Time (TT)
+
+        static const Real djmjd0 = 2400000.5;
+        const Pair<Real, Real> tt = anInstant.getModifiedJulianDateParts(Scale::TT);
+
+        iauXys06a(djmjd0 + tt.first, tt.second, &x, &y, &s);
+    }
 
     // CIP offsets wrt IAU 2006/2000A (mas->radians)
 
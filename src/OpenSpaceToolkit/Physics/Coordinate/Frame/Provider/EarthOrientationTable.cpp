@@ -0,0 +1,413 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/EarthOrientationTable.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/Manager.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+// Include sofa last to avoid type errors in underlying Eigen lib
+#include <sofa/sofa.h>
+
+#define OSTK_PHYSICS_COORDINATE_FRAME_PROVIDER_EARTH_ORIENTATION_TABLE_CHEBYSHEV_DEGREE 7
+#define OSTK_PHYSICS_COORDINATE_FRAME_PROVIDER_EARTH_ORIENTATION_TABLE_RATE_STEP 60.0  // [s]
+
+using IersManager = ostk::physics::coordinate::frame::provider::iers::Manager;
+
+namespace ostk
+{
+namespace physics
+{
+namespace coordinate
+{
+namespace frame
+{
+namespace provider
+{
+
+namespace
+{
+
+constexpr Size ChebyshevNodeCount = OSTK_PHYSICS_COORDINATE_FRAME_PROVIDER_EARTH_ORIENTATION_TABLE_CHEBYSHEV_DEGREE + 1;
+
+// Exact model: CIP X, Y and CIO locator s [rad] (IAU 2006/2000A), polar motion xp, yp [asec] (IERS)
+
+void SampleAt(const Instant& anInstant, double (&aChannelArray)[5])
+{
+    using ostk::core::container::Pair;
+    using ostk::core::type::Real;
+
+    using ostk::physics::time::Scale;
+
+    static const double djmjd0 = 2400000.5;
+    const Pair<Real, Real> tt = anInstant.getModifiedJulianDateParts(Scale::TT);
+
+    iauXys06a(
+        djmjd0 + static_cast<double>(tt.first), tt.second, &aChannelArray[0], &aChannelArray[1], &aChannelArray[2]
+    );
+
+    const Vector2d polarMotion = IersManager::Get().getPolarMotionAt(anInstant);
+
+    aChannelArray[3] = polarMotion.x();
+    aChannelArray[4] = polarMotion.y();
+}
+
+}  // namespace
+
+EarthOrientationTable::EarthOrientationTable(
+    const Interval& anInterval, const Duration& aStep, const EarthOrientationTable::Interpolation& anInterpolation
+)
+    : interval_(anInterval),
+      step_(aStep),
+      interpolation_(anInterpolation),
+      stepSeconds_(0.0),
+      segmentCount_(0),
+      coefficientCount_(0),
+      coefficients_(Array<double>::Empty()),
+      cipAccuracy_(Real::Undefined()),
+      polarMotionAccuracy_(Real::Undefined())
+{
+    if ((!interval_.isDefined()) || (!step_.isDefined()))
+    {
+        return;
+    }
+
+    if (!step_.isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Step");
+    }
+
+    stepSeconds_ = step_.inSeconds();
+    segmentCount_ = std::max<Size>(1, std::ceil(interval_.getDuration().inSeconds() / stepSeconds_));
+
+    const Instant& startInstant = interval_.accessStart();
+
+    const auto segmentStartAt = [&startInstant, this](const Size aSegmentIndex) -> Instant
+    {
+        return startInstant + Duration::Seconds(static_cast<double>(aSegmentIndex) * stepSeconds_);
+    };
+
+    double channels[ChannelCount];
+
+    switch (interpolation_)
+    {
+        case EarthOrientationTable::Interpolation::Hermite:
+        {
+            // Per segment and channel: value and scaled rate at both ends
+
+            coefficientCount_ = 4;
+            coefficients_.resize(segmentCount_ * ChannelCount * coefficientCount_);
+
+            static const double rateStep = OSTK_PHYSICS_COORDINATE_FRAME_PROVIDER_EARTH_ORIENTATION_TABLE_RATE_STEP;
+
+            double previousValues[ChannelCount];
+            double previousRates[ChannelCount];
+
+            for (Size nodeIndex = 0; nodeIndex <= segmentCount_; ++nodeIndex)
+            {
+                const Instant nodeInstant = segmentStartAt(nodeIndex);
+
+                double values[ChannelCount];
+                double forwardValues[ChannelCount];
+                double backwardValues[ChannelCount];
+
+                SampleAt(nodeInstant, values);
+                SampleAt(nodeInstant + Duration::Seconds(rateStep), forwardValues);
+                SampleAt(nodeInstant - Duration::Seconds(rateStep), backwardValues);
+
+                double rates[ChannelCount];
+
+                for (Size channelIndex = 0; channelIndex < ChannelCount; ++channelIndex)
+                {
+                    rates[channelIndex] =
+                        stepSeconds_ * (forwardValues[channelIndex] - backwardValues[channelIndex]) / (2.0 * rateStep);
+                }
+
+                if (nodeIndex > 0)
+                {
+                    double* coefficients = &coefficients_[(nodeIndex - 1) * ChannelCount * coefficientCount_];
+
+                    for (Size channelIndex = 0; channelIndex < ChannelCount; ++channelIndex)
+                    {
+                        coefficients[channelIndex * coefficientCount_ + 0] = previousValues[channelIndex];
+                        coefficients[channelIndex * coefficientCount_ + 1] = previousRates[channelIndex];
+                        coefficients[channelIndex * coefficientCount_ + 2] = values[channelIndex];
+                        coefficients[channelIndex * coefficientCount_ + 3] = rates[channelIndex];
+                    }
+                }
+
+                std::copy(std::begin(values), std::end(values), std::begin(previousValues));
+                std::copy(std::begin(rates), std::end(rates), std::begin(previousRates));
+            }
+
+            break;
+        }
+
+        case EarthOrientationTable::Interpolation::Chebyshev:
+        {
+            // Per segment and channel: Chebyshev coefficients, fitted on Chebyshev nodes of the segment
+
+            coefficientCount_ = ChebyshevNodeCount;
+            coefficients_.resize(segmentCount_ * ChannelCount * coefficientCount_);
+
+            double nodeValues[ChebyshevNodeCount][ChannelCount];
+
+            for (Size segmentIndex = 0; segmentIndex < segmentCount_; ++segmentIndex)
+            {
+                const Instant segmentStartInstant = segmentStartAt(segmentIndex);
+
+                for (Size nodeIndex = 0; nodeIndex < ChebyshevNodeCount; ++nodeIndex)
+                {
+                    const double tau = std::cos(M_PI * (nodeIndex + 0.5) / ChebyshevNodeCount);
+
+                    SampleAt(
+                        segmentStartInstant + Duration::Seconds(0.5 * (tau + 1.0) * stepSeconds_), nodeValues[nodeIndex]
+                    );
+                }
+
+                double* coefficients = &coefficients_[segmentIndex * ChannelCount * coefficientCount_];
+
+                for (Size channelIndex = 0; channelIndex < ChannelCount; ++channelIndex)
+                {
+                    for (Size degree = 0; degree < ChebyshevNodeCount; ++degree)
+                    {
+                        double coefficient = 0.0;
+
+                        for (Size nodeIndex = 0; nodeIndex < ChebyshevNodeCount; ++nodeIndex)
+                        {
+                            coefficient += nodeValues[nodeIndex][channelIndex] *
+                                           std::cos(M_PI * degree * (nodeIndex + 0.5) / ChebyshevNodeCount);
+                        }
+
+                        coefficients[channelIndex * coefficientCount_ + degree] =
+                            coefficient * (degree == 0 ? 1.0 : 2.0) / ChebyshevNodeCount;
+                    }
+                }
+            }
+
+            break;
+        }
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Interpolation");
+    }
+
+    // Estimate interpolation error at segment midpoints
+
+    double cipAccuracy = 0.0;
+    double polarMotionAccuracy = 0.0;
+
+    for (Size segmentIndex = 0; segmentIndex < segmentCount_; ++segmentIndex)
+    {
+        const Instant midpointInstant = segmentStartAt(segmentIndex) + Duration::Seconds(0.5 * stepSeconds_);
+
+        double interpolatedChannels[ChannelCount];
+
+        SampleAt(midpointInstant, channels);
+        this->evaluateAt_(midpointInstant, interpolatedChannels);
+
+        for (Size channelIndex = 0; channelIndex < 3; ++channelIndex)
+        {
+            cipAccuracy = std::max(cipAccuracy, std::abs(interpolatedChannels[channelIndex] - channels[channelIndex]));
+        }
+
+        for (Size channelIndex = 3; channelIndex < ChannelCount; ++channelIndex)
+        {
+            polarMotionAccuracy =
+                std::max(polarMotionAccuracy, std::abs(interpolatedChannels[channelIndex] - channels[channelIndex]));
+        }
+    }
+
+    cipAccuracy_ = cipAccuracy;
+    polarMotionAccuracy_ = polarMotionAccuracy;
+}
+
+bool EarthOrientationTable::isDefined() const
+{
+    return interval_.isDefined() && step_.isDefined() && (segmentCount_ > 0);
+}
+
+bool EarthOrientationTable::covers(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Earth orientation table");
+    }
+
+    return (anInstant >= interval_.accessStart()) && (anInstant <= interval_.accessEnd());
+}
+
+const Interval& EarthOrientationTable::accessInterval() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Earth orientation table");
+    }
+
+    return interval_;
+}
+
+Duration EarthOrientationTable::getStep() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Earth orientation table");
+    }
+
+    return step_;
+}
+
+EarthOrientationTable::Interpolation EarthOrientationTable::getInterpolation() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Earth orientation table");
+    }
+
+    return interpolation_;
+}
+
+Real EarthOrientationTable::getCipAccuracy() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Earth orientation table");
+    }
+
+    return cipAccuracy_;
+}
+
+Real EarthOrientationTable::getPolarMotionAccuracy() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Earth orientation table");
+    }
+
+    return polarMotionAccuracy_;
+}
+
+Vector3d EarthOrientationTable::getCipCoordinatesAt(const Instant& anInstant) const
+{
+    if (!this->covers(anInstant))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Instant [{}] is outside of table interval [{}].", anInstant.toString(), interval_.toString()
+        );
+    }
+
+    double channels[ChannelCount];
+
+    this->evaluateAt_(anInstant, channels);
+
+    return {channels[0], channels[1], channels[2]};
+}
+
+Vector2d EarthOrientationTable::getPolarMotionAt(const Instant& anInstant) const
+{
+    if (!this->covers(anInstant))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Instant [{}] is outside of table interval [{}].", anInstant.toString(), interval_.toString()
+        );
+    }
+
+    double channels[ChannelCount];
+
+    this->evaluateAt_(anInstant, channels);
+
+    return {channels[3], channels[4]};
+}
+
+EarthOrientationTable EarthOrientationTable::Undefined()
+{
+    return {Interval::Undefined(), Duration::Undefined(), EarthOrientationTable::Interpolation::Chebyshev};
+}
+
+String EarthOrientationTable::StringFromInterpolation(const EarthOrientationTable::Interpolation& anInterpolation)
+{
+    switch (anInterpolation)
+    {
+        case EarthOrientationTable::Interpolation::Hermite:
+            return "Hermite";
+
+        case EarthOrientationTable::Interpolation::Chebyshev:
+            return "Chebyshev";
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Interpolation");
+    }
+
+    return String::Empty();
+}
+
+void EarthOrientationTable::evaluateAt_(const Instant& anInstant, double (&aChannelArray)[ChannelCount]) const
+{
+    const double elapsedSeconds = (anInstant - interval_.accessStart()).inSeconds();
+
+    const Size segmentIndex =
+        (elapsedSeconds <= 0.0) ? 0 : std::min<Size>(elapsedSeconds / stepSeconds_, segmentCount_ - 1);
+
+    const double u = (elapsedSeconds - static_cast<double>(segmentIndex) * stepSeconds_) / stepSeconds_;  // [0, 1]
+
+    const double* coefficients = &coefficients_[segmentIndex * ChannelCount * coefficientCount_];
+
+    if (interpolation_ == EarthOrientationTable::Interpolation::Hermite)
+    {
+        const double u2 = u * u;
+        const double u3 = u2 * u;
+
+        const double h00 = 2.0 * u3 - 3.0 * u2 + 1.0;
+        const double h10 = u3 - 2.0 * u2 + u;
+        const double h01 = -2.0 * u3 + 3.0 * u2;
+        const double h11 = u3 - u2;
+
+        for (Size channelIndex = 0; channelIndex < ChannelCount; ++channelIndex)
+        {
+            const double* channelCoefficients = &coefficients[channelIndex * coefficientCount_];
+
+            aChannelArray[channelIndex] = h00 * channelCoefficients[0] + h10 * channelCoefficients[1] +
+                                          h01 * channelCoefficients[2] + h11 * channelCoefficients[3];
+        }
+
+        return;
+    }
+
+    // Clenshaw recurrence
+
+    const double tau = 2.0 * u - 1.0;
+
+    for (Size channelIndex = 0; channelIndex < ChannelCount; ++channelIndex)
+    {
+        const double* channelCoefficients = &coefficients[channelIndex * coefficientCount_];
+
+        double b1 = 0.0;
+        double b2 = 0.0;
+
+        for (Size degree = coefficientCount_ - 1; degree > 0; --degree)
+        {
+            const double b0 = 2.0 * tau * b1 - b2 + channelCoefficients[degree];
+
+            b2 = b1;
+            b1 = b0;
+        }
+
+        aChannelArray[channelIndex] = tau * b1 - b2 + channelCoefficients[0];
+    }
+}
+
+}  // namespace provider
+}  // namespace frame
+}  // namespace coordinate
+}  // namespace physics
+}  // namespace ostk
@@ -28,6 +28,63 @@ namespace iers
 
 using ostk::physics::data::utilities::getFileModifiedInstant;
 
+namespace
+{
+
+/// @brief                      Build EOP table from daily records
+///
+///                             Missing days are left undefined. When extrapolating, one more day is linearly
+///                             extrapolated from the last two records.
+
+template <class Record>
+EOPTable TableFromRecords(const Map<Integer, Record>& aRecordMap, const bool isExtrapolated)
+{
+    using ostk::core::type::Index;
+    using ostk::core::type::Size;
+    using ostk::core::container::Array;
+
+    const Integer firstMjd = aRecordMap.begin()->first;
+    const Integer lastMjd = aRecordMap.rbegin()->first;
+
+    const Size recordDayCount = static_cast<Size>(static_cast<Integer::ValueType>(lastMjd - firstMjd)) + 1;
+    const Size dayCount = recordDayCount + ((isExtrapolated && (recordDayCount > 1)) ? 1 : 0);
+
+    Array<Real> xArray = Array<Real>::Empty();
+    Array<Real> yArray = Array<Real>::Empty();
+    Array<Real> ut1MinusUtcArray = Array<Real>::Empty();
+
+    xArray.resize(dayCount, Real::Undefined());
+    yArray.resize(dayCount, Real::Undefined());
+    ut1MinusUtcArray.resize(dayCount, Real::Undefined());
+
+    for (const auto& recordIt : aRecordMap)
+    {
+        const Index index = static_cast<Index>(static_cast<Integer::ValueType>(recordIt.first - firstMjd));
+
+        xArray[index] = recordIt.second.x;
+        yArray[index] = recordIt.second.y;
+        ut1MinusUtcArray[index] = recordIt.second.ut1MinusUtc;
+    }
+
+    if (dayCount > recordDayCount)
+    {
+        for (Array<Real>* arrayPtr : {&xArray, &yArray, &ut1MinusUtcArray})
+        {
+            Array<Real>& values = *arrayPtr;
+
+            if (values[recordDayCount - 2].isDefined() && values[recordDayCount - 1].isDefined())
+            {
+                values[recordDayCount] =
+                    values[recordDayCount - 1] + (values[recordDayCount - 1] - values[recordDayCount - 2]);
+            }
+        }
+    }
+
+    return {firstMjd, xArray, yArray, ut1MinusUtcArray, Array<Real>::Empty()};
+}
+
+}  // namespace
+
 std::ostream& operator<<(std::ostream& anOutputStream, const BulletinA& aBulletinA)
 {
     using ostk::core::type::String;
@@ -165,6 +222,26 @@ const Interval& BulletinA::accessPredictionInterval() const
     return predictionInterval_;
 }
 
+const EOPTable& BulletinA::accessObservationTable() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Bulletin A");
+    }
+
+    return observationTable_;
+}
+
+const EOPTable& BulletinA::accessPredictionTable() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Bulletin A");
+    }
+
+    return predictionTable_;
+}
+
 Date BulletinA::getReleaseDate() const
 {
     return this->accessReleaseDate();
@@ -243,7 +320,8 @@ BulletinA::Observation BulletinA::getObservationAt(const Instant& anInstant) con
             const Integer month = observationIt->second.month;
             const Integer day = observationIt->second.day;
 
-            // [TBI] IERS gazette #13 for more precise interpolation and correction for tidal effects
+            // All fields, errors included, are interpolated linearly: see EOPTable for Lagrange interpolation and
+            // ocean tidal corrections (IERS Gazette #13), as selected through the IERS manager
 
             const Observation observation1 = observation1It->second;
             const Observation observation2 = observation2It->second;
@@ -321,7 +399,8 @@ BulletinA::Prediction BulletinA::getPredictionAt(const Instant& anInstant) const
 
             if (nextPredictionIt != predictions_.end())
             {
-                // [TBI] IERS gazette #13 for more precise interpolation and correction for tidal effects
+                // All fields are interpolated linearly: see EOPTable for Lagrange interpolation and ocean tidal
+                // corrections (IERS Gazette #13), as selected through the IERS manager
 
                 const BulletinA::Prediction& previousPrediction = predictionIt->second;
                 const BulletinA::Prediction& nextPrediction = nextPredictionIt->second;
@@ -568,6 +647,8 @@ BulletinA BulletinA::Load(const filesystem::File& aFile)
 
         bulletin.observationInterval_ =
             Interval(observationStartInstant, observationEndInstant, Interval::Type::HalfOpenRight);
+
+        bulletin.observationTable_ = TableFromRecords(bulletin.observations_, true);
     }
 
     if (!bulletin.predictions_.empty())
@@ -578,6 +659,8 @@ BulletinA BulletinA::Load(const filesystem::File& aFile)
             Instant::ModifiedJulianDate(Real::Integer(bulletin.predictions_.rbegin()->first), Scale::UTC);
 
         bulletin.predictionInterval_ = Interval::Closed(predictionStartInstant, predictionEndInstant);
+
+        bulletin.predictionTable_ = TableFromRecords(bulletin.predictions_, false);
     }
 
     return bulletin;
@@ -590,8 +673,10 @@ BulletinA::BulletinA()
       taiMinusUtcEpoch_(Instant::Undefined()),
       observationInterval_(Interval::Undefined()),
       observations_(Map<Integer, BulletinA::Observation>()),
+      observationTable_(EOPTable::Undefined()),
       predictionInterval_(Interval::Undefined()),
-      predictions_(Map<Integer, BulletinA::Prediction>())
+      predictions_(Map<Integer, BulletinA::Prediction>()),
+      predictionTable_(EOPTable::Undefined())
 {
 }
 
@@ -0,0 +1,419 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/EOPTable.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace coordinate
+{
+namespace frame
+{
+namespace provider
+{
+namespace iers
+{
+
+namespace
+{
+
+struct OceanTidalTerm
+{
+    int multipliers[6];  // Of GMST + pi, l, l', F, D and Omega
+    double xSin;         // [µas]
+    double xCos;         // [µas]
+    double ySin;         // [µas]
+    double yCos;         // [µas]
+};
+
+// Diurnal then semidiurnal terms, from the IERS Gazette #13 PMUT1_OCEANS routine
+
+const OceanTidalTerm OceanTidalTerms[] = {
+    {{1, -1, 0, -2, -2, -2}, -0.05, 0.94, -0.94, -0.05},
+    {{1, -2, 0, -2, 0, -1}, 0.06, 0.64, -0.64, 0.06},
+    {{1, -2, 0, -2, 0, -2}, 0.30, 3.42, -3.42, 0.30},
+    {{1, 0, 0, -2, -2, -1}, 0.08, 0.78, -0.78, 0.08},
+    {{1, 0, 0, -2, -2, -2}, 0.46, 4.15, -4.15, 0.45},
+    {{1, -1, 0, -2, 0, -1}, 1.19, 4.96, -4.96, 1.19},
+    {{1, -1, 0, -2, 0, -2}, 6.24, 26.31, -26.31, 6.23},
+    {{1, 1, 0, -2, -2, -1}, 0.24, 0.94, -0.94, 0.24},
+    {{1, 1, 0, -2, -2, -2}, 1.28, 4.99, -4.99, 1.28},
+    {{1, 0, 0, -2, 0, 0}, -0.28, -0.77, 0.77, -0.28},
+    {{1, 0, 0, -2, 0, -1}, 9.22, 25.06, -25.06, 9.22},
+    {{1, 0, 0, -2, 0, -2}, 48.82, 132.91, -132.90, 48.82},
+    {{1, -2, 0, 0, 0, 0}, -0.32, -0.86, 0.86, -0.32},
+    {{1, 0, 0, 0, -2, 0}, -0.66, -1.72, 1.72, -0.66},
+    {{1, -1, 0, -2, 2, -2}, -0.42, -0.92, 0.92, -0.42},
+    {{1, 1, 0, -2, 0, -1}, -0.30, -0.64, 0.64, -0.30},
+    {{1, 1, 0, -2, 0, -2}, -1.61, -3.46, 3.46, -1.61},
+    {{1, -1, 0, 0, 0, 0}, -4.48, -9.61, 9.61, -4.48},
+    {{1, -1, 0, 0, 0, -1}, -0.90, -1.93, 1.93, -0.90},
+    {{1, 1, 0, 0, -2, 0}, -0.86, -1.81, 1.81, -0.86},
+    {{1, 0, -1, -2, 2, -2}, 1.54, 3.03, -3.03, 1.54},
+    {{1, 0, 0, -2, 2, -1}, -0.29, -0.58, 0.58, -0.29},
+    {{1, 0, 0, -2, 2, -2}, 26.13, 51.25, -51.25, 26.13},
+    {{1, 0, 1, -2, 2, -2}, -0.22, -0.42, 0.42, -0.22},
+    {{1, 0, -1, 0, 0, 0}, -0.61, -1.20, 1.20, -0.61},
+    {{1, 0, 0, 0, 0, 1}, 1.54, 3.00, -3.00, 1.54},
+    {{1, 0, 0, 0, 0, 0}, -77.48, -151.74, 151.74, -77.48},
+    {{1, 0, 0, 0, 0, -1}, -10.52, -20.56, 20.56, -10.52},
+    {{1, 0, 0, 0, 0, -2}, 0.23, 0.44, -0.44, 0.23},
+    {{1, 0, 1, 0, 0, 0}, -0.61, -1.19, 1.19, -0.61},
+    {{1, 0, 0, 2, -2, 2}, -1.09, -2.11, 2.11, -1.09},
+    {{1, -1, 0, 0, 2, 0}, -0.69, -1.43, 1.43, -0.69},
+    {{1, 1, 0, 0, 0, 0}, -3.46, -7.28, 7.28, -3.46},
+    {{1, 1, 0, 0, 0, -1}, -0.69, -1.44, 1.44, -0.69},
+    {{1, 0, 0, 0, 2, 0}, -0.37, -1.06, 1.06, -0.37},
+    {{1, 2, 0, 0, 0, 0}, -0.17, -0.51, 0.51, -0.17},
+    {{1, 0, 0, 2, 0, 2}, -1.10, -3.42, 3.42, -1.09},
+    {{1, 0, 0, 2, 0, 1}, -0.70, -2.19, 2.19, -0.70},
+    {{1, 0, 0, 2, 0, 0}, -0.15, -0.46, 0.46, -0.15},
+    {{1, 1, 0, 2, 0, 2}, -0.03, -0.59, 0.59, -0.03},
+    {{1, 1, 0, 2, 0, 1}, -0.02, -0.38, 0.38, -0.02},
+    {{2, -3, 0, -2, 0, -2}, -0.49, -0.04, 0.63, 0.24},
+    {{2, -1, 0, -2, -2, -2}, -1.33, -0.17, 1.53, 0.68},
+    {{2, -2, 0, -2, 0, -2}, -6.08, -1.61, 3.13, 3.35},
+    {{2, 0, 0, -2, -2, -2}, -7.59, -2.05, 3.44, 4.23},
+    {{2, 0, 1, -2, -2, -2}, -0.52, -0.14, 0.22, 0.29},
+    {{2, -1, -1, -2, 0, -2}, 0.47, 0.11, -0.10, -0.27},
+    {{2, -1, 0, -2, 0, -1}, 2.12, 0.49, -0.41, -1.23},
+    {{2, -1, 0, -2, 0, -2}, -56.87, -12.93, 11.15, 32.88},
+    {{2, -1, 1, -2, 0, -2}, -0.54, -0.12, 0.10, 0.31},
+    {{2, 1, 0, -2, -2, -2}, -11.01, -2.40, 1.89, 6.41},
+    {{2, 1, 1, -2, -2, -2}, -0.51, -0.11, 0.08, 0.30},
+    {{2, -2, 0, -2, 2, -2}, 0.98, 0.11, -0.11, -0.58},
+    {{2, 0, -1, -2, 0, -2}, 1.13, 0.11, -0.13, -0.67},
+    {{2, 0, 0, -2, 0, -1}, 12.32, 1.00, -1.41, -7.31},
+    {{2, 0, 0, -2, 0, -2}, -330.15, -26.96, 37.58, 195.92},
+    {{2, 0, 1, -2, 0, -2}, -1.01, -0.07, 0.11, 0.60},
+    {{2, -1, 0, -2, 2, -2}, 2.47, -0.28, -0.44, -1.48},
+    {{2, 1, 0, -2, 0, -2}, 9.40, -1.44, -1.88, -5.65},
+    {{2, -1, 0, 0, 0, 0}, -2.35, 0.37, 0.47, 1.41},
+    {{2, -1, 0, 0, 0, -1}, -1.04, 0.17, 0.21, 0.62},
+    {{2, 0, -1, -2, 2, -2}, -8.51, 3.50, 3.29, 5.11},
+    {{2, 0, 0, -2, 2, -2}, -144.13, 63.56, 59.23, 86.56},
+    {{2, 0, 1, -2, 2, -2}, 1.19, -0.56, -0.52, -0.72},
+    {{2, 0, 0, 0, 0, 1}, 0.49, -0.25, -0.23, -0.29},
+    {{2, 0, 0, 0, 0, 0}, -38.48, 19.14, 17.72, 23.11},
+    {{2, 0, 0, 0, 0, -1}, -11.44, 5.75, 5.32, 6.87},
+    {{2, 0, 0, 0, 0, -2}, -1.24, 0.63, 0.58, 0.75},
+    {{2, 1, 0, 0, 0, 0}, -1.77, 1.79, 1.71, 1.04},
+    {{2, 1, 0, 0, 0, -1}, -0.77, 0.78, 0.74, 0.46},
+    {{2, 0, 0, 2, 0, 2}, -0.33, 0.62, 0.60, 0.17},
+};
+
+std::vector<double> ValuesFromArray(const Array<Real>& aRealArray, const Size& aSize, const String& aName)
+{
+    if (aRealArray.isEmpty())
+    {
+        return std::vector<double>(aSize, std::numeric_limits<double>::quiet_NaN());
+    }
+
+    if (aRealArray.getSize() != aSize)
+    {
+        throw ostk::core::error::runtime::Wrong(aName);
+    }
+
+    std::vector<double> values;
+    values.reserve(aSize);
+
+    for (const Real& value : aRealArray)
+    {
+        values.push_back(value.isDefined() ? static_cast<double>(value) : std::numeric_limits<double>::quiet_NaN());
+    }
+
+    return values;
+}
+
+}  // namespace
+
+EOPTable::EOPTable(
+    const Integer& aFirstMjd,
+    const Array<Real>& aPolarMotionXArray,
+    const Array<Real>& aPolarMotionYArray,
+    const Array<Real>& aUt1MinusUtcArray,
+    const Array<Real>& aLodArray
+)
+    : firstMjd_(aFirstMjd),
+      polarMotionX_(),
+      polarMotionY_(),
+      ut1MinusUtc_(),
+      lod_()
+{
+    if (!firstMjd_.isDefined())
+    {
+        return;
+    }
+
+    Size size = 0;
+
+    for (const Array<Real>* arrayPtr : {&aPolarMotionXArray, &aPolarMotionYArray, &aUt1MinusUtcArray, &aLodArray})
+    {
+        size = std::max(size, arrayPtr->getSize());
+    }
+
+    polarMotionX_ = ValuesFromArray(aPolarMotionXArray, size, "PM-x array");
+    polarMotionY_ = ValuesFromArray(aPolarMotionYArray, size, "PM-y array");
+    ut1MinusUtc_ = ValuesFromArray(aUt1MinusUtcArray, size, "UT1 - UTC array");
+    lod_ = ValuesFromArray(aLodArray, size, "LOD array");
+}
+
+bool EOPTable::isDefined() const
+{
+    return firstMjd_.isDefined() && (polarMotionX_.size() > 1);
+}
+
+Integer EOPTable::getFirstMjd() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("EOP table");
+    }
+
+    return firstMjd_;
+}
+
+Integer EOPTable::getLastMjd() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("EOP table");
+    }
+
+    return firstMjd_ + static_cast<Integer::ValueType>(polarMotionX_.size() - 1);
+}
+
+Size EOPTable::getSize() const
+{
+    return polarMotionX_.size();
+}
+
+bool EOPTable::covers(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!this->isDefined())
+    {
+        return false;
+    }
+
+    const double elapsedDays = this->getElapsedDays_(anInstant);
+
+    return (elapsedDays >= 0.0) && (elapsedDays <= static_cast<double>(polarMotionX_.size() - 1));
+}
+
+Vector2d EOPTable::getPolarMotionAt(const Instant& anInstant, const EOPTable::Interpolation& anInterpolation) const
+{
+    using ostk::physics::time::Scale;
+
+    if (!this->covers(anInstant))
+    {
+        throw ostk::core::error::RuntimeError("Cannot get polar motion at [{}].", anInstant.toString(Scale::UTC));
+    }
+
+    const double elapsedDays = this->getElapsedDays_(anInstant);
+
+    const double x = EOPTable::Interpolate(polarMotionX_, elapsedDays, anInterpolation, false);
+    const double y = EOPTable::Interpolate(polarMotionY_, elapsedDays, anInterpolation, false);
+
+    if (std::isnan(x) || std::isnan(y))
+    {
+        return Vector2d::Undefined();
+    }
+
+    return {x, y};
+}
+
+Real EOPTable::getUt1MinusUtcAt(const Instant& anInstant, const EOPTable::Interpolation& anInterpolation) const
+{
+    using ostk::physics::time::Scale;
+
+    if (!this->covers(anInstant))
+    {
+        throw ostk::core::error::RuntimeError("Cannot get UT1 - UTC at [{}].", anInstant.toString(Scale::UTC));
+    }
+
+    const double ut1MinusUtc =
+        EOPTable::Interpolate(ut1MinusUtc_, this->getElapsedDays_(anInstant), anInterpolation, true);
+
+    return std::isnan(ut1MinusUtc) ? Real::Undefined() : Real(ut1MinusUtc);
+}
+
+Real EOPTable::getLodAt(const Instant& anInstant, const EOPTable::Interpolation& anInterpolation) const
+{
+    using ostk::physics::time::Scale;
+
+    if (!this->covers(anInstant))
+    {
+        throw ostk::core::error::RuntimeError("Cannot get length of day at [{}].", anInstant.toString(Scale::UTC));
+    }
+
+    const double lod = EOPTable::Interpolate(lod_, this->getElapsedDays_(anInstant), anInterpolation, false);
+
+    return std::isnan(lod) ? Real::Undefined() : Real(lod);
+}
+
+Vector2d EOPTable::OceanTidalPolarMotionCorrectionAt(const Instant& anInstant)
+{
+    using ostk::physics::time::Scale;
+
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    static const double arcsecondsPerRevolution = 1296000.0;
+    static const double radiansPerArcsecond = 2.0 * M_PI / arcsecondsPerRevolution;
+
+    const double t = (static_cast<double>(anInstant.getModifiedJulianDate(Scale::UTC)) - 51544.5) / 36525.0;
+    const double t2 = t * t;
+    const double t3 = t2 * t;
+    const double t4 = t3 * t;
+
+    // Fundamental arguments [asec]: GMST + pi, then the Delaunay arguments (IERS Conventions 2003)
+
+    const double arguments[6] = {
+        (67310.54841 + (876600.0 * 3600.0 + 8640184.812866) * t + 0.093104 * t2 - 6.2e-6 * t3) * 15.0 + 648000.0,
+        485868.249036 + 1717915923.2178 * t + 31.8792 * t2 + 0.051635 * t3 - 0.00024470 * t4,
+        1287104.79305 + 129596581.0481 * t - 0.5532 * t2 + 0.000136 * t3 - 0.00001149 * t4,
+        335779.526232 + 1739527262.8478 * t - 12.7512 * t2 - 0.001037 * t3 + 0.00000417 * t4,
+        1072260.70369 + 1602961601.2090 * t - 6.3706 * t2 + 0.006593 * t3 - 0.00003169 * t4,
+        450160.398036 - 6962890.5431 * t + 7.4722 * t2 + 0.007702 * t3 - 0.00005939 * t4,
+    };
+
+    double fundamentalArguments[6];
+
+    for (Size index = 0; index < 6; ++index)
+    {
+        fundamentalArguments[index] = std::fmod(arguments[index], arcsecondsPerRevolution) * radiansPerArcsecond;
+    }
+
+    double x = 0.0;
+    double y = 0.0;
+
+    for (const OceanTidalTerm& term : OceanTidalTerms)
+    {
+        double argument = 0.0;
+
+        for (Size index = 0; index < 6; ++index)
+        {
+            argument += static_cast<double>(term.multipliers[index]) * fundamentalArguments[index];
+        }
+
+        const double sinArgument = std::sin(argument);
+        const double cosArgument = std::cos(argument);
+
+        x += term.xSin * sinArgument + term.xCos * cosArgument;
+        y += term.ySin * sinArgument + term.yCos * cosArgument;
+    }
+
+    return {x * 1e-6, y * 1e-6};
+}
+
+EOPTable EOPTable::Undefined()
+{
+    return {
+        Integer::Undefined(), Array<Real>::Empty(), Array<Real>::Empty(), Array<Real>::Empty(), Array<Real>::Empty()
+    };
+}
+
+String EOPTable::StringFromInterpolation(const EOPTable::Interpolation& anInterpolation)
+{
+    switch (anInterpolation)
+    {
+        case EOPTable::Interpolation::Linear:
+            return "Linear";
+
+        case EOPTable::Interpolation::Lagrange:
+            return "Lagrange";
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Interpolation");
+    }
+
+    return String::Empty();
+}
+
+double EOPTable::getElapsedDays_(const Instant& anInstant) const
+{
+    using ostk::physics::time::Scale;
+
+    return static_cast<double>(anInstant.getModifiedJulianDate(Scale::UTC)) -
+           static_cast<double>(static_cast<Integer::ValueType>(firstMjd_));
+}
+
+double EOPTable::Interpolate(
+    const std::vector<double>& aValueArray,
+    const double& anElapsedDays,
+    const EOPTable::Interpolation& anInterpolation,
+    const bool isLeapSecondAware
+)
+{
+    const Size size = aValueArray.size();
+    const Size index = std::min(static_cast<Size>(std::floor(anElapsedDays)), size - 2);
+
+    if ((anInterpolation == EOPTable::Interpolation::Linear) || (size < 4))
+    {
+        const double ratio = anElapsedDays - static_cast<double>(index);
+
+        return aValueArray[index] + ratio * (aValueArray[index + 1] - aValueArray[index]);
+    }
+
+    // 4-point Lagrange stencil around [index, index + 1], shifted inwards at the table edges
+
+    const Size firstIndex = std::min(std::max(index, Size(1)) - 1, size - 4);
+
+    double values[4];
+
+    for (Size k = 0; k < 4; ++k)
+    {
+        values[k] = aValueArray[firstIndex + k];
+
+        // UT1 - UTC jumps by 1 s at leap seconds: align samples on the day containing the instant
+
+        if (isLeapSecondAware)
+        {
+            values[k] -= std::round(values[k] - aValueArray[index]);
+        }
+    }
+
+    const double t = anElapsedDays - static_cast<double>(firstIndex);
+
+    double value = 0.0;
+
+    for (Size k = 0; k < 4; ++k)
+    {
+        double weight = 1.0;
+
+        for (Size l = 0; l < 4; ++l)
+        {
+            if (l != k)
+            {
+                weight *= (t - static_cast<double>(l)) / (static_cast<double>(k) - static_cast<double>(l));
+            }
+        }
+
+        value += weight * values[k];
+    }
+
+    return value;
+}
+
+}  // namespace iers
+}  // namespace provider
+}  // namespace frame
+}  // namespace coordinate
+}  // namespace physics
+}  // namespace ostk
@@ -71,10 +71,18 @@ Interval Finals2000A::getInterval() const
     return span_;
 }
 
-Vector2d Finals2000A::getPolarMotionAt(const Instant& anInstant) const
+const EOPTable& Finals2000A::accessTable() const
 {
-    using ostk::physics::time::Scale;
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Finals 2000A");
+    }
+
+    return table_;
+}
 
+Vector2d Finals2000A::getPolarMotionAt(const Instant& anInstant) const
+{
     if (!anInstant.isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Instant");
@@ -85,38 +93,11 @@ Vector2d Finals2000A::getPolarMotionAt(const Instant& anInstant) const
         throw ostk::core::error::runtime::Undefined("Finals 2000A");
     }
 
-    const Pair<const Finals2000A::Data*, const Finals2000A::Data*> dataRange = this->accessDataRange(anInstant);
-
-    if ((dataRange.first != nullptr) && (dataRange.second != nullptr))
-    {
-        const Finals2000A::Data& previousData = *(dataRange.first);
-        const Finals2000A::Data& nextData = *(dataRange.second);
-
-        if (previousData.x_A.isDefined() && previousData.y_A.isDefined() && nextData.x_A.isDefined() &&
-            nextData.y_A.isDefined())
-        {
-            const Real instantMjd_UTC = anInstant.getModifiedJulianDate(Scale::UTC);
-
-            const Real ratio = (instantMjd_UTC - previousData.mjd) / (nextData.mjd - previousData.mjd);
-
-            const Real x_A = previousData.x_A + ratio * (nextData.x_A - previousData.x_A);
-            const Real y_A = previousData.y_A + ratio * (nextData.y_A - previousData.y_A);
-
-            return {x_A, y_A};
-        }
-        else
-        {
-            return Vector2d::Undefined();
-        }
-    }
-
-    throw ostk::core::error::RuntimeError("Cannot get polar motion at [{}].", anInstant.toString(Scale::UTC));
+    return table_.getPolarMotionAt(anInstant);
 }
 
 Real Finals2000A::getUt1MinusUtcAt(const Instant& anInstant) const
 {
-    using ostk::physics::time::Scale;
-
     if (!anInstant.isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Instant");
@@ -127,39 +108,11 @@ Real Finals2000A::getUt1MinusUtcAt(const Instant& anInstant) const
         throw ostk::core::error::runtime::Undefined("Finals 2000A");
     }
 
-    const Pair<const Finals2000A::Data*, const Finals2000A::Data*> dataRange = this->accessDataRange(anInstant);
-
-    if ((dataRange.first != nullptr) && (dataRange.second != nullptr))
-    {
-        const Finals2000A::Data& previousData = *(dataRange.first);
-        const Finals2000A::Data& nextData = *(dataRange.second);
-
-        if (previousData.ut1MinusUtc_A.isDefined() && nextData.ut1MinusUtc_A.isDefined())
-        {
-            const Real instantMjd_UTC = anInstant.getModifiedJulianDate(Scale::UTC);
-
-            const Real ratio = (instantMjd_UTC - previousData.mjd) / (nextData.mjd - previousData.mjd);
-
-            const Real ut1MinusUtc_A =
-                previousData.ut1MinusUtc_A + ratio * (nextData.ut1MinusUtc_A - previousData.ut1MinusUtc_A);
-            // const Real ut1MinusUtc_B = previousData.ut1MinusUtc_B + ratio * (nextData.ut1MinusUtc_B -
-            // previousData.ut1MinusUtc_B) ;
-
-            return ut1MinusUtc_A;
-        }
-        else
-        {
-            return Real::Undefined();
-        }
-    }
-
-    throw ostk::core::error::RuntimeError("Cannot get UT1 - UTC at [{}].", anInstant.toString(Scale::UTC));
+    return table_.getUt1MinusUtcAt(anInstant);
 }
 
 Real Finals2000A::getLodAt(const Instant& anInstant) const
 {
-    using ostk::physics::time::Scale;
-
     if (!anInstant.isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Instant");
@@ -170,30 +123,7 @@ Real Finals2000A::getLodAt(const Instant& anInstant) const
         throw ostk::core::error::runtime::Undefined("Finals 2000A");
     }
 
-    const Pair<const Finals2000A::Data*, const Finals2000A::Data*> dataRange = this->accessDataRange(anInstant);
-
-    if ((dataRange.first != nullptr) && (dataRange.second != nullptr))
-    {
-        const Finals2000A::Data& previousData = *(dataRange.first);
-        const Finals2000A::Data& nextData = *(dataRange.second);
-
-        if (previousData.lod_A.isDefined() && nextData.lod_A.isDefined())
-        {
-            const Real instantMjd_UTC = anInstant.getModifiedJulianDate(Scale::UTC);
-
-            const Real ratio = (instantMjd_UTC - previousData.mjd) / (nextData.mjd - previousData.mjd);
-
-            const Real lod_A = previousData.lod_A + ratio * (nextData.lod_A - previousData.lod_A);
-
-            return lod_A;
-        }
-        else
-        {
-            return Real::Undefined();
-        }
-    }
-
-    throw ostk::core::error::RuntimeError("Cannot get length of day at [{}].", anInstant.toString(Scale::UTC));
+    return table_.getLodAt(anInstant);
 }
 
 Finals2000A::Data Finals2000A::getDataAt(const Instant& anInstant) const
@@ -316,6 +246,7 @@ Finals2000A Finals2000A::Load(const filesystem::File& aFile)
     using ostk::core::type::Uint8;
     using ostk::core::type::Uint16;
     using ostk::core::type::Real;
+    using ostk::core::type::Size;
     using ostk::core::type::String;
     using ostk::core::container::Array;
 
@@ -436,6 +367,34 @@ Finals2000A Finals2000A::Load(const filesystem::File& aFile)
         const Instant endInstant = Instant::ModifiedJulianDate(finals2000a.data_.rbegin()->first, Scale::UTC);
 
         finals2000a.span_ = Interval::Closed(startInstant, endInstant);
+
+        // Daily values, indexed by MJD offset from the first entry (missing days are left undefined)
+
+        const Integer firstMjd = finals2000a.data_.begin()->first.floor();
+        const Integer lastMjd = finals2000a.data_.rbegin()->first.floor();
+        const Size dayCount = static_cast<Size>(static_cast<Integer::ValueType>(lastMjd - firstMjd)) + 1;
+
+        Array<Real> xArray = Array<Real>::Empty();
+        Array<Real> yArray = Array<Real>::Empty();
+        Array<Real> ut1MinusUtcArray = Array<Real>::Empty();
+        Array<Real> lodArray = Array<Real>::Empty();
+
+        xArray.resize(dayCount, Real::Undefined());
+        yArray.resize(dayCount, Real::Undefined());
+        ut1MinusUtcArray.resize(dayCount, Real::Undefined());
+        lodArray.resize(dayCount, Real::Undefined());
+
+        for (const auto& dataIt : finals2000a.data_)
+        {
+            const Index index = static_cast<Index>(static_cast<Integer::ValueType>(dataIt.first.floor() - firstMjd));
+
+            xArray[index] = dataIt.second.x_A;
+            yArray[index] = dataIt.second.y_A;
+            ut1MinusUtcArray[index] = dataIt.second.ut1MinusUtc_A;
+            lodArray[index] = dataIt.second.lod_A;
+        }
+
+        finals2000a.table_ = EOPTable(firstMjd, xArray, yArray, ut1MinusUtcArray, lodArray);
     }
 
     return finals2000a;
@@ -444,7 +403,8 @@ Finals2000A Finals2000A::Load(const filesystem::File& aFile)
 Finals2000A::Finals2000A()
     : lastModifiedTimestamp_(Instant::Undefined()),
       span_(Interval::Undefined()),
-      data_(Map<Real, Finals2000A::Data>())
+      data_(Map<Real, Finals2000A::Data>()),
+      table_(EOPTable::Undefined())
 {
 }
 
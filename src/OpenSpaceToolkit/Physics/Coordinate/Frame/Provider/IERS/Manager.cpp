@@ -3,6 +3,7 @@
 #include <chrono>
 #include <cstdlib>
 #include <fstream>
+#include <memory>
 #include <numeric>
 #include <thread>
 
@@ -18,6 +19,7 @@
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/Manager.hpp>
 #include <OpenSpaceToolkit/Physics/Data/Manager.hpp>
 #include <OpenSpaceToolkit/Physics/Data/Manifest.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DUT1Provider.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Date.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
@@ -54,6 +56,27 @@ const String finals2000AManifestName = "finals-2000A";
 
 const String temporaryDirectoryName = "tmp";
 
+using ostk::physics::time::DUT1Provider;
+
+/// @brief                      Forwards UT1 - UTC queries from Instant to the IERS manager
+
+class IersDUT1Provider : public DUT1Provider
+{
+   public:
+    virtual Real getUt1MinusUtcAt(const Instant& anInstant) const override
+    {
+        return Manager::Get().getUt1MinusUtcAt(anInstant);
+    }
+
+    virtual Size getRevision() const override
+    {
+        return Manager::Get().getRevision();
+    }
+};
+
+static const bool IersDUT1ProviderIsRegistered =
+    (DUT1Provider::Set(std::make_shared<const IersDUT1Provider>()), true);
+
 Manager::Mode Manager::getMode() const
 {
     std::lock_guard<std::mutex> lock {mutex_};
@@ -80,13 +103,11 @@ Directory Manager::getFinals2000ADirectory() const
 
 BulletinA Manager::getBulletinA() const
 {
-    std::lock_guard<std::mutex> lock {mutex_};
-
-    const BulletinA* bulletinAPtr = accessBulletinA_();
+    const Shared<const BulletinA> bulletinASPtr = this->accessBulletinASnapshot_();
 
-    if (bulletinAPtr != nullptr)
+    if (bulletinASPtr != nullptr)
     {
-        return *bulletinAPtr;
+        return *bulletinASPtr;
     }
 
     throw ostk::core::error::RuntimeError("Cannot obtain Bulletin A.");
@@ -94,13 +115,11 @@ BulletinA Manager::getBulletinA() const
 
 Finals2000A Manager::getFinals2000A() const
 {
-    std::lock_guard<std::mutex> lock {mutex_};
-
-    const Finals2000A* finals2000aPtr = accessFinals2000A_();
+    const Shared<const Finals2000A> finals2000aSPtr = this->accessFinals2000ASnapshot_();
 
-    if (finals2000aPtr != nullptr)
+    if (finals2000aSPtr != nullptr)
     {
-        return *finals2000aPtr;
+        return *finals2000aSPtr;
     }
 
     throw ostk::core::error::RuntimeError("Cannot obtain Finals 2000A.");
@@ -113,50 +132,14 @@ Vector2d Manager::getPolarMotionAt(const Instant& anInstant) const
         throw ostk::core::error::runtime::Undefined("Instant");
     }
 
-    std::lock_guard<std::mutex> lock {mutex_};
-
-    // Try data in this order:
-    // 1. Bulletin A rapid service observations (released daily)
-    // 2. Bulletin A predictions (released daily)
-    // 3. Finals 2000A observations (released weekly)
-    //
-    // https://hpiers.obspm.fr/eoppc/bul/bulb/explanatory.html
-
-    const BulletinA* bulletinAPtr = this->accessBulletinA_();
-
-    if (bulletinAPtr != nullptr)
-    {
-        if (bulletinAPtr->accessObservationInterval().contains(anInstant))
-        {
-            const BulletinA::Observation observation = bulletinAPtr->getObservationAt(anInstant);
-
-            return {observation.x, observation.y};
-        }
-        else if (bulletinAPtr->accessPredictionInterval().contains(anInstant))
-        {
-            const BulletinA::Prediction prediction = bulletinAPtr->getPredictionAt(anInstant);
-
-            return {prediction.x, prediction.y};
-        }
-    }
-
-    const Finals2000A* finals2000aPtr = this->accessFinals2000A_();
+    const Vector2d polarMotion = this->getInterpolatedPolarMotionAt_(anInstant);
 
-    if (finals2000aPtr != nullptr)
+    if (!oceanTidalCorrectionEnabled_.load(std::memory_order_relaxed))
     {
-        const Vector2d polarMotion = finals2000aPtr->getPolarMotionAt(anInstant);
-        if (!polarMotion.isDefined())
-        {
-            throw ostk::core::error::RuntimeError(
-                "Cannot obtain polar motion from Finals2000a at [{}].", anInstant.toString()
-            );
-        }
         return polarMotion;
     }
 
-    throw ostk::core::error::RuntimeError("Cannot obtain polar motion at [{}].", anInstant.toString());
-
-    return Vector2d::Undefined();
+    return polarMotion + EOPTable::OceanTidalPolarMotionCorrectionAt(anInstant);
 }
 
 Real Manager::getUt1MinusUtcAt(const Instant& anInstant) const
@@ -166,8 +149,6 @@ Real Manager::getUt1MinusUtcAt(const Instant& anInstant) const
         throw ostk::core::error::runtime::Undefined("Instant");
     }
 
-    std::lock_guard<std::mutex> lock {mutex_};
-
     // Try data in this order:
     // 1. Bulletin A rapid service observations (released daily)
     // 2. Bulletin A predictions (released daily)
@@ -175,29 +156,27 @@ Real Manager::getUt1MinusUtcAt(const Instant& anInstant) const
     //
     // https://hpiers.obspm.fr/eoppc/bul/bulb/explanatory.html
 
-    const BulletinA* bulletinAPtr = this->accessBulletinA_();
+    const EOPTable::Interpolation interpolation = interpolation_.load(std::memory_order_relaxed);
+
+    const Shared<const BulletinA> bulletinASPtr = this->accessBulletinASnapshot_();
 
-    if (bulletinAPtr != nullptr)
+    if (bulletinASPtr != nullptr)
     {
-        if (bulletinAPtr->accessObservationInterval().contains(anInstant))
+        if (bulletinASPtr->accessObservationInterval().contains(anInstant))
         {
-            const BulletinA::Observation observation = bulletinAPtr->getObservationAt(anInstant);
-
-            return observation.ut1MinusUtc;
+            return bulletinASPtr->accessObservationTable().getUt1MinusUtcAt(anInstant, interpolation);
         }
-        else if (bulletinAPtr->accessPredictionInterval().contains(anInstant))
+        else if (bulletinASPtr->accessPredictionInterval().contains(anInstant))
         {
-            const BulletinA::Prediction prediction = bulletinAPtr->getPredictionAt(anInstant);
-
-            return prediction.ut1MinusUtc;
+            return bulletinASPtr->accessPredictionTable().getUt1MinusUtcAt(anInstant, interpolation);
         }
     }
 
-    const Finals2000A* finals2000aPtr = this->accessFinals2000A_();
+    const Shared<const Finals2000A> finals2000aSPtr = this->accessFinals2000ASnapshot_();
 
-    if (finals2000aPtr != nullptr)
+    if (finals2000aSPtr != nullptr)
     {
-        return finals2000aPtr->getUt1MinusUtcAt(anInstant);
+        return finals2000aSPtr->accessTable().getUt1MinusUtcAt(anInstant, interpolation);
     }
 
     throw ostk::core::error::RuntimeError("Cannot obtain UT1 - UTC at [{}].", anInstant.toString());
@@ -212,13 +191,11 @@ Real Manager::getLodAt(const Instant& anInstant) const
         throw ostk::core::error::runtime::Undefined("Instant");
     }
 
-    std::lock_guard<std::mutex> lock {mutex_};
+    const Shared<const Finals2000A> finals2000aSPtr = this->accessFinals2000ASnapshot_();
 
-    const Finals2000A* finals2000aPtr = this->accessFinals2000A_();
-
-    if (finals2000aPtr != nullptr)
+    if (finals2000aSPtr != nullptr)
     {
-        return finals2000aPtr->getLodAt(anInstant);
+        return finals2000aSPtr->accessTable().getLodAt(anInstant, interpolation_.load(std::memory_order_relaxed));
     }
 
     throw ostk::core::error::RuntimeError("Cannot obtain LOD at [{}].", anInstant.toString());
@@ -226,11 +203,29 @@ Real Manager::getLodAt(const Instant& anInstant) const
     return Real::Undefined();
 }
 
+Size Manager::getRevision() const
+{
+    return revision_.load(std::memory_order_acquire);
+}
+
+EOPTable::Interpolation Manager::getInterpolation() const
+{
+    return interpolation_.load();
+}
+
+bool Manager::isOceanTidalCorrectionEnabled() const
+{
+    return oceanTidalCorrectionEnabled_.load();
+}
+
 void Manager::setMode(const Manager::Mode& aMode)
 {
     std::lock_guard<std::mutex> lock {mutex_};
 
     mode_ = aMode;
+
+    bulletinAMissing_.store(false);
+    finals2000AMissing_.store(false);
 }
 
 void Manager::setLocalRepository(const Directory& aDirectory)
@@ -245,6 +240,23 @@ void Manager::setLocalRepository(const Directory& aDirectory)
     localRepository_ = aDirectory;
 
     setup_();
+
+    bulletinAMissing_.store(false);
+    finals2000AMissing_.store(false);
+}
+
+void Manager::setInterpolation(const EOPTable::Interpolation& anInterpolation)
+{
+    interpolation_.store(anInterpolation);
+
+    revision_.fetch_add(1, std::memory_order_release);
+}
+
+void Manager::setOceanTidalCorrectionEnabled(const bool isEnabled)
+{
+    oceanTidalCorrectionEnabled_.store(isEnabled);
+
+    revision_.fetch_add(1, std::memory_order_release);
 }
 
 void Manager::loadBulletinA(const BulletinA& aBulletinA)
@@ -289,8 +301,13 @@ void Manager::reset()
 {
     std::lock_guard<std::mutex> lock {mutex_};
 
-    bulletinA_ = BulletinA::Undefined();
-    finals2000A_ = Finals2000A::Undefined();
+    bulletinASPtr_.store(nullptr);
+    finals2000ASPtr_.store(nullptr);
+
+    bulletinAMissing_.store(false);
+    finals2000AMissing_.store(false);
+
+    revision_.fetch_add(1, std::memory_order_release);
 }
 
 void Manager::clearLocalRepository()
@@ -298,6 +315,9 @@ void Manager::clearLocalRepository()
     localRepository_.remove();
 
     this->setup_();
+
+    bulletinAMissing_.store(false);
+    finals2000AMissing_.store(false);
 }
 
 Manager& Manager::Get()
@@ -330,6 +350,30 @@ Manager::Mode Manager::DefaultMode()
     return defaultMode;
 }
 
+EOPTable::Interpolation Manager::DefaultInterpolation()
+{
+    static const EOPTable::Interpolation defaultInterpolation = EOPTable::Interpolation::Linear;
+
+    if (const char* interpolationString =
+            std::getenv("OSTK_PHYSICS_COORDINATE_FRAME_PROVIDER_IERS_MANAGER_INTERPOLATION"))
+    {
+        if (strcmp(interpolationString, "Linear") == 0)
+        {
+            return EOPTable::Interpolation::Linear;
+        }
+        else if (strcmp(interpolationString, "Lagrange") == 0)
+        {
+            return EOPTable::Interpolation::Lagrange;
+        }
+        else
+        {
+            throw ostk::core::error::runtime::Wrong("Interpolation", interpolationString);
+        }
+    }
+
+    return defaultInterpolation;
+}
+
 Directory Manager::DefaultLocalRepository()
 {
     using ostk::core::filesystem::Path;
@@ -368,8 +412,13 @@ Manager::Manager(const Manager::Mode& aMode)
     : mode_(aMode),
       localRepository_(Manager::DefaultLocalRepository()),
       localRepositoryLockTimeout_(Manager::DefaultLocalRepositoryLockTimeout()),
-      bulletinA_(BulletinA::Undefined()),
-      finals2000A_(Finals2000A::Undefined())
+      bulletinASPtr_(nullptr),
+      finals2000ASPtr_(nullptr),
+      bulletinAMissing_(false),
+      finals2000AMissing_(false),
+      interpolation_(Manager::DefaultInterpolation()),
+      oceanTidalCorrectionEnabled_(false),
+      revision_(0)
 {
     this->setup_();
 }
@@ -456,20 +505,26 @@ void Manager::unlockLocalRepository_() const
 
 void Manager::loadBulletinA_(const BulletinA& aBulletinA) const
 {
-    bulletinA_ = aBulletinA;
+    bulletinASPtr_.store(std::make_shared<const BulletinA>(aBulletinA));
+    bulletinAMissing_.store(false);
+
+    revision_.fetch_add(1, std::memory_order_release);
 }
 
 void Manager::loadFinals2000A_(const Finals2000A& aFinals2000A) const
 {
-    finals2000A_ = aFinals2000A;
+    finals2000ASPtr_.store(std::make_shared<const Finals2000A>(aFinals2000A));
+    finals2000AMissing_.store(false);
+
+    revision_.fetch_add(1, std::memory_order_release);
 }
 
-const BulletinA* Manager::accessBulletinA_() const
+Shared<const BulletinA> Manager::accessBulletinA_() const
 {
     // If we've loaded a file, simply return it
-    if (bulletinA_.isDefined())
+    if (const Shared<const BulletinA> bulletinASPtr = bulletinASPtr_.load())
     {
-        return &bulletinA_;
+        return bulletinASPtr;
     }
 
     // If set to automatic, try to load or fetch the latest file
@@ -511,13 +566,15 @@ const BulletinA* Manager::accessBulletinA_() const
 
             this->loadBulletinA_(BulletinA::Load(localBulletinAFile));
 
-            return &bulletinA_;
+            return bulletinASPtr_.load();
         }
 
         case Manager::Mode::Manual:
         {
             if (!this->getBulletinADirectory().containsFileWithName(bulletinAFileName))
             {
+                bulletinAMissing_.store(true);
+
                 return nullptr;
             }
 
@@ -526,7 +583,7 @@ const BulletinA* Manager::accessBulletinA_() const
 
             this->loadBulletinA_(BulletinA::Load(localBulletinAFile));
 
-            return &bulletinA_;
+            return bulletinASPtr_.load();
         }
 
         default:
@@ -537,12 +594,12 @@ const BulletinA* Manager::accessBulletinA_() const
     return nullptr;
 }
 
-const Finals2000A* Manager::accessFinals2000A_() const
+Shared<const Finals2000A> Manager::accessFinals2000A_() const
 {
     // If we've loaded a file, simply return it
-    if (finals2000A_.isDefined())
+    if (const Shared<const Finals2000A> finals2000ASPtr = finals2000ASPtr_.load())
     {
-        return &finals2000A_;
+        return finals2000ASPtr;
     }
 
     // If set to automatic, try to load or fetch the latest file
@@ -584,12 +641,14 @@ const Finals2000A* Manager::accessFinals2000A_() const
 
             this->loadFinals2000A_(Finals2000A::Load(localFinals2000AFile));
 
-            return &finals2000A_;
+            return finals2000ASPtr_.load();
         }
         case Manager::Mode::Manual:
         {
             if (!this->getFinals2000ADirectory().containsFileWithName(finals2000AFileName))
             {
+                finals2000AMissing_.store(true);
+
                 return nullptr;
             }
 
@@ -600,7 +659,7 @@ const Finals2000A* Manager::accessFinals2000A_() const
 
             this->loadFinals2000A_(finals2000A);
 
-            return &finals2000A_;
+            return finals2000ASPtr_.load();
         }
         default:
             return nullptr;
@@ -819,6 +878,84 @@ File Manager::fetchLatestFinals2000A_() const
     return latestFinals2000AFile;
 }
 
+Vector2d Manager::getInterpolatedPolarMotionAt_(const Instant& anInstant) const
+{
+    // Try data in this order:
+    // 1. Bulletin A rapid service observations (released daily)
+    // 2. Bulletin A predictions (released daily)
+    // 3. Finals 2000A observations (released weekly)
+    //
+    // https://hpiers.obspm.fr/eoppc/bul/bulb/explanatory.html
+
+    const EOPTable::Interpolation interpolation = interpolation_.load(std::memory_order_relaxed);
+
+    const Shared<const BulletinA> bulletinASPtr = this->accessBulletinASnapshot_();
+
+    if (bulletinASPtr != nullptr)
+    {
+        if (bulletinASPtr->accessObservationInterval().contains(anInstant))
+        {
+            return bulletinASPtr->accessObservationTable().getPolarMotionAt(anInstant, interpolation);
+        }
+        else if (bulletinASPtr->accessPredictionInterval().contains(anInstant))
+        {
+            return bulletinASPtr->accessPredictionTable().getPolarMotionAt(anInstant, interpolation);
+        }
+    }
+
+    const Shared<const Finals2000A> finals2000aSPtr = this->accessFinals2000ASnapshot_();
+
+    if (finals2000aSPtr != nullptr)
+    {
+        const Vector2d polarMotion = finals2000aSPtr->accessTable().getPolarMotionAt(anInstant, interpolation);
+        if (!polarMotion.isDefined())
+        {
+            throw ostk::core::error::RuntimeError(
+                "Cannot obtain polar motion from Finals2000a at [{}].", anInstant.toString()
+            );
+        }
+        return polarMotion;
+    }
+
+    throw ostk::core::error::RuntimeError("Cannot obtain polar motion at [{}].", anInstant.toString());
+
+    return Vector2d::Undefined();
+}
+
+Shared<const BulletinA> Manager::accessBulletinASnapshot_() const
+{
+    if (const Shared<const BulletinA> bulletinASPtr = bulletinASPtr_.load())
+    {
+        return bulletinASPtr;
+    }
+
+    if (bulletinAMissing_.load())
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock {mutex_};
+
+    return this->accessBulletinA_();
+}
+
+Shared<const Finals2000A> Manager::accessFinals2000ASnapshot_() const
+{
+    if (const Shared<const Finals2000A> finals2000ASPtr = finals2000ASPtr_.load())
+    {
+        return finals2000ASPtr;
+    }
+
+    if (finals2000AMissing_.load())
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock {mutex_};
+
+    return this->accessFinals2000A_();
+}
+
 }  // namespace iers
 }  // namespace provider
 }  // namespace frame
@@ -31,7 +31,15 @@ namespace frame
 namespace provider
 {
 
-ITRF::ITRF() {}
+ITRF::ITRF()
+    : earthOrientationTableSPtr_(nullptr)
+{
+}
+
+ITRF::ITRF(const Shared<const EarthOrientationTable>& anEarthOrientationTableSPtr)
+    : earthOrientationTableSPtr_(anEarthOrientationTableSPtr)
+{
+}
 
 ITRF::~ITRF() {}
 
@@ -42,7 +50,7 @@ ITRF* ITRF::clone() const
 
 bool ITRF::isDefined() const
 {
-    return true;
+    return (earthOrientationTableSPtr_ == nullptr) || earthOrientationTableSPtr_->isDefined();
 }
 
 Transform ITRF::getTransformAt(const Instant& anInstant) const
@@ -63,11 +71,6 @@ Transform ITRF::getTransformAt(const Instant& anInstant) const
         throw ostk::core::error::runtime::Undefined("ITRF");
     }
 
-    // Time (TT)
-
-    static const Real djmjd0 = 2400000.5;
-    const Real tt = anInstant.getDateTime(Scale::TT).getModifiedJulianDate();
-
     // The polar motion xp,yp can be obtained from IERS bulletins.  The
     // values are the coordinates (in radians) of the Celestial
     // Intermediate Pole with respect to the International Terrestrial
@@ -77,7 +80,10 @@ Transform ITRF::getTransformAt(const Instant& anInstant) const
 
     // Polar motion
 
-    const Vector2d polarMotion = IersManager::Get().getPolarMotionAt(anInstant);  // [asec]
+    const Vector2d polarMotion =
+        ((earthOrientationTableSPtr_ != nullptr) && earthOrientationTableSPtr_->covers(anInstant))
+            ? earthOrientationTableSPtr_->getPolarMotionAt(anInstant)
+            : IersManager::Get().getPolarMotionAt(anInstant);  // [asec]
 
     const Real xp = polarMotion.x() * DAS2R;  // [rad]
     const Real yp = polarMotion.y() * DAS2R;  // [rad]
@@ -87,7 +93,12 @@ Transform ITRF::getTransformAt(const Instant& anInstant) const
     // However, it is dominated by a secular drift of about 47 microarcseconds per century, and so can be taken into
     // account by using s' = -47*t, where t is centuries since J2000.0.
 
-    const Real sp = iauSp00(djmjd0, tt);
+    // Julian centuries since J2000.0 (TT), computed from instant difference rather than calendar date
+
+    static const Instant j2000 = Instant::J2000();
+    const Real t = (anInstant - j2000).inDays() / 36525.0;
+
+    const Real sp = -47e-6 * t * DAS2R;  // Equivalent to iauSp00
 
     // Polar motion matrix (TIRS -> ITRS, IERS 2003)
     // The matrix operates in the sense V(TRS) = rpom * V(CIP), meaning
@@ -22,7 +22,9 @@ namespace frame
 namespace provider
 {
 
+using ostk::core::container::Pair;
 using ostk::core::container::Triple;
+using ostk::core::type::Real;
 
 using ostk::physics::unit::Angle;
 using ostk::physics::time::Scale;
@@ -34,9 +36,9 @@ Triple<Angle, Angle, Angle> computeFK5Precession(const Instant& anInstant)
 
     // Compute the Julian Centuries.
 
-    const double JD_TT = anInstant.getJulianDate(Scale::TT);
+    const Pair<Real, Real> JD_TT = anInstant.getJulianDateParts(Scale::TT);
     const double JD_J2000 = 2451545.0;
-    const double T_TT = (JD_TT - JD_J2000) / 36525.0;
+    const double T_TT = ((static_cast<double>(JD_TT.first) - JD_J2000) + static_cast<double>(JD_TT.second)) / 36525.0;
 
     // Compute the angles [arcsec].
 
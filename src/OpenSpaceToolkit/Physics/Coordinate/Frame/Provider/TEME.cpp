@@ -49,6 +49,8 @@ Transform TEME::getTransformAt(const Instant& anInstant) const
     // https://celestrak.com/publications/AIAA/2006-6753/faq.php
     // http://www.dtic.mil/dtic/tr/fulltext/u2/a637370.pdf p.18
 
+    using ostk::core::container::Pair;
+
     using ostk::mathematics::object::Vector2d;
     using ostk::mathematics::geometry::d3::transformation::rotation::RotationMatrix;
 
@@ -69,10 +71,10 @@ Transform TEME::getTransformAt(const Instant& anInstant) const
     // Time (UTC)
 
     static const Real djmjd0 = 2400000.5;
-    const Real utc = anInstant.getDateTime(Scale::UTC).getModifiedJulianDate();
+    const Pair<Real, Real> utc = anInstant.getModifiedJulianDateParts(Scale::UTC);
 
-    const Real date = std::floor(utc);
-    const Real time = utc - date;
+    const Real date = utc.first;
+    const Real time = utc.second;
 
     // UT1 - UTC (s)
 
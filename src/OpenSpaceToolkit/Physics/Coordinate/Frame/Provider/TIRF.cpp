@@ -44,6 +44,8 @@ bool TIRF::isDefined() const
 
 Transform TIRF::getTransformAt(const Instant& anInstant) const
 {
+    using ostk::core::container::Pair;
+
     using ostk::mathematics::geometry::d3::transformation::rotation::RotationMatrix;
 
     using ostk::physics::time::Scale;
@@ -64,10 +66,10 @@ Transform TIRF::getTransformAt(const Instant& anInstant) const
     // Time (UTC)
 
     static const Real djmjd0 = 2400000.5;
-    const Real utc = anInstant.getDateTime(Scale::UTC).getModifiedJulianDate();
+    const Pair<Real, Real> utc = anInstant.getModifiedJulianDateParts(Scale::UTC);
 
-    const Real date = std::floor(utc);
-    const Real time = utc - date;
+    const Real date = utc.first;
+    const Real time = utc.second;
 
     // UT1 - UTC (s)
 
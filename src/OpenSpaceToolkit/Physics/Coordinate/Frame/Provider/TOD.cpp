@@ -63,6 +63,9 @@ iau::Theory TOD::getTheory() const
 
 Transform TOD::getTransformAt(const Instant& anInstant) const
 {
+    using ostk::core::container::Pair;
+    using ostk::core::type::Real;
+
     using ostk::mathematics::geometry::d3::transformation::rotation::RotationMatrix;
 
     if (!anInstant.isDefined())
@@ -75,8 +78,10 @@ Transform TOD::getTransformAt(const Instant& anInstant) const
         throw ostk::core::error::runtime::Undefined("TOD");
     }
 
-    const double date1 = 2400000.5;
-    const double date2 = this->epoch_.getModifiedJulianDate(Scale::TT);
+    const Pair<Real, Real> tt = this->epoch_.getModifiedJulianDateParts(Scale::TT);
+
+    const double date1 = 2400000.5 + static_cast<double>(tt.first);
+    const double date2 = tt.second;
 
     double rbpn[3][3];
 
@@ -15,6 +15,8 @@ namespace physics
 namespace coordinate
 {
 
+using ostk::core::type::Index;
+
 Position::Position(const Vector3d& aCoordinateSet, const Position::Unit& aUnit, const Shared<const Frame>& aFrameSPtr)
     : coordinates_(aCoordinateSet),
       unit_(aUnit),
@@ -216,6 +218,74 @@ Position Position::Meters(const Vector3d& aCoordinateSet, const Shared<const Fra
     return {aCoordinateSet, Position::Unit::Meter, aFrameSPtr};
 }
 
+Array<Position> Position::InFrame(
+    const Array<Position>& aPositionArray,
+    const Shared<const Frame>& aFrameSPtr,
+    const Array<Instant>& anInstantArray,
+    const Size& aThreadCount
+)
+{
+    if ((aFrameSPtr == nullptr) || (!aFrameSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    if (aPositionArray.getSize() != anInstantArray.getSize())
+    {
+        throw ostk::core::error::runtime::Wrong("Instant array size");
+    }
+
+    Array<Position> positions = Array<Position>::Empty();
+    positions.reserve(aPositionArray.getSize());
+
+    if (aPositionArray.isEmpty())
+    {
+        return positions;
+    }
+
+    for (const Position& position : aPositionArray)
+    {
+        if (!position.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Position");
+        }
+    }
+
+    const Shared<const Frame>& frameSPtr = aPositionArray.accessFirst().frameSPtr_;
+
+    bool isSingleFrame = true;
+
+    for (const Position& position : aPositionArray)
+    {
+        if ((position.frameSPtr_ != frameSPtr) && ((*position.frameSPtr_) != (*frameSPtr)))
+        {
+            isSingleFrame = false;
+            break;
+        }
+    }
+
+    if (!isSingleFrame)
+    {
+        for (Index index = 0; index < aPositionArray.getSize(); ++index)
+        {
+            positions.add(aPositionArray[index].inFrame(aFrameSPtr, anInstantArray[index]));
+        }
+
+        return positions;
+    }
+
+    const Array<Transform> transforms = frameSPtr->getTransformsTo(aFrameSPtr, anInstantArray, aThreadCount);
+
+    for (Index index = 0; index < aPositionArray.getSize(); ++index)
+    {
+        const Position& position = aPositionArray[index];
+
+        positions.add({transforms[index].applyToPosition(position.coordinates_), position.unit_, aFrameSPtr});
+    }
+
+    return positions;
+}
+
 }  // namespace coordinate
 }  // namespace physics
 }  // namespace ostk
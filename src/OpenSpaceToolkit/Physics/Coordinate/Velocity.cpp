@@ -13,6 +13,8 @@ namespace physics
 namespace coordinate
 {
 
+using ostk::core::type::Index;
+
 Velocity::Velocity(const Vector3d& aCoordinateSet, const Velocity::Unit& aUnit, const Shared<const Frame>& aFrameSPtr)
     : coordinates_(aCoordinateSet),
       unit_(aUnit),
@@ -182,6 +184,85 @@ String Velocity::StringFromUnit(const Velocity::Unit& aUnit)
     return String::Empty();
 }
 
+Array<Velocity> Velocity::InFrame(
+    const Array<Velocity>& aVelocityArray,
+    const Array<Position>& aPositionArray,
+    const Shared<const Frame>& aFrameSPtr,
+    const Array<Instant>& anInstantArray,
+    const Size& aThreadCount
+)
+{
+    if ((aFrameSPtr == nullptr) || (!aFrameSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    if (aVelocityArray.getSize() != aPositionArray.getSize())
+    {
+        throw ostk::core::error::runtime::Wrong("Position array size");
+    }
+
+    if (aVelocityArray.getSize() != anInstantArray.getSize())
+    {
+        throw ostk::core::error::runtime::Wrong("Instant array size");
+    }
+
+    Array<Velocity> velocities = Array<Velocity>::Empty();
+    velocities.reserve(aVelocityArray.getSize());
+
+    if (aVelocityArray.isEmpty())
+    {
+        return velocities;
+    }
+
+    for (const Velocity& velocity : aVelocityArray)
+    {
+        if (!velocity.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Velocity");
+        }
+    }
+
+    const Shared<const Frame>& frameSPtr = aVelocityArray.accessFirst().frameSPtr_;
+
+    bool isSingleFrame = true;
+
+    for (const Velocity& velocity : aVelocityArray)
+    {
+        if ((velocity.frameSPtr_ != frameSPtr) && ((*velocity.frameSPtr_) != (*frameSPtr)))
+        {
+            isSingleFrame = false;
+            break;
+        }
+    }
+
+    if (!isSingleFrame)
+    {
+        for (Index index = 0; index < aVelocityArray.getSize(); ++index)
+        {
+            velocities.add(aVelocityArray[index].inFrame(aPositionArray[index], aFrameSPtr, anInstantArray[index]));
+        }
+
+        return velocities;
+    }
+
+    const Array<Position> positions = Position::InFrame(aPositionArray, frameSPtr, anInstantArray, aThreadCount);
+    const Array<Transform> transforms = frameSPtr->getTransformsTo(aFrameSPtr, anInstantArray, aThreadCount);
+
+    for (Index index = 0; index < aVelocityArray.getSize(); ++index)
+    {
+        const Velocity& velocity = aVelocityArray[index];
+
+        velocities.add(
+            {transforms[index].applyToVelocity(positions[index].accessCoordinates(), velocity.coordinates_),
+             velocity.unit_,
+             aFrameSPtr}
+        );
+    }
+
+    return velocities;
+}
+
 Derived::Unit Velocity::DerivedUnitFromVelocityUnit(const Velocity::Unit& aUnit)
 {
     using ostk::physics::unit::Length;
@@ -6,6 +6,7 @@
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/Exponential.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/HarrisPriester.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/NRLMSISE00.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Earth.hpp>
 
@@ -18,8 +19,11 @@ namespace environment
 namespace atmospheric
 {
 
+using ostk::core::type::Size;
+
 using ostk::physics::coordinate::Frame;
 using ostk::physics::environment::atmospheric::earth::Exponential;
+using ostk::physics::environment::atmospheric::earth::HarrisPriester;
 using ostk::physics::environment::atmospheric::earth::NRLMSISE00;
 using EarthCelestial = ostk::physics::environment::object::celestial::Earth;
 using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
@@ -47,7 +51,15 @@ class Earth::Impl
 
     virtual Real getDensityAt(const Position& aPosition, const Instant& anInstant) const = 0;
 
+    virtual Array<Real> getDensitiesAt(const Array<Position>& aPositionArray, const Instant& anInstant) const;
+
+    virtual Array<Real> getDensitiesAt(
+        const Array<Position>& aPositionArray, const Array<Instant>& anInstantArray
+    ) const;
+
    protected:
+    LLA getLLAAt(const Position& aPosition, const Instant& anInstant) const;
+
     Shared<const Frame> earthFrameSPtr_;
     Length earthRadius_;
     Real earthFlattening_;
@@ -84,6 +96,48 @@ Earth::InputDataType Earth::Impl::getInputDataType() const
     return inputDataType_;
 }
 
+Array<Real> Earth::Impl::getDensitiesAt(const Array<Position>& aPositionArray, const Instant& anInstant) const
+{
+    Array<Real> densities = Array<Real>::Empty();
+    densities.reserve(aPositionArray.getSize());
+
+    for (const Position& position : aPositionArray)
+    {
+        densities.add(this->getDensityAt(position, anInstant));
+    }
+
+    return densities;
+}
+
+Array<Real> Earth::Impl::getDensitiesAt(
+    const Array<Position>& aPositionArray, const Array<Instant>& anInstantArray
+) const
+{
+    if (aPositionArray.getSize() != anInstantArray.getSize())
+    {
+        throw ostk::core::error::RuntimeError(
+            "Position count [{}] does not match instant count [{}].", aPositionArray.getSize(), anInstantArray.getSize()
+        );
+    }
+
+    Array<Real> densities = Array<Real>::Empty();
+    densities.reserve(aPositionArray.getSize());
+
+    for (Size index = 0; index < aPositionArray.getSize(); ++index)
+    {
+        densities.add(this->getDensityAt(aPositionArray[index], anInstantArray[index]));
+    }
+
+    return densities;
+}
+
+LLA Earth::Impl::getLLAAt(const Position& aPosition, const Instant& anInstant) const
+{
+    return LLA::Cartesian(
+        aPosition.inFrame(earthFrameSPtr_, anInstant).getCoordinates(), earthRadius_, earthFlattening_
+    );
+}
+
 class Earth::ExponentialImpl : public Earth::Impl
 {
    public:
@@ -162,6 +216,12 @@ class Earth::NRLMSISE00Impl : public Earth::Impl
 
     virtual Real getDensityAt(const Position& aPosition, const Instant& anInstant) const override;
 
+    virtual Array<Real> getDensitiesAt(const Array<Position>& aPositionArray, const Instant& anInstant) const override;
+
+    virtual Array<Real> getDensitiesAt(
+        const Array<Position>& aPositionArray, const Array<Instant>& anInstantArray
+    ) const override;
+
    private:
     NRLMSISE00 NRLMSISE00Model_;
 };
@@ -212,6 +272,114 @@ Real Earth::NRLMSISE00Impl::getDensityAt(const Position& aPosition, const Instan
     );
 }
 
+Array<Real> Earth::NRLMSISE00Impl::getDensitiesAt(const Array<Position>& aPositionArray, const Instant& anInstant) const
+{
+    Array<LLA> llas = Array<LLA>::Empty();
+    llas.reserve(aPositionArray.getSize());
+
+    for (const Position& position : aPositionArray)
+    {
+        llas.add(this->getLLAAt(position, anInstant));
+    }
+
+    return this->NRLMSISE00Model_.getDensitiesAt(llas, anInstant);
+}
+
+Array<Real> Earth::NRLMSISE00Impl::getDensitiesAt(
+    const Array<Position>& aPositionArray, const Array<Instant>& anInstantArray
+) const
+{
+    if (aPositionArray.getSize() != anInstantArray.getSize())
+    {
+        throw ostk::core::error::RuntimeError(
+            "Position count [{}] does not match instant count [{}].", aPositionArray.getSize(), anInstantArray.getSize()
+        );
+    }
+
+    Array<LLA> llas = Array<LLA>::Empty();
+    llas.reserve(aPositionArray.getSize());
+
+    for (Size index = 0; index < aPositionArray.getSize(); ++index)
+    {
+        llas.add(this->getLLAAt(aPositionArray[index], anInstantArray[index]));
+    }
+
+    return this->NRLMSISE00Model_.getDensitiesAt(llas, anInstantArray);
+}
+
+class Earth::HarrisPriesterImpl : public Earth::Impl
+{
+   public:
+    HarrisPriesterImpl(
+        const Earth::Type& aType,
+        const Earth::InputDataType& anInputDataType,
+        const Shared<const Frame>& anEarthFrameSPtr,
+        const Length& anEarthRadius,
+        const Real& anEarthFlattening,
+        const Shared<Celestial>& aSunCelestialSPtr
+    );
+
+    ~HarrisPriesterImpl();
+
+    virtual HarrisPriesterImpl* clone() const override;
+
+    virtual Real getDensityAt(const LLA& aLLA, const Instant& anInstant) const override;
+
+    virtual Real getDensityAt(const Position& aPosition, const Instant& anInstant) const override;
+
+    using Earth::Impl::getDensitiesAt;  // Per-instant evaluation: Harris-Priester has no batch over instants
+
+    virtual Array<Real> getDensitiesAt(const Array<Position>& aPositionArray, const Instant& anInstant) const override;
+
+   private:
+    HarrisPriester harrisPriesterModel_;
+};
+
+Earth::HarrisPriesterImpl::HarrisPriesterImpl(
+    const Earth::Type& aType,
+    const Earth::InputDataType& anInputDataType,
+    const Shared<const Frame>& anEarthFrameSPtr,
+    const Length& anEarthRadius,
+    const Real& anEarthFlattening,
+    const Shared<Celestial>& aSunCelestialSPtr
+)
+    : Earth::Impl(aType, anInputDataType, anEarthFrameSPtr, anEarthRadius, anEarthFlattening),
+      harrisPriesterModel_(HarrisPriester::DefaultCosineExponent, anEarthFrameSPtr, aSunCelestialSPtr)
+{
+}
+
+Earth::HarrisPriesterImpl::~HarrisPriesterImpl() {}
+
+Earth::HarrisPriesterImpl* Earth::HarrisPriesterImpl::clone() const
+{
+    return new Earth::HarrisPriesterImpl(*this);
+}
+
+Real Earth::HarrisPriesterImpl::getDensityAt(const LLA& aLLA, const Instant& anInstant) const
+{
+    return this->harrisPriesterModel_.getDensityAt(aLLA, anInstant);
+}
+
+Real Earth::HarrisPriesterImpl::getDensityAt(const Position& aPosition, const Instant& anInstant) const
+{
+    return this->harrisPriesterModel_.getDensityAt(this->getLLAAt(aPosition, anInstant), anInstant);
+}
+
+Array<Real> Earth::HarrisPriesterImpl::getDensitiesAt(
+    const Array<Position>& aPositionArray, const Instant& anInstant
+) const
+{
+    Array<LLA> llas = Array<LLA>::Empty();
+    llas.reserve(aPositionArray.getSize());
+
+    for (const Position& position : aPositionArray)
+    {
+        llas.add(this->getLLAAt(position, anInstant));
+    }
+
+    return this->harrisPriesterModel_.getDensitiesAt(llas, anInstant);
+}
+
 Earth::Earth(
     const Earth::Type& aType,
     const Earth::InputDataType& anInputDataType,
@@ -290,6 +458,16 @@ Real Earth::getDensityAt(const LLA& aLLA, const Instant& anInstant) const
     return implUPtr_->getDensityAt(aLLA, anInstant);
 }
 
+Array<Real> Earth::getDensitiesAt(const Array<Position>& aPositionArray, const Instant& anInstant) const
+{
+    return implUPtr_->getDensitiesAt(aPositionArray, anInstant);
+}
+
+Array<Real> Earth::getDensitiesAt(const Array<Position>& aPositionArray, const Array<Instant>& anInstantArray) const
+{
+    return implUPtr_->getDensitiesAt(aPositionArray, anInstantArray);
+}
+
 Unique<Earth::Impl> Earth::ImplFromType(
     const Earth::Type& aType,
     const Earth::InputDataType& anInputDataType,
@@ -312,6 +490,12 @@ Unique<Earth::Impl> Earth::ImplFromType(
             aType, anInputDataType, anEarthFrameSPtr, anEarthRadius, anEarthFlattening
         );
     }
+    else if (aType == Earth::Type::HarrisPriester)
+    {
+        return std::make_unique<HarrisPriesterImpl>(
+            aType, anInputDataType, anEarthFrameSPtr, anEarthRadius, anEarthFlattening, aSunCelestialSPtr
+        );
+    }
     else if (aType == Earth::Type::NRLMSISE00)
     {
         if (anInputDataType == Earth::InputDataType::Undefined ||
@@ -1,13 +1,13 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <array>
+#include <charconv>
 #include <fstream>
 #include <iostream>
 #include <sstream>
+#include <string_view>
 
-#include <boost/algorithm/string/trim.hpp>
-#include <boost/lexical_cast.hpp>
-
-#include <OpenSpaceToolkit/Core/Container/Table.hpp>
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
@@ -33,12 +33,211 @@ using ostk::core::type::Size;
 using ostk::core::type::Real;
 using ostk::core::type::String;
 using ostk::core::utils::Print;
-using ostk::core::container::Table;
 
 using ostk::physics::time::Scale;
 using ostk::physics::time::Time;
 using ostk::physics::time::DateTime;
 
+// Parsing helpers, working in place over the file buffer
+
+static std::string ReadFile(const File& aFile)
+{
+    std::ifstream fileStream {aFile.getPath().toString(), std::ios::binary | std::ios::ate};
+
+    if (!fileStream.is_open())
+    {
+        throw ostk::core::error::RuntimeError("Cannot open file [{}].", aFile.toString());
+    }
+
+    std::string buffer(static_cast<std::size_t>(fileStream.tellg()), '\0');
+
+    fileStream.seekg(0);
+    fileStream.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+
+    return buffer;
+}
+
+static std::string_view NextLine(const std::string& aBuffer, std::size_t& aLineStart)
+{
+    std::size_t lineEnd = aBuffer.find('\n', aLineStart);
+
+    if (lineEnd == std::string::npos)
+    {
+        lineEnd = aBuffer.size();
+    }
+
+    std::string_view line {aBuffer.data() + aLineStart, lineEnd - aLineStart};
+
+    if (!line.empty() && (line.back() == '\r'))
+    {
+        line.remove_suffix(1);
+    }
+
+    aLineStart = lineEnd + 1;
+
+    return line;
+}
+
+template <std::size_t N>
+static Size SplitFields(const std::string_view& aLine, std::array<std::string_view, N>& aFieldArray)
+{
+    Size fieldCount = 0;
+    std::size_t fieldStart = 0;
+
+    while (fieldCount < N)
+    {
+        const std::size_t fieldEnd = aLine.find(',', fieldStart);
+
+        if (fieldEnd == std::string_view::npos)
+        {
+            aFieldArray[fieldCount++] = aLine.substr(fieldStart);
+            break;
+        }
+
+        aFieldArray[fieldCount++] = aLine.substr(fieldStart, fieldEnd - fieldStart);
+        fieldStart = fieldEnd + 1;
+    }
+
+    return fieldCount;
+}
+
+template <std::size_t N>
+static Size SplitWords(const std::string_view& aLine, std::array<std::string_view, N>& aWordArray)
+{
+    Size wordCount = 0;
+    std::size_t wordEnd = 0;
+
+    while (wordCount < N)
+    {
+        const std::size_t wordStart = aLine.find_first_not_of(" \t", wordEnd);
+
+        if (wordStart == std::string_view::npos)
+        {
+            break;
+        }
+
+        wordEnd = std::min(aLine.find_first_of(" \t", wordStart), aLine.size());
+
+        aWordArray[wordCount++] = aLine.substr(wordStart, wordEnd - wordStart);
+    }
+
+    return wordCount;
+}
+
+static int ParseInteger(const std::string_view& aString)
+{
+    int value = 0;
+
+    const std::from_chars_result result = std::from_chars(aString.data(), aString.data() + aString.size(), value);
+
+    if ((result.ec != std::errc()) || (result.ptr != (aString.data() + aString.size())))
+    {
+        throw ostk::core::error::RuntimeError("Cannot parse integer [{}].", std::string(aString));
+    }
+
+    return value;
+}
+
+static double ParseReal(const std::string_view& aString)
+{
+    double value = 0.0;
+
+    const std::from_chars_result result = std::from_chars(aString.data(), aString.data() + aString.size(), value);
+
+    if ((result.ec != std::errc()) || (result.ptr != (aString.data() + aString.size())))
+    {
+        throw ostk::core::error::RuntimeError("Cannot parse real [{}].", std::string(aString));
+    }
+
+    return value;
+}
+
+static Integer ParseOptionalInteger(const std::string_view& aString)
+{
+    return aString.empty() ? Integer::Undefined() : Integer(ParseInteger(aString));
+}
+
+static Real ParseOptionalReal(const std::string_view& aString)
+{
+    return aString.empty() ? Real::Undefined() : Real(ParseReal(aString));
+}
+
+static Integer ModifiedJulianDay(const int aYear, const int aMonth, const int aDay)
+{
+    // Fliegel & Van Flandern Julian Day Number, shifted to Modified Julian Day
+
+    const int monthOffset = (aMonth - 14) / 12;
+
+    const int julianDayNumber = (1461 * (aYear + 4800 + monthOffset)) / 4 +
+                                (367 * (aMonth - 2 - 12 * monthOffset)) / 12 -
+                                (3 * ((aYear + 4900 + monthOffset) / 100)) / 4 + aDay - 32075;
+
+    return julianDayNumber - 2400001;
+}
+
+static Integer MonthNumber(const Date& aDate)
+{
+    return Integer(aDate.getYear()) * 12 + Integer(aDate.getMonth()) - 1;
+}
+
+static bool Ap3HourIndicesAreDefined(const CSSISpaceWeather::Reading& aReading)
+{
+    return aReading.Ap1.isDefined() && aReading.Ap2.isDefined() && aReading.Ap3.isDefined() &&
+           aReading.Ap4.isDefined() && aReading.Ap5.isDefined() && aReading.Ap6.isDefined() &&
+           aReading.Ap7.isDefined() && aReading.Ap8.isDefined();
+}
+
+static const CSSISpaceWeather::Reading* FindReading(
+    const Array<CSSISpaceWeather::Reading>& aReadingArray, const Integer& aFirstKey, const Integer& aKey
+)
+{
+    if (aReadingArray.isEmpty())
+    {
+        return nullptr;
+    }
+
+    const int index = aKey - aFirstKey;
+
+    if ((index < 0) || (index >= static_cast<int>(aReadingArray.getSize())))
+    {
+        return nullptr;
+    }
+
+    const CSSISpaceWeather::Reading& reading = aReadingArray[index];
+
+    return reading.date.isDefined() ? &reading : nullptr;
+}
+
+static Array<CSSISpaceWeather::Reading> FlattenReadings(const Map<Integer, CSSISpaceWeather::Reading>& aReadingMap)
+{
+    Array<CSSISpaceWeather::Reading> readings = Array<CSSISpaceWeather::Reading>::Empty();
+
+    if (aReadingMap.empty())
+    {
+        return readings;
+    }
+
+    const Integer firstKey = aReadingMap.begin()->first;
+
+    readings.reserve(aReadingMap.rbegin()->first - firstKey + 1);
+
+    for (const auto& readingIt : aReadingMap)
+    {
+        // Fill missing keys with undefined readings, so that readings stay indexed by key
+        while (static_cast<int>(readings.getSize()) < (readingIt.first - firstKey))
+        {
+            CSSISpaceWeather::Reading missingReading = readingIt.second;
+            missingReading.date = Date::Undefined();
+
+            readings.add(missingReading);
+        }
+
+        readings.add(readingIt.second);
+    }
+
+    return readings;
+}
+
 std::ostream& operator<<(std::ostream& anOutputStream, const CSSISpaceWeather& aCSSISpaceWeather)
 {
     Print::Header(anOutputStream, "CSSI Space Weather");
@@ -64,9 +263,12 @@ std::ostream& operator<<(std::ostream& anOutputStream, const CSSISpaceWeather& a
 
     Print::Separator(anOutputStream, "Observations");
     Print::Line(anOutputStream) << dataHeader;
-    for (const auto& observationIt : aCSSISpaceWeather.observations_)
+    for (const auto& observation : aCSSISpaceWeather.observations_)
     {
-        const CSSISpaceWeather::Reading& observation = observationIt.second;
+        if (!observation.date.isDefined())
+        {
+            continue;
+        }
 
         Print::Line(anOutputStream) << String::Format(
             "{:04}-{:02}-{:02}  {:>4d}  {:>2d}  {:>2d}  {:>2d}  {:>2d}  {:>2d}  {:>2d}  {:>2d}  {:>2d}  {:>2d}  {:>4d} "
@@ -111,9 +313,12 @@ std::ostream& operator<<(std::ostream& anOutputStream, const CSSISpaceWeather& a
     Print::Separator(anOutputStream, "Daily Predictions");
     Print::Line(anOutputStream) << dataHeader;
 
-    for (const auto& dailyPredictionIt : aCSSISpaceWeather.dailyPredictions_)
+    for (const auto& dailyPrediction : aCSSISpaceWeather.dailyPredictions_)
     {
-        const CSSISpaceWeather::Reading& dailyPrediction = dailyPredictionIt.second;
+        if (!dailyPrediction.date.isDefined())
+        {
+            continue;
+        }
 
         Print::Line(anOutputStream) << String::Format(
             "{:04}-{:02}-{:02}  {:>4d}  {:>2d}  {:>2d}  {:>2d}  {:>2d}  {:>2d}  {:>2d}  {:>2d}  {:>2d}  {:>2d}  {:>4d} "
@@ -161,9 +366,12 @@ std::ostream& operator<<(std::ostream& anOutputStream, const CSSISpaceWeather& a
         "F10.7AdjLast81"
     );
 
-    for (const auto& monthlyPredictionIt : aCSSISpaceWeather.monthlyPredictions_)
+    for (const auto& monthlyPrediction : aCSSISpaceWeather.monthlyPredictions_)
     {
-        const CSSISpaceWeather::Reading& monthlyPrediction = monthlyPredictionIt.second;
+        if (!monthlyPrediction.date.isDefined())
+        {
+            continue;
+        }
 
         Print::Line(anOutputStream) << String::Format(
             "{:04}-{:02}-{:02}  {:>4d}  {:>2d}  {:>4d}  {:6.2f}  {:6.2f}  {:s}  {:6.2f}  {:6.2f}  {:6.2f}  {:6.2f}",
@@ -238,11 +446,12 @@ const CSSISpaceWeather::Reading& CSSISpaceWeather::accessObservationAt(const Ins
 
     const Real instantMjd = anInstant.getModifiedJulianDate(Scale::UTC);
 
-    const auto observationIt = observations_.find(instantMjd.floor());
+    const CSSISpaceWeather::Reading* observationPtr =
+        FindReading(observations_, firstObservationMjd_, instantMjd.floor());
 
-    if (observationIt != observations_.end())
+    if (observationPtr != nullptr)
     {
-        return observationIt->second;
+        return *observationPtr;
     }
 
     throw ostk::core::error::RuntimeError("Cannot find observation at [{}].", anInstant.toString(Scale::UTC));
@@ -282,11 +491,12 @@ const CSSISpaceWeather::Reading& CSSISpaceWeather::accessDailyPredictionAt(const
 
     const Real instantMjd = anInstant.getModifiedJulianDate(Scale::UTC);
 
-    const auto predictionIt = dailyPredictions_.find(instantMjd.floor());
+    const CSSISpaceWeather::Reading* predictionPtr =
+        FindReading(dailyPredictions_, firstDailyPredictionMjd_, instantMjd.floor());
 
-    if (predictionIt != dailyPredictions_.end())
+    if (predictionPtr != nullptr)
     {
-        return predictionIt->second;
+        return *predictionPtr;
     }
 
     throw ostk::core::error::RuntimeError("Cannot find daily prediction at [{}].", anInstant.toString(Scale::UTC));
@@ -324,16 +534,13 @@ const CSSISpaceWeather::Reading& CSSISpaceWeather::accessMonthlyPredictionAt(con
         );
     }
 
-    const Integer year = anInstant.getDateTime(Scale::UTC).getDate().getYear();
-    const Integer month = anInstant.getDateTime(Scale::UTC).getDate().getMonth();
-
-    const Real monthMjd = DateTime(year, month, 1).getModifiedJulianDate();
-
-    const auto predictionIt = monthlyPredictions_.find(monthMjd.floor());
+    const CSSISpaceWeather::Reading* predictionPtr = FindReading(
+        monthlyPredictions_, firstMonthlyPredictionMonth_, MonthNumber(anInstant.getDateTime(Scale::UTC).getDate())
+    );
 
-    if (predictionIt != monthlyPredictions_.end())
+    if (predictionPtr != nullptr)
     {
-        return predictionIt->second;
+        return *predictionPtr;
     }
 
     throw ostk::core::error::RuntimeError("Cannot find monthly prediction at [{}].", anInstant.toString(Scale::UTC));
@@ -424,6 +631,60 @@ const CSSISpaceWeather::Reading& CSSISpaceWeather::accessLastReadingWhere(
     );
 }
 
+const Interval& CSSISpaceWeather::accessNRLMSISE00ApInterval() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("CSSI Space Weather");
+    }
+
+    return NRLMSISE00ApInterval_;
+}
+
+Array<Real> CSSISpaceWeather::getNRLMSISE00ApValuesAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("CSSI Space Weather");
+    }
+
+    if (!NRLMSISE00ApInterval_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("NRLMSISE00 Ap interval");
+    }
+
+    if (!NRLMSISE00ApInterval_.contains(anInstant))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Instant [{}] out of NRLMSISE00 Ap range [{} - {}].",
+            anInstant.toString(Scale::UTC),
+            NRLMSISE00ApInterval_.accessStart().toString(Scale::UTC),
+            NRLMSISE00ApInterval_.accessEnd().toString(Scale::UTC)
+        );
+    }
+
+    const DateTime dateTime = anInstant.getDateTime(Scale::UTC);
+
+    // [00:00 - 03:00) == 0, [03:00 - 06:00) == 1, etc.
+    const Size dayIndex = static_cast<int>(dateTime.getModifiedJulianDate().floor() - firstApMjd_);
+    const Size index = 8 * dayIndex + dateTime.getTime().getHour() / 3;
+
+    return {
+        apDailyIndices_[dayIndex],
+        ap3HourIndices_[index],             // now
+        ap3HourIndices_[index - 1],         // now - 3 hours
+        ap3HourIndices_[index - 2],         // now - 6 hours
+        ap3HourIndices_[index - 3],         // now - 9 hours
+        ap3HourIndexAverages_[index - 4],   // now - 12 hours to now - 33 hours
+        ap3HourIndexAverages_[index - 12],  // now - 36 hours to now - 57 hours
+    };
+}
+
 CSSISpaceWeather CSSISpaceWeather::Undefined()
 {
     return CSSISpaceWeather();
@@ -443,169 +704,151 @@ CSSISpaceWeather CSSISpaceWeather::Load(const File& aFile)
 
     CSSISpaceWeather spaceWeather;
 
-    Table spaceWeatherTable = Table::Load(aFile, Table::Format::CSV, true);
+    Map<Integer, CSSISpaceWeather::Reading> observations;
+    Map<Integer, CSSISpaceWeather::Reading> dailyPredictions;
+    Map<Integer, CSSISpaceWeather::Reading> monthlyPredictions;
 
-    for (const auto& row : spaceWeatherTable)
+    const std::string buffer = ReadFile(aFile);
+
+    std::array<std::string_view, 31> fields;
+
+    bool isHeader = true;
+
+    for (std::size_t lineStart = 0; lineStart < buffer.size();)
     {
-        if (row.isEmpty() || !row[0].isDefined())
+        const std::string_view line = NextLine(buffer, lineStart);
+
+        if (isHeader)
         {
+            isHeader = false;
             continue;
         }
 
-        const Date date = Date::Parse(row[0].getString(), Date::Format::Standard);
+        const Size fieldCount = SplitFields(line, fields);
 
-        // [TBR] Toss data past 2030 due to this restriction in the Instant class
-        if (date.getYear() > 2030)
+        if ((fieldCount == 0) || fields[0].empty())
         {
             continue;
         }
 
-        const Integer mjd = DateTime(date, Time(0, 0, 0)).getModifiedJulianDate().floor();
-
-        const Integer BSRN = row[1].isDefined() ? row[1].getInteger() : Integer::Undefined();
-        const Integer ND = row[2].isDefined() ? row[2].getInteger() : Integer::Undefined();
-        const Integer Kp1 = row[3].isDefined() ? row[3].getInteger() : Integer::Undefined();
-        const Integer Kp2 = row[4].isDefined() ? row[4].getInteger() : Integer::Undefined();
-        const Integer Kp3 = row[5].isDefined() ? row[5].getInteger() : Integer::Undefined();
-        const Integer Kp4 = row[6].isDefined() ? row[6].getInteger() : Integer::Undefined();
-        const Integer Kp5 = row[7].isDefined() ? row[7].getInteger() : Integer::Undefined();
-        const Integer Kp6 = row[8].isDefined() ? row[8].getInteger() : Integer::Undefined();
-        const Integer Kp7 = row[9].isDefined() ? row[9].getInteger() : Integer::Undefined();
-        const Integer Kp8 = row[10].isDefined() ? row[10].getInteger() : Integer::Undefined();
-        const Integer KpSum = row[11].isDefined() ? row[11].getInteger() : Integer::Undefined();
-        const Integer Ap1 = row[12].isDefined() ? row[12].getInteger() : Integer::Undefined();
-        const Integer Ap2 = row[13].isDefined() ? row[13].getInteger() : Integer::Undefined();
-        const Integer Ap3 = row[14].isDefined() ? row[14].getInteger() : Integer::Undefined();
-        const Integer Ap4 = row[15].isDefined() ? row[15].getInteger() : Integer::Undefined();
-        const Integer Ap5 = row[16].isDefined() ? row[16].getInteger() : Integer::Undefined();
-        const Integer Ap6 = row[17].isDefined() ? row[17].getInteger() : Integer::Undefined();
-        const Integer Ap7 = row[18].isDefined() ? row[18].getInteger() : Integer::Undefined();
-        const Integer Ap8 = row[19].isDefined() ? row[19].getInteger() : Integer::Undefined();
-        const Integer ApAvg = row[20].isDefined() ? row[20].getInteger() : Integer::Undefined();
-        const Real Cp = row[21].isDefined() ? row[21].getReal() : Real::Undefined();
-        const Integer C9 = row[22].isDefined() ? row[22].getInteger() : Integer::Undefined();
-        const Integer ISN = row[23].isDefined() ? row[23].getInteger() : Integer::Undefined();
-        const Real F107Obs = row[24].isDefined() ? row[24].getReal() : Real::Undefined();
-        const Real F107Adj = row[25].isDefined() ? row[25].getReal() : Real::Undefined();
-        const String F107DataType = row[26].getString();
-        const Real F107ObsCenter81 = row[27].isDefined() ? row[27].getReal() : Real::Undefined();
-        const Real F107ObsLast81 = row[28].isDefined() ? row[28].getReal() : Real::Undefined();
-        const Real F107AdjCenter81 = row[29].isDefined() ? row[29].getReal() : Real::Undefined();
-        const Real F107AdjLast81 = row[30].isDefined() ? row[30].getReal() : Real::Undefined();
-
-        const CSSISpaceWeather::Reading reading = {
-            date,
-            BSRN,
-            ND,
-            Kp1,
-            Kp2,
-            Kp3,
-            Kp4,
-            Kp5,
-            Kp6,
-            Kp7,
-            Kp8,
-            KpSum,
-            Ap1,
-            Ap2,
-            Ap3,
-            Ap4,
-            Ap5,
-            Ap6,
-            Ap7,
-            Ap8,
-            ApAvg,
-            Cp,
-            C9,
-            ISN,
-            F107Obs,
-            F107Adj,
-            F107DataType,
-            F107ObsCenter81,
-            F107ObsLast81,
-            F107AdjCenter81,
-            F107AdjLast81,
-        };
-
-        if (F107DataType == "OBS" || F107DataType == "INT")
-        {
-            spaceWeather.observations_.insert({mjd, reading});
-        }
-        else if (F107DataType == "PRD")
+        try
         {
-            spaceWeather.dailyPredictions_.insert({mjd, reading});
-        }
-        else
-        {
-            spaceWeather.monthlyPredictions_.insert({mjd, reading});
-        }
-    }
-
-    if (!spaceWeather.observations_.empty())
-    {
-        spaceWeather.lastObservationDate_ = spaceWeather.observations_.rbegin()->second.date;
-
-        const Instant observationStartInstant =
-            Instant::ModifiedJulianDate(Real::Integer(spaceWeather.observations_.begin()->first), Scale::UTC);
-
-        // End at the end of the day
-        const Instant observationEndInstant =
-            Instant::ModifiedJulianDate(Real::Integer(spaceWeather.observations_.rbegin()->first), Scale::UTC) +
-            Duration::Days(1);
-
-        spaceWeather.observationInterval_ =
-            Interval(observationStartInstant, observationEndInstant, Interval::Type::HalfOpenRight);
-    }
-
-    if (!spaceWeather.dailyPredictions_.empty())
-    {
-        const Instant dailyPredictionStartInstant =
-            Instant::ModifiedJulianDate(Real::Integer(spaceWeather.dailyPredictions_.begin()->first), Scale::UTC);
-
-        // End at the end of the day
-        const Instant dailyPredictionEndInstant =
-            Instant::ModifiedJulianDate(Real::Integer(spaceWeather.dailyPredictions_.rbegin()->first), Scale::UTC) +
-            Duration::Days(1);
-
-        spaceWeather.dailyPredictionInterval_ =
-            Interval(dailyPredictionStartInstant, dailyPredictionEndInstant, Interval::Type::HalfOpenRight);
+            if (fieldCount < fields.size())
+            {
+                throw ostk::core::error::RuntimeError("Missing fields.");
+            }
 
-        // Use the last daily prediction to make an artificial first monthly prediction
-        // so that the data Intervals overlap
-        const CSSISpaceWeather::Reading& lastDailyPrediction = spaceWeather.dailyPredictions_.rbegin()->second;
+            const int year = ParseInteger(fields[0].substr(0, 4));
 
-        Date monthBeginningDate = lastDailyPrediction.date;
-        monthBeginningDate.setDay(1);
+            // [TBR] Toss data past 2030 due to this restriction in the Instant class
+            if (year > 2030)
+            {
+                continue;
+            }
 
-        CSSISpaceWeather::Reading overlapMonthlyReading = lastDailyPrediction;
-        overlapMonthlyReading.date = monthBeginningDate;
-        overlapMonthlyReading.F107DataType = "PRM";
+            if ((fields[0].size() != 10) || (fields[0][4] != '-') || (fields[0][7] != '-'))
+            {
+                throw ostk::core::error::RuntimeError("Invalid date.");
+            }
 
-        const Integer monthMjd = DateTime(monthBeginningDate, Time::Midnight()).getModifiedJulianDate().floor();
-        spaceWeather.monthlyPredictions_.insert({monthMjd, overlapMonthlyReading});
+            const int month = ParseInteger(fields[0].substr(5, 2));
+            const int day = ParseInteger(fields[0].substr(8, 2));
+
+            const Date date = Date(year, month, day);
+
+            const Integer mjd = ModifiedJulianDay(year, month, day);
+
+            const Integer BSRN = ParseOptionalInteger(fields[1]);
+            const Integer ND = ParseOptionalInteger(fields[2]);
+            const Integer Kp1 = ParseOptionalInteger(fields[3]);
+            const Integer Kp2 = ParseOptionalInteger(fields[4]);
+            const Integer Kp3 = ParseOptionalInteger(fields[5]);
+            const Integer Kp4 = ParseOptionalInteger(fields[6]);
+            const Integer Kp5 = ParseOptionalInteger(fields[7]);
+            const Integer Kp6 = ParseOptionalInteger(fields[8]);
+            const Integer Kp7 = ParseOptionalInteger(fields[9]);
+            const Integer Kp8 = ParseOptionalInteger(fields[10]);
+            const Integer KpSum = ParseOptionalInteger(fields[11]);
+            const Integer Ap1 = ParseOptionalInteger(fields[12]);
+            const Integer Ap2 = ParseOptionalInteger(fields[13]);
+            const Integer Ap3 = ParseOptionalInteger(fields[14]);
+            const Integer Ap4 = ParseOptionalInteger(fields[15]);
+            const Integer Ap5 = ParseOptionalInteger(fields[16]);
+            const Integer Ap6 = ParseOptionalInteger(fields[17]);
+            const Integer Ap7 = ParseOptionalInteger(fields[18]);
+            const Integer Ap8 = ParseOptionalInteger(fields[19]);
+            const Integer ApAvg = ParseOptionalInteger(fields[20]);
+            const Real Cp = ParseOptionalReal(fields[21]);
+            const Integer C9 = ParseOptionalInteger(fields[22]);
+            const Integer ISN = ParseOptionalInteger(fields[23]);
+            const Real F107Obs = ParseOptionalReal(fields[24]);
+            const Real F107Adj = ParseOptionalReal(fields[25]);
+            const String F107DataType = String(std::string(fields[26]));
+            const Real F107ObsCenter81 = ParseOptionalReal(fields[27]);
+            const Real F107ObsLast81 = ParseOptionalReal(fields[28]);
+            const Real F107AdjCenter81 = ParseOptionalReal(fields[29]);
+            const Real F107AdjLast81 = ParseOptionalReal(fields[30]);
+
+            const CSSISpaceWeather::Reading reading = {
+                date,
+                BSRN,
+                ND,
+                Kp1,
+                Kp2,
+                Kp3,
+                Kp4,
+                Kp5,
+                Kp6,
+                Kp7,
+                Kp8,
+                KpSum,
+                Ap1,
+                Ap2,
+                Ap3,
+                Ap4,
+                Ap5,
+                Ap6,
+                Ap7,
+                Ap8,
+                ApAvg,
+                Cp,
+                C9,
+                ISN,
+                F107Obs,
+                F107Adj,
+                F107DataType,
+                F107ObsCenter81,
+                F107ObsLast81,
+                F107AdjCenter81,
+                F107AdjLast81,
+            };
+
+            if (F107DataType == "OBS" || F107DataType == "INT")
+            {
+                observations.insert({mjd, reading});
+            }
+            else if (F107DataType == "PRD")
+            {
+                dailyPredictions.insert({mjd, reading});
+            }
+            else
+            {
+                monthlyPredictions.insert({mjd, reading});
+            }
+        }
+        catch (...)
+        {
+            throw ostk::core::error::RuntimeError("CSSISpaceWeather failed to parse line: {}", std::string(line));
+        }
     }
 
-    if (!spaceWeather.monthlyPredictions_.empty())
-    {
-        const Instant monthlyPredictionStartInstant =
-            Instant::ModifiedJulianDate(Real::Integer(spaceWeather.monthlyPredictions_.begin()->first), Scale::UTC);
-
-        // End at the end of the day
-        const Instant monthlyPredictionEndInstant =
-            Instant::ModifiedJulianDate(Real::Integer(spaceWeather.monthlyPredictions_.rbegin()->first), Scale::UTC);
-
-        spaceWeather.monthlyPredictionInterval_ =
-            Interval::Closed(monthlyPredictionStartInstant, monthlyPredictionEndInstant);
-    }
+    spaceWeather.setReadings_(observations, dailyPredictions, monthlyPredictions);
 
     return spaceWeather;
 }
 
 CSSISpaceWeather CSSISpaceWeather::LoadLegacy(const File& aFile)
 {
-    using ostk::core::type::Index;
-    using ostk::core::type::Uint8;
-    using ostk::core::type::Uint16;
     using ostk::core::type::Real;
     using ostk::core::type::String;
 
@@ -625,105 +868,64 @@ CSSISpaceWeather CSSISpaceWeather::LoadLegacy(const File& aFile)
 
     CSSISpaceWeather spaceWeather;
 
-    std::ifstream fileStream {aFile.getPath().toString()};
+    Map<Integer, CSSISpaceWeather::Reading> observations;
+    Map<Integer, CSSISpaceWeather::Reading> dailyPredictions;
+    Map<Integer, CSSISpaceWeather::Reading> monthlyPredictions;
+
+    const std::string buffer = ReadFile(aFile);
+
+    // Data lines have 33 words, the first 2 are enough for tags
+    std::array<std::string_view, 33> words;
 
     bool readingObserved = false;
     bool readingDailyPredicted = false;
     bool readingMonthlyPredicted = false;
 
-    String line;
-
-    auto split_spaces = [](std::string s) -> Array<String>
-    {
-        Array<String> results;
-        const String delimiter = " ";
-
-        size_t last = 0;
-        size_t next = 0;
-        while ((next = s.find(delimiter, last)) != std::string::npos)
-        {
-            // account for multiple consecutive delimiters
-            String token = s.substr(last, next - last);
-            if (token != delimiter)
-            {
-                results.add(token);
-            }
-            last = next + 1;
-        }
-        results.add(s.substr(last));
-        return results;
-    };
-
-    while (std::getline(fileStream, line))
+    for (std::size_t lineStart = 0; lineStart < buffer.size();)
     {
-        Array<String> lineParts = split_spaces(line);
+        const std::string_view line = NextLine(buffer, lineStart);
 
-        // TBI: this is hacky, removes any whitespace strings
-        lineParts.remove({"", " ", "  ", "   "});
+        const Size wordCount = SplitWords(line, words);
 
-        if (lineParts.empty())
+        if (wordCount == 0)
         {
             continue;
         }
 
         // Intepret BEGIN tags
-        if (lineParts.getSize() >= 2 && lineParts[0] == "BEGIN" && lineParts[1] == "OBSERVED")
+        if (wordCount >= 2 && words[0] == "BEGIN" && words[1] == "OBSERVED")
         {
             readingObserved = true;
             continue;
         }
 
-        if (lineParts.getSize() >= 2 && lineParts[0] == "BEGIN" && lineParts[1] == "DAILY_PREDICTED")
+        if (wordCount >= 2 && words[0] == "BEGIN" && words[1] == "DAILY_PREDICTED")
         {
             readingDailyPredicted = true;
             continue;
         }
 
-        if (lineParts.getSize() >= 2 && lineParts[0] == "BEGIN" && lineParts[1] == "MONTHLY_PREDICTED")
+        if (wordCount >= 2 && words[0] == "BEGIN" && words[1] == "MONTHLY_PREDICTED")
         {
             readingMonthlyPredicted = true;
             continue;
         }
 
         // Intepret END tags
-        if (lineParts.getSize() >= 2 && lineParts[0] == "END" && lineParts[1] == "OBSERVED")
+        if (wordCount >= 2 && words[0] == "END" && words[1] == "OBSERVED")
         {
             readingObserved = false;
 
-            spaceWeather.lastObservationDate_ = spaceWeather.observations_.rbegin()->second.date;
-
-            const Instant observationStartInstant =
-                Instant::ModifiedJulianDate(Real::Integer(spaceWeather.observations_.begin()->first), Scale::UTC);
-
-            // End at the end of the day
-            const Instant observationEndInstant =
-                Instant::ModifiedJulianDate(Real::Integer(spaceWeather.observations_.rbegin()->first), Scale::UTC) +
-                Duration::Days(1);
-
-            spaceWeather.observationInterval_ =
-                Interval(observationStartInstant, observationEndInstant, Interval::Type::HalfOpenRight);
-
             continue;
         }
 
-        if (lineParts.getSize() >= 2 && lineParts[0] == "END" && lineParts[1] == "DAILY_PREDICTED")
+        if (wordCount >= 2 && words[0] == "END" && words[1] == "DAILY_PREDICTED")
         {
             readingDailyPredicted = false;
 
-            const Instant dailyPredictionStartInstant =
-                Instant::ModifiedJulianDate(Real::Integer(spaceWeather.dailyPredictions_.begin()->first), Scale::UTC);
-
-            // End at the end of the day
-            const Instant dailyPredictionEndInstant =
-                Instant::ModifiedJulianDate(Real::Integer(spaceWeather.dailyPredictions_.rbegin()->first), Scale::UTC) +
-                Duration::Days(1);
-
-            spaceWeather.dailyPredictionInterval_ =
-                Interval(dailyPredictionStartInstant, dailyPredictionEndInstant, Interval::Type::HalfOpenRight);
-
             // Use the last daily prediction to make an artificial first monthly prediction
-            // so that the data Intervals overlap
-            const CSSISpaceWeather::Reading& lastDailyPrediction = spaceWeather.dailyPredictions_.rbegin()->second;
+            // so that the data Intervals overlap (inserted before the monthly predictions, so it takes precedence)
+            const CSSISpaceWeather::Reading& lastDailyPrediction = dailyPredictions.rbegin()->second;
 
             Date monthBeginningDate = lastDailyPrediction.date;
             monthBeginningDate.setDay(1);
@@ -733,64 +935,58 @@ CSSISpaceWeather CSSISpaceWeather::LoadLegacy(const File& aFile)
             overlapMonthlyReading.F107DataType = "PRM";
 
             const Integer monthMjd = DateTime(monthBeginningDate, Time::Midnight()).getModifiedJulianDate().floor();
-            spaceWeather.monthlyPredictions_.insert({monthMjd, overlapMonthlyReading});
+            monthlyPredictions.insert({monthMjd, overlapMonthlyReading});
 
             continue;
         }
 
-        if (lineParts.getSize() >= 2 && lineParts[0] == "END" && lineParts[1] == "MONTHLY_PREDICTED")
+        if (wordCount >= 2 && words[0] == "END" && words[1] == "MONTHLY_PREDICTED")
         {
             readingMonthlyPredicted = false;
-
-            const Instant monthlyPredictionStartInstant =
-                Instant::ModifiedJulianDate(Real::Integer(spaceWeather.monthlyPredictions_.begin()->first), Scale::UTC);
-
-            const Instant monthlyPredictionEndInstant = Instant::ModifiedJulianDate(
-                Real::Integer(spaceWeather.monthlyPredictions_.rbegin()->first), Scale::UTC
-            );
-
-            spaceWeather.monthlyPredictionInterval_ =
-                Interval::Closed(monthlyPredictionStartInstant, monthlyPredictionEndInstant);
         }
 
         if (readingObserved || readingDailyPredicted || readingMonthlyPredicted)
         {
             try
             {
-                Integer DATE_YEAR = boost::lexical_cast<int>(lineParts[0]);
-                Integer DATE_MONT = boost::lexical_cast<int>(lineParts[1]);
-                Integer DATE_DAY = boost::lexical_cast<int>(lineParts[2]);
-                Integer BSRN = boost::lexical_cast<int>(lineParts[3]);
-                Integer ND = boost::lexical_cast<int>(lineParts[4]);
-                Integer Kp1 = boost::lexical_cast<int>(lineParts[5]);
-                Integer Kp2 = boost::lexical_cast<int>(lineParts[6]);
-                Integer Kp3 = boost::lexical_cast<int>(lineParts[7]);
-                Integer Kp4 = boost::lexical_cast<int>(lineParts[8]);
-                Integer Kp5 = boost::lexical_cast<int>(lineParts[9]);
-                Integer Kp6 = boost::lexical_cast<int>(lineParts[10]);
-                Integer Kp7 = boost::lexical_cast<int>(lineParts[11]);
-                Integer Kp8 = boost::lexical_cast<int>(lineParts[12]);
-                Integer KpSum = boost::lexical_cast<int>(lineParts[13]);
-                Integer Ap1 = boost::lexical_cast<int>(lineParts[14]);
-                Integer Ap2 = boost::lexical_cast<int>(lineParts[15]);
-                Integer Ap3 = boost::lexical_cast<int>(lineParts[16]);
-                Integer Ap4 = boost::lexical_cast<int>(lineParts[17]);
-                Integer Ap5 = boost::lexical_cast<int>(lineParts[18]);
-                Integer Ap6 = boost::lexical_cast<int>(lineParts[19]);
-                Integer Ap7 = boost::lexical_cast<int>(lineParts[20]);
-                Integer Ap8 = boost::lexical_cast<int>(lineParts[21]);
-                Integer ApAvg = boost::lexical_cast<int>(lineParts[22]);
-                Real Cp = boost::lexical_cast<double>(lineParts[23]);
-                Integer C9 = boost::lexical_cast<int>(lineParts[24]);
-                Integer ISN = boost::lexical_cast<int>(lineParts[25]);
-                Real F107Adj = boost::lexical_cast<double>(lineParts[26]);
-                // Real Q = boost::lexical_cast<double>(lineParts[27]); // This isn't in the CSV format, so let's ignore
-                // it
-                Real F107AdjCenter81 = boost::lexical_cast<double>(lineParts[28]);
-                Real F107AdjLast81 = boost::lexical_cast<double>(lineParts[29]);
-                Real F107Obs = boost::lexical_cast<double>(lineParts[30]);
-                Real F107ObsCenter81 = boost::lexical_cast<double>(lineParts[31]);
-                Real F107ObsLast81 = boost::lexical_cast<double>(lineParts[32]);
+                if (wordCount < words.size())
+                {
+                    throw ostk::core::error::RuntimeError("Missing words.");
+                }
+
+                Integer DATE_YEAR = ParseInteger(words[0]);
+                Integer DATE_MONT = ParseInteger(words[1]);
+                Integer DATE_DAY = ParseInteger(words[2]);
+                Integer BSRN = ParseInteger(words[3]);
+                Integer ND = ParseInteger(words[4]);
+                Integer Kp1 = ParseInteger(words[5]);
+                Integer Kp2 = ParseInteger(words[6]);
+                Integer Kp3 = ParseInteger(words[7]);
+                Integer Kp4 = ParseInteger(words[8]);
+                Integer Kp5 = ParseInteger(words[9]);
+                Integer Kp6 = ParseInteger(words[10]);
+                Integer Kp7 = ParseInteger(words[11]);
+                Integer Kp8 = ParseInteger(words[12]);
+                Integer KpSum = ParseInteger(words[13]);
+                Integer Ap1 = ParseInteger(words[14]);
+                Integer Ap2 = ParseInteger(words[15]);
+                Integer Ap3 = ParseInteger(words[16]);
+                Integer Ap4 = ParseInteger(words[17]);
+                Integer Ap5 = ParseInteger(words[18]);
+                Integer Ap6 = ParseInteger(words[19]);
+                Integer Ap7 = ParseInteger(words[20]);
+                Integer Ap8 = ParseInteger(words[21]);
+                Integer ApAvg = ParseInteger(words[22]);
+                Real Cp = ParseReal(words[23]);
+                Integer C9 = ParseInteger(words[24]);
+                Integer ISN = ParseInteger(words[25]);
+                Real F107Adj = ParseReal(words[26]);
+                // Real Q = ParseReal(words[27]); // This isn't in the CSV format, so let's ignore it
+                Real F107AdjCenter81 = ParseReal(words[28]);
+                Real F107AdjLast81 = ParseReal(words[29]);
+                Real F107Obs = ParseReal(words[30]);
+                Real F107ObsCenter81 = ParseReal(words[31]);
+                Real F107ObsLast81 = ParseReal(words[32]);
 
                 Date date = Date(DATE_YEAR, DATE_MONT, DATE_DAY);
 
@@ -800,7 +996,7 @@ CSSISpaceWeather CSSISpaceWeather::LoadLegacy(const File& aFile)
                     continue;
                 }
 
-                const Integer mjd = DateTime(date, Time(0, 0, 0)).getModifiedJulianDate().floor();
+                const Integer mjd = ModifiedJulianDay(DATE_YEAR, DATE_MONT, DATE_DAY);
 
                 String F107DataType;
 
@@ -853,40 +1049,254 @@ CSSISpaceWeather CSSISpaceWeather::LoadLegacy(const File& aFile)
 
                 if (readingObserved)
                 {
-                    spaceWeather.observations_.insert({mjd, reading});
+                    observations.insert({mjd, reading});
                 }
                 else if (readingDailyPredicted)
                 {
-                    spaceWeather.dailyPredictions_.insert({mjd, reading});
+                    dailyPredictions.insert({mjd, reading});
                 }
                 else if (readingMonthlyPredicted)
                 {
-                    spaceWeather.monthlyPredictions_.insert({mjd, reading});
+                    monthlyPredictions.insert({mjd, reading});
                 }
 
                 continue;
             }
             catch (...)
             {
-                throw ostk::core::error::RuntimeError("CSSISpaceWeather failed to parse line: {}", line);
+                throw ostk::core::error::RuntimeError("CSSISpaceWeather failed to parse line: {}", std::string(line));
             }
         }
     }
 
+    spaceWeather.setReadings_(observations, dailyPredictions, monthlyPredictions);
+
     return spaceWeather;
 }
 
 CSSISpaceWeather::CSSISpaceWeather()
     : lastObservationDate_(Date::Undefined()),
       observationInterval_(Interval::Undefined()),
-      observations_(Map<Integer, CSSISpaceWeather::Reading>()),
+      firstObservationMjd_(Integer::Undefined()),
+      observations_(Array<CSSISpaceWeather::Reading>::Empty()),
 
       dailyPredictionInterval_(Interval::Undefined()),
-      dailyPredictions_(Map<Integer, CSSISpaceWeather::Reading>()),
+      firstDailyPredictionMjd_(Integer::Undefined()),
+      dailyPredictions_(Array<CSSISpaceWeather::Reading>::Empty()),
 
       monthlyPredictionInterval_(Interval::Undefined()),
-      monthlyPredictions_(Map<Integer, CSSISpaceWeather::Reading>())
+      firstMonthlyPredictionMonth_(Integer::Undefined()),
+      monthlyPredictions_(Array<CSSISpaceWeather::Reading>::Empty()),
+
+      NRLMSISE00ApInterval_(Interval::Undefined()),
+      firstApMjd_(Integer::Undefined()),
+      apDailyIndices_(Array<Real>::Empty()),
+      ap3HourIndices_(Array<Real>::Empty()),
+      ap3HourIndexAverages_(Array<Real>::Empty())
+{
+}
+
+void CSSISpaceWeather::setReadings_(
+    const Map<Integer, CSSISpaceWeather::Reading>& anObservationMap,
+    const Map<Integer, CSSISpaceWeather::Reading>& aDailyPredictionMap,
+    const Map<Integer, CSSISpaceWeather::Reading>& aMonthlyPredictionMap
+)
+{
+    Map<Integer, CSSISpaceWeather::Reading> monthlyPredictionMap = aMonthlyPredictionMap;
+
+    if (!anObservationMap.empty())
+    {
+        lastObservationDate_ = anObservationMap.rbegin()->second.date;
+
+        const Instant observationStartInstant =
+            Instant::ModifiedJulianDate(Real::Integer(anObservationMap.begin()->first), Scale::UTC);
+
+        // End at the end of the day
+        const Instant observationEndInstant =
+            Instant::ModifiedJulianDate(Real::Integer(anObservationMap.rbegin()->first), Scale::UTC) +
+            Duration::Days(1);
+
+        observationInterval_ = Interval(observationStartInstant, observationEndInstant, Interval::Type::HalfOpenRight);
+
+        firstObservationMjd_ = anObservationMap.begin()->first;
+        observations_ = FlattenReadings(anObservationMap);
+    }
+
+    if (!aDailyPredictionMap.empty())
+    {
+        const Instant dailyPredictionStartInstant =
+            Instant::ModifiedJulianDate(Real::Integer(aDailyPredictionMap.begin()->first), Scale::UTC);
+
+        // End at the end of the day
+        const Instant dailyPredictionEndInstant =
+            Instant::ModifiedJulianDate(Real::Integer(aDailyPredictionMap.rbegin()->first), Scale::UTC) +
+            Duration::Days(1);
+
+        dailyPredictionInterval_ =
+            Interval(dailyPredictionStartInstant, dailyPredictionEndInstant, Interval::Type::HalfOpenRight);
+
+        firstDailyPredictionMjd_ = aDailyPredictionMap.begin()->first;
+        dailyPredictions_ = FlattenReadings(aDailyPredictionMap);
+
+        // Use the last daily prediction to make an artificial first monthly prediction
+        // so that the data Intervals overlap
+        const CSSISpaceWeather::Reading& lastDailyPrediction = aDailyPredictionMap.rbegin()->second;
+
+        Date monthBeginningDate = lastDailyPrediction.date;
+        monthBeginningDate.setDay(1);
+
+        CSSISpaceWeather::Reading overlapMonthlyReading = lastDailyPrediction;
+        overlapMonthlyReading.date = monthBeginningDate;
+        overlapMonthlyReading.F107DataType = "PRM";
+
+        const Integer monthMjd = DateTime(monthBeginningDate, Time::Midnight()).getModifiedJulianDate().floor();
+        monthlyPredictionMap.insert({monthMjd, overlapMonthlyReading});
+    }
+
+    if (!monthlyPredictionMap.empty())
+    {
+        const Instant monthlyPredictionStartInstant =
+            Instant::ModifiedJulianDate(Real::Integer(monthlyPredictionMap.begin()->first), Scale::UTC);
+
+        const Instant monthlyPredictionEndInstant =
+            Instant::ModifiedJulianDate(Real::Integer(monthlyPredictionMap.rbegin()->first), Scale::UTC);
+
+        monthlyPredictionInterval_ = Interval::Closed(monthlyPredictionStartInstant, monthlyPredictionEndInstant);
+
+        // Monthly predictions are indexed by month number, as months do not have a constant number of days
+        Map<Integer, CSSISpaceWeather::Reading> monthlyPredictionsByMonth;
+
+        for (const auto& monthlyPredictionIt : monthlyPredictionMap)
+        {
+            monthlyPredictionsByMonth.insert(
+                {MonthNumber(monthlyPredictionIt.second.date), monthlyPredictionIt.second}
+            );
+        }
+
+        firstMonthlyPredictionMonth_ = monthlyPredictionsByMonth.begin()->first;
+        monthlyPredictions_ = FlattenReadings(monthlyPredictionsByMonth);
+    }
+
+    this->computeApIndices_();
+}
+
+void CSSISpaceWeather::computeApIndices_()
 {
+    // Ap indices are precomputed over observations and daily predictions, following the same rules as the Manager:
+    // readings are looked up in observations first, and undefined Ap indices are replaced by the ones of the last
+    // reading where they are defined
+
+    if (observations_.isEmpty() && dailyPredictions_.isEmpty())
+    {
+        return;
+    }
+
+    const Integer firstMjd = (!observations_.isEmpty()) ? firstObservationMjd_ : firstDailyPredictionMjd_;
+    const Integer lastMjd = (!dailyPredictions_.isEmpty())
+                              ? firstDailyPredictionMjd_ + Integer(dailyPredictions_.getSize()) - 1
+                              : firstObservationMjd_ + Integer(observations_.getSize()) - 1;
+
+    const CSSISpaceWeather::Reading* lastAp3HourReadingPtr = nullptr;
+    const CSSISpaceWeather::Reading* lastApDailyReadingPtr = nullptr;
+
+    Integer firstApMjd = Integer::Undefined();
+
+    Array<Real> apDailyIndices = Array<Real>::Empty();
+    Array<Real> ap3HourIndices = Array<Real>::Empty();
+
+    apDailyIndices.reserve(lastMjd - firstMjd + 1);
+    ap3HourIndices.reserve(8 * (lastMjd - firstMjd + 1));
+
+    for (Integer mjd = firstMjd; mjd <= lastMjd; ++mjd)
+    {
+        const CSSISpaceWeather::Reading* readingPtr = FindReading(observations_, firstObservationMjd_, mjd);
+
+        if (readingPtr == nullptr)
+        {
+            readingPtr = FindReading(dailyPredictions_, firstDailyPredictionMjd_, mjd);
+        }
+
+        // Missing day, Ap indices are not precomputed
+        if (readingPtr == nullptr)
+        {
+            return;
+        }
+
+        if (Ap3HourIndicesAreDefined(*readingPtr))
+        {
+            lastAp3HourReadingPtr = readingPtr;
+        }
+
+        if (readingPtr->ApAvg.isDefined())
+        {
+            lastApDailyReadingPtr = readingPtr;
+        }
+
+        // Skip leading days without any defined Ap indices
+        if ((lastAp3HourReadingPtr == nullptr) || (lastApDailyReadingPtr == nullptr))
+        {
+            continue;
+        }
+
+        if (!firstApMjd.isDefined())
+        {
+            firstApMjd = mjd;
+        }
+
+        apDailyIndices.add(Real::Integer(lastApDailyReadingPtr->ApAvg));
+
+        ap3HourIndices.add(Real::Integer(lastAp3HourReadingPtr->Ap1));
+        ap3HourIndices.add(Real::Integer(lastAp3HourReadingPtr->Ap2));
+        ap3HourIndices.add(Real::Integer(lastAp3HourReadingPtr->Ap3));
+        ap3HourIndices.add(Real::Integer(lastAp3HourReadingPtr->Ap4));
+        ap3HourIndices.add(Real::Integer(lastAp3HourReadingPtr->Ap5));
+        ap3HourIndices.add(Real::Integer(lastAp3HourReadingPtr->Ap6));
+        ap3HourIndices.add(Real::Integer(lastAp3HourReadingPtr->Ap7));
+        ap3HourIndices.add(Real::Integer(lastAp3HourReadingPtr->Ap8));
+    }
+
+    if (!firstApMjd.isDefined())
+    {
+        return;
+    }
+
+    // NRLMSISE00 needs the 3-hourly Ap indices up to 57 hours before the Instant
+
+    const Instant startInstant =
+        Instant::ModifiedJulianDate(Real::Integer(firstApMjd), Scale::UTC) + Duration::Hours(57.0);
+    const Instant endInstant = Instant::ModifiedJulianDate(Real::Integer(lastMjd + 1), Scale::UTC);
+
+    if (startInstant >= endInstant)
+    {
+        return;
+    }
+
+    Array<Real> ap3HourIndexAverages = Array<Real>::Empty();
+    ap3HourIndexAverages.reserve(ap3HourIndices.getSize());
+
+    for (Size index = 0; index < ap3HourIndices.getSize(); ++index)
+    {
+        if (index < 7)
+        {
+            ap3HourIndexAverages.add(Real::Undefined());
+            continue;
+        }
+
+        Real apSum = 0.0;
+
+        for (Size offset = 0; offset < 8; ++offset)
+        {
+            apSum += ap3HourIndices[index - offset];
+        }
+
+        ap3HourIndexAverages.add(apSum / 8.0);
+    }
+
+    NRLMSISE00ApInterval_ = Interval(startInstant, endInstant, Interval::Type::HalfOpenRight);
+    firstApMjd_ = firstApMjd;
+    apDailyIndices_ = apDailyIndices;
+    ap3HourIndices_ = ap3HourIndices;
+    ap3HourIndexAverages_ = ap3HourIndexAverages;
 }
 
 }  // namespace earth
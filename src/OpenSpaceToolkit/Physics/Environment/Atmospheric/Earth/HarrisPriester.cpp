@@ -0,0 +1,216 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/HarrisPriester.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace environment
+{
+namespace atmospheric
+{
+namespace earth
+{
+
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+using ostk::physics::time::Scale;
+
+// Reference values defined in Satellite Orbits by Montenbruck and Gill p. 91, for mean solar activity
+// Altitude [km], minimum density [g/km^3], maximum density [g/km^3]
+
+static constexpr Size TableSize = 50;
+
+static constexpr double TableAltitudes[TableSize] = {
+    100.0, 120.0, 130.0, 140.0, 150.0, 160.0, 170.0, 180.0, 190.0, 200.0, 210.0, 220.0, 230.0,
+    240.0, 250.0, 260.0, 270.0, 280.0, 290.0, 300.0, 320.0, 340.0, 360.0, 380.0, 400.0, 420.0,
+    440.0, 460.0, 480.0, 500.0, 520.0, 540.0, 560.0, 580.0, 600.0, 620.0, 640.0, 660.0, 680.0,
+    700.0, 720.0, 740.0, 760.0, 780.0, 800.0, 840.0, 880.0, 920.0, 960.0, 1000.0
+};
+
+static constexpr double TableMinimumDensities[TableSize] = {
+    4.974e+05, 2.490e+04, 8.377e+03, 3.899e+03, 2.122e+03, 1.263e+03, 8.008e+02, 5.283e+02, 3.617e+02, 2.557e+02,
+    1.839e+02, 1.341e+02, 9.949e+01, 7.488e+01, 5.709e+01, 4.403e+01, 3.430e+01, 2.697e+01, 2.139e+01, 1.708e+01,
+    1.099e+01, 7.214e+00, 4.824e+00, 3.274e+00, 2.249e+00, 1.558e+00, 1.091e+00, 7.701e-01, 5.474e-01, 3.916e-01,
+    2.819e-01, 2.042e-01, 1.488e-01, 1.092e-01, 8.070e-02, 6.012e-02, 4.519e-02, 3.430e-02, 2.632e-02, 2.043e-02,
+    1.607e-02, 1.281e-02, 1.036e-02, 8.496e-03, 7.069e-03, 4.680e-03, 3.200e-03, 2.210e-03, 1.560e-03, 1.150e-03
+};
+
+static constexpr double TableMaximumDensities[TableSize] = {
+    4.974e+05, 2.490e+04, 8.710e+03, 4.059e+03, 2.215e+03, 1.344e+03, 8.758e+02, 6.010e+02, 4.297e+02, 3.162e+02,
+    2.396e+02, 1.853e+02, 1.455e+02, 1.157e+02, 9.308e+01, 7.555e+01, 6.182e+01, 5.095e+01, 4.226e+01, 3.526e+01,
+    2.511e+01, 1.819e+01, 1.337e+01, 9.955e+00, 7.492e+00, 5.684e+00, 4.355e+00, 3.362e+00, 2.612e+00, 2.042e+00,
+    1.605e+00, 1.267e+00, 1.005e+00, 7.997e-01, 6.390e-01, 5.123e-01, 4.121e-01, 3.325e-01, 2.691e-01, 2.185e-01,
+    1.779e-01, 1.452e-01, 1.190e-01, 9.776e-02, 8.059e-02, 5.741e-02, 4.210e-02, 3.130e-02, 2.360e-02, 1.810e-02
+};
+
+// Right ascension lag of the diurnal bulge apex with respect to the Sun [rad]
+static constexpr double BulgeLag = 30.0 * M_PI / 180.0;
+
+HarrisPriester::HarrisPriester(
+    const Real& aCosineExponent, const Shared<const Frame>& anEarthFrameSPtr, const Shared<Celestial>& aSunCelestialSPtr
+)
+    : cosineExponent_(aCosineExponent),
+      earthFrameSPtr_(anEarthFrameSPtr),
+      sunCelestialSPtr_(aSunCelestialSPtr)
+{
+}
+
+HarrisPriester* HarrisPriester::clone() const
+{
+    return new HarrisPriester(*this);
+}
+
+bool HarrisPriester::isDefined() const
+{
+    return cosineExponent_.isDefined() && (earthFrameSPtr_ != nullptr);
+}
+
+Real HarrisPriester::getCosineExponent() const
+{
+    return cosineExponent_;
+}
+
+Real HarrisPriester::getDensityAt(const LLA& aLLA, const Instant& anInstant) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Harris-Priester");
+    }
+
+    return this->computeDensityAt(aLLA, this->computeBulgeApexDirectionAt(anInstant));
+}
+
+Array<Real> HarrisPriester::getDensitiesAt(const Array<LLA>& anLLAArray, const Instant& anInstant) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Harris-Priester");
+    }
+
+    const Vector3d bulgeApexDirection = this->computeBulgeApexDirectionAt(anInstant);
+
+    Array<Real> densities = Array<Real>::Empty();
+    densities.reserve(anLLAArray.getSize());
+
+    for (const LLA& lla : anLLAArray)
+    {
+        densities.add(this->computeDensityAt(lla, bulgeApexDirection));
+    }
+
+    return densities;
+}
+
+Vector3d HarrisPriester::computeBulgeApexDirectionAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    double sunDeclination = 0.0;
+    double sunLongitude = 0.0;  // Earth-fixed longitude of the Sun
+
+    if (sunCelestialSPtr_ != nullptr)
+    {
+        const Vector3d sunDirection =
+            sunCelestialSPtr_->getPositionIn(earthFrameSPtr_, anInstant).accessCoordinates().normalized();
+
+        sunDeclination = std::asin(sunDirection.z());
+        sunLongitude = std::atan2(sunDirection.y(), sunDirection.x());
+    }
+    else
+    {
+        // Low precision Sun position (Montenbruck and Gill p. 70), and Greenwich Mean Sidereal Time (UT1 ~ UTC)
+
+        const double d = anInstant.getJulianDate(Scale::UTC) - 2451545.0;
+        const double T = d / 36525.0;
+
+        const double meanAnomaly = (357.5256 + 35999.049 * T) * M_PI / 180.0;
+        const double eclipticLongitude =
+            meanAnomaly +
+            (282.9400 + 6892.0 / 3600.0 * std::sin(meanAnomaly) + 72.0 / 3600.0 * std::sin(2.0 * meanAnomaly)) * M_PI /
+                180.0;
+        const double obliquity = 23.43929111 * M_PI / 180.0;
+
+        const double sunRightAscension =
+            std::atan2(std::cos(obliquity) * std::sin(eclipticLongitude), std::cos(eclipticLongitude));
+
+        const double greenwichMeanSiderealTime =
+            (280.46061837 + 360.98564736629 * d + 0.000387933 * T * T) * M_PI / 180.0;
+
+        sunDeclination = std::asin(std::sin(obliquity) * std::sin(eclipticLongitude));
+        sunLongitude = sunRightAscension - greenwichMeanSiderealTime;
+    }
+
+    const double apexLongitude = sunLongitude + BulgeLag;
+
+    return {
+        std::cos(sunDeclination) * std::cos(apexLongitude),
+        std::cos(sunDeclination) * std::sin(apexLongitude),
+        std::sin(sunDeclination)
+    };
+}
+
+Real HarrisPriester::computeDensityAt(const LLA& aLLA, const Vector3d& aBulgeApexDirection) const
+{
+    const double altitude = aLLA.getAltitude().inKilometers();
+
+    if ((altitude < TableAltitudes[0]) || (altitude > TableAltitudes[TableSize - 1]))
+    {
+        throw ostk::core::error::RuntimeError(String::Format(
+            "Harris-Priester density model is only valid for altitudes between 100 km and 1000 km. Altitude = {}",
+            aLLA.getAltitude().toString()
+        ));
+    }
+
+    // Altitude band, such that TableAltitudes[index] <= altitude < TableAltitudes[index + 1]
+
+    const Size index = std::min(
+        static_cast<Size>(std::upper_bound(TableAltitudes, TableAltitudes + TableSize, altitude) - TableAltitudes) - 1,
+        TableSize - 2
+    );
+
+    const double altitudeOffset = altitude - TableAltitudes[index];
+    const double bandHeight = TableAltitudes[index + 1] - TableAltitudes[index];
+
+    // Exponential interpolation within the band
+
+    const double minimumDensity =
+        TableMinimumDensities[index] *
+        std::pow(TableMinimumDensities[index + 1] / TableMinimumDensities[index], altitudeOffset / bandHeight);
+    const double maximumDensity =
+        TableMaximumDensities[index] *
+        std::pow(TableMaximumDensities[index + 1] / TableMaximumDensities[index], altitudeOffset / bandHeight);
+
+    // cos^n(psi / 2), with psi the angle between the position and the diurnal bulge apex
+
+    const double latitude = aLLA.getLatitude().inRadians();
+    const double longitude = aLLA.getLongitude().inRadians();
+
+    const Vector3d direction = {
+        std::cos(latitude) * std::cos(longitude), std::cos(latitude) * std::sin(longitude), std::sin(latitude)
+    };
+
+    const double cosineHalfAngleSquared = 0.5 + 0.5 * direction.dot(aBulgeApexDirection);
+    const double cosinePower =
+        std::pow(std::max(cosineHalfAngleSquared, 0.0), 0.5 * static_cast<double>(cosineExponent_));
+
+    // [g/km^3] to [kg/m^3]
+    return (minimumDensity + (maximumDensity - minimumDensity) * cosinePower) * 1e-12;
+}
+
+}  // namespace earth
+}  // namespace atmospheric
+}  // namespace environment
+}  // namespace physics
+}  // namespace ostk
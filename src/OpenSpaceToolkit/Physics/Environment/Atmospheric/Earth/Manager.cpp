@@ -3,6 +3,7 @@
 #include <chrono>
 #include <cstdlib>
 #include <fstream>
+#include <memory>
 #include <numeric>
 #include <thread>
 
@@ -79,117 +80,104 @@ Directory Manager::getCSSISpaceWeatherDirectory() const
 
 CSSISpaceWeather Manager::getLoadedCSSISpaceWeather() const
 {
-    std::lock_guard<std::mutex> lock {mutex_};
+    const Shared<const CSSISpaceWeather> CSSISpaceWeatherSPtr = CSSISpaceWeatherSPtr_.load();
+
+    if (CSSISpaceWeatherSPtr != nullptr)
+    {
+        return *CSSISpaceWeatherSPtr;
+    }
 
-    return CSSISpaceWeather_;
+    return CSSISpaceWeather::Undefined();
 }
 
 CSSISpaceWeather Manager::getCSSISpaceWeatherAt(const Instant& anInstant) const
 {
-    std::lock_guard<std::mutex> lock {mutex_};
-
-    const CSSISpaceWeather* CSSISpaceWeatherPtr = this->accessCSSISpaceWeatherAt(anInstant);
-
-    if (CSSISpaceWeatherPtr != nullptr)
-    {
-        return *CSSISpaceWeatherPtr;
-    }
-
-    throw ostk::core::error::RuntimeError("Cannot obtain CSSI Space Weather File at [{}].", anInstant.toString());
+    return *this->accessCSSISpaceWeatherAt(anInstant);
 }
 
 Array<Integer> Manager::getKp3HourSolarIndicesAt(const Instant& anInstant) const
 {
-    std::lock_guard<std::mutex> lock {mutex_};
-    const CSSISpaceWeather* CSSISpaceWeatherPtr = this->accessCSSISpaceWeatherAt(anInstant);
-
-    static auto getKpArray = [](const CSSISpaceWeather::Reading& aReading) -> Array<Integer>
-    {
-        return Array<Integer> {
-            aReading.Kp1,
-            aReading.Kp2,
-            aReading.Kp3,
-            aReading.Kp4,
-            aReading.Kp5,
-            aReading.Kp6,
-            aReading.Kp7,
-            aReading.Kp8,
-        };
+    const Shared<const CSSISpaceWeather::Reading> readingSPtr = this->accessKp3HourSolarIndexReadingAt(anInstant);
+
+    return Array<Integer> {
+        readingSPtr->Kp1,
+        readingSPtr->Kp2,
+        readingSPtr->Kp3,
+        readingSPtr->Kp4,
+        readingSPtr->Kp5,
+        readingSPtr->Kp6,
+        readingSPtr->Kp7,
+        readingSPtr->Kp8,
     };
+}
 
-    static auto outputIsDefined = [](const CSSISpaceWeather::Reading& reading) -> bool
+Shared<const CSSISpaceWeather::Reading> Manager::accessKp3HourSolarIndexReadingAt(const Instant& anInstant) const
+{
+    const Shared<const CSSISpaceWeather> CSSISpaceWeatherSPtr = this->accessCSSISpaceWeatherAt(anInstant);
+
+    static auto outputIsDefined = [](const CSSISpaceWeather::Reading& aReading) -> bool
     {
-        const Array<Integer>& array = getKpArray(reading);
-        return std::all_of(
-            array.begin(),
-            array.end(),
-            [](const Integer& val)
-            {
-                return val.isDefined();
-            }
-        );
+        return aReading.Kp1.isDefined() && aReading.Kp2.isDefined() && aReading.Kp3.isDefined() &&
+               aReading.Kp4.isDefined() && aReading.Kp5.isDefined() && aReading.Kp6.isDefined() &&
+               aReading.Kp7.isDefined() && aReading.Kp8.isDefined();
     };
 
-    const CSSISpaceWeather::Reading& reading = CSSISpaceWeatherPtr->accessReadingAt(anInstant);
+    const CSSISpaceWeather::Reading& reading = CSSISpaceWeatherSPtr->accessReadingAt(anInstant);
+
+    // Aliasing pointer: shares ownership of the snapshot, points to one of its readings
 
     if (outputIsDefined(reading))
     {
-        return getKpArray(reading);
+        return {CSSISpaceWeatherSPtr, &reading};
     }
     else
     {
-        return getKpArray(CSSISpaceWeatherPtr->accessLastReadingWhere(outputIsDefined, anInstant));
+        return {CSSISpaceWeatherSPtr, &CSSISpaceWeatherSPtr->accessLastReadingWhere(outputIsDefined, anInstant)};
     }
 }
 
 Array<Integer> Manager::getAp3HourSolarIndicesAt(const Instant& anInstant) const
 {
-    std::lock_guard<std::mutex> lock {mutex_};
-    const CSSISpaceWeather* CSSISpaceWeatherPtr = this->accessCSSISpaceWeatherAt(anInstant);
-
-    static auto getApArray = [](const CSSISpaceWeather::Reading& aReading) -> Array<Integer>
-    {
-        return Array<Integer> {
-            aReading.Ap1,
-            aReading.Ap2,
-            aReading.Ap3,
-            aReading.Ap4,
-            aReading.Ap5,
-            aReading.Ap6,
-            aReading.Ap7,
-            aReading.Ap8,
-        };
+    const Shared<const CSSISpaceWeather::Reading> readingSPtr = this->accessAp3HourSolarIndexReadingAt(anInstant);
+
+    return Array<Integer> {
+        readingSPtr->Ap1,
+        readingSPtr->Ap2,
+        readingSPtr->Ap3,
+        readingSPtr->Ap4,
+        readingSPtr->Ap5,
+        readingSPtr->Ap6,
+        readingSPtr->Ap7,
+        readingSPtr->Ap8,
     };
+}
+
+Shared<const CSSISpaceWeather::Reading> Manager::accessAp3HourSolarIndexReadingAt(const Instant& anInstant) const
+{
+    const Shared<const CSSISpaceWeather> CSSISpaceWeatherSPtr = this->accessCSSISpaceWeatherAt(anInstant);
 
     static auto outputIsDefined = [](const CSSISpaceWeather::Reading& aReading) -> bool
     {
-        const Array<Integer>& array = getApArray(aReading);
-        return std::all_of(
-            array.begin(),
-            array.end(),
-            [](const Integer& val)
-            {
-                return val.isDefined();
-            }
-        );
+        return aReading.Ap1.isDefined() && aReading.Ap2.isDefined() && aReading.Ap3.isDefined() &&
+               aReading.Ap4.isDefined() && aReading.Ap5.isDefined() && aReading.Ap6.isDefined() &&
+               aReading.Ap7.isDefined() && aReading.Ap8.isDefined();
     };
 
-    const CSSISpaceWeather::Reading& reading = CSSISpaceWeatherPtr->accessReadingAt(anInstant);
+    const CSSISpaceWeather::Reading& reading = CSSISpaceWeatherSPtr->accessReadingAt(anInstant);
 
     if (outputIsDefined(reading))
     {
-        return getApArray(reading);
+        return {CSSISpaceWeatherSPtr, &reading};
     }
     else
     {
-        return getApArray(CSSISpaceWeatherPtr->accessLastReadingWhere(outputIsDefined, anInstant));
+        return {CSSISpaceWeatherSPtr, &CSSISpaceWeatherSPtr->accessLastReadingWhere(outputIsDefined, anInstant)};
     }
 }
 
 Integer Manager::getApDailyIndexAt(const Instant& anInstant) const
 {
-    std::lock_guard<std::mutex> lock {mutex_};
-    const CSSISpaceWeather* CSSISpaceWeatherPtr = this->accessCSSISpaceWeatherAt(anInstant);
+    const Shared<const CSSISpaceWeather> CSSISpaceWeatherSPtr = this->accessCSSISpaceWeatherAt(anInstant);
 
     static auto getApDaily = [](const CSSISpaceWeather::Reading& aReading) -> Integer
     {
@@ -201,7 +189,7 @@ Integer Manager::getApDailyIndexAt(const Instant& anInstant) const
         return aReading.ApAvg.isDefined();
     };
 
-    const CSSISpaceWeather::Reading& reading = CSSISpaceWeatherPtr->accessReadingAt(anInstant);
+    const CSSISpaceWeather::Reading& reading = CSSISpaceWeatherSPtr->accessReadingAt(anInstant);
 
     if (outputIsDefined(reading))
     {
@@ -209,14 +197,13 @@ Integer Manager::getApDailyIndexAt(const Instant& anInstant) const
     }
     else
     {
-        return getApDaily(CSSISpaceWeatherPtr->accessLastReadingWhere(outputIsDefined, anInstant));
+        return getApDaily(CSSISpaceWeatherSPtr->accessLastReadingWhere(outputIsDefined, anInstant));
     }
 }
 
 Real Manager::getF107SolarFluxAt(const Instant& anInstant) const
 {
-    std::lock_guard<std::mutex> lock {mutex_};
-    const CSSISpaceWeather* CSSISpaceWeatherPtr = this->accessCSSISpaceWeatherAt(anInstant);
+    const Shared<const CSSISpaceWeather> CSSISpaceWeatherSPtr = this->accessCSSISpaceWeatherAt(anInstant);
 
     static auto getF107Obs = [](const CSSISpaceWeather::Reading& aReading) -> Real
     {
@@ -228,7 +215,7 @@ Real Manager::getF107SolarFluxAt(const Instant& anInstant) const
         return aReading.F107Obs.isDefined();
     };
 
-    const CSSISpaceWeather::Reading& reading = CSSISpaceWeatherPtr->accessReadingAt(anInstant);
+    const CSSISpaceWeather::Reading& reading = CSSISpaceWeatherSPtr->accessReadingAt(anInstant);
 
     if (outputIsDefined(reading))
     {
@@ -236,14 +223,13 @@ Real Manager::getF107SolarFluxAt(const Instant& anInstant) const
     }
     else
     {
-        return getF107Obs(CSSISpaceWeatherPtr->accessLastReadingWhere(outputIsDefined, anInstant));
+        return getF107Obs(CSSISpaceWeatherSPtr->accessLastReadingWhere(outputIsDefined, anInstant));
     }
 }
 
 Real Manager::getF107SolarFlux81DayAvgAt(const Instant& anInstant) const
 {
-    std::lock_guard<std::mutex> lock {mutex_};
-    const CSSISpaceWeather* CSSISpaceWeatherPtr = this->accessCSSISpaceWeatherAt(anInstant);
+    const Shared<const CSSISpaceWeather> CSSISpaceWeatherSPtr = this->accessCSSISpaceWeatherAt(anInstant);
 
     static auto getF107ObsCenter81 = [](const CSSISpaceWeather::Reading& aReading) -> Real
     {
@@ -255,7 +241,7 @@ Real Manager::getF107SolarFlux81DayAvgAt(const Instant& anInstant) const
         return aReading.F107ObsCenter81.isDefined();
     };
 
-    const CSSISpaceWeather::Reading& reading = CSSISpaceWeatherPtr->accessReadingAt(anInstant);
+    const CSSISpaceWeather::Reading& reading = CSSISpaceWeatherSPtr->accessReadingAt(anInstant);
 
     if (outputIsDefined(reading))
     {
@@ -263,7 +249,7 @@ Real Manager::getF107SolarFlux81DayAvgAt(const Instant& anInstant) const
     }
     else
     {
-        return getF107ObsCenter81(CSSISpaceWeatherPtr->accessLastReadingWhere(outputIsDefined, anInstant));
+        return getF107ObsCenter81(CSSISpaceWeatherSPtr->accessLastReadingWhere(outputIsDefined, anInstant));
     }
 }
 
@@ -311,7 +297,7 @@ void Manager::reset()
 {
     std::lock_guard<std::mutex> lock {mutex_};
 
-    CSSISpaceWeather_ = CSSISpaceWeather::Undefined();
+    CSSISpaceWeatherSPtr_.store(nullptr);
 
     localRepository_ = DefaultLocalRepository();
     localRepositoryLockTimeout_ = DefaultLocalRepositoryLockTimeout();
@@ -391,7 +377,7 @@ Manager::Manager(const Manager::Mode& aMode)
     : mode_(aMode),
       localRepository_(Manager::DefaultLocalRepository()),
       localRepositoryLockTimeout_(Manager::DefaultLocalRepositoryLockTimeout()),
-      CSSISpaceWeather_(CSSISpaceWeather::Undefined())
+      CSSISpaceWeatherSPtr_(nullptr)
 {
     this->setup();
 }
@@ -401,73 +387,34 @@ bool Manager::isLocalRepositoryLocked() const
     return this->getLocalRepositoryLockFile().exists();
 }
 
-const CSSISpaceWeather* Manager::accessCSSISpaceWeatherAt(const Instant& anInstant) const
+Shared<const CSSISpaceWeather> Manager::accessCSSISpaceWeatherAt(const Instant& anInstant) const
 {
     if (!anInstant.isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Instant");
     }
 
-    // Try currently loaded
-    if (CSSISpaceWeather_.isDefined())
-    {
-        if (CSSISpaceWeather_.accessObservationInterval().contains(anInstant) ||
-            CSSISpaceWeather_.accessDailyPredictionInterval().contains(anInstant) ||
-            CSSISpaceWeather_.accessMonthlyPredictionInterval().contains(anInstant))
-        {
-            return &CSSISpaceWeather_;
-        }
+    // Lock-free when space weather data is already loaded, otherwise mutex-protected
 
-        throw ostk::core::error::RuntimeError(
-            "Loaded CSSI Space Weather file is not valid for [{}].", anInstant.toString()
-        );
-    }
+    Shared<const CSSISpaceWeather> CSSISpaceWeatherSPtr = CSSISpaceWeatherSPtr_.load();
 
-    // Try loading or fetching latest Space Weather file
-    switch (mode_)
+    if (CSSISpaceWeatherSPtr == nullptr)
     {
-        case Manager::Mode::Automatic:
-        {
-            const File latestCSSISpaceWeatherFile = this->getLatestCSSISpaceWeatherFile();
-
-            if (!latestCSSISpaceWeatherFile.isDefined())
-            {
-                throw ostk::core::error::RuntimeError(
-                    "Failed to load or fetch latest CSSI Space Weather file at {}.",
-                    latestCSSISpaceWeatherFile.getPath().toString());
-            }
-
-            const_cast<Manager *>(this)->loadCSSISpaceWeather_(CSSISpaceWeather::Load(latestCSSISpaceWeatherFile));
-
-            return &CSSISpaceWeather_;
-        }
-
-        case Manager::Mode::Manual:
-        {
-            if (!this->getCSSISpaceWeatherDirectory().containsFileWithName(CSSISpaceWeatherFileName))
-            {
-                throw ostk::core::error::RuntimeError("No CSSI Space Weather data loaded and manager set to Manual mode.");
-            }
-
-            const File localCSSISpaceWeatherFile =
-                File::Path(this->getCSSISpaceWeatherDirectory().getPath() + Path::Parse(CSSISpaceWeatherFileName));
-
-            if (!localCSSISpaceWeatherFile.isDefined())
-            {
-                throw ostk::core::error::RuntimeError(
-                    "Failed to load latest CSSI Space Weather file at {}.", localCSSISpaceWeatherFile.getPath().toString());
-            }
+        std::lock_guard<std::mutex> lock {mutex_};
 
-            const_cast<Manager *>(this)->loadCSSISpaceWeather_(CSSISpaceWeather::Load(localCSSISpaceWeatherFile));
-
-            return &CSSISpaceWeather_;
-        }
+        CSSISpaceWeatherSPtr = this->accessCSSISpaceWeather_();
+    }
 
-        default:
-        {
-            throw ostk::core::error::RuntimeError("No CSSI Space Weather data loaded and manager set to Manual mode.");
-        }
+    if (CSSISpaceWeatherSPtr->accessObservationInterval().contains(anInstant) ||
+        CSSISpaceWeatherSPtr->accessDailyPredictionInterval().contains(anInstant) ||
+        CSSISpaceWeatherSPtr->accessMonthlyPredictionInterval().contains(anInstant))
+    {
+        return CSSISpaceWeatherSPtr;
     }
+
+    throw ostk::core::error::RuntimeError(
+        "Loaded CSSI Space Weather file is not valid for [{}].", anInstant.toString()
+    );
 }
 
 File Manager::getLocalRepositoryLockFile() const
@@ -502,15 +449,77 @@ void Manager::setup()
     }
 }
 
-void Manager::loadCSSISpaceWeather_(const CSSISpaceWeather& aCSSISpaceWeather)
+void Manager::loadCSSISpaceWeather_(const CSSISpaceWeather& aCSSISpaceWeather) const
 {
-    if (CSSISpaceWeather_.isDefined() &&
-        (CSSISpaceWeather_.accessLastObservationDate() == aCSSISpaceWeather.accessLastObservationDate()))
+    const Shared<const CSSISpaceWeather> CSSISpaceWeatherSPtr = CSSISpaceWeatherSPtr_.load();
+
+    if ((CSSISpaceWeatherSPtr != nullptr) &&
+        (CSSISpaceWeatherSPtr->accessLastObservationDate() == aCSSISpaceWeather.accessLastObservationDate()))
     {
         throw ostk::core::error::RuntimeError("Identical CSSI Space Weather already loaded.");
     }
 
-    CSSISpaceWeather_ = aCSSISpaceWeather;
+    CSSISpaceWeatherSPtr_.store(std::make_shared<const CSSISpaceWeather>(aCSSISpaceWeather));
+}
+
+Shared<const CSSISpaceWeather> Manager::accessCSSISpaceWeather_() const
+{
+    // Space weather data may have been loaded by another thread while waiting for the lock
+    if (const Shared<const CSSISpaceWeather> CSSISpaceWeatherSPtr = CSSISpaceWeatherSPtr_.load())
+    {
+        return CSSISpaceWeatherSPtr;
+    }
+
+    // Try loading or fetching latest Space Weather file
+    switch (mode_)
+    {
+        case Manager::Mode::Automatic:
+        {
+            const File latestCSSISpaceWeatherFile = this->getLatestCSSISpaceWeatherFile();
+
+            if (!latestCSSISpaceWeatherFile.isDefined())
+            {
+                throw ostk::core::error::RuntimeError(
+                    "Failed to load or fetch latest CSSI Space Weather file at {}.",
+                    latestCSSISpaceWeatherFile.getPath().toString()
+                );
+            }
+
+            this->loadCSSISpaceWeather_(CSSISpaceWeather::Load(latestCSSISpaceWeatherFile));
+
+            return CSSISpaceWeatherSPtr_.load();
+        }
+
+        case Manager::Mode::Manual:
+        {
+            if (!this->getCSSISpaceWeatherDirectory().containsFileWithName(CSSISpaceWeatherFileName))
+            {
+                throw ostk::core::error::RuntimeError(
+                    "No CSSI Space Weather data loaded and manager set to Manual mode."
+                );
+            }
+
+            const File localCSSISpaceWeatherFile =
+                File::Path(this->getCSSISpaceWeatherDirectory().getPath() + Path::Parse(CSSISpaceWeatherFileName));
+
+            if (!localCSSISpaceWeatherFile.isDefined())
+            {
+                throw ostk::core::error::RuntimeError(
+                    "Failed to load latest CSSI Space Weather file at {}.",
+                    localCSSISpaceWeatherFile.getPath().toString()
+                );
+            }
+
+            this->loadCSSISpaceWeather_(CSSISpaceWeather::Load(localCSSISpaceWeatherFile));
+
+            return CSSISpaceWeatherSPtr_.load();
+        }
+
+        default:
+        {
+            throw ostk::core::error::RuntimeError("No CSSI Space Weather data loaded and manager set to Manual mode.");
+        }
+    }
 }
 
 File Manager::fetchLatestCSSISpaceWeather_()
@@ -2,13 +2,16 @@
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/Unique.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/CSSISpaceWeather.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/Manager.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/NRLMSISE00.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Earth.hpp>
@@ -22,7 +25,11 @@ extern "C"
 }
 }  // namespace NRLMSISE00_c
 
+#include <algorithm>
 #include <cmath>
+#include <functional>
+#include <future>
+#include <mutex>
 
 namespace ostk
 {
@@ -35,12 +42,16 @@ namespace atmospheric
 namespace earth
 {
 
+using ostk::core::type::Index;
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
+using ostk::core::type::Shared;
 using ostk::core::type::Size;
 using ostk::core::type::Unique;
 using ostk::core::container::Array;
 
+using ostk::mathematics::object::Vector3d;
+
 using ostk::physics::coordinate::Frame;
 using ostk::physics::time::Scale;
 using ostk::physics::time::Instant;
@@ -52,6 +63,38 @@ using EarthCelestial = ostk::physics::environment::object::celestial::Earth;
 using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
 using ostk::physics::environment::atmospheric::earth::Manager;
 
+// Split [0, aCount) into contiguous chunks, each evaluated by its own thread
+
+static void ComputeInChunks(
+    const Size& aCount, const Size& aThreadCount, const std::function<void(const Index, const Index)>& aFunction
+)
+{
+    const Size threadCount = std::max<Size>(1, std::min<Size>(aThreadCount, aCount));
+
+    if (threadCount == 1)
+    {
+        aFunction(0, aCount);
+
+        return;
+    }
+
+    const Size chunkSize = (aCount + threadCount - 1) / threadCount;
+
+    Array<std::future<void>> futures = Array<std::future<void>>::Empty();
+
+    for (Index beginIndex = 0; beginIndex < aCount; beginIndex += chunkSize)
+    {
+        const Index endIndex = std::min<Index>(beginIndex + chunkSize, aCount);
+
+        futures.add(std::async(std::launch::async, aFunction, beginIndex, endIndex));
+    }
+
+    for (std::future<void>& future : futures)
+    {
+        future.get();
+    }
+}
+
 NRLMSISE00::NRLMSISE00(
     const InputDataType& anInputDataType,
     const Real& aF107ConstantValue,
@@ -135,9 +178,26 @@ Unique<NRLMSISE00::ap_array> NRLMSISE00::computeApArray(const Instant& anInstant
             //  this one
             //
             // Then use that as a starting index to find the correct data points and averages.
+            //
+            // The loaded CSSI Space Weather precomputes this series and its averages over observations and daily
+            // predictions, in which case the values are read directly.
 
             const Manager& spaceWeatherManager = Manager::Get();
 
+            const Shared<const CSSISpaceWeather> CSSISpaceWeatherSPtr =
+                spaceWeatherManager.accessCSSISpaceWeatherAt(anInstant);
+
+            const Interval& apInterval = CSSISpaceWeatherSPtr->accessNRLMSISE00ApInterval();
+
+            if (apInterval.isDefined() && apInterval.contains(anInstant))
+            {
+                const Array<Real> apValues = CSSISpaceWeatherSPtr->getNRLMSISE00ApValuesAt(anInstant);
+
+                std::copy(apValues.begin(), apValues.end(), std::begin(outputStruct->a));
+
+                break;
+            }
+
             // Fetch AP parameters for each day up to 57 hours ago
             const Instant instant57HrPrevious = anInstant - Duration::Hours(57);
             const Instant instant33HrPrevious = anInstant - Duration::Hours(33);
@@ -155,11 +215,24 @@ Unique<NRLMSISE00::ap_array> NRLMSISE00::computeApArray(const Instant& anInstant
 
             // Fetch AP indices for all days. Stack them into one continuous array.
             Array<Integer> apMultiDayArray = Array<Integer>::Empty();
-            apMultiDayArray.reserve(fetchDays.getSize());
+            apMultiDayArray.reserve(8 * fetchDays.getSize());
 
             for (const Instant& fetchDay : fetchDays)
             {
-                apMultiDayArray.add(spaceWeatherManager.getAp3HourSolarIndicesAt(fetchDay));
+                const Shared<const CSSISpaceWeather::Reading> readingSPtr =
+                    spaceWeatherManager.accessAp3HourSolarIndexReadingAt(fetchDay);
+
+                apMultiDayArray.insert(
+                    apMultiDayArray.end(),
+                    {readingSPtr->Ap1,
+                     readingSPtr->Ap2,
+                     readingSPtr->Ap3,
+                     readingSPtr->Ap4,
+                     readingSPtr->Ap5,
+                     readingSPtr->Ap6,
+                     readingSPtr->Ap7,
+                     readingSPtr->Ap8}
+                );
             }
 
             // Find correct index to start at based on time of day of the first day
@@ -195,6 +268,64 @@ Unique<NRLMSISE00::ap_array> NRLMSISE00::computeApArray(const Instant& anInstant
 Unique<NRLMSISE00::nrlmsise_input> NRLMSISE00::computeNRLMSISE00Input(
     const Unique<NRLMSISE00::ap_array>& apValues, const LLA& aLLA, const Instant& anInstant
 ) const
+{
+    NRLMSISE00::instant_input instantInput;
+
+    this->computeTimeInput(anInstant, instantInput);
+    this->computeSpaceWeatherInput(apValues, anInstant, instantInput);
+
+    Unique<NRLMSISE00::nrlmsise_input> input =
+        std::make_unique<NRLMSISE00::nrlmsise_input>(this->computeNRLMSISE00Input(instantInput, aLLA));
+
+    // Point to the provided AP values, as the local instant input does not outlive this call
+    input->ap_a = apValues.get();
+
+    return input;
+}
+
+NRLMSISE00::instant_input NRLMSISE00::computeInstantInput(const Instant& anInstant) const
+{
+    NRLMSISE00::instant_input instantInput;
+
+    this->computeTimeInput(anInstant, instantInput);
+
+    if (this->inputDataType_ == InputDataType::CSSISpaceWeatherFile)
+    {
+        this->computeSpaceWeatherInput(this->computeApArray(anInstant), anInstant, instantInput);
+    }
+    else
+    {
+        this->computeSpaceWeatherInput(nullptr, anInstant, instantInput);
+    }
+
+    return instantInput;
+}
+
+void NRLMSISE00::computeTimeInput(const Instant& anInstant, NRLMSISE00::instant_input& anInstantInput) const
+{
+    const DateTime currentDateTime = anInstant.getDateTime(Scale::UTC);
+
+    // current year/doy/sec
+    const Integer year = currentDateTime.getDate().getYear();
+
+    const Instant startOfYear = Instant::DateTime(DateTime(Date(year, 1, 1), Time::Midnight()), Scale::UTC);
+    const Integer dayOfYear = (anInstant - startOfYear).getDays() + 1;
+
+    const Time timeOfDay = currentDateTime.getTime();
+    const Integer secondsInDay = timeOfDay.getHour() * 3600 + timeOfDay.getMinute() * 60 + timeOfDay.getSecond();
+
+    anInstantInput.year = year;
+    anInstantInput.doy = dayOfYear;
+    anInstantInput.sec = secondsInDay;
+
+    // Use actual sun position to compute local solar time if provided
+    anInstantInput.sunPosition = sunCelestialSPtr_ ? sunCelestialSPtr_->getPositionIn(earthFrameSPtr_, anInstant)
+                                                   : Position::Undefined();
+}
+
+void NRLMSISE00::computeSpaceWeatherInput(
+    const Unique<NRLMSISE00::ap_array>& apValues, const Instant& anInstant, NRLMSISE00::instant_input& anInstantInput
+) const
 {
     Real f107Previous = Real::Undefined();
     Real f107Average = Real::Undefined();
@@ -228,33 +359,36 @@ Unique<NRLMSISE00::nrlmsise_input> NRLMSISE00::computeNRLMSISE00Input(
         }
     }
 
-    const DateTime currentDateTime = anInstant.getDateTime(Scale::UTC);
-
-    // current year/doy/sec
-    const Integer year = currentDateTime.getDate().getYear();
-
-    const Instant startOfYear = Instant::DateTime(DateTime(Date(year, 1, 1), Time::Midnight()), Scale::UTC);
-    const Integer dayOfYear = (anInstant - startOfYear).getDays() + 1;
+    anInstantInput.f107A = f107Average;
+    anInstantInput.f107 = f107Previous;
 
-    const Time timeOfDay = currentDateTime.getTime();
-    const Integer secondsInDay = timeOfDay.getHour() * 3600 + timeOfDay.getMinute() * 60 + timeOfDay.getSecond();
+    if (apValues != nullptr)
+    {
+        anInstantInput.ap = apValues->a[0];
+        anInstantInput.apValues = *apValues;
+        anInstantInput.hasApValues = true;
+    }
+    else
+    {
+        anInstantInput.ap = this->convertKpToAp(this->kpConstantValue_);
+        anInstantInput.hasApValues = false;
+    }
+}
 
+NRLMSISE00::nrlmsise_input NRLMSISE00::computeNRLMSISE00Input(
+    NRLMSISE00::instant_input& anInstantInput, const LLA& aLLA
+) const
+{
     Real lst = Real::Undefined();
 
-    // Use actual sun position to compute local solar time if provided
-    if (sunCelestialSPtr_)
+    if (anInstantInput.sunPosition.isDefined())
     {
-        const Position position = {
-            aLLA.toCartesian(earthRadius_, earthFlattening_), Position::Unit::Meter, earthFrameSPtr_
-        };
-
-        const Position sunPositionInFrame = sunCelestialSPtr_->getPositionIn(earthFrameSPtr_, anInstant);
+        const Vector3d position = aLLA.toCartesian(earthRadius_, earthFlattening_);
+        const Vector3d& sunPosition = anInstantInput.sunPosition.accessCoordinates();
 
         lst = (Real::Pi() + std::atan2(
-                                sunPositionInFrame.accessCoordinates()[0] * position.accessCoordinates()[1] -
-                                    sunPositionInFrame.accessCoordinates()[1] * position.accessCoordinates()[0],
-                                sunPositionInFrame.accessCoordinates()[0] * position.accessCoordinates()[0] +
-                                    sunPositionInFrame.accessCoordinates()[1] * position.accessCoordinates()[1]
+                                sunPosition[0] * position[1] - sunPosition[1] * position[0],
+                                sunPosition[0] * position[0] + sunPosition[1] * position[1]
                             )) *
               12.0 / Real::Pi();
     }
@@ -262,33 +396,22 @@ Unique<NRLMSISE00::nrlmsise_input> NRLMSISE00::computeNRLMSISE00Input(
     {
         // This is the preferred method per the NRLMSISE documentation
         // https://github.com/magnific0/nrlmsise-00/blob/master/nrlmsise-00.h#L103
-        lst = Real::Integer(secondsInDay) / 3600.0 + aLLA.getLongitude().inDegrees() / 15.0;
+        lst = Real(anInstantInput.sec) / 3600.0 + aLLA.getLongitude().inDegrees() / 15.0;
     }
 
-    Unique<NRLMSISE00::nrlmsise_input> input = std::make_unique<NRLMSISE00::nrlmsise_input>();
-
-    input->doy = dayOfYear;
-    input->year = year;
-    input->sec = secondsInDay;
-    input->alt = aLLA.getAltitude().inKilometers();
-    input->g_lat = aLLA.getLatitude().inDegrees();
-    input->g_long = aLLA.getLongitude().inDegrees();
-    input->lst = lst;
-    input->f107A = f107Average;
-    input->f107 = f107Previous;
+    NRLMSISE00::nrlmsise_input input;
 
-    if (apValues != nullptr)
-    {
-        input->ap = apValues->a[0];
-        input->ap_a = apValues.get();
-    }
-    else
-    {
-        const Real ap = this->convertKpToAp(this->kpConstantValue_);
-
-        input->ap = ap;
-        input->ap_a = nullptr;
-    }
+    input.doy = anInstantInput.doy;
+    input.year = anInstantInput.year;
+    input.sec = anInstantInput.sec;
+    input.alt = aLLA.getAltitude().inKilometers();
+    input.g_lat = aLLA.getLatitude().inDegrees();
+    input.g_long = aLLA.getLongitude().inDegrees();
+    input.lst = lst;
+    input.f107A = anInstantInput.f107A;
+    input.f107 = anInstantInput.f107;
+    input.ap = anInstantInput.ap;
+    input.ap_a = anInstantInput.hasApValues ? &anInstantInput.apValues : nullptr;
 
     return input;
 }
@@ -325,16 +448,112 @@ Real NRLMSISE00::getKpConstantValue() const
 
 Real NRLMSISE00::getDensityAt(const LLA& aLLA, const Instant& anInstant) const
 {
-    Unique<NRLMSISE00::ap_array> apValues = nullptr;
+    NRLMSISE00::instant_input instantInput = this->computeInstantInput(anInstant);
 
-    if (this->inputDataType_ == InputDataType::CSSISpaceWeatherFile)
+    NRLMSISE00::nrlmsise_input input = this->computeNRLMSISE00Input(instantInput, aLLA);
+
+    return NRLMSISE00::GetDensityAt(input);
+}
+
+Array<Real> NRLMSISE00::getDensitiesAt(
+    const Array<LLA>& anLLAArray, const Instant& anInstant, const Size& aThreadCount
+) const
+{
+    Array<Real> densities = Array<Real>::Empty();
+
+    if (anLLAArray.isEmpty())
+    {
+        return densities;
+    }
+
+    densities.resize(anLLAArray.getSize(), Real::Undefined());
+
+    const NRLMSISE00::instant_input instantInput = this->computeInstantInput(anInstant);
+
+    ComputeInChunks(
+        anLLAArray.getSize(),
+        aThreadCount,
+        [this, &anLLAArray, &instantInput, &densities](const Index aBeginIndex, const Index anEndIndex) -> void
+        {
+            // Inputs point to the AP values of the instant input: each chunk uses its own copy
+
+            NRLMSISE00::instant_input chunkInstantInput = instantInput;
+
+            for (Index index = aBeginIndex; index < anEndIndex; ++index)
+            {
+                NRLMSISE00::nrlmsise_input input = this->computeNRLMSISE00Input(chunkInstantInput, anLLAArray[index]);
+
+                densities[index] = NRLMSISE00::GetDensityAt(input);
+            }
+        }
+    );
+
+    return densities;
+}
+
+Array<Real> NRLMSISE00::getDensitiesAt(
+    const Array<LLA>& anLLAArray, const Array<Instant>& anInstantArray, const Size& aThreadCount
+) const
+{
+    if (anLLAArray.getSize() != anInstantArray.getSize())
     {
-        apValues = this->computeApArray(anInstant);
+        throw ostk::core::error::RuntimeError(
+            "Position count [{}] does not match instant count [{}].", anLLAArray.getSize(), anInstantArray.getSize()
+        );
     }
 
-    const Unique<NRLMSISE00::nrlmsise_input> input = this->computeNRLMSISE00Input(apValues, aLLA, anInstant);
+    Array<Real> densities = Array<Real>::Empty();
+    densities.resize(anLLAArray.getSize(), Real::Undefined());
+
+    ComputeInChunks(
+        anLLAArray.getSize(),
+        aThreadCount,
+        [this, &anLLAArray, &anInstantArray, &densities](const Index aBeginIndex, const Index anEndIndex) -> void
+        {
+            NRLMSISE00::instant_input instantInput;
+
+            // The AP values and solar fluxes only change between 3-hour UTC intervals: they are fetched from the space
+            // weather manager once per interval (and per chunk)
 
-    return NRLMSISE00::GetDensityAt(*input);
+            bool hasSpaceWeatherInput = false;
+            int previousYear = 0;
+            int previousDayOfYear = 0;
+            int previousInterval = 0;
+
+            for (Index index = aBeginIndex; index < anEndIndex; ++index)
+            {
+                const Instant& instant = anInstantArray[index];
+
+                this->computeTimeInput(instant, instantInput);
+
+                const int interval = static_cast<int>(instantInput.sec) / 10800;
+
+                if (!hasSpaceWeatherInput || (instantInput.year != previousYear) ||
+                    (instantInput.doy != previousDayOfYear) || (interval != previousInterval))
+                {
+                    if (this->inputDataType_ == InputDataType::CSSISpaceWeatherFile)
+                    {
+                        this->computeSpaceWeatherInput(this->computeApArray(instant), instant, instantInput);
+                    }
+                    else
+                    {
+                        this->computeSpaceWeatherInput(nullptr, instant, instantInput);
+                    }
+
+                    hasSpaceWeatherInput = true;
+                    previousYear = instantInput.year;
+                    previousDayOfYear = instantInput.doy;
+                    previousInterval = interval;
+                }
+
+                NRLMSISE00::nrlmsise_input input = this->computeNRLMSISE00Input(instantInput, anLLAArray[index]);
+
+                densities[index] = NRLMSISE00::GetDensityAt(input);
+            }
+        }
+    );
+
+    return densities;
 }
 
 Real NRLMSISE00::GetDensityAt(NRLMSISE00::nrlmsise_input& input)
@@ -350,7 +569,17 @@ Real NRLMSISE00::GetDensityAt(NRLMSISE00::nrlmsise_input& input)
     }
 
     NRLMSISE00_c::nrlmsise_input* input_c = reinterpret_cast<NRLMSISE00_c::nrlmsise_input*>(&input);
-    NRLMSISE00_c::gtd7d(input_c, &flags, &output);
+
+    {
+        // The NRLMSISE-00 C implementation keeps intermediate results in file-scope static variables: concurrent
+        // evaluations are serialized
+
+        static std::mutex mutex;
+
+        const std::lock_guard<std::mutex> lock {mutex};
+
+        NRLMSISE00_c::gtd7d(input_c, &flags, &output);
+    }
 
     return output.d[5];
 }
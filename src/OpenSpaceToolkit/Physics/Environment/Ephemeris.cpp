@@ -16,6 +16,16 @@ Ephemeris::Ephemeris() {}
 
 Ephemeris::~Ephemeris() {}
 
+Position Ephemeris::getPositionIn(const Shared<const Frame>& aFrameSPtr, const Instant& anInstant) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ephemeris");
+    }
+
+    return this->accessFrame()->getOriginIn(aFrameSPtr, anInstant);
+}
+
 }  // namespace environment
 }  // namespace physics
 }  // namespace ostk
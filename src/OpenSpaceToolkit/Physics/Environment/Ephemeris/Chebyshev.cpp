@@ -0,0 +1,563 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <mutex>
+
+#include <OpenSpaceToolkit/Core/Container/Map.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/Dynamic.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Ephemeris/Chebyshev.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace environment
+{
+namespace ephemeris
+{
+
+using ostk::core::container::Map;
+using ostk::core::type::String;
+
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::object::Vector3d;
+
+// Translation (3), velocity (3), orientation quaternion (4: x, y, z, s) and angular velocity (3)
+
+static constexpr Size ChannelCount = 13;
+
+static void ChannelsFromTransform(const Transform& aTransform, double* aChannelArray)
+{
+    const Vector3d& translation = aTransform.accessTranslation();
+    const Vector3d& velocity = aTransform.accessVelocity();
+    const Quaternion& orientation = aTransform.accessOrientation();
+    const Vector3d& angularVelocity = aTransform.accessAngularVelocity();
+
+    aChannelArray[0] = translation.x();
+    aChannelArray[1] = translation.y();
+    aChannelArray[2] = translation.z();
+    aChannelArray[3] = velocity.x();
+    aChannelArray[4] = velocity.y();
+    aChannelArray[5] = velocity.z();
+    aChannelArray[6] = orientation.x();
+    aChannelArray[7] = orientation.y();
+    aChannelArray[8] = orientation.z();
+    aChannelArray[9] = orientation.s();
+    aChannelArray[10] = angularVelocity.x();
+    aChannelArray[11] = angularVelocity.y();
+    aChannelArray[12] = angularVelocity.z();
+}
+
+class Chebyshev::Fit
+{
+   public:
+    Fit(const String& aFrameName,
+        const Interval& anInterval,
+        const Duration& aStep,
+        const Size& aDegree,
+        const Shared<const Frame>& aFrameSPtr)
+        : frameName(aFrameName),
+          interval(anInterval),
+          step(aStep),
+          degree(aDegree),
+          sourceFrameSPtr(aFrameSPtr),
+          stepSeconds(aStep.inSeconds()),
+          segmentCount(std::max<Size>(1, std::ceil(anInterval.getDuration().inSeconds() / stepSeconds))),
+          coefficientCount(aDegree + 1),
+          coefficients(Array<double>::Empty()),
+          positionAccuracy(Real::Undefined()),
+          orientationAccuracy(Real::Undefined())
+    {
+        coefficients.resize(segmentCount * ChannelCount * coefficientCount);
+    }
+
+    // Once the last ephemeris sharing the fit is gone, release its frame, unless it has already been replaced by
+    // a new fit with the same parameters
+
+    ~Fit()
+    {
+        const std::lock_guard<std::mutex> lock {Fit::RegistryMutex()};
+
+        Map<String, std::weak_ptr<const Fit>>& registry = Fit::Registry();
+
+        const auto registryIt = registry.find(frameName);
+
+        if ((registryIt == registry.end()) || (!registryIt->second.expired()))
+        {
+            return;
+        }
+
+        registry.erase(registryIt);
+
+        try
+        {
+            if (Frame::Exists(frameName))
+            {
+                Frame::Destruct(frameName);
+            }
+        }
+        catch (...)
+        {
+            // Destructors must not throw
+        }
+    }
+
+    // Fits currently alive, keyed by the name of their frame (never destroyed, so that fits may outlive statics)
+
+    static std::mutex& RegistryMutex()
+    {
+        static std::mutex* mutexPtr = new std::mutex();
+
+        return *mutexPtr;
+    }
+
+    static Map<String, std::weak_ptr<const Fit>>& Registry()
+    {
+        static Map<String, std::weak_ptr<const Fit>>* registryPtr = new Map<String, std::weak_ptr<const Fit>>();
+
+        return *registryPtr;
+    }
+
+    String frameName;
+
+    Interval interval;
+    Duration step;
+    Size degree;
+
+    Shared<const Frame> sourceFrameSPtr;
+
+    double stepSeconds;
+    Size segmentCount;
+    Size coefficientCount;
+    Array<double> coefficients;  // [segment][channel][coefficient]
+
+    Real positionAccuracy;
+    Real orientationAccuracy;
+
+    Transform getTransformAt(const Instant& anInstant) const
+    {
+        if (!interval.contains(anInstant))
+        {
+            return Frame::GCRF()->getTransformTo(sourceFrameSPtr, anInstant);
+        }
+
+        double channels[ChannelCount];
+
+        this->evaluateAt(anInstant, ChannelCount, channels);
+
+        const Quaternion orientation =
+            Quaternion::XYZS(channels[6], channels[7], channels[8], channels[9]).toNormalized();
+
+        return {
+            anInstant,
+            {channels[0], channels[1], channels[2]},
+            {channels[3], channels[4], channels[5]},
+            orientation,
+            {channels[10], channels[11], channels[12]},
+            Transform::Type::Passive
+        };
+    }
+
+    // Evaluate the first channels only (e.g. 3 for translation)
+
+    void evaluateAt(const Instant& anInstant, const Size aChannelCount, double (&aChannelArray)[ChannelCount]) const
+    {
+        const double elapsedSeconds = (anInstant - interval.accessStart()).inSeconds();
+
+        const Size segmentIndex =
+            (elapsedSeconds <= 0.0) ? 0 : std::min<Size>(elapsedSeconds / stepSeconds, segmentCount - 1);
+
+        const double u = (elapsedSeconds - static_cast<double>(segmentIndex) * stepSeconds) / stepSeconds;  // [0, 1]
+        const double tau = 2.0 * u - 1.0;
+
+        const double* segmentCoefficients = &coefficients[segmentIndex * ChannelCount * coefficientCount];
+
+        // Clenshaw recurrence
+
+        for (Size channelIndex = 0; channelIndex < aChannelCount; ++channelIndex)
+        {
+            const double* channelCoefficients = &segmentCoefficients[channelIndex * coefficientCount];
+
+            double b1 = 0.0;
+            double b2 = 0.0;
+
+            for (Size index = coefficientCount - 1; index > 0; --index)
+            {
+                const double b0 = 2.0 * tau * b1 - b2 + channelCoefficients[index];
+
+                b2 = b1;
+                b1 = b0;
+            }
+
+            aChannelArray[channelIndex] = tau * b1 - b2 + channelCoefficients[0];
+        }
+    }
+};
+
+Chebyshev::Chebyshev(
+    const Ephemeris& anEphemeris, const Interval& anInterval, const Duration& aStep, const Size& aDegree
+)
+    : fitSPtr_(nullptr),
+      frameSPtr_(nullptr)
+{
+    if ((!anEphemeris.isDefined()) || (!anInterval.isDefined()) || (!aStep.isDefined()))
+    {
+        return;
+    }
+
+    if (!aStep.isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Step");
+    }
+
+    if (aDegree == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Degree");
+    }
+
+    const Shared<const Frame> sourceFrameSPtr = anEphemeris.accessFrame();
+
+    // Fits of the same ephemeris with the same parameters share their coefficients and frame: look them up first,
+    // as fitting costs thousands of evaluations of the wrapped ephemeris
+
+    const String frameName = String::Format(
+        "{} (Chebyshev) [{} - {} / {} / {}]",
+        sourceFrameSPtr->getName(),
+        anInterval.accessStart().toString(),
+        anInterval.accessEnd().toString(),
+        aStep.toString(),
+        aDegree
+    );
+
+    // Fits are only released with the registry unlocked, as their destructor locks it
+
+    Shared<const Fit> registeredFitSPtr = nullptr;
+
+    {
+        const std::lock_guard<std::mutex> lock {Fit::RegistryMutex()};
+
+        const auto registryIt = Fit::Registry().find(frameName);
+
+        if (registryIt != Fit::Registry().end())
+        {
+            registeredFitSPtr = registryIt->second.lock();
+
+            if (registeredFitSPtr != nullptr)
+            {
+                if (const Shared<const Frame> registeredFrameSPtr = Frame::WithName(frameName))
+                {
+                    fitSPtr_ = registeredFitSPtr;
+                    frameSPtr_ = registeredFrameSPtr;
+
+                    return;
+                }
+            }
+        }
+    }
+
+    const Shared<Fit> fitSPtr = std::make_shared<Fit>(frameName, anInterval, aStep, aDegree, sourceFrameSPtr);
+
+    Fit& fit = *fitSPtr;
+
+    const Instant& startInstant = anInterval.accessStart();
+    const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+
+    const auto segmentStartAt = [&startInstant, &fit](const Size aSegmentIndex) -> Instant
+    {
+        return startInstant + Duration::Seconds(static_cast<double>(aSegmentIndex) * fit.stepSeconds);
+    };
+
+    // Per segment and channel: Chebyshev coefficients, fitted on Chebyshev nodes of the segment
+
+    const Size nodeCount = fit.coefficientCount;
+
+    Array<double> nodeValues = Array<double>::Empty();
+    nodeValues.resize(nodeCount * ChannelCount);
+
+    for (Size segmentIndex = 0; segmentIndex < fit.segmentCount; ++segmentIndex)
+    {
+        const Instant segmentStartInstant = segmentStartAt(segmentIndex);
+
+        for (Size nodeIndex = 0; nodeIndex < nodeCount; ++nodeIndex)
+        {
+            const double tau = std::cos(M_PI * (nodeIndex + 0.5) / nodeCount);
+
+            double* channels = &nodeValues[nodeIndex * ChannelCount];
+
+            ChannelsFromTransform(
+                gcrfSPtr->getTransformTo(
+                    fit.sourceFrameSPtr, segmentStartInstant + Duration::Seconds(0.5 * (tau + 1.0) * fit.stepSeconds)
+                ),
+                channels
+            );
+
+            // Quaternions q and -q represent the same orientation: keep the sign continuous over the segment
+
+            if (nodeIndex > 0)
+            {
+                double dot = 0.0;
+
+                for (Size channelIndex = 6; channelIndex < 10; ++channelIndex)
+                {
+                    dot += channels[channelIndex] * nodeValues[channelIndex];
+                }
+
+                if (dot < 0.0)
+                {
+                    for (Size channelIndex = 6; channelIndex < 10; ++channelIndex)
+                    {
+                        channels[channelIndex] = -channels[channelIndex];
+                    }
+                }
+            }
+        }
+
+        double* segmentCoefficients = &fit.coefficients[segmentIndex * ChannelCount * fit.coefficientCount];
+
+        for (Size channelIndex = 0; channelIndex < ChannelCount; ++channelIndex)
+        {
+            for (Size index = 0; index < nodeCount; ++index)
+            {
+                double coefficient = 0.0;
+
+                for (Size nodeIndex = 0; nodeIndex < nodeCount; ++nodeIndex)
+                {
+                    coefficient += nodeValues[nodeIndex * ChannelCount + channelIndex] *
+                                   std::cos(M_PI * index * (nodeIndex + 0.5) / nodeCount);
+                }
+
+                segmentCoefficients[channelIndex * fit.coefficientCount + index] =
+                    coefficient * (index == 0 ? 1.0 : 2.0) / nodeCount;
+            }
+        }
+    }
+
+    // Estimate fitting error at segment midpoints
+
+    double positionAccuracy = 0.0;
+    double orientationAccuracy = 0.0;
+
+    for (Size segmentIndex = 0; segmentIndex < fit.segmentCount; ++segmentIndex)
+    {
+        const Instant midpointInstant = segmentStartAt(segmentIndex) + Duration::Seconds(0.5 * fit.stepSeconds);
+
+        const Transform transform = gcrfSPtr->getTransformTo(fit.sourceFrameSPtr, midpointInstant);
+        const Transform fittedTransform = fit.getTransformAt(midpointInstant);
+
+        positionAccuracy = std::max(
+            positionAccuracy, (fittedTransform.accessTranslation() - transform.accessTranslation()).norm()
+        );
+        orientationAccuracy = std::max(
+            orientationAccuracy,
+            static_cast<double>(
+                fittedTransform.accessOrientation().angularDifferenceWith(transform.accessOrientation()).inRadians()
+            )
+        );
+    }
+
+    fit.positionAccuracy = positionAccuracy;
+    fit.orientationAccuracy = orientationAccuracy;
+
+    // Another fit with the same parameters may have been registered in the meantime: the fit computed here is
+    // then dropped, after the registry is unlocked
+
+    Shared<const Frame> staleFrameSPtr = nullptr;
+
+    {
+        const std::lock_guard<std::mutex> lock {Fit::RegistryMutex()};
+
+        std::weak_ptr<const Fit>& registeredFitWPtr = Fit::Registry()[frameName];
+
+        registeredFitSPtr = registeredFitWPtr.lock();
+
+        const Shared<const Frame> registeredFrameSPtr = Frame::WithName(frameName);
+
+        if ((registeredFitSPtr != nullptr) && (registeredFrameSPtr != nullptr))
+        {
+            fitSPtr_ = registeredFitSPtr;
+            frameSPtr_ = registeredFrameSPtr;
+        }
+        else
+        {
+            // A frame left by an expired fit, whose destructor has yet to run
+
+            if (registeredFrameSPtr != nullptr)
+            {
+                staleFrameSPtr = registeredFrameSPtr;
+
+                Frame::Destruct(frameName);
+            }
+
+            using DynamicProvider = ostk::physics::coordinate::frame::provider::Dynamic;
+
+            // The provider only holds a weak reference to the fit, which would otherwise be kept alive by the frame
+            // manager: once the fit is released, frames still held elsewhere fall back to the wrapped ephemeris
+
+            const std::weak_ptr<const Fit> fitWPtr = fitSPtr;
+
+            const Shared<const DynamicProvider> transformProviderSPtr = std::make_shared<const DynamicProvider>(
+                [fitWPtr, sourceFrameSPtr](const Instant& anInstant) -> Transform
+                {
+                    if (const Shared<const Fit> fitSPtr = fitWPtr.lock())
+                    {
+                        return fitSPtr->getTransformAt(anInstant);
+                    }
+
+                    return Frame::GCRF()->getTransformTo(sourceFrameSPtr, anInstant);
+                }
+            );
+
+            frameSPtr_ = Frame::Construct(frameName, false, Frame::GCRF(), transformProviderSPtr);
+            fitSPtr_ = fitSPtr;
+
+            registeredFitWPtr = fitSPtr;
+        }
+    }
+}
+
+Chebyshev::~Chebyshev() {}
+
+Chebyshev* Chebyshev::clone() const
+{
+    return new Chebyshev(*this);
+}
+
+bool Chebyshev::isDefined() const
+{
+    return (fitSPtr_ != nullptr) && (frameSPtr_ != nullptr);
+}
+
+Shared<const Frame> Chebyshev::accessFrame() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Chebyshev");
+    }
+
+    return frameSPtr_;
+}
+
+Position Chebyshev::getPositionIn(const Shared<const Frame>& aFrameSPtr, const Instant& anInstant) const
+{
+    if ((aFrameSPtr == nullptr) || (!aFrameSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    if (!this->covers(anInstant))
+    {
+        return Ephemeris::getPositionIn(aFrameSPtr, anInstant);
+    }
+
+    if (aFrameSPtr == frameSPtr_)
+    {
+        return Position::Meters({0.0, 0.0, 0.0}, aFrameSPtr);
+    }
+
+    double channels[ChannelCount];
+
+    fitSPtr_->evaluateAt(anInstant, 3, channels);
+
+    // Passive transform from GCRF: x_FRAME = q * (x_GCRF + t), hence the frame origin is at -t in GCRF
+
+    return Position::Meters({-channels[0], -channels[1], -channels[2]}, Frame::GCRF()).inFrame(aFrameSPtr, anInstant);
+}
+
+bool Chebyshev::covers(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Chebyshev");
+    }
+
+    return fitSPtr_->interval.contains(anInstant);
+}
+
+const Interval& Chebyshev::accessInterval() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Chebyshev");
+    }
+
+    return fitSPtr_->interval;
+}
+
+Duration Chebyshev::getStep() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Chebyshev");
+    }
+
+    return fitSPtr_->step;
+}
+
+Size Chebyshev::getDegree() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Chebyshev");
+    }
+
+    return fitSPtr_->degree;
+}
+
+Real Chebyshev::getPositionAccuracy() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Chebyshev");
+    }
+
+    return fitSPtr_->positionAccuracy;
+}
+
+Real Chebyshev::getOrientationAccuracy() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Chebyshev");
+    }
+
+    return fitSPtr_->orientationAccuracy;
+}
+
+Transform Chebyshev::getTransformAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Chebyshev");
+    }
+
+    return fitSPtr_->getTransformAt(anInstant);
+}
+
+Duration Chebyshev::DefaultStep()
+{
+    return Duration::Days(1.0);
+}
+
+}  // namespace ephemeris
+}  // namespace environment
+}  // namespace physics
+}  // namespace ostk
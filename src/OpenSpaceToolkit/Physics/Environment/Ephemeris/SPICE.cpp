@@ -40,6 +40,30 @@ Shared<const Frame> SPICE::accessFrame() const
     return Engine::Get().getFrameOf(object_);
 }
 
+Position SPICE::getPositionIn(const Shared<const Frame>& aFrameSPtr, const Instant& anInstant) const
+{
+    using ostk::physics::environment::ephemeris::spice::Engine;
+
+    if ((aFrameSPtr == nullptr) || (!aFrameSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("SPICE");
+    }
+
+    const Engine& engine = Engine::Get();
+
+    if (aFrameSPtr == engine.getFrameOf(object_))
+    {
+        return Position::Meters({0.0, 0.0, 0.0}, aFrameSPtr);
+    }
+
+    return engine.getPositionOf(object_, anInstant).inFrame(aFrameSPtr, anInstant);
+}
+
 String SPICE::StringFromObject(const SPICE::Object& anObject)
 {
     using ostk::core::container::Map;
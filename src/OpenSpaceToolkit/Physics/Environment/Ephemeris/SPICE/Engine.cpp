@@ -1,5 +1,6 @@
 /// Apache License 2.0
 
+#include <algorithm>
 #include <regex>
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
@@ -13,6 +14,7 @@
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/Dynamic.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Ephemeris/SPICE/Engine.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Ephemeris/SPICE/Manager.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 
 extern "C"
 {
@@ -31,6 +33,80 @@ namespace ephemeris
 namespace spice
 {
 
+/// @brief                      Coverage windows of loaded kernels
+///
+///                             Intervals are sorted by start, along with the running maximum of their ends, so that a
+///                             stabbing query is a binary search followed by a backward scan which stops as soon as no
+///                             earlier interval can reach the instant (flattened interval tree).
+
+class Engine::CoverageIndex
+{
+   public:
+    CoverageIndex(const Array<Interval>& anIntervalArray)
+        : intervals_(anIntervalArray),
+          endMaxima_(Array<Instant>::Empty())
+    {
+        std::sort(
+            intervals_.begin(),
+            intervals_.end(),
+            [](const Interval& aFirstInterval, const Interval& aSecondInterval) -> bool
+            {
+                return aFirstInterval.accessStart() < aSecondInterval.accessStart();
+            }
+        );
+
+        endMaxima_.reserve(intervals_.getSize());
+
+        for (const Interval& interval : intervals_)
+        {
+            endMaxima_.add(
+                (endMaxima_.isEmpty() || (endMaxima_.accessLast() < interval.accessEnd())) ? interval.accessEnd()
+                                                                                           : endMaxima_.accessLast()
+            );
+        }
+    }
+
+    bool covers(const Instant& anInstant) const
+    {
+        // Intervals starting after the instant cannot contain it
+
+        const auto intervalIt = std::upper_bound(
+            intervals_.begin(),
+            intervals_.end(),
+            anInstant,
+            [](const Instant& aValue, const Interval& anInterval) -> bool
+            {
+                return aValue < anInterval.accessStart();
+            }
+        );
+
+        for (Size index = static_cast<Size>(intervalIt - intervals_.begin()); index > 0; --index)
+        {
+            if (endMaxima_[index - 1] < anInstant)
+            {
+                break;
+            }
+
+            if (intervals_[index - 1].contains(anInstant))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+   private:
+    Array<Interval> intervals_;
+    Array<Instant> endMaxima_;
+};
+
+using ostk::physics::time::Duration;
+
+// Delay before fetching Earth orientation kernels again, when the latest fetched ones do not cover an instant
+
+static const Duration EarthKernelFetchRetryPeriod = Duration::Hours(1.0);
+
 static void handleException()
 {
     // https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/req/error.html
@@ -55,6 +131,21 @@ static void handleException()
     );
 }
 
+static SpiceDouble EphemerisTimeFromInstant(const Instant& anInstant)
+{
+    using ostk::core::container::Pair;
+    using ostk::core::type::Real;
+
+    using ostk::physics::time::Scale;
+
+    // Ephemeris time [s] from J2000, TDB being approximated by TT
+
+    const Pair<Real, Real> julianDate_TT = anInstant.getJulianDateParts(Scale::TT);
+
+    return ((static_cast<double>(julianDate_TT.first) - 2451545.0) + static_cast<double>(julianDate_TT.second)) *
+           86400.0;
+}
+
 std::ostream& operator<<(std::ostream& anOutputStream, const Engine& anEngine)
 {
     ostk::core::utils::Print::Header(anOutputStream, "SPICE :: Engine");
@@ -120,9 +211,55 @@ bool Engine::isKernelLoaded(const Kernel& aKernel) const
 
 Engine::Mode Engine::getMode() const
 {
+    return mode_.load();
+}
+
+bool Engine::isReaderEnabled() const
+{
+    return readerEnabled_.load();
+}
+
+Size Engine::getKernelLoadCount() const
+{
+    return kernelLoadCount_.load(std::memory_order_relaxed);
+}
+
+Size Engine::getKernelUnloadCount() const
+{
+    return kernelUnloadCount_.load(std::memory_order_relaxed);
+}
+
+Size Engine::getKernelFetchCount() const
+{
+    return kernelFetchCount_.load(std::memory_order_relaxed);
+}
+
+Position Engine::getPositionOf(const SPICE::Object& aSpiceObject, const Instant& anInstant) const
+{
+    using ostk::core::type::Integer;
+
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    const String spiceIdentifier = Engine::SpiceIdentifierFromSpiceObject(aSpiceObject);
+
+    if (readerEnabled_.load())
+    {
+        const Shared<const Reader> readerSPtr = readerSPtr_.load();
+
+        const Transform transform = readerSPtr->getTranslationAt(Integer::Parse(spiceIdentifier), anInstant);
+
+        if (transform.isDefined())
+        {
+            return Position::Meters(-transform.accessTranslation(), Frame::GCRF());
+        }
+    }
+
     const std::lock_guard<std::mutex> lock {mutex_};
 
-    return mode_;
+    return Position::Meters(this->getPositionAt_(spiceIdentifier, anInstant), Frame::GCRF());
 }
 
 Shared<const Frame> Engine::getFrameOf(const SPICE::Object& aSpiceObject) const
@@ -152,7 +289,12 @@ void Engine::setMode(const Engine::Mode& aMode)
 {
     const std::lock_guard<std::mutex> lock {mutex_};
 
-    mode_ = aMode;
+    mode_.store(aMode);
+}
+
+void Engine::setReaderEnabled(const bool aBoolean)
+{
+    readerEnabled_.store(aBoolean);
 }
 
 void Engine::loadKernel(const Kernel& aKernel)
@@ -179,20 +321,40 @@ void Engine::unloadKernel(const Kernel& aKernel)
     this->unloadKernel_(aKernel);
 }
 
-void Engine::reset()
+void Engine::prefetchKernels(const Interval& anInterval)
 {
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
     const std::lock_guard<std::mutex> lock {mutex_};
 
-    earthKernelCache_.clear();
-    earthKernelCacheIndex_ = 0;
+    // Earth orientation kernels all start at the same epoch: covering both ends covers the interval
+
+    if (this->isEarthKernelFetchNeeded(anInterval.accessStart()) ||
+        this->isEarthKernelFetchNeeded(anInterval.accessEnd()))
+    {
+        this->fetchEarthKernels(anInterval);
+    }
+}
+
+void Engine::reset()
+{
+    const std::lock_guard<std::mutex> lock {mutex_};
 
     kernelSet_.clear();
 
+    earthKernelIndexSPtr_.store(std::make_shared<const CoverageIndex>(Array<Interval>::Empty()));
+    earthKernelFetchInstantSPtr_.store(nullptr);
+
     // Unload all kernels, clear the kernel pool, and re-initialize the subsystem
     // https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/cspice/kclear_c.html
 
     kclear_c();
 
+    readerSPtr_.store(std::make_shared<const Reader>());
+
     this->setup();
 }
 
@@ -247,8 +409,13 @@ Array<Kernel> Engine::DefaultKernels()
 
 Engine::Engine(const Engine::Mode& aMode)
     : mode_(aMode),
-      earthKernelCache_(Array<Pair<Interval, const Kernel*>>::Empty()),
-      earthKernelCacheIndex_(0)
+      earthKernelIndexSPtr_(std::make_shared<const CoverageIndex>(Array<Interval>::Empty())),
+      earthKernelFetchInstantSPtr_(nullptr),
+      readerSPtr_(std::make_shared<const Reader>()),
+      readerEnabled_(true),
+      kernelLoadCount_(0),
+      kernelUnloadCount_(0),
+      kernelFetchCount_(0)
 {
     this->setup();
 }
@@ -260,26 +427,47 @@ bool Engine::isKernelLoaded_(const Kernel& aKernel) const
 
 Transform Engine::getTransformAt(const String& aSpiceIdentifier, const String& aFrameName, const Instant& anInstant)
     const
+{
+    using ostk::core::type::Integer;
+
+    if (readerEnabled_.load())
+    {
+        // Earth orientation kernels may have to be fetched first (automatic mode)
+
+        if ((aSpiceIdentifier == "399") && this->isEarthKernelFetchNeeded(anInstant))
+        {
+            const std::lock_guard<std::mutex> lock {mutex_};
+
+            this->manageKernels(aSpiceIdentifier, anInstant);
+        }
+
+        const Shared<const Reader> readerSPtr = readerSPtr_.load();
+
+        const Transform transform = readerSPtr->getTransformAt(Integer::Parse(aSpiceIdentifier), aFrameName, anInstant);
+
+        if (transform.isDefined())
+        {
+            return transform;
+        }
+    }
+
+    const std::lock_guard<std::mutex> lock {mutex_};
+
+    return this->getTransformAt_(aSpiceIdentifier, aFrameName, anInstant);
+}
+
+Transform Engine::getTransformAt_(const String& aSpiceIdentifier, const String& aFrameName, const Instant& anInstant)
+    const
 {
     using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
     using ostk::mathematics::geometry::d3::transformation::rotation::RotationMatrix;
     using ostk::mathematics::object::Matrix3d;
-    using ostk::mathematics::object::Vector3d;
-
-    using ostk::physics::time::Scale;
 
     // Load required kernels
 
     this->manageKernels(aSpiceIdentifier, anInstant);
 
-    // Time
-
-    const SpiceDouble ephemerisTime = unitim_c(anInstant.getJulianDate(Scale::TT), "JDTDB", "ET");
-
-    if (failed_c())
-    {
-        handleException();
-    }
+    const SpiceDouble ephemerisTime = EphemerisTimeFromInstant(anInstant);
 
     // Position & Velocity
 
@@ -339,6 +527,23 @@ Transform Engine::getTransformAt(const String& aSpiceIdentifier, const String& a
     return {anInstant, -x_BODY_GCRF, -v_BODY_GCRF, q_BODY_GCRF, w_BODY_GCRF_in_BODY, Transform::Type::Passive};
 }
 
+Vector3d Engine::getPositionAt_(const String& aSpiceIdentifier, const Instant& anInstant) const
+{
+    // Position only: orientation kernels are not needed
+
+    SpiceDouble lt;
+    SpiceDouble position[3];
+
+    spkpos_c(aSpiceIdentifier.data(), EphemerisTimeFromInstant(anInstant), "J2000", "NONE", "earth", position, &lt);
+
+    if (failed_c())
+    {
+        handleException();
+    }
+
+    return {position[0] * 1e3, position[1] * 1e3, position[2] * 1e3};
+}
+
 void Engine::setup()
 {
     // Set error action
@@ -359,65 +564,92 @@ void Engine::setup()
     }
 }
 
+bool Engine::isEarthKernelFetchNeeded(const Instant& anInstant) const
+{
+    if ((mode_.load() != Engine::Mode::Automatic) || earthKernelIndexSPtr_.load()->covers(anInstant))
+    {
+        return false;
+    }
+
+    // Fetched kernels are the latest available ones: if they do not cover the instant, fetching again only helps once
+    // newer kernels may have been published, and the loaded (predicted) Earth orientation kernel is used meanwhile
+
+    const Shared<const Instant> fetchInstantSPtr = earthKernelFetchInstantSPtr_.load();
+
+    return (fetchInstantSPtr == nullptr) || (Instant::Now() >= (*fetchInstantSPtr + EarthKernelFetchRetryPeriod));
+}
+
 void Engine::manageKernels(const String& aSpiceIdentifier, const Instant& anInstant) const
 {
-    if (mode_ == Engine::Mode::Automatic)
+    // Load Earth orientation kernel (if necessary)
+
+    if ((aSpiceIdentifier != "399") || !this->isEarthKernelFetchNeeded(anInstant))
+    {
+        return;
+    }
+
+    this->fetchEarthKernels(Interval::Closed(anInstant, anInstant));
+}
+
+void Engine::fetchEarthKernels(const Interval& anInterval) const
+{
+    // List available Earth kernels
+
+    const Array<Kernel> earthKernels = Manager::Get().fetchMatchingKernels("^earth_000101_[\\d]{6}_[\\d]{6}.bpc$");
+
+    kernelFetchCount_.fetch_add(1, std::memory_order_relaxed);
+
+    if (earthKernels.isEmpty())
+    {
+        throw ostk::core::error::RuntimeError("Cannot fetch BPC Earth kernel over [{}].", anInterval.toString());
+    }
+
+    earthKernelFetchInstantSPtr_.store(std::make_shared<const Instant>(Instant::Now()));
+
+    // Load every kernel intersecting the interval, by increasing coverage end, as the last loaded kernel takes
+    // precedence where coverages overlap, and fall back to the kernel with the latest coverage end
+
+    Array<Pair<Interval, const Kernel*>> earthKernelCoverages = Array<Pair<Interval, const Kernel*>>::Empty();
+
+    for (const Kernel& earthKernel : earthKernels)
     {
-        // Load kernel (if necessary)
+        const Interval coverage = Engine::EarthKernelCoverage(earthKernel);
 
-        if (aSpiceIdentifier == "399")  // Earth
+        if (coverage.isDefined())
         {
-            bool earthKernelFound = false;
+            earthKernelCoverages.add({coverage, &earthKernel});
+        }
+    }
 
-            if (!earthKernelCache_.isEmpty())
-            {
-                if (earthKernelCache_.at(earthKernelCacheIndex_).first.contains(anInstant))
-                {
-                    earthKernelFound = true;
-                }
-                else
-                {
-                    for (earthKernelCacheIndex_ = 0; earthKernelCacheIndex_ < earthKernelCache_.getSize();
-                         ++earthKernelCacheIndex_)
-                    {
-                        if (earthKernelCache_.at(earthKernelCacheIndex_).first.contains(anInstant))
-                        {
-                            earthKernelFound = true;
-
-                            break;
-                        }
-                    }
-                }
-            }
+    std::sort(
+        earthKernelCoverages.begin(),
+        earthKernelCoverages.end(),
+        [](const Pair<Interval, const Kernel*>& aLhs, const Pair<Interval, const Kernel*>& aRhs) -> bool
+        {
+            return aLhs.first.accessEnd() < aRhs.first.accessEnd();
+        }
+    );
 
-            if (!earthKernelFound)
-            {
-                const std::function<void(const bool)> loadEarthKernel = [&](const bool isFirstTime) -> void
-                {
-                    (void)isFirstTime;
-
-                    // List available Earth kernels
-
-                    const Array<Kernel> earthKernels =
-                        Manager::Get().fetchMatchingKernels("^earth_000101_[\\d]{6}_[\\d]{6}.bpc$");
-
-                    if (!earthKernels.isEmpty())
-                    {
-                        const_cast<Engine*>(this)->loadKernel_(earthKernels.accessFirst()
-                        );  // [TBM] The first kernel is not necessarily the correct one
-                    }
-                    else
-                    {
-                        throw ostk::core::error::RuntimeError(
-                            "Cannot fetch BPC Earth kernel at [{}].", anInstant.toString()
-                        );
-                    }
-                };
-
-                loadEarthKernel(true);
-            }
+    bool isLoaded = false;
+
+    for (const auto& earthKernelCoverage : earthKernelCoverages)
+    {
+        const Interval& coverage = earthKernelCoverage.first;
+
+        if ((coverage.accessStart() <= anInterval.accessEnd()) && (anInterval.accessStart() <= coverage.accessEnd()))
+        {
+            const_cast<Engine*>(this)->loadKernel_(*earthKernelCoverage.second);
+
+            isLoaded = true;
         }
     }
+
+    if (!isLoaded)
+    {
+        const_cast<Engine*>(this)->loadKernel_(
+            earthKernelCoverages.isEmpty() ? earthKernels.accessFirst() : *earthKernelCoverages.accessLast().second
+        );
+    }
 }
 
 void Engine::loadKernel_(const Kernel& aKernel)
@@ -431,7 +663,7 @@ void Engine::loadKernel_(const Kernel& aKernel)
 
     if (!kernelFile.exists())
     {
-        if (mode_ == Engine::Mode::Automatic)
+        if (mode_.load() == Engine::Mode::Automatic)
         {
             Manager::Get().fetchKernel(aKernel);
             const Path filePath = Manager::Get().getLocalRepository().getPath() + Path::Parse(aKernel.getName());
@@ -443,6 +675,10 @@ void Engine::loadKernel_(const Kernel& aKernel)
         }
     }
 
+    const Shared<Reader> readerSPtr = std::make_shared<Reader>(*readerSPtr_.load());
+
+    readerSPtr->loadKernel(Kernel(aKernel.getType(), kernelFile));
+
     const String kernelFilePathString = kernelFile.getPath().toString();
 
     const ConstSpiceChar* kernelFilePathSpiceChar = kernelFilePathString.data();
@@ -456,7 +692,11 @@ void Engine::loadKernel_(const Kernel& aKernel)
 
     kernelSet_.insert(aKernel);
 
-    this->updateEarthKernelCache();
+    kernelLoadCount_.fetch_add(1, std::memory_order_relaxed);
+
+    readerSPtr_.store(readerSPtr);
+
+    this->updateEarthKernelIndex();
 }
 
 void Engine::unloadKernel_(const Kernel& aKernel)
@@ -481,12 +721,37 @@ void Engine::unloadKernel_(const Kernel& aKernel)
 
     kernelSet_.erase(aKernel);
 
-    // Reset cache
+    kernelUnloadCount_.fetch_add(1, std::memory_order_relaxed);
 
-    this->updateEarthKernelCache();
+    const Shared<Reader> readerSPtr = std::make_shared<Reader>(*readerSPtr_.load());
+
+    readerSPtr->unloadKernel(aKernel);
+
+    readerSPtr_.store(readerSPtr);
+
+    // Reset index
+
+    this->updateEarthKernelIndex();
+}
+
+void Engine::updateEarthKernelIndex()
+{
+    Array<Interval> coverages = Array<Interval>::Empty();
+
+    for (const auto& kernel : kernelSet_)
+    {
+        const Interval coverage = Engine::EarthKernelCoverage(kernel);
+
+        if (coverage.isDefined())
+        {
+            coverages.add(coverage);
+        }
+    }
+
+    earthKernelIndexSPtr_.store(std::make_shared<const CoverageIndex>(coverages));
 }
 
-void Engine::updateEarthKernelCache()
+Interval Engine::EarthKernelCoverage(const Kernel& aKernel)
 {
     using ostk::core::type::Integer;
     using ostk::core::type::Uint16;
@@ -497,37 +762,28 @@ void Engine::updateEarthKernelCache()
     using ostk::physics::time::Scale;
     using ostk::physics::time::Time;
 
-    earthKernelCache_.clear();
-    earthKernelCacheIndex_ = 0;
-
-    for (const auto& kernel : kernelSet_)
+    if ((aKernel.getType() != Kernel::Type::BPCK) || (aKernel.getName().getHead(13) != "earth_000101_"))
     {
-        if (kernel.getType() == Kernel::Type::BPCK)
-        {
-            if (kernel.getName().getHead(13) == "earth_000101_")
-            {
-                // earth_000101_190103_181012.bpc
+        return Interval::Undefined();
+    }
 
-                static const Instant startInstant = Instant::DateTime(DateTime(2000, 1, 1, 0, 0, 0), Scale::UTC);
+    // earth_000101_190103_181012.bpc
 
-                const String endDateString = kernel.getName().getSubstring(20, 6);
+    static const Instant startInstant = Instant::DateTime(DateTime(2000, 1, 1, 0, 0, 0), Scale::UTC);
 
-                const Integer endYear = Integer::Parse(endDateString.getSubstring(0, 2));
-                const Integer endMonth = Integer::Parse(endDateString.getSubstring(2, 2));
-                const Integer endDay = Integer::Parse(endDateString.getSubstring(4, 2));
+    const String endDateString = aKernel.getName().getSubstring(20, 6);
 
-                const Date endDate = {
-                    static_cast<Uint16>(2000 + endYear), static_cast<Uint8>(endMonth), static_cast<Uint8>(endDay)
-                };
+    const Integer endYear = Integer::Parse(endDateString.getSubstring(0, 2));
+    const Integer endMonth = Integer::Parse(endDateString.getSubstring(2, 2));
+    const Integer endDay = Integer::Parse(endDateString.getSubstring(4, 2));
 
-                const Instant endInstant = Instant::DateTime(DateTime(endDate, Time::Midnight()), Scale::UTC);
+    const Date endDate = {
+        static_cast<Uint16>(2000 + endYear), static_cast<Uint8>(endMonth), static_cast<Uint8>(endDay)
+    };
 
-                const Interval interval = Interval::Closed(startInstant, endInstant);
+    const Instant endInstant = Instant::DateTime(DateTime(endDate, Time::Midnight()), Scale::UTC);
 
-                earthKernelCache_.add({interval, &kernel});
-            }
-        }
-    }
+    return Interval::Closed(startInstant, endInstant);
 }
 
 String Engine::SpiceIdentifierFromSpiceObject(const SPICE::Object& aSpiceObject)
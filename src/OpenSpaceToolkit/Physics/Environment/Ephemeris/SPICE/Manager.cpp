@@ -61,6 +61,7 @@ void Manager::setLocalRepository(const Directory& aDirectory)
     const std::lock_guard<std::mutex> lock {mutex_};
 
     localRepository_ = aDirectory;
+    localCatalogIsStale_ = true;
 
     setup();
 }
@@ -134,6 +135,8 @@ void Manager::fetchKernel(const Kernel& aKernel) const
         );
     }
 
+    localCatalogIsStale_ = true;
+
     std::cout << String::Format(
                      "Successfully fetched SPICE Kernel [{}] from [{}]...",
                      kernelFile.toString(),
@@ -179,6 +182,8 @@ Array<Kernel> Manager::fetchMatchingKernels(const String& aRegexString) const
             }
         }
 
+        localCatalogIsStale_ = true;
+
         std::cout << String::Format(
                          "Successfully fetched SPICE Kernel [{}] from [{}]...",
                          fetchedKernelFile.toString(),
@@ -198,43 +203,50 @@ Array<Kernel> Manager::fetchMatchingKernels(const String& aRegexString) const
 
 Kernel Manager::findKernel(const String& aRegexString) const
 {
-    using iterator = std::filesystem::directory_iterator;
-
-    const std::regex aRegex {aRegexString};
-
-    Array<Path> kernelPaths;
-
     // Try to find kernel in local repository
-    std::filesystem::path directory = std::string(localRepository_.getPath().toString());
 
-    const iterator end;
-    for (iterator iter {directory}; iter != end; ++iter)
     {
-        const String filename = iter->path().filename().string();
-        if (std::filesystem::is_regular_file(*iter) && std::regex_match(filename, aRegex))
+        const std::lock_guard<std::mutex> lock {mutex_};
+
+        const std::regex& regex = this->accessRegex_(aRegexString);
+
+        for (const String& kernelName : this->accessLocalCatalog_())
         {
-            kernelPaths.add(Path::Parse(iter->path().string()));
+            if (std::regex_match(kernelName, regex))
+            {
+                return Kernel::File(File::Path(localRepository_.getPath() + Path::Parse(kernelName)));
+            }
         }
     }
 
     // If none found, fall back to fetching from remote
-    if (kernelPaths.isEmpty())
-    {
-        Array<Kernel> fetchedKernels = const_cast<Manager*>(this)->fetchMatchingKernels(aRegexString);
 
-        if (fetchedKernels.isEmpty())
-        {
-            throw ostk::core::error::RuntimeError("Failed to find or fetch SPICE Kernel matching [{}].", aRegexString);
-        }
+    Array<Kernel> fetchedKernels = const_cast<Manager*>(this)->fetchMatchingKernels(aRegexString);
 
-        return fetchedKernels.accessFirst();
+    if (fetchedKernels.isEmpty())
+    {
+        throw ostk::core::error::RuntimeError("Failed to find or fetch SPICE Kernel matching [{}].", aRegexString);
     }
 
-    return Kernel::File(File::Path(kernelPaths.accessFirst()));
+    return fetchedKernels.accessFirst();
+}
+
+void Manager::refresh()
+{
+    const std::lock_guard<std::mutex> lock {mutex_};
+
+    localCatalog_.clear();
+    localCatalogIsStale_ = true;
+
+    regexCache_.clear();
 }
 
 Manager::Manager()
-    : localRepository_(Manager::DefaultLocalRepository())
+    : localRepository_(Manager::DefaultLocalRepository()),
+      localCatalog_(Array<String>::Empty()),
+      localCatalogTimestamp_(),
+      localCatalogIsStale_(true),
+      regexCache_()
 {
 }
 
@@ -246,6 +258,48 @@ void Manager::setup()
     }
 }
 
+const Array<String>& Manager::accessLocalCatalog_() const
+{
+    using iterator = std::filesystem::directory_iterator;
+
+    const std::filesystem::path directory = std::string(localRepository_.getPath().toString());
+
+    // Adding, removing or renaming a file updates the modification time of the directory
+
+    const std::filesystem::file_time_type timestamp = std::filesystem::last_write_time(directory);
+
+    if (localCatalogIsStale_ || (timestamp != localCatalogTimestamp_))
+    {
+        localCatalog_.clear();
+
+        const iterator end;
+        for (iterator iter {directory}; iter != end; ++iter)
+        {
+            if (std::filesystem::is_regular_file(*iter))
+            {
+                localCatalog_.add(iter->path().filename().string());
+            }
+        }
+
+        localCatalogTimestamp_ = timestamp;
+        localCatalogIsStale_ = false;
+    }
+
+    return localCatalog_;
+}
+
+const std::regex& Manager::accessRegex_(const String& aRegexString) const
+{
+    const auto regexIt = regexCache_.find(aRegexString);
+
+    if (regexIt != regexCache_.end())
+    {
+        return regexIt->second;
+    }
+
+    return regexCache_.emplace(aRegexString, std::regex {aRegexString}).first->second;
+}
+
 }  // namespace spice
 }  // namespace ephemeris
 }  // namespace environment
@@ -0,0 +1,1470 @@
+/// Apache License 2.0
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/RotationMatrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Ephemeris/SPICE/Reader.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace environment
+{
+namespace ephemeris
+{
+namespace spice
+{
+
+using ostk::core::container::Pair;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::geometry::d3::transformation::rotation::RotationMatrix;
+using ostk::mathematics::object::Matrix3d;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::time::Scale;
+
+// https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/req/daf.html
+
+static constexpr Size DAFRecordSize = 1024;
+
+// Maximum length of SPK center chains and frame chains
+
+static constexpr Size MaximumChainLength = 16;
+
+static constexpr int J2000FrameIdentifier = 1;
+static constexpr int ECLIPJ2000FrameIdentifier = 17;
+static constexpr int EarthIdentifier = 399;
+
+// Obliquity of the ecliptic at J2000, as used by the SPICE ECLIPJ2000 frame [rad]
+
+static constexpr double EclipticObliquity = 84381.448 / 3600.0 * M_PI / 180.0;
+
+/// @brief                      Read-only memory mapping of a file
+
+class MappedFile
+{
+   public:
+    MappedFile(const String& aFilePath)
+        : data_(nullptr),
+          size_(0)
+    {
+        const int fileDescriptor = ::open(aFilePath.data(), O_RDONLY);
+
+        if (fileDescriptor < 0)
+        {
+            throw ostk::core::error::RuntimeError("Cannot open kernel file [{}].", aFilePath);
+        }
+
+        struct stat fileStatus;
+
+        if (::fstat(fileDescriptor, &fileStatus) != 0)
+        {
+            ::close(fileDescriptor);
+
+            throw ostk::core::error::RuntimeError("Cannot read kernel file [{}].", aFilePath);
+        }
+
+        size_ = static_cast<Size>(fileStatus.st_size);
+
+        if (size_ > 0)
+        {
+            void* address = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+            if (address == MAP_FAILED)
+            {
+                ::close(fileDescriptor);
+
+                throw ostk::core::error::RuntimeError("Cannot map kernel file [{}].", aFilePath);
+            }
+
+            data_ = static_cast<const char*>(address);
+        }
+
+        ::close(fileDescriptor);
+    }
+
+    MappedFile(const MappedFile& aMappedFile) = delete;
+
+    MappedFile& operator=(const MappedFile& aMappedFile) = delete;
+
+    ~MappedFile()
+    {
+        if (data_ != nullptr)
+        {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+    }
+
+    const char* data() const
+    {
+        return data_;
+    }
+
+    Size size() const
+    {
+        return size_;
+    }
+
+   private:
+    const char* data_;
+    Size size_;
+};
+
+/// @brief                      Chebyshev segment (SPK type 2 or 3, binary PCK type 2)
+
+struct Segment
+{
+    int body;               ///< SPK target, or binary PCK frame class identifier
+    int center;             ///< SPK center (0 for binary PCK)
+    int frame;              ///< Reference frame identifier
+    int type;               ///< Segment type
+    double startTime;       ///< Coverage start [s] (TDB from J2000)
+    double endTime;         ///< Coverage end [s] (TDB from J2000)
+    const double* records;  ///< First record
+    double initialTime;     ///< Start of the first record [s]
+    double intervalLength;  ///< Record interval length [s]
+    Size recordSize;        ///< Record size [double]
+    Size recordCount;       ///< Record count
+    Size coefficientCount;  ///< Chebyshev coefficient count per component
+};
+
+/// @brief                      Text kernel assignment (NAME = ( ... ) or NAME += ( ... ))
+
+struct Assignment
+{
+    std::string name;
+    bool isAppend;
+    Array<double> numbers;
+    Array<String> strings;
+};
+
+/// @brief                      Text kernel pool variable
+
+struct Variable
+{
+    Array<double> numbers;
+    Array<String> strings;
+};
+
+using VariableMap = std::unordered_map<std::string, Variable>;
+
+/// @brief                      Frame definition, resolved from built-in frames and text kernels
+
+struct FrameDefinition
+{
+    enum class Class
+    {
+        Inertial,  ///< J2000
+        PCK,       ///< Body-fixed frame, from a binary PCK segment or text PCK constants
+        TK         ///< Constant rotation with respect to a relative frame
+    };
+
+    FrameDefinition::Class frameClass;
+
+    int classIdentifier;  ///< PCK frame class identifier
+
+    bool hasConstants;                 ///< True if text PCK constants are available
+    Array<double> poleRightAscension;  ///< [deg, deg/century, ...]
+    Array<double> poleDeclination;     ///< [deg, deg/century, ...]
+    Array<double> primeMeridian;       ///< [deg, deg/day, ...]
+
+    std::string relativeFrameName;  ///< TK relative frame name
+    Matrix3d rotation;              ///< TK rotation, from relative frame coordinates to frame coordinates
+};
+
+class Reader::Source
+{
+   public:
+    Kernel kernel;
+
+    Shared<const MappedFile> fileSPtr;
+
+    Array<Segment> spkSegments;
+    Array<Segment> pckSegments;
+
+    Array<Assignment> assignments;
+};
+
+class Reader::Index
+{
+   public:
+    Array<const Segment*> spkSegments;  ///< In decreasing priority order
+    Array<const Segment*> pckSegments;  ///< In decreasing priority order
+
+    VariableMap variables;
+    std::unordered_map<std::string, FrameDefinition> frames;
+
+    bool getStateAt(const int aTarget, const int anObserver, const double anEphemerisTime, double aState[6]) const;
+
+    bool getRotationAt(
+        const std::string& aFrameName,
+        const double anEphemerisTime,
+        Matrix3d& aRotation,
+        Vector3d& anAngularVelocity,
+        const Size aDepth
+    ) const;
+};
+
+static bool IsLittleEndian()
+{
+    const std::uint16_t value = 1;
+    char firstByte;
+
+    std::memcpy(&firstByte, &value, 1);
+
+    return firstByte == 1;
+}
+
+static std::string ToUpper(const std::string& aString)
+{
+    std::string upperString = aString;
+
+    for (char& character : upperString)
+    {
+        character = static_cast<char>(std::toupper(static_cast<unsigned char>(character)));
+    }
+
+    return upperString;
+}
+
+/// @brief                      Frame rotation about a coordinate axis (SPICE ROTATE convention)
+
+static Matrix3d AxisRotation(const int anAxis, const double anAngle)
+{
+    const double c = std::cos(anAngle);
+    const double s = std::sin(anAngle);
+
+    Matrix3d rotation;
+
+    switch (anAxis)
+    {
+        case 1:
+            rotation << 1.0, 0.0, 0.0, 0.0, c, s, 0.0, -s, c;
+            break;
+
+        case 2:
+            rotation << c, 0.0, -s, 0.0, 1.0, 0.0, s, 0.0, c;
+            break;
+
+        default:
+            rotation << c, s, 0.0, -s, c, 0.0, 0.0, 0.0, 1.0;
+            break;
+    }
+
+    return rotation;
+}
+
+/// @brief                      Rotation from reference frame to body-fixed frame, from 3-1-3 Euler angles and rates
+///
+///                             R = [a3]_3 [a2]_1 [a1]_3, and the angular velocity of the body-fixed frame with respect
+///                             to the reference frame, expressed in the body-fixed frame.
+
+static void EulerRotation(
+    const double anAngles[3], const double aRates[3], Matrix3d& aRotation, Vector3d& anAngularVelocity
+)
+{
+    aRotation = AxisRotation(3, anAngles[2]) * AxisRotation(1, anAngles[1]) * AxisRotation(3, anAngles[0]);
+
+    const double sinA2 = std::sin(anAngles[1]);
+    const double cosA2 = std::cos(anAngles[1]);
+    const double sinA3 = std::sin(anAngles[2]);
+    const double cosA3 = std::cos(anAngles[2]);
+
+    anAngularVelocity = {
+        aRates[1] * cosA3 + aRates[0] * sinA3 * sinA2,
+        -aRates[1] * sinA3 + aRates[0] * cosA3 * sinA2,
+        aRates[2] + aRates[0] * cosA2
+    };
+}
+
+/// @brief                      Evaluate a Chebyshev expansion and its derivative at x in [-1, 1]
+
+static void EvaluateChebyshev(
+    const double* aCoefficients, const Size aCount, const double anX, double& aValue, double& aDerivative
+)
+{
+    double t0 = 1.0;
+    double t1 = anX;
+    double dt0 = 0.0;
+    double dt1 = 1.0;
+
+    aValue = aCoefficients[0];
+    aDerivative = 0.0;
+
+    if (aCount > 1)
+    {
+        aValue += aCoefficients[1] * t1;
+        aDerivative += aCoefficients[1] * dt1;
+    }
+
+    for (Size index = 2; index < aCount; ++index)
+    {
+        const double t2 = 2.0 * anX * t1 - t0;
+        const double dt2 = 2.0 * t1 + 2.0 * anX * dt1 - dt0;
+
+        aValue += aCoefficients[index] * t2;
+        aDerivative += aCoefficients[index] * dt2;
+
+        t0 = t1;
+        t1 = t2;
+        dt0 = dt1;
+        dt1 = dt2;
+    }
+}
+
+/// @brief                      Evaluate a segment: three components and their time derivatives
+
+static void EvaluateSegment(const Segment& aSegment, const double anEphemerisTime, double aState[6])
+{
+    const double recordPosition = std::floor((anEphemerisTime - aSegment.initialTime) / aSegment.intervalLength);
+
+    const Size recordIndex =
+        (recordPosition <= 0.0) ? 0 : std::min(static_cast<Size>(recordPosition), aSegment.recordCount - 1);
+
+    const double* record = aSegment.records + recordIndex * aSegment.recordSize;
+
+    const double midpoint = record[0];
+    const double radius = record[1];
+
+    const double x = (anEphemerisTime - midpoint) / radius;
+
+    for (Size component = 0; component < 3; ++component)
+    {
+        double value;
+        double derivative;
+
+        EvaluateChebyshev(
+            record + 2 + component * aSegment.coefficientCount, aSegment.coefficientCount, x, value, derivative
+        );
+
+        aState[component] = value;
+        aState[component + 3] = derivative / radius;
+    }
+
+    if (aSegment.type == 3)
+    {
+        for (Size component = 0; component < 3; ++component)
+        {
+            double derivative;
+
+            EvaluateChebyshev(
+                record + 2 + (component + 3) * aSegment.coefficientCount,
+                aSegment.coefficientCount,
+                x,
+                aState[component + 3],
+                derivative
+            );
+        }
+    }
+}
+
+/// @brief                      Find the highest priority segment of a body covering an ephemeris time
+
+static const Segment* FindSegment(
+    const Array<const Segment*>& aSegmentArray, const int aBody, const double anEphemerisTime
+)
+{
+    for (const Segment* segmentPtr : aSegmentArray)
+    {
+        if ((segmentPtr->body == aBody) && (segmentPtr->startTime <= anEphemerisTime) &&
+            (anEphemerisTime <= segmentPtr->endTime))
+        {
+            return segmentPtr;
+        }
+    }
+
+    return nullptr;
+}
+
+/// @brief                      Ephemeris time [s] from J2000, TDB being approximated by TT (as in the SPICE engine)
+
+static double EphemerisTimeFromInstant(const Instant& anInstant)
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    const Pair<Real, Real> julianDate_TT = anInstant.getJulianDateParts(Scale::TT);
+
+    return ((static_cast<double>(julianDate_TT.first) - 2451545.0) + static_cast<double>(julianDate_TT.second)) *
+           86400.0;
+}
+
+/// @brief                      Read the Chebyshev segments of an SPK or binary PCK file
+///
+/// @return                     False if the file is not a DAF file in native byte order
+
+static bool ReadSegments(const MappedFile& aFile, Array<Segment>& aSPKSegmentArray, Array<Segment>& aPCKSegmentArray)
+{
+    if (aFile.size() < DAFRecordSize)
+    {
+        return false;
+    }
+
+    const char* data = aFile.data();
+
+    const std::string_view identifier = {data, 8};
+    const std::string_view format = {data + 88, 8};
+
+    const bool isSPK = (identifier == "DAF/SPK ");
+    const bool isPCK = (identifier == "DAF/PCK ");
+
+    if ((!isSPK && !isPCK) || (format != (IsLittleEndian() ? "LTL-IEEE" : "BIG-IEEE")))
+    {
+        return false;
+    }
+
+    std::int32_t doubleCount;
+    std::int32_t integerCount;
+    std::int32_t firstSummaryRecord;
+
+    std::memcpy(&doubleCount, data + 8, 4);
+    std::memcpy(&integerCount, data + 12, 4);
+    std::memcpy(&firstSummaryRecord, data + 76, 4);
+
+    if ((doubleCount != 2) || (integerCount != (isSPK ? 6 : 5)))
+    {
+        return false;
+    }
+
+    const Size summarySize = static_cast<Size>(doubleCount + (integerCount + 1) / 2);
+    const Size wordCount = aFile.size() / sizeof(double);
+
+    // DAF addresses are 1-based double word indices
+
+    const double* words = reinterpret_cast<const double*>(data);
+
+    Size summaryRecord = static_cast<Size>(std::max(firstSummaryRecord, 0));
+    Size visitedRecordCount = 0;
+
+    while ((summaryRecord > 0) && ((summaryRecord * DAFRecordSize) <= aFile.size()) &&
+           (visitedRecordCount++ < (aFile.size() / DAFRecordSize)))
+    {
+        const double* control = words + (summaryRecord - 1) * (DAFRecordSize / sizeof(double));
+
+        const Size summaryCount = static_cast<Size>(std::max(control[2], 0.0));
+
+        for (Size summaryIndex = 0; (summaryIndex < summaryCount) &&
+                                    ((3 + (summaryIndex + 1) * summarySize) <= (DAFRecordSize / sizeof(double)));
+             ++summaryIndex)
+        {
+            const double* summary = control + 3 + summaryIndex * summarySize;
+
+            std::int32_t integers[6];
+            std::memcpy(integers, summary + doubleCount, static_cast<Size>(integerCount) * 4);
+
+            Segment segment;
+
+            segment.startTime = summary[0];
+            segment.endTime = summary[1];
+            segment.body = integers[0];
+            segment.center = isSPK ? integers[1] : 0;
+            segment.frame = isSPK ? integers[2] : integers[1];
+            segment.type = isSPK ? integers[3] : integers[2];
+
+            const std::int32_t beginAddress = isSPK ? integers[4] : integers[3];
+            const std::int32_t endAddress = isSPK ? integers[5] : integers[4];
+
+            const bool isSupportedType = isSPK ? ((segment.type == 2) || (segment.type == 3)) : (segment.type == 2);
+
+            if (!isSupportedType || (beginAddress < 1) || (endAddress < (beginAddress + 3)) ||
+                (static_cast<Size>(endAddress) > wordCount))
+            {
+                continue;
+            }
+
+            // Segment directory: INIT, INTLEN, RSIZE, N
+
+            const double* directory = words + (endAddress - 4);
+
+            const double recordSize = directory[2];
+            const double recordCount = directory[3];
+            const Size componentCount = (segment.type == 3) ? 6 : 3;
+
+            if ((directory[1] <= 0.0) || (recordSize < (2.0 + componentCount)) || (recordCount < 1.0))
+            {
+                continue;
+            }
+
+            segment.records = words + (beginAddress - 1);
+            segment.initialTime = directory[0];
+            segment.intervalLength = directory[1];
+            segment.recordSize = static_cast<Size>(recordSize);
+            segment.recordCount = static_cast<Size>(recordCount);
+            segment.coefficientCount = (segment.recordSize - 2) / componentCount;
+
+            if ((static_cast<Size>(beginAddress - 1) + segment.recordSize * segment.recordCount) >
+                static_cast<Size>(endAddress - 4))
+            {
+                continue;
+            }
+
+            (isSPK ? aSPKSegmentArray : aPCKSegmentArray).add(segment);
+        }
+
+        summaryRecord = static_cast<Size>(std::max(control[0], 0.0));
+    }
+
+    return true;
+}
+
+/// @brief                      Parse the data sections of a text kernel
+///
+///                             https://naif.jpl.nasa.gov/pub/naif/toolkit_docs/C/req/kernel.html
+
+static Array<Assignment> ParseTextKernel(const std::string_view& aContents)
+{
+    // Gather data sections
+
+    std::string data;
+
+    bool isData = false;
+    Size lineStart = 0;
+
+    while (lineStart < aContents.size())
+    {
+        Size lineEnd = aContents.find('\n', lineStart);
+
+        if (lineEnd == std::string_view::npos)
+        {
+            lineEnd = aContents.size();
+        }
+
+        std::string_view line = aContents.substr(lineStart, lineEnd - lineStart);
+
+        while (!line.empty() && std::isspace(static_cast<unsigned char>(line.front())))
+        {
+            line.remove_prefix(1);
+        }
+
+        while (!line.empty() && std::isspace(static_cast<unsigned char>(line.back())))
+        {
+            line.remove_suffix(1);
+        }
+
+        if (line == "\\begindata")
+        {
+            isData = true;
+        }
+        else if (line == "\\begintext")
+        {
+            isData = false;
+        }
+        else if (isData)
+        {
+            data.append(line);
+            data.push_back('\n');
+        }
+
+        lineStart = lineEnd + 1;
+    }
+
+    // Tokenize assignments
+
+    Array<Assignment> assignments = Array<Assignment>::Empty();
+
+    Size position = 0;
+
+    const auto skipSeparators = [&data, &position]() -> void
+    {
+        while ((position < data.size()) &&
+               (std::isspace(static_cast<unsigned char>(data[position])) || (data[position] == ',')))
+        {
+            ++position;
+        }
+    };
+
+    // Parse a value into an assignment, return false if the value is not supported (e.g. dates)
+
+    const auto parseValue = [&data, &position](Assignment& anAssignment) -> bool
+    {
+        if (data[position] == '\'')
+        {
+            std::string value;
+
+            ++position;
+
+            while (position < data.size())
+            {
+                if (data[position] == '\'')
+                {
+                    if (((position + 1) < data.size()) && (data[position + 1] == '\''))
+                    {
+                        value.push_back('\'');
+                        position += 2;
+
+                        continue;
+                    }
+
+                    ++position;
+
+                    break;
+                }
+
+                value.push_back(data[position++]);
+            }
+
+            anAssignment.strings.add(value);
+
+            return true;
+        }
+
+        const Size valueStart = position;
+
+        while ((position < data.size()) && !std::isspace(static_cast<unsigned char>(data[position])) &&
+               (data[position] != ',') && (data[position] != ')'))
+        {
+            ++position;
+        }
+
+        std::string value = data.substr(valueStart, position - valueStart);
+
+        for (char& character : value)
+        {
+            if ((character == 'D') || (character == 'd'))
+            {
+                character = 'E';
+            }
+        }
+
+        char* valueEnd = nullptr;
+        const double number = std::strtod(value.c_str(), &valueEnd);
+
+        if (value.empty() || (valueEnd != (value.c_str() + value.size())))
+        {
+            return false;
+        }
+
+        anAssignment.numbers.add(number);
+
+        return true;
+    };
+
+    while (true)
+    {
+        skipSeparators();
+
+        if (position >= data.size())
+        {
+            break;
+        }
+
+        const Size nameStart = position;
+
+        while ((position < data.size()) && !std::isspace(static_cast<unsigned char>(data[position])) &&
+               (data[position] != '=') && (data[position] != '+'))
+        {
+            ++position;
+        }
+
+        Assignment assignment = {
+            data.substr(nameStart, position - nameStart), false, Array<double>::Empty(), Array<String>::Empty()
+        };
+
+        while ((position < data.size()) && std::isspace(static_cast<unsigned char>(data[position])))
+        {
+            ++position;
+        }
+
+        if (data.compare(position, 2, "+=") == 0)
+        {
+            assignment.isAppend = true;
+            position += 2;
+        }
+        else if ((position < data.size()) && (data[position] == '='))
+        {
+            position += 1;
+        }
+        else
+        {
+            break;  // Malformed data section
+        }
+
+        skipSeparators();
+
+        if (position >= data.size())
+        {
+            break;
+        }
+
+        bool isValid = true;
+
+        if (data[position] == '(')
+        {
+            ++position;
+
+            while (true)
+            {
+                skipSeparators();
+
+                if (position >= data.size())
+                {
+                    break;
+                }
+
+                if (data[position] == ')')
+                {
+                    ++position;
+
+                    break;
+                }
+
+                isValid = parseValue(assignment) && isValid;
+            }
+        }
+        else
+        {
+            isValid = parseValue(assignment);
+        }
+
+        if (isValid)
+        {
+            assignments.add(assignment);
+        }
+    }
+
+    return assignments;
+}
+
+bool Reader::Index::getStateAt(const int aTarget, const int anObserver, const double anEphemerisTime, double aState[6])
+    const
+{
+    // Chains of (body, state with respect to the next body), followed up to the solar system barycenter
+
+    const auto buildChain = [this, anEphemerisTime](const int aBody, int aBodyArray[], double aStateArray[][6]) -> Size
+    {
+        Size length = 0;
+
+        aBodyArray[0] = aBody;
+
+        while (length < MaximumChainLength)
+        {
+            const Segment* segmentPtr = FindSegment(spkSegments, aBodyArray[length], anEphemerisTime);
+
+            if ((segmentPtr == nullptr) || (segmentPtr->frame != J2000FrameIdentifier))
+            {
+                break;
+            }
+
+            EvaluateSegment(*segmentPtr, anEphemerisTime, aStateArray[length]);
+
+            aBodyArray[length + 1] = segmentPtr->center;
+
+            ++length;
+        }
+
+        return length + 1;
+    };
+
+    int targetBodies[MaximumChainLength + 1];
+    double targetStates[MaximumChainLength][6];
+    int observerBodies[MaximumChainLength + 1];
+    double observerStates[MaximumChainLength][6];
+
+    const Size targetChainLength = buildChain(aTarget, targetBodies, targetStates);
+    const Size observerChainLength =
+        (aTarget == anObserver) ? 1 : buildChain(anObserver, observerBodies, observerStates);
+
+    if (aTarget == anObserver)
+    {
+        observerBodies[0] = anObserver;
+    }
+
+    for (Size targetIndex = 0; targetIndex < targetChainLength; ++targetIndex)
+    {
+        for (Size observerIndex = 0; observerIndex < observerChainLength; ++observerIndex)
+        {
+            if (targetBodies[targetIndex] == observerBodies[observerIndex])
+            {
+                for (Size component = 0; component < 6; ++component)
+                {
+                    aState[component] = 0.0;
+
+                    for (Size index = 0; index < targetIndex; ++index)
+                    {
+                        aState[component] += targetStates[index][component];
+                    }
+
+                    for (Size index = 0; index < observerIndex; ++index)
+                    {
+                        aState[component] -= observerStates[index][component];
+                    }
+                }
+
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+bool Reader::Index::getRotationAt(
+    const std::string& aFrameName,
+    const double anEphemerisTime,
+    Matrix3d& aRotation,
+    Vector3d& anAngularVelocity,
+    const Size aDepth
+) const
+{
+    const auto frameIt = frames.find(aFrameName);
+
+    if ((frameIt == frames.end()) || (aDepth >= MaximumChainLength))
+    {
+        return false;
+    }
+
+    const FrameDefinition& frameDefinition = frameIt->second;
+
+    switch (frameDefinition.frameClass)
+    {
+        case FrameDefinition::Class::Inertial:
+        {
+            aRotation = Matrix3d::Identity();
+            anAngularVelocity = Vector3d::Zero();
+
+            return true;
+        }
+
+        case FrameDefinition::Class::PCK:
+        {
+            if (const Segment* segmentPtr =
+                    FindSegment(pckSegments, frameDefinition.classIdentifier, anEphemerisTime))
+            {
+                if ((segmentPtr->frame != J2000FrameIdentifier) && (segmentPtr->frame != ECLIPJ2000FrameIdentifier))
+                {
+                    return false;
+                }
+
+                // Binary PCK angles are the 3-1-3 Euler angles themselves [rad]
+
+                double state[6];
+
+                EvaluateSegment(*segmentPtr, anEphemerisTime, state);
+
+                EulerRotation(state, state + 3, aRotation, anAngularVelocity);
+
+                if (segmentPtr->frame == ECLIPJ2000FrameIdentifier)
+                {
+                    aRotation = aRotation * AxisRotation(1, EclipticObliquity);
+                }
+
+                return true;
+            }
+
+            if (!frameDefinition.hasConstants)
+            {
+                return false;
+            }
+
+            // Text PCK: pole right ascension and declination, and prime meridian, as polynomials of time [deg]
+
+            const double days = anEphemerisTime / 86400.0;
+            const double centuries = days / 36525.0;
+
+            const auto evaluatePolynomial =
+                [](const Array<double>& aCoefficientArray, const double aTime, double& aValue, double& aRate) -> void
+            {
+                aValue = 0.0;
+                aRate = 0.0;
+
+                double power = 1.0;
+
+                for (Size index = 0; index < aCoefficientArray.getSize(); ++index)
+                {
+                    if (index > 0)
+                    {
+                        aRate += static_cast<double>(index) * aCoefficientArray[index] * power;
+                        power *= aTime;
+                    }
+
+                    aValue += aCoefficientArray[index] * power;
+                }
+            };
+
+            double rightAscension;
+            double rightAscensionRate;
+            double declination;
+            double declinationRate;
+            double primeMeridian;
+            double primeMeridianRate;
+
+            evaluatePolynomial(frameDefinition.poleRightAscension, centuries, rightAscension, rightAscensionRate);
+            evaluatePolynomial(frameDefinition.poleDeclination, centuries, declination, declinationRate);
+            evaluatePolynomial(frameDefinition.primeMeridian, days, primeMeridian, primeMeridianRate);
+
+            static constexpr double DegreesToRadians = M_PI / 180.0;
+
+            const double angles[3] = {
+                M_PI / 2.0 + rightAscension * DegreesToRadians,
+                M_PI / 2.0 - declination * DegreesToRadians,
+                std::fmod(primeMeridian, 360.0) * DegreesToRadians
+            };
+
+            const double rates[3] = {
+                rightAscensionRate * DegreesToRadians / (36525.0 * 86400.0),
+                -declinationRate * DegreesToRadians / (36525.0 * 86400.0),
+                primeMeridianRate * DegreesToRadians / 86400.0
+            };
+
+            EulerRotation(angles, rates, aRotation, anAngularVelocity);
+
+            return true;
+        }
+
+        case FrameDefinition::Class::TK:
+        {
+            if (!this->getRotationAt(
+                    frameDefinition.relativeFrameName, anEphemerisTime, aRotation, anAngularVelocity, aDepth + 1
+                ))
+            {
+                return false;
+            }
+
+            aRotation = frameDefinition.rotation * aRotation;
+            anAngularVelocity = frameDefinition.rotation * anAngularVelocity;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static const Variable* AccessVariable(const VariableMap& aVariableMap, const std::string& aName)
+{
+    const auto variableIt = aVariableMap.find(aName);
+
+    return (variableIt != aVariableMap.end()) ? &(variableIt->second) : nullptr;
+}
+
+static bool GetInteger(const VariableMap& aVariableMap, const std::string& aName, int& anInteger)
+{
+    const Variable* variablePtr = AccessVariable(aVariableMap, aName);
+
+    if ((variablePtr == nullptr) || variablePtr->numbers.isEmpty())
+    {
+        return false;
+    }
+
+    anInteger = static_cast<int>(std::lround(variablePtr->numbers.accessFirst()));
+
+    return true;
+}
+
+static bool GetString(const VariableMap& aVariableMap, const std::string& aName, std::string& aString)
+{
+    const Variable* variablePtr = AccessVariable(aVariableMap, aName);
+
+    if ((variablePtr == nullptr) || variablePtr->strings.isEmpty())
+    {
+        return false;
+    }
+
+    aString = variablePtr->strings.accessFirst();
+
+    return true;
+}
+
+/// @brief                      Define a PCK frame, with the text PCK constants of its body when available
+
+static FrameDefinition PCKFrameDefinition(const VariableMap& aVariableMap, const int aClassIdentifier)
+{
+    FrameDefinition frameDefinition;
+
+    frameDefinition.frameClass = FrameDefinition::Class::PCK;
+    frameDefinition.classIdentifier = aClassIdentifier;
+    frameDefinition.hasConstants = false;
+
+    const std::string prefix = "BODY" + std::to_string(aClassIdentifier) + "_";
+
+    const Variable* rightAscensionPtr = AccessVariable(aVariableMap, prefix + "POLE_RA");
+    const Variable* declinationPtr = AccessVariable(aVariableMap, prefix + "POLE_DEC");
+    const Variable* primeMeridianPtr = AccessVariable(aVariableMap, prefix + "PM");
+
+    // Nutation and precession terms, non-J2000 reference frames and non-J2000 epochs are left to CSPICE
+
+    int referenceFrame = J2000FrameIdentifier;
+
+    GetInteger(aVariableMap, prefix + "CONSTANTS_REF_FRAME", referenceFrame);
+
+    const bool isSupported = (referenceFrame == J2000FrameIdentifier) &&
+                             (AccessVariable(aVariableMap, prefix + "CONSTANTS_JED_EPOCH") == nullptr) &&
+                             (AccessVariable(aVariableMap, prefix + "NUT_PREC_RA") == nullptr) &&
+                             (AccessVariable(aVariableMap, prefix + "NUT_PREC_DEC") == nullptr) &&
+                             (AccessVariable(aVariableMap, prefix + "NUT_PREC_PM") == nullptr);
+
+    if (isSupported && (rightAscensionPtr != nullptr) && (declinationPtr != nullptr) && (primeMeridianPtr != nullptr) &&
+        !rightAscensionPtr->numbers.isEmpty() && !declinationPtr->numbers.isEmpty() &&
+        !primeMeridianPtr->numbers.isEmpty())
+    {
+        frameDefinition.hasConstants = true;
+        frameDefinition.poleRightAscension = rightAscensionPtr->numbers;
+        frameDefinition.poleDeclination = declinationPtr->numbers;
+        frameDefinition.primeMeridian = primeMeridianPtr->numbers;
+    }
+
+    return frameDefinition;
+}
+
+/// @brief                      Define a TK frame from its TKFRAME_<id>_* variables
+///
+/// @return                     False if the frame specification is not supported
+
+static bool TKFrameDefinition(
+    const VariableMap& aVariableMap, const int aFrameIdentifier, FrameDefinition& aFrameDefinition
+)
+{
+    const std::string prefix = "TKFRAME_" + std::to_string(aFrameIdentifier) + "_";
+
+    std::string relativeFrameName;
+    std::string specification;
+
+    if (!GetString(aVariableMap, prefix + "RELATIVE", relativeFrameName) ||
+        !GetString(aVariableMap, prefix + "SPEC", specification))
+    {
+        return false;
+    }
+
+    aFrameDefinition.frameClass = FrameDefinition::Class::TK;
+    aFrameDefinition.relativeFrameName = ToUpper(relativeFrameName);
+
+    specification = ToUpper(specification);
+
+    if (specification == "MATRIX")
+    {
+        // Column-major matrix, transforming vectors from the TK frame to the relative frame
+
+        const Variable* matrixPtr = AccessVariable(aVariableMap, prefix + "MATRIX");
+
+        if ((matrixPtr == nullptr) || (matrixPtr->numbers.getSize() != 9))
+        {
+            return false;
+        }
+
+        Matrix3d matrix;
+
+        for (Size index = 0; index < 9; ++index)
+        {
+            matrix(index % 3, index / 3) = matrixPtr->numbers[index];
+        }
+
+        aFrameDefinition.rotation = matrix.transpose();
+
+        return true;
+    }
+    else if (specification == "ANGLES")
+    {
+        // Rotation from the relative frame to the TK frame: [angle_3]_axis_3 [angle_2]_axis_2 [angle_1]_axis_1
+
+        const Variable* anglesPtr = AccessVariable(aVariableMap, prefix + "ANGLES");
+        const Variable* axesPtr = AccessVariable(aVariableMap, prefix + "AXES");
+
+        if ((anglesPtr == nullptr) || (axesPtr == nullptr) || (anglesPtr->numbers.getSize() != 3) ||
+            (axesPtr->numbers.getSize() != 3))
+        {
+            return false;
+        }
+
+        std::string units = "RADIANS";
+
+        GetString(aVariableMap, prefix + "UNITS", units);
+
+        units = ToUpper(units);
+
+        double unitInRadians;
+
+        if (units == "RADIANS")
+        {
+            unitInRadians = 1.0;
+        }
+        else if (units == "DEGREES")
+        {
+            unitInRadians = M_PI / 180.0;
+        }
+        else if (units == "ARCMINUTES")
+        {
+            unitInRadians = M_PI / 180.0 / 60.0;
+        }
+        else if (units == "ARCSECONDS")
+        {
+            unitInRadians = M_PI / 180.0 / 3600.0;
+        }
+        else
+        {
+            return false;
+        }
+
+        aFrameDefinition.rotation = Matrix3d::Identity();
+
+        for (Size index = 0; index < 3; ++index)
+        {
+            const int axis = static_cast<int>(std::lround(axesPtr->numbers[index]));
+
+            if ((axis < 1) || (axis > 3))
+            {
+                return false;
+            }
+
+            aFrameDefinition.rotation =
+                AxisRotation(axis, anglesPtr->numbers[index] * unitInRadians) * aFrameDefinition.rotation;
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+Reader::Reader()
+    : sources_(Array<Shared<const Source>>::Empty()),
+      indexSPtr_(nullptr)
+{
+    this->updateIndex();
+}
+
+bool Reader::isEmpty() const
+{
+    return sources_.isEmpty();
+}
+
+bool Reader::isKernelLoaded(const Kernel& aKernel) const
+{
+    if (!aKernel.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Kernel");
+    }
+
+    for (const auto& sourceSPtr : sources_)
+    {
+        if (sourceSPtr->kernel.getName() == aKernel.getName())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void Reader::loadKernel(const Kernel& aKernel)
+{
+    if (!aKernel.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Kernel");
+    }
+
+    if (this->isKernelLoaded(aKernel))
+    {
+        return;
+    }
+
+    const Kernel::Type type = aKernel.getType();
+
+    if ((type != Kernel::Type::SPK) && (type != Kernel::Type::BPCK) && (type != Kernel::Type::PCK) &&
+        (type != Kernel::Type::FK))
+    {
+        return;
+    }
+
+    const Shared<Source> sourceSPtr = std::make_shared<Source>();
+
+    sourceSPtr->kernel = aKernel;
+    sourceSPtr->fileSPtr = std::make_shared<const MappedFile>(aKernel.getFile().getPath().toString());
+    sourceSPtr->spkSegments = Array<Segment>::Empty();
+    sourceSPtr->pckSegments = Array<Segment>::Empty();
+    sourceSPtr->assignments = Array<Assignment>::Empty();
+
+    if ((type == Kernel::Type::SPK) || (type == Kernel::Type::BPCK))
+    {
+        if (!ReadSegments(*sourceSPtr->fileSPtr, sourceSPtr->spkSegments, sourceSPtr->pckSegments))
+        {
+            return;
+        }
+    }
+    else
+    {
+        sourceSPtr->assignments =
+            ParseTextKernel({sourceSPtr->fileSPtr->data(), sourceSPtr->fileSPtr->size()});
+
+        sourceSPtr->fileSPtr = nullptr;
+    }
+
+    sources_.add(sourceSPtr);
+
+    this->updateIndex();
+}
+
+void Reader::unloadKernel(const Kernel& aKernel)
+{
+    if (!aKernel.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Kernel");
+    }
+
+    Array<Shared<const Source>> sources = Array<Shared<const Source>>::Empty();
+
+    for (const auto& sourceSPtr : sources_)
+    {
+        if (sourceSPtr->kernel.getName() != aKernel.getName())
+        {
+            sources.add(sourceSPtr);
+        }
+    }
+
+    if (sources.getSize() != sources_.getSize())
+    {
+        sources_ = sources;
+
+        this->updateIndex();
+    }
+}
+
+Transform Reader::getTransformAt(const Integer& aBodyIdentifier, const String& aFrameName, const Instant& anInstant)
+    const
+{
+    const Transform translation = this->getTranslationAt(aBodyIdentifier, anInstant);
+
+    if (!translation.isDefined())
+    {
+        return Transform::Undefined();
+    }
+
+    const Transform rotation = this->getRotationAt(aFrameName, anInstant);
+
+    if (!rotation.isDefined())
+    {
+        return Transform::Undefined();
+    }
+
+    return {
+        anInstant,
+        translation.accessTranslation(),
+        translation.accessVelocity(),
+        rotation.accessOrientation(),
+        rotation.accessAngularVelocity(),
+        Transform::Type::Passive
+    };
+}
+
+Transform Reader::getTranslationAt(const Integer& aBodyIdentifier, const Instant& anInstant) const
+{
+    if (!aBodyIdentifier.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Body identifier");
+    }
+
+    double state[6];
+
+    if (!indexSPtr_->getStateAt(
+            static_cast<int>(aBodyIdentifier), EarthIdentifier, EphemerisTimeFromInstant(anInstant), state
+        ))
+    {
+        return Transform::Undefined();
+    }
+
+    const Vector3d x_BODY_GCRF = {state[0] * 1e3, state[1] * 1e3, state[2] * 1e3};
+    const Vector3d v_BODY_GCRF = {state[3] * 1e3, state[4] * 1e3, state[5] * 1e3};
+
+    return {
+        anInstant, -x_BODY_GCRF, -v_BODY_GCRF, Quaternion::Unit(), Vector3d::Zero(), Transform::Type::Passive
+    };
+}
+
+Transform Reader::getRotationAt(const String& aFrameName, const Instant& anInstant) const
+{
+    Matrix3d dcm_BODY_GCRF;
+    Vector3d w_BODY_GCRF_in_BODY;
+
+    if (!indexSPtr_->getRotationAt(
+            aFrameName, EphemerisTimeFromInstant(anInstant), dcm_BODY_GCRF, w_BODY_GCRF_in_BODY, 0
+        ))
+    {
+        return Transform::Undefined();
+    }
+
+    const RotationMatrix dcm_GCRF_BODY = {
+        dcm_BODY_GCRF(0, 0),
+        dcm_BODY_GCRF(1, 0),
+        dcm_BODY_GCRF(2, 0),
+        dcm_BODY_GCRF(0, 1),
+        dcm_BODY_GCRF(1, 1),
+        dcm_BODY_GCRF(2, 1),
+        dcm_BODY_GCRF(0, 2),
+        dcm_BODY_GCRF(1, 2),
+        dcm_BODY_GCRF(2, 2)
+    };
+
+    const Quaternion q_BODY_GCRF = Quaternion::RotationMatrix(dcm_GCRF_BODY).toConjugate().toNormalized().rectify();
+
+    return {
+        anInstant, Vector3d::Zero(), Vector3d::Zero(), q_BODY_GCRF, w_BODY_GCRF_in_BODY, Transform::Type::Passive
+    };
+}
+
+void Reader::updateIndex()
+{
+    static const Array<Pair<std::string, int>> bodyIdentifiers = {
+        {"SUN", 10},
+        {"MERCURY", 199},
+        {"VENUS", 299},
+        {"EARTH", 399},
+        {"MOON", 301},
+        {"MARS", 499},
+        {"JUPITER", 599},
+        {"SATURN", 699},
+        {"URANUS", 799},
+        {"NEPTUNE", 899}
+    };
+
+    const Shared<Index> indexSPtr = std::make_shared<Index>();
+
+    indexSPtr->spkSegments = Array<const Segment*>::Empty();
+    indexSPtr->pckSegments = Array<const Segment*>::Empty();
+
+    // Segments: the last loaded kernel, and the last segment within a kernel, take precedence
+
+    for (auto sourceIt = sources_.rbegin(); sourceIt != sources_.rend(); ++sourceIt)
+    {
+        const Source& source = **sourceIt;
+
+        for (auto segmentIt = source.spkSegments.rbegin(); segmentIt != source.spkSegments.rend(); ++segmentIt)
+        {
+            indexSPtr->spkSegments.add(&(*segmentIt));
+        }
+
+        for (auto segmentIt = source.pckSegments.rbegin(); segmentIt != source.pckSegments.rend(); ++segmentIt)
+        {
+            indexSPtr->pckSegments.add(&(*segmentIt));
+        }
+    }
+
+    // Text kernel pool, in load order
+
+    for (const auto& sourceSPtr : sources_)
+    {
+        for (const Assignment& assignment : sourceSPtr->assignments)
+        {
+            Variable& variable = indexSPtr->variables[assignment.name];
+
+            if (!assignment.isAppend)
+            {
+                variable.numbers = Array<double>::Empty();
+                variable.strings = Array<String>::Empty();
+            }
+
+            variable.numbers.add(assignment.numbers);
+            variable.strings.add(assignment.strings);
+        }
+    }
+
+    // Built-in frames
+
+    FrameDefinition j2000FrameDefinition;
+    j2000FrameDefinition.frameClass = FrameDefinition::Class::Inertial;
+
+    FrameDefinition eclipticFrameDefinition;
+    eclipticFrameDefinition.frameClass = FrameDefinition::Class::TK;
+    eclipticFrameDefinition.relativeFrameName = "J2000";
+    eclipticFrameDefinition.rotation = AxisRotation(1, EclipticObliquity);
+
+    indexSPtr->frames["J2000"] = j2000FrameDefinition;
+    indexSPtr->frames["ECLIPJ2000"] = eclipticFrameDefinition;
+    indexSPtr->frames["ITRF93"] = PCKFrameDefinition(indexSPtr->variables, 3000);
+
+    for (const auto& bodyIdentifier : bodyIdentifiers)
+    {
+        indexSPtr->frames["IAU_" + bodyIdentifier.first] =
+            PCKFrameDefinition(indexSPtr->variables, bodyIdentifier.second);
+    }
+
+    // Frames defined in text kernels (FRAME_<id>_NAME, FRAME_<id>_CLASS, ...)
+
+    for (const auto& variable : indexSPtr->variables)
+    {
+        const std::string& name = variable.first;
+
+        if ((name.size() <= 11) || (name.compare(0, 6, "FRAME_") != 0) ||
+            (name.compare(name.size() - 5, 5, "_NAME") != 0) || variable.second.strings.isEmpty())
+        {
+            continue;
+        }
+
+        const std::string identifierString = name.substr(6, name.size() - 11);
+
+        char* identifierEnd = nullptr;
+        const long identifier = std::strtol(identifierString.c_str(), &identifierEnd, 10);
+
+        if (identifierEnd != (identifierString.c_str() + identifierString.size()))
+        {
+            continue;
+        }
+
+        const std::string frameName = ToUpper(variable.second.strings.accessFirst());
+        const std::string framePrefix = "FRAME_" + identifierString + "_";
+
+        int frameClass;
+        int classIdentifier;
+
+        if (!GetInteger(indexSPtr->variables, framePrefix + "CLASS", frameClass) ||
+            !GetInteger(indexSPtr->variables, framePrefix + "CLASS_ID", classIdentifier))
+        {
+            continue;
+        }
+
+        if (frameClass == 2)
+        {
+            indexSPtr->frames[frameName] = PCKFrameDefinition(indexSPtr->variables, classIdentifier);
+        }
+        else if (frameClass == 4)
+        {
+            FrameDefinition frameDefinition;
+
+            if (TKFrameDefinition(indexSPtr->variables, static_cast<int>(identifier), frameDefinition))
+            {
+                indexSPtr->frames[frameName] = frameDefinition;
+            }
+            else
+            {
+                indexSPtr->frames.erase(frameName);
+            }
+        }
+        else
+        {
+            indexSPtr->frames.erase(frameName);  // CK and dynamic frames are left to CSPICE
+        }
+    }
+
+    indexSPtr_ = indexSPtr;
+}
+
+}  // namespace spice
+}  // namespace ephemeris
+}  // namespace environment
+}  // namespace physics
+}  // namespace ostk
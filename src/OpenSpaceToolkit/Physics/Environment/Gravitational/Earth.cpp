@@ -1,15 +1,22 @@
 /// Apache License 2.0
 
-#include <GeographicLib/Constants.hpp>
-#include <GeographicLib/GravityModel.hpp>
-#include <GeographicLib/Utility.hpp>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
 
 #include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
 #include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth/Manager.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Gravitational/Spherical.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/SphericalHarmonics.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Earth.hpp>
 
 namespace ostk
@@ -21,7 +28,9 @@ namespace environment
 namespace gravitational
 {
 
-using GeographicLib::GravityModel;
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+using ostk::core::type::Shared;
 
 using ostk::physics::unit::Derived;
 using ostk::physics::unit::Length;
@@ -88,6 +97,47 @@ const Model::Parameters Earth::Spherical = {
     0.0,
 };
 
+namespace
+{
+
+// Process-wide registry of loaded gravity models: coefficient files are read once per (model, data path, degree,
+// order), and loaded models are shared by all instances and copies. Entries expire when no longer referenced.
+
+Shared<const SphericalHarmonics> AccessGravityModel(
+    const std::string& aName, const std::string& aDataPath, const int aDegree, const int anOrder
+)
+{
+    using Key = std::tuple<std::string, std::string, int, int>;
+
+    static std::mutex mutex;
+    static std::map<Key, std::weak_ptr<const SphericalHarmonics>> gravityModels;
+
+    const std::lock_guard<std::mutex> lock {mutex};
+
+    std::weak_ptr<const SphericalHarmonics>& gravityModelWPtr =
+        gravityModels[Key {aName, aDataPath, aDegree, anOrder}];
+
+    if (Shared<const SphericalHarmonics> gravityModelSPtr = gravityModelWPtr.lock())
+    {
+        return gravityModelSPtr;
+    }
+
+    const Shared<const SphericalHarmonics> gravityModelSPtr = std::make_shared<const SphericalHarmonics>(
+        SphericalHarmonics::Load(File::Path(Path::Parse(aDataPath + "/" + aName + ".egm")), aDegree, anOrder)
+    );
+
+    gravityModelWPtr = gravityModelSPtr;
+
+    return gravityModelSPtr;
+}
+
+// Altitude bands of the truncation tables: radii R 2^(k / n), with n bands per doubling of the radius
+
+constexpr std::size_t TruncationBandsPerOctave = 8;
+constexpr std::size_t TruncationBandCount = 8 * TruncationBandsPerOctave;  // 8 octaves, up to 256 R
+
+}  // namespace
+
 class Earth::Impl
 {
    public:
@@ -103,8 +153,20 @@ class Earth::Impl
 
     virtual Integer getOrder() const = 0;
 
+    virtual Real getTruncationTolerance() const = 0;
+
     virtual Vector3d getFieldValueAt(const Vector3d& aPosition, const Instant& anInstant) const = 0;
 
+    virtual Vector3d getFieldValueAt(
+        const Vector3d& aPosition, const Instant& anInstant, const Integer& aDegree, const Integer& anOrder
+    ) const = 0;
+
+    virtual Array<Vector3d> getFieldValuesAt(const Array<Vector3d>& aPositionArray, const Instant& anInstant) const = 0;
+
+    virtual Pair<Vector3d, Matrix3d> getFieldValueAndGradientAt(
+        const Vector3d& aPosition, const Instant& anInstant
+    ) const = 0;
+
    private:
     Earth::Type type_;
 };
@@ -136,16 +198,37 @@ class Earth::SphericalImpl : public Earth::Impl
 
     virtual Integer getOrder() const override;
 
+    virtual Real getTruncationTolerance() const override;
+
     virtual Vector3d getFieldValueAt(const Vector3d& aPosition, const Instant& anInstant) const override;
 
+    virtual Vector3d getFieldValueAt(
+        const Vector3d& aPosition, const Instant& anInstant, const Integer& aDegree, const Integer& anOrder
+    ) const override;
+
+    virtual Array<Vector3d> getFieldValuesAt(const Array<Vector3d>& aPositionArray, const Instant& anInstant)
+        const override;
+
+    virtual Pair<Vector3d, Matrix3d> getFieldValueAndGradientAt(const Vector3d& aPosition, const Instant& anInstant)
+        const override;
+
    private:
     SphericalGravitationalModel sphericalModel_;
+    SphericalHarmonics pointMassModel_;
 };
 
 Earth::SphericalImpl::SphericalImpl(const Earth::Type& aType)
 
     : Earth::Impl(aType),
-      sphericalModel_(Earth::Spherical)
+      sphericalModel_(Earth::Spherical),
+      pointMassModel_(
+          Earth::Spherical.gravitationalParameter_.in(GravitationalParameterSIUnit),
+          Earth::Spherical.equatorialRadius_.inMeters(),
+          0,
+          0,
+          {1.0},
+          {}
+      )
 
 {
 }
@@ -167,11 +250,44 @@ Integer Earth::SphericalImpl::getOrder() const
     return Integer::Undefined();
 }
 
+Real Earth::SphericalImpl::getTruncationTolerance() const
+{
+    return Real::Undefined();
+}
+
 Vector3d Earth::SphericalImpl::getFieldValueAt(const Vector3d& aPosition, const Instant& anInstant) const
 {
     return sphericalModel_.getFieldValueAt(aPosition, anInstant);
 }
 
+Vector3d Earth::SphericalImpl::getFieldValueAt(
+    const Vector3d& aPosition, const Instant& anInstant, const Integer& aDegree, const Integer& anOrder
+) const
+{
+    (void)aDegree;  // Point mass only
+    (void)anOrder;
+
+    return sphericalModel_.getFieldValueAt(aPosition, anInstant);
+}
+
+Array<Vector3d> Earth::SphericalImpl::getFieldValuesAt(
+    const Array<Vector3d>& aPositionArray, const Instant& anInstant
+) const
+{
+    (void)anInstant;  // Temporal invariance
+
+    return pointMassModel_.getFieldValuesAt(aPositionArray);
+}
+
+Pair<Vector3d, Matrix3d> Earth::SphericalImpl::getFieldValueAndGradientAt(
+    const Vector3d& aPosition, const Instant& anInstant
+) const
+{
+    (void)anInstant;  // Temporal invariance
+
+    return pointMassModel_.getFieldValueAndGradientAt(aPosition);
+}
+
 class Earth::ExternalImpl : public Earth::Impl
 {
    public:
@@ -179,7 +295,8 @@ class Earth::ExternalImpl : public Earth::Impl
         const Earth::Type& aType,
         const Directory& aDataDirectory,
         const Integer& aGravityModelDegree,
-        const Integer& aGravityModelOrder
+        const Integer& aGravityModelOrder,
+        const Real& aTruncationTolerance
     );
 
     ExternalImpl(const ExternalImpl& anExternalImpl);
@@ -194,15 +311,36 @@ class Earth::ExternalImpl : public Earth::Impl
 
     virtual Directory getDataDirectory() const;
 
+    virtual Real getTruncationTolerance() const override;
+
     virtual Vector3d getFieldValueAt(const Vector3d& aPosition, const Instant& anInstant) const override;
 
+    virtual Vector3d getFieldValueAt(
+        const Vector3d& aPosition, const Instant& anInstant, const Integer& aDegree, const Integer& anOrder
+    ) const override;
+
+    virtual Array<Vector3d> getFieldValuesAt(const Array<Vector3d>& aPositionArray, const Instant& anInstant)
+        const override;
+
+    virtual Pair<Vector3d, Matrix3d> getFieldValueAndGradientAt(const Vector3d& aPosition, const Instant& anInstant)
+        const override;
+
    private:
     Integer gravityModelDegree_;
     Integer gravityModelOrder_;
     Directory dataDirectory_;
-    Unique<GravityModel> gravityModelUPtr_;
+    Shared<const SphericalHarmonics> gravityModelSPtr_;
+
+    Real truncationTolerance_;
+    std::vector<Integer> truncationDegrees_;  // Per altitude band, empty if evaluations are not truncated
+
+    Integer getTruncationDegreeAt(const Vector3d& aPosition) const;
+
+    static std::vector<Integer> TruncationDegreesFrom(
+        const SphericalHarmonics& aGravityModel, const Real& aTruncationTolerance
+    );
 
-    static Unique<GravityModel> GravityModelFromType(
+    static Shared<const SphericalHarmonics> GravityModelFromType(
         const Earth::Type& aType,
         const Directory& aDataDirectory,
         const Integer& aGravityModelDegree,
@@ -214,16 +352,19 @@ Earth::ExternalImpl::ExternalImpl(
     const Earth::Type& aType,
     const Directory& aDataDirectory,
     const Integer& aGravityModelDegree,
-    const Integer& aGravityModelOrder
+    const Integer& aGravityModelOrder,
+    const Real& aTruncationTolerance
 )
 
     : Earth::Impl(aType),
       gravityModelDegree_(aGravityModelDegree),
       gravityModelOrder_(aGravityModelOrder),
       dataDirectory_(aDataDirectory),
-      gravityModelUPtr_(
+      gravityModelSPtr_(
           Earth::ExternalImpl::GravityModelFromType(aType, aDataDirectory, aGravityModelDegree, aGravityModelOrder)
-      )
+      ),
+      truncationTolerance_(aTruncationTolerance),
+      truncationDegrees_(Earth::ExternalImpl::TruncationDegreesFrom(*gravityModelSPtr_, aTruncationTolerance))
 
 {
 }
@@ -233,12 +374,9 @@ Earth::ExternalImpl::ExternalImpl(const Earth::ExternalImpl& anExternalImpl)
       gravityModelDegree_(anExternalImpl.getDegree()),
       gravityModelOrder_(anExternalImpl.getOrder()),
       dataDirectory_(anExternalImpl.getDataDirectory()),
-      gravityModelUPtr_(Earth::ExternalImpl::GravityModelFromType(
-          anExternalImpl.getType(),
-          anExternalImpl.getDataDirectory(),
-          anExternalImpl.getDegree(),
-          anExternalImpl.getOrder()
-      ))
+      gravityModelSPtr_(anExternalImpl.gravityModelSPtr_),  // Loaded model is immutable, and shared between copies
+      truncationTolerance_(anExternalImpl.truncationTolerance_),
+      truncationDegrees_(anExternalImpl.truncationDegrees_)
 {
 }
 
@@ -264,20 +402,119 @@ Directory Earth::ExternalImpl::getDataDirectory() const
     return dataDirectory_;
 }
 
+Real Earth::ExternalImpl::getTruncationTolerance() const
+{
+    return truncationTolerance_;
+}
+
 Vector3d Earth::ExternalImpl::getFieldValueAt(const Vector3d& aPosition, const Instant& anInstant) const
 {
     (void)anInstant;  // Temporal invariance
 
-    double g_x;
-    double g_y;
-    double g_z;
+    return gravityModelSPtr_->getFieldValueAt(aPosition, this->getTruncationDegreeAt(aPosition));
+}
 
-    gravityModelUPtr_->V(aPosition.x(), aPosition.y(), aPosition.z(), g_x, g_y, g_z);
+Vector3d Earth::ExternalImpl::getFieldValueAt(
+    const Vector3d& aPosition, const Instant& anInstant, const Integer& aDegree, const Integer& anOrder
+) const
+{
+    (void)anInstant;  // Temporal invariance
 
-    return {g_x, g_y, g_z};
+    return gravityModelSPtr_->getFieldValueAt(aPosition, aDegree, anOrder);
 }
 
-Unique<GravityModel> Earth::ExternalImpl::GravityModelFromType(
+Array<Vector3d> Earth::ExternalImpl::getFieldValuesAt(
+    const Array<Vector3d>& aPositionArray, const Instant& anInstant
+) const
+{
+    (void)anInstant;  // Temporal invariance
+
+    if (truncationDegrees_.empty())
+    {
+        return gravityModelSPtr_->getFieldValuesAt(aPositionArray);
+    }
+
+    // Positions are evaluated together: truncate to the highest degree they need
+
+    Integer degree = 0;
+
+    for (const auto& position : aPositionArray)
+    {
+        const Integer positionDegree = this->getTruncationDegreeAt(position);
+
+        if (positionDegree > degree)
+        {
+            degree = positionDegree;
+        }
+    }
+
+    return gravityModelSPtr_->getFieldValuesAt(aPositionArray, degree);
+}
+
+Pair<Vector3d, Matrix3d> Earth::ExternalImpl::getFieldValueAndGradientAt(
+    const Vector3d& aPosition, const Instant& anInstant
+) const
+{
+    (void)anInstant;  // Temporal invariance
+
+    return gravityModelSPtr_->getFieldValueAndGradientAt(aPosition, this->getTruncationDegreeAt(aPosition));
+}
+
+Integer Earth::ExternalImpl::getTruncationDegreeAt(const Vector3d& aPosition) const
+{
+    if (truncationDegrees_.empty())
+    {
+        return Integer::Undefined();
+    }
+
+    // Band of the position radius, positions below the reference radius falling in the first band
+
+    const double radiusRatio = aPosition.norm() / static_cast<double>(gravityModelSPtr_->getReferenceRadius());
+
+    const double bandIndex = (radiusRatio > 1.0)
+                               ? std::floor(static_cast<double>(TruncationBandsPerOctave) * std::log2(radiusRatio))
+                               : 0.0;
+
+    return truncationDegrees_[static_cast<std::size_t>(
+        std::min(bandIndex, static_cast<double>(truncationDegrees_.size() - 1))
+    )];
+}
+
+std::vector<Integer> Earth::ExternalImpl::TruncationDegreesFrom(
+    const SphericalHarmonics& aGravityModel, const Real& aTruncationTolerance
+)
+{
+    if (!aTruncationTolerance.isDefined())
+    {
+        return {};
+    }
+
+    if (aTruncationTolerance < 0.0)
+    {
+        throw ostk::core::error::RuntimeError(
+            "Truncation tolerance [{}] is negative.", aTruncationTolerance.toString()
+        );
+    }
+
+    // Degree at the lower radius of each band, the truncation error decreasing with radius
+
+    const double referenceRadius = static_cast<double>(aGravityModel.getReferenceRadius());
+
+    std::vector<Integer> truncationDegrees;
+    truncationDegrees.reserve(TruncationBandCount);
+
+    for (std::size_t bandIndex = 0; bandIndex < TruncationBandCount; ++bandIndex)
+    {
+        const double radius =
+            referenceRadius * std::exp2(static_cast<double>(bandIndex) / static_cast<double>(TruncationBandsPerOctave));
+
+        truncationDegrees.push_back(aGravityModel.getTruncationDegreeAt(radius, aTruncationTolerance));
+    }
+
+    return truncationDegrees;
+}
+
+Shared<const SphericalHarmonics> Earth::ExternalImpl::GravityModelFromType(
     const Earth::Type& aType,
     const Directory& aDataDirectory,
     const Integer& aGravityModelDegree,
@@ -354,9 +591,7 @@ Unique<GravityModel> Earth::ExternalImpl::GravityModelFromType(
                 throw ostk::core::error::runtime::Wrong("Gravity Model Order", gravityModelOrder);
             }
 
-            return std::make_unique<GeographicLib::GravityModel>(
-                "wgs84", dataPath, gravityModelDegree, gravityModelOrder
-            );
+            return AccessGravityModel("wgs84", dataPath, gravityModelDegree, gravityModelOrder);
         }
 
         case Earth::Type::EGM84:
@@ -371,9 +606,7 @@ Unique<GravityModel> Earth::ExternalImpl::GravityModelFromType(
                 throw ostk::core::error::runtime::Wrong("Gravity Model Order", gravityModelOrder);
             }
 
-            return std::make_unique<GeographicLib::GravityModel>(
-                "egm84", dataPath, gravityModelDegree, gravityModelOrder
-            );
+            return AccessGravityModel("egm84", dataPath, gravityModelDegree, gravityModelOrder);
         }
 
         case Earth::Type::WGS84_EGM96:
@@ -389,9 +622,7 @@ Unique<GravityModel> Earth::ExternalImpl::GravityModelFromType(
                 throw ostk::core::error::runtime::Wrong("Gravity Model Order", gravityModelOrder);
             }
 
-            return std::make_unique<GeographicLib::GravityModel>(
-                "egm96", dataPath, gravityModelDegree, gravityModelOrder
-            );
+            return AccessGravityModel("egm96", dataPath, gravityModelDegree, gravityModelOrder);
         }
 
         case Earth::Type::EGM2008:
@@ -406,9 +637,7 @@ Unique<GravityModel> Earth::ExternalImpl::GravityModelFromType(
                 throw ostk::core::error::runtime::Wrong("Gravity Model Order", gravityModelOrder);
             }
 
-            return std::make_unique<GeographicLib::GravityModel>(
-                "egm2008", dataPath, gravityModelDegree, gravityModelOrder
-            );
+            return AccessGravityModel("egm2008", dataPath, gravityModelDegree, gravityModelOrder);
         }
 
         default:
@@ -422,15 +651,23 @@ Earth::Earth(
     const Earth::Type& aType,
     const Directory& aDataDirectory,
     const Integer& aGravityModelDegree,
-    const Integer& aGravityModelOrder
+    const Integer& aGravityModelOrder,
+    const Real& aTruncationTolerance
 )
     : Model(Earth::ParametersFromType(aType)),
-      implUPtr_(Earth::ImplFromType(aType, aDataDirectory, aGravityModelDegree, aGravityModelOrder))
+      implUPtr_(
+          Earth::ImplFromType(aType, aDataDirectory, aGravityModelDegree, aGravityModelOrder, aTruncationTolerance)
+      )
 {
 }
 
-Earth::Earth(const Earth::Type& aType, const Integer& aGravityModelDegree, const Integer& aGravityModelOrder)
-    : Earth(aType, Directory::Undefined(), aGravityModelDegree, aGravityModelOrder)
+Earth::Earth(
+    const Earth::Type& aType,
+    const Integer& aGravityModelDegree,
+    const Integer& aGravityModelOrder,
+    const Real& aTruncationTolerance
+)
+    : Earth(aType, Directory::Undefined(), aGravityModelDegree, aGravityModelOrder, aTruncationTolerance)
 {
 }
 
@@ -483,16 +720,39 @@ Integer Earth::getOrder() const
     return implUPtr_->getOrder();
 }
 
+Real Earth::getTruncationTolerance() const
+{
+    return implUPtr_->getTruncationTolerance();
+}
+
 Vector3d Earth::getFieldValueAt(const Vector3d& aPosition, const Instant& anInstant) const
 {
     return implUPtr_->getFieldValueAt(aPosition, anInstant);
 }
 
+Vector3d Earth::getFieldValueAt(
+    const Vector3d& aPosition, const Instant& anInstant, const Integer& aDegree, const Integer& anOrder
+) const
+{
+    return implUPtr_->getFieldValueAt(aPosition, anInstant, aDegree, anOrder);
+}
+
+Array<Vector3d> Earth::getFieldValuesAt(const Array<Vector3d>& aPositionArray, const Instant& anInstant) const
+{
+    return implUPtr_->getFieldValuesAt(aPositionArray, anInstant);
+}
+
+Pair<Vector3d, Matrix3d> Earth::getFieldValueAndGradientAt(const Vector3d& aPosition, const Instant& anInstant) const
+{
+    return implUPtr_->getFieldValueAndGradientAt(aPosition, anInstant);
+}
+
 Unique<Earth::Impl> Earth::ImplFromType(
     const Earth::Type& aType,
     const Directory& aDataDirectory,
     const Integer& aGravityModelDegree,
-    const Integer& aGravityModelOrder
+    const Integer& aGravityModelOrder,
+    const Real& aTruncationTolerance
 )
 {
     if (aType == Earth::Type::Undefined)
@@ -504,7 +764,9 @@ Unique<Earth::Impl> Earth::ImplFromType(
         return std::make_unique<Earth::SphericalImpl>(aType);
     }
 
-    return std::make_unique<Earth::ExternalImpl>(aType, aDataDirectory, aGravityModelDegree, aGravityModelOrder);
+    return std::make_unique<Earth::ExternalImpl>(
+        aType, aDataDirectory, aGravityModelDegree, aGravityModelOrder, aTruncationTolerance
+    );
 }
 
 Model::Parameters Earth::ParametersFromType(const Earth::Type& aType)
@@ -0,0 +1,176 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Gridded.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace environment
+{
+namespace gravitational
+{
+
+using ostk::core::container::Array;
+
+using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
+
+const Size Gridded::DefaultMemoryBudget = 256 * 1024 * 1024;
+
+Gridded::Gridded(
+    const Model& aModel,
+    const Length& aMinimumRadius,
+    const Length& aMaximumRadius,
+    const Real& aTolerance,
+    const Size& aMemoryBudget
+)
+    : Gridded(aModel, FieldGrid::Undefined())
+{
+    if (!aMinimumRadius.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Minimum radius");
+    }
+
+    if (!aMaximumRadius.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Maximum radius");
+    }
+
+    // Gravitational models are time invariant: the batch evaluation of gravitational::Earth is used when available
+
+    const Model* modelPtr = modelSPtr_.get();
+    const EarthGravitationalModel* earthModelPtr = dynamic_cast<const EarthGravitationalModel*>(modelPtr);
+
+    const FieldGrid::FieldFunction residualFunction = [this, modelPtr, earthModelPtr](
+                                                          const Array<Vector3d>& aPositionArray
+                                                      ) -> Array<Vector3d>
+    {
+        Array<Vector3d> fieldValues = Array<Vector3d>::Empty();
+
+        if (earthModelPtr != nullptr)
+        {
+            fieldValues = earthModelPtr->getFieldValuesAt(aPositionArray, Instant::J2000());
+        }
+        else
+        {
+            fieldValues.reserve(aPositionArray.getSize());
+
+            for (const auto& position : aPositionArray)
+            {
+                fieldValues.add(modelPtr->getFieldValueAt(position, Instant::J2000()));
+            }
+        }
+
+        for (Size index = 0; index < aPositionArray.getSize(); ++index)
+        {
+            fieldValues[index] -= this->getReferenceFieldValueAt(aPositionArray[index]);
+        }
+
+        return fieldValues;
+    };
+
+    fieldGrid_ = FieldGrid(
+        residualFunction, aMinimumRadius.inMeters(), aMaximumRadius.inMeters(), aTolerance, aMemoryBudget
+    );
+}
+
+Gridded::Gridded(const Model& aModel, const FieldGrid& aFieldGrid)
+    : Model(aModel.getParameters()),
+      modelSPtr_(aModel.clone()),
+      fieldGrid_(aFieldGrid),
+      gravitationalParameter_SI_(Real::Undefined()),
+      equatorialRadius_SI_(Real::Undefined()),
+      J2_(Real::Undefined())
+{
+    const Model::Parameters parameters = aModel.getParameters();
+
+    if (parameters.gravitationalParameter_.isDefined())
+    {
+        gravitationalParameter_SI_ = parameters.gravitationalParameter_.in(GravitationalParameterSIUnit);
+    }
+
+    if (parameters.equatorialRadius_.isDefined())
+    {
+        equatorialRadius_SI_ = parameters.equatorialRadius_.inMeters();
+    }
+
+    J2_ = parameters.J2_;
+}
+
+Gridded* Gridded::clone() const
+{
+    return new Gridded(*this);
+}
+
+bool Gridded::isDefined() const
+{
+    return modelSPtr_->isDefined() && fieldGrid_.isDefined();
+}
+
+const Model& Gridded::accessModel() const
+{
+    return *modelSPtr_;
+}
+
+FieldGrid Gridded::getFieldGrid() const
+{
+    return fieldGrid_;
+}
+
+Real Gridded::getErrorBound() const
+{
+    return fieldGrid_.getErrorBound();
+}
+
+Vector3d Gridded::getFieldValueAt(const Vector3d& aPosition, const Instant& anInstant) const
+{
+    if (!fieldGrid_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Field grid");
+    }
+
+    if (!fieldGrid_.contains(aPosition))
+    {
+        return modelSPtr_->getFieldValueAt(aPosition, anInstant);
+    }
+
+    return this->getReferenceFieldValueAt(aPosition) + fieldGrid_.getValueAt(aPosition);
+}
+
+Vector3d Gridded::getReferenceFieldValueAt(const Vector3d& aPosition) const
+{
+    // Point mass and J2 field, zero for the parameters which are undefined
+
+    if (!gravitationalParameter_SI_.isDefined())
+    {
+        return Vector3d::Zero();
+    }
+
+    const double r = aPosition.norm();
+    const double k = -static_cast<double>(gravitationalParameter_SI_) / (r * r * r);
+
+    if ((!J2_.isDefined()) || (!equatorialRadius_SI_.isDefined()))
+    {
+        return k * aPosition;
+    }
+
+    const double R_r = static_cast<double>(equatorialRadius_SI_) / r;
+    const double z_r = aPosition.z() / r;
+    const double f = 1.5 * static_cast<double>(J2_) * R_r * R_r;
+
+    const double horizontalFactor = 1.0 + f * (1.0 - 5.0 * z_r * z_r);
+    const double verticalFactor = 1.0 + f * (3.0 - 5.0 * z_r * z_r);
+
+    return {
+        k * horizontalFactor * aPosition.x(), k * horizontalFactor * aPosition.y(), k * verticalFactor * aPosition.z()
+    };
+}
+
+}  // namespace gravitational
+}  // namespace environment
+}  // namespace physics
+}  // namespace ostk
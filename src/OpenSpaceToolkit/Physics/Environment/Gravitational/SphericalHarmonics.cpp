@@ -0,0 +1,938 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/SphericalHarmonics.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace environment
+{
+namespace gravitational
+{
+
+namespace
+{
+
+constexpr Size LaneCount = OSTK_PHYSICS_ENVIRONMENT_GRAVITATIONAL_SPHERICAL_HARMONICS_LANE_COUNT;
+
+// Solid harmonics are carried scaled, so that sectoral terms of high order (at high latitude) remain representable
+
+constexpr double ScaleFactor = 1e200;
+
+// Derivatives of a term C V_nm + S W_nm of degree n and order m, with normalized solid harmonics, in units of 1 / R:
+//
+// d/dx = - A_nm (C V + S W)_n+1,m+1 + B_nm (C V + S W)_n+1,m-1
+// d/dy = A_nm (S V - C W)_n+1,m+1 + B_nm (S V - C W)_n+1,m-1
+// d/dz = - Z_nm (C V + S W)_n+1,m
+//
+// W_n0 being zero, only the C coefficient of a term of order 0 contributes to its derivatives.
+
+struct DerivativeFactors
+{
+    double A;
+    double B;
+    double Z;
+};
+
+DerivativeFactors DerivativeFactorsOf(
+    const double* aSquareRootArray, const double* anInverseSquareRootArray, const Size n, const Size m
+)
+{
+    const double* s = aSquareRootArray;
+    const double* is = anInverseSquareRootArray;
+
+    const double factor = s[2 * n + 1] * is[2 * n + 3];
+
+    if (m == 0)
+    {
+        return {factor * s[n + 1] * s[n + 2] * is[2], 0.0, factor * s[n + 1] * s[n + 1]};
+    }
+
+    return {
+        0.5 * factor * s[n + m + 1] * s[n + m + 2],
+        (m == 1) ? (0.5 * factor * s[2] * s[n + 1] * s[n]) : (0.5 * factor * s[n - m + 2] * s[n - m + 1]),
+        factor * s[n + m + 1] * s[n - m + 1],
+    };
+}
+
+// Mean square, over the sphere of radius r, of the field of each degree n: (n + 1) (2n + 1) (GM / r^2)^2 (R / r)^2n
+// sigma_n^2, with sigma_n^2 the degree variance
+
+std::vector<double> MeanSquareFieldValuesOf(
+    const double aGravitationalParameter,
+    const double aReferenceRadius,
+    const double aRadius,
+    const std::vector<double>& aDegreeVarianceArray
+)
+{
+    const double radiusRatio = aReferenceRadius / aRadius;
+    const double fieldFactor = aGravitationalParameter / (aRadius * aRadius);
+
+    std::vector<double> meanSquareFieldValues(aDegreeVarianceArray.size());
+
+    double radiusRatioPower = 1.0;  // (R / r)^n
+
+    for (Size n = 0; n < aDegreeVarianceArray.size(); ++n)
+    {
+        const double fieldValue = fieldFactor * radiusRatioPower;
+
+        meanSquareFieldValues[n] =
+            static_cast<double>((n + 1) * (2 * n + 1)) * fieldValue * fieldValue * aDegreeVarianceArray[n];
+
+        radiusRatioPower *= radiusRatio;
+    }
+
+    return meanSquareFieldValues;
+}
+
+}  // namespace
+
+struct SphericalHarmonics::Coefficients
+{
+    Size degree;
+    Size order;
+
+    std::vector<double> cosineCoefficients;
+    std::vector<double> sineCoefficients;
+
+    std::vector<double> squareRoots;         // sqrt(i)
+    std::vector<double> inverseSquareRoots;  // 1 / sqrt(i)
+
+    std::vector<double> degreeVariances;  // sum_m (C_nm^2 + S_nm^2)
+
+    Size cosineIndex(const Size n, const Size m) const
+    {
+        return m * (degree + 1) - (m * (m - 1)) / 2 + (n - m);
+    }
+
+    Size sineIndex(const Size n, const Size m) const
+    {
+        return this->cosineIndex(n, m) - (degree + 1);
+    }
+};
+
+SphericalHarmonics::SphericalHarmonics(
+    const Real& aGravitationalParameter,
+    const Real& aReferenceRadius,
+    const Integer& aDegree,
+    const Integer& anOrder,
+    const std::vector<double>& aCosineCoefficientArray,
+    const std::vector<double>& aSineCoefficientArray
+)
+    : gravitationalParameter_(aGravitationalParameter),
+      referenceRadius_(aReferenceRadius),
+      degree_(aDegree),
+      order_(anOrder),
+      coefficientsSPtr_(nullptr)
+{
+    if ((!aDegree.isDefined()) || (!anOrder.isDefined()))
+    {
+        return;
+    }
+
+    if ((aDegree < 0) || (anOrder < 0) || (anOrder > aDegree))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Degree [{}] and order [{}] are not valid.", aDegree.toString(), anOrder.toString()
+        );
+    }
+
+    const Size degree = static_cast<Size>(static_cast<Integer::ValueType>(aDegree));
+    const Size order = static_cast<Size>(static_cast<Integer::ValueType>(anOrder));
+
+    const Size cosineCoefficientCount = ((order + 1) * (2 * degree - order + 2)) / 2;
+    const Size sineCoefficientCount = cosineCoefficientCount - (degree + 1);
+
+    if (aCosineCoefficientArray.size() != cosineCoefficientCount)
+    {
+        throw ostk::core::error::RuntimeError(
+            "Cosine coefficient count [{}] is not [{}].", aCosineCoefficientArray.size(), cosineCoefficientCount
+        );
+    }
+
+    if (aSineCoefficientArray.size() != sineCoefficientCount)
+    {
+        throw ostk::core::error::RuntimeError(
+            "Sine coefficient count [{}] is not [{}].", aSineCoefficientArray.size(), sineCoefficientCount
+        );
+    }
+
+    Coefficients coefficients = {degree, order, aCosineCoefficientArray, aSineCoefficientArray, {}, {}, {}};
+
+    // Recursion factors, up to the degree + 2 terms of the gradient
+
+    coefficients.squareRoots.resize(2 * degree + 8);
+    coefficients.inverseSquareRoots.resize(2 * degree + 8);
+
+    for (Size index = 0; index < coefficients.squareRoots.size(); ++index)
+    {
+        coefficients.squareRoots[index] = std::sqrt(static_cast<double>(index));
+        coefficients.inverseSquareRoots[index] = (index > 0) ? (1.0 / coefficients.squareRoots[index]) : 0.0;
+    }
+
+    // Degree variances, for truncation error estimates
+
+    coefficients.degreeVariances.assign(degree + 1, 0.0);
+
+    for (Size m = 0; m <= order; ++m)
+    {
+        for (Size n = m; n <= degree; ++n)
+        {
+            const double cosine = coefficients.cosineCoefficients[coefficients.cosineIndex(n, m)];
+            const double sine = (m > 0) ? coefficients.sineCoefficients[coefficients.sineIndex(n, m)] : 0.0;
+
+            coefficients.degreeVariances[n] += cosine * cosine + sine * sine;
+        }
+    }
+
+    coefficientsSPtr_ = std::make_shared<const Coefficients>(std::move(coefficients));
+}
+
+bool SphericalHarmonics::isDefined() const
+{
+    return gravitationalParameter_.isDefined() && referenceRadius_.isDefined() && (coefficientsSPtr_ != nullptr);
+}
+
+Integer SphericalHarmonics::getDegree() const
+{
+    return degree_;
+}
+
+Integer SphericalHarmonics::getOrder() const
+{
+    return order_;
+}
+
+Real SphericalHarmonics::getGravitationalParameter() const
+{
+    return gravitationalParameter_;
+}
+
+Real SphericalHarmonics::getReferenceRadius() const
+{
+    return referenceRadius_;
+}
+
+Real SphericalHarmonics::getCosineCoefficient(const Integer& aDegree, const Integer& anOrder) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Spherical harmonics");
+    }
+
+    if ((aDegree < 0) || (anOrder < 0) || (anOrder > aDegree) || (aDegree > degree_) || (anOrder > order_))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Degree [{}] and order [{}] are out of bounds.", aDegree.toString(), anOrder.toString()
+        );
+    }
+
+    return coefficientsSPtr_->cosineCoefficients[coefficientsSPtr_->cosineIndex(
+        static_cast<Size>(static_cast<Integer::ValueType>(aDegree)),
+        static_cast<Size>(static_cast<Integer::ValueType>(anOrder))
+    )];
+}
+
+Real SphericalHarmonics::getSineCoefficient(const Integer& aDegree, const Integer& anOrder) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Spherical harmonics");
+    }
+
+    if ((aDegree < 0) || (anOrder < 0) || (anOrder > aDegree) || (aDegree > degree_) || (anOrder > order_))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Degree [{}] and order [{}] are out of bounds.", aDegree.toString(), anOrder.toString()
+        );
+    }
+
+    if (anOrder == 0)
+    {
+        return 0.0;
+    }
+
+    return coefficientsSPtr_->sineCoefficients[coefficientsSPtr_->sineIndex(
+        static_cast<Size>(static_cast<Integer::ValueType>(aDegree)),
+        static_cast<Size>(static_cast<Integer::ValueType>(anOrder))
+    )];
+}
+
+Vector3d SphericalHarmonics::getFieldValueAt(
+    const Vector3d& aPosition, const Integer& aDegree, const Integer& anOrder
+) const
+{
+    Vector3d fieldValue = Vector3d::Zero();
+
+    this->evaluate<1, false>(&aPosition, 1, aDegree, anOrder, &fieldValue, nullptr);
+
+    return fieldValue;
+}
+
+Array<Vector3d> SphericalHarmonics::getFieldValuesAt(
+    const Array<Vector3d>& aPositionArray, const Integer& aDegree, const Integer& anOrder
+) const
+{
+    Array<Vector3d> fieldValues = Array<Vector3d>::Empty();
+    fieldValues.resize(aPositionArray.getSize(), Vector3d::Zero());
+
+    this->evaluate<LaneCount, false>(
+        aPositionArray.data(), aPositionArray.getSize(), aDegree, anOrder, fieldValues.data(), nullptr
+    );
+
+    return fieldValues;
+}
+
+Pair<Vector3d, Matrix3d> SphericalHarmonics::getFieldValueAndGradientAt(
+    const Vector3d& aPosition, const Integer& aDegree, const Integer& anOrder
+) const
+{
+    Vector3d fieldValue = Vector3d::Zero();
+    Matrix3d gradient = Matrix3d::Zero();
+
+    this->evaluate<1, true>(&aPosition, 1, aDegree, anOrder, &fieldValue, &gradient);
+
+    return {fieldValue, gradient};
+}
+
+Pair<Array<Vector3d>, Array<Matrix3d>> SphericalHarmonics::getFieldValuesAndGradientsAt(
+    const Array<Vector3d>& aPositionArray, const Integer& aDegree, const Integer& anOrder
+) const
+{
+    Array<Vector3d> fieldValues = Array<Vector3d>::Empty();
+    fieldValues.resize(aPositionArray.getSize(), Vector3d::Zero());
+
+    Array<Matrix3d> gradients = Array<Matrix3d>::Empty();
+    gradients.resize(aPositionArray.getSize(), Matrix3d::Zero());
+
+    this->evaluate<LaneCount, true>(
+        aPositionArray.data(), aPositionArray.getSize(), aDegree, anOrder, fieldValues.data(), gradients.data()
+    );
+
+    return {fieldValues, gradients};
+}
+
+Real SphericalHarmonics::getTruncationErrorAt(const Real& aRadius, const Integer& aDegree) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Spherical harmonics");
+    }
+
+    if (!aRadius.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Radius");
+    }
+
+    if (!aDegree.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Degree");
+    }
+
+    if (aRadius <= 0.0)
+    {
+        throw ostk::core::error::RuntimeError("Radius [{}] is not positive.", aRadius.toString());
+    }
+
+    if (aDegree < 0)
+    {
+        throw ostk::core::error::RuntimeError("Degree [{}] is negative.", aDegree.toString());
+    }
+
+    const std::vector<double> meanSquareFieldValues = MeanSquareFieldValuesOf(
+        static_cast<double>(gravitationalParameter_),
+        static_cast<double>(referenceRadius_),
+        static_cast<double>(aRadius),
+        coefficientsSPtr_->degreeVariances
+    );
+
+    const Size degree = static_cast<Size>(static_cast<Integer::ValueType>(aDegree));
+
+    double squaredError = 0.0;
+
+    for (Size n = degree + 1; n < meanSquareFieldValues.size(); ++n)
+    {
+        squaredError += meanSquareFieldValues[n];
+    }
+
+    return std::sqrt(squaredError);
+}
+
+Integer SphericalHarmonics::getTruncationDegreeAt(const Real& aRadius, const Real& aTolerance) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Spherical harmonics");
+    }
+
+    if (!aRadius.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Radius");
+    }
+
+    if (!aTolerance.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Tolerance");
+    }
+
+    if (aRadius <= 0.0)
+    {
+        throw ostk::core::error::RuntimeError("Radius [{}] is not positive.", aRadius.toString());
+    }
+
+    if (aTolerance < 0.0)
+    {
+        throw ostk::core::error::RuntimeError("Tolerance [{}] is negative.", aTolerance.toString());
+    }
+
+    const std::vector<double> meanSquareFieldValues = MeanSquareFieldValuesOf(
+        static_cast<double>(gravitationalParameter_),
+        static_cast<double>(referenceRadius_),
+        static_cast<double>(aRadius),
+        coefficientsSPtr_->degreeVariances
+    );
+
+    // Errors accumulated from the highest degree down, until the tolerance is exceeded
+
+    const double squaredTolerance = static_cast<double>(aTolerance) * static_cast<double>(aTolerance);
+
+    double squaredError = 0.0;
+
+    for (Size n = meanSquareFieldValues.size() - 1; n > 0; --n)
+    {
+        squaredError += meanSquareFieldValues[n];
+
+        if (squaredError > squaredTolerance)
+        {
+            return static_cast<Integer::ValueType>(n);
+        }
+    }
+
+    return 0;
+}
+
+SphericalHarmonics SphericalHarmonics::Undefined()
+{
+    return {Real::Undefined(), Real::Undefined(), Integer::Undefined(), Integer::Undefined(), {}, {}};
+}
+
+SphericalHarmonics SphericalHarmonics::Load(const File& aFile, const Integer& aDegree, const Integer& anOrder)
+{
+    using ostk::core::filesystem::Path;
+    using ostk::core::type::String;
+
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
+
+    if (!aFile.exists())
+    {
+        throw ostk::core::error::RuntimeError("File [{}] does not exist.", aFile.toString());
+    }
+
+    // Model file: "EGMF-1" header, then "Key Value" lines
+
+    Real gravitationalParameter = Real::Undefined();
+    Real referenceRadius = Real::Undefined();
+    std::string identifier;
+
+    {
+        std::ifstream fileStream {aFile.getPath().toString()};
+
+        std::string line;
+
+        if ((!std::getline(fileStream, line)) || (line.rfind("EGMF-", 0) != 0))
+        {
+            throw ostk::core::error::RuntimeError("File [{}] is not a gravity model file.", aFile.toString());
+        }
+
+        while (std::getline(fileStream, line))
+        {
+            std::istringstream lineStream {line};
+
+            std::string key;
+            std::string value;
+
+            if ((!(lineStream >> key >> value)) || (key[0] == '#'))
+            {
+                continue;
+            }
+
+            if (key == "ModelMass")
+            {
+                gravitationalParameter = std::stod(value);
+            }
+            else if (key == "ModelRadius")
+            {
+                referenceRadius = std::stod(value);
+            }
+            else if (key == "ID")
+            {
+                identifier = value;
+            }
+        }
+    }
+
+    if ((!gravitationalParameter.isDefined()) || (!referenceRadius.isDefined()) || (identifier.size() != 8))
+    {
+        throw ostk::core::error::RuntimeError("Cannot read gravity model parameters from [{}].", aFile.toString());
+    }
+
+    // Coefficient file: 8 bytes identifier, N and M (int32), then C and S coefficients (little-endian doubles)
+
+    const String coefficientFilePath = aFile.getPath().toString() + ".cof";
+
+    std::ifstream coefficientStream {coefficientFilePath, std::ios::binary};
+
+    if (!coefficientStream.is_open())
+    {
+        throw ostk::core::error::RuntimeError("Cannot open coefficient file [{}].", coefficientFilePath);
+    }
+
+    char identifierBuffer[8];
+    std::int32_t degreeAndOrder[2];
+
+    if ((!coefficientStream.read(identifierBuffer, 8)) ||
+        (std::string(identifierBuffer, 8) != identifier) ||
+        (!coefficientStream.read(reinterpret_cast<char*>(degreeAndOrder), sizeof(degreeAndOrder))))
+    {
+        throw ostk::core::error::RuntimeError("Cannot read coefficient file [{}].", coefficientFilePath);
+    }
+
+    const Size fileDegree = static_cast<Size>(degreeAndOrder[0]);
+    const Size fileOrder = static_cast<Size>(degreeAndOrder[1]);
+
+    const Integer requestedDegree = (aDegree.isDefined() && (aDegree >= 0)) ? aDegree : Integer(-1);
+    const Integer requestedOrder =
+        (anOrder.isDefined() && (anOrder >= 0)) ? anOrder : requestedDegree;  // Order up to degree if not set
+
+    if ((requestedDegree >= 0) && (requestedOrder > requestedDegree))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Requested degree [{}] and order [{}] are not valid.", requestedDegree.toString(), requestedOrder.toString()
+        );
+    }
+
+    const Size degree = (requestedDegree >= 0)
+                          ? std::min(fileDegree, static_cast<Size>(static_cast<Integer::ValueType>(requestedDegree)))
+                          : fileDegree;
+    const Size order = std::min(
+        degree,
+        (requestedOrder >= 0) ? std::min(fileOrder, static_cast<Size>(static_cast<Integer::ValueType>(requestedOrder)))
+                              : fileOrder
+    );
+
+    // Columns of a given order are stored contiguously: skip degrees and orders beyond the requested ones
+
+    const auto readColumns = [&coefficientStream, &coefficientFilePath, fileDegree, fileOrder, degree, order](
+                                 const Size aFirstOrder, std::vector<double>& aCoefficientArray
+                             ) -> void
+    {
+        for (Size m = aFirstOrder; m <= fileOrder; ++m)
+        {
+            const std::streamoff columnSize = static_cast<std::streamoff>((fileDegree + 1 - m) * sizeof(double));
+
+            if (m > order)
+            {
+                coefficientStream.seekg(columnSize, std::ios::cur);
+                continue;
+            }
+
+            const Size offset = aCoefficientArray.size();
+
+            aCoefficientArray.resize(offset + (degree + 1 - m));
+
+            coefficientStream.read(
+                reinterpret_cast<char*>(aCoefficientArray.data() + offset),
+                static_cast<std::streamsize>((degree + 1 - m) * sizeof(double))
+            );
+
+            coefficientStream.seekg(
+                columnSize - static_cast<std::streamoff>((degree + 1 - m) * sizeof(double)), std::ios::cur
+            );
+        }
+
+        if (!coefficientStream)
+        {
+            throw ostk::core::error::RuntimeError("Cannot read coefficients from [{}].", coefficientFilePath);
+        }
+    };
+
+    std::vector<double> cosineCoefficients;
+    std::vector<double> sineCoefficients;
+
+    readColumns(0, cosineCoefficients);
+    readColumns(1, sineCoefficients);
+
+    return {
+        gravitationalParameter,
+        referenceRadius,
+        Integer(static_cast<Integer::ValueType>(degree)),
+        Integer(static_cast<Integer::ValueType>(order)),
+        cosineCoefficients,
+        sineCoefficients
+    };
+}
+
+template <Size laneCount, bool hasGradient>
+void SphericalHarmonics::evaluate(
+    const Vector3d* aPositionPtr,
+    const Size aPositionCount,
+    const Integer& aDegree,
+    const Integer& anOrder,
+    Vector3d* aFieldValuePtr,
+    Matrix3d* aGradientPtr
+) const
+{
+    // Field: derivatives of the solid harmonics up to degree + 1 and order + 1
+    // Gradient: up to degree + 2 and order + 2
+
+    constexpr Size derivativeOrder = hasGradient ? 2 : 1;
+    constexpr Size columnCount = 2 * derivativeOrder + 1;
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Spherical harmonics");
+    }
+
+    // Truncation: degree up to the maximum degree, order up to the maximum order and the truncation degree
+
+    const bool isDegreeValid = (!aDegree.isDefined()) || ((aDegree >= 0) && (aDegree <= degree_));
+    const bool isOrderValid = (!anOrder.isDefined()) || ((anOrder >= 0) && (anOrder <= order_) &&
+                                                         ((!aDegree.isDefined()) || (anOrder <= aDegree)));
+
+    if ((!isDegreeValid) || (!isOrderValid))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Truncation degree [{}] and order [{}] are not valid.", aDegree.toString(), anOrder.toString()
+        );
+    }
+
+    const Coefficients& coefficients = *coefficientsSPtr_;
+
+    const double* s = coefficients.squareRoots.data();
+    const double* is = coefficients.inverseSquareRoots.data();
+
+    const Size degree =
+        aDegree.isDefined() ? static_cast<Size>(static_cast<Integer::ValueType>(aDegree)) : coefficients.degree;
+    const Size order = std::min(
+        degree, anOrder.isDefined() ? static_cast<Size>(static_cast<Integer::ValueType>(anOrder)) : coefficients.order
+    );
+
+    const Size maxDegree = degree + derivativeOrder;
+    const Size maxOrder = order + derivativeOrder;
+
+    const double radius = static_cast<double>(referenceRadius_);
+    const double gravitationalParameter = static_cast<double>(gravitationalParameter_);
+
+    // Columns of V_nm, W_nm (orders m - derivative order to m + derivative order), for all lanes:
+    // [column][V, W][degree][lane]
+
+    thread_local std::vector<double> columns;
+
+    columns.resize(columnCount * 2 * (maxDegree + 1) * laneCount);
+
+    double* columnPtr = columns.data();
+
+    const auto V = [columnPtr, maxDegree](const Size aColumn, const Size aRow) -> double*
+    {
+        return columnPtr + (((aColumn % columnCount) * 2 + 0) * (maxDegree + 1) + aRow) * laneCount;
+    };
+
+    const auto W = [columnPtr, maxDegree](const Size aColumn, const Size aRow) -> double*
+    {
+        return columnPtr + (((aColumn % columnCount) * 2 + 1) * (maxDegree + 1) + aRow) * laneCount;
+    };
+
+    for (Size blockIndex = 0; blockIndex < aPositionCount; blockIndex += laneCount)
+    {
+        const Size positionCount = std::min(laneCount, aPositionCount - blockIndex);
+
+        alignas(64) double xs[laneCount];    // x R / r^2
+        alignas(64) double ys[laneCount];    // y R / r^2
+        alignas(64) double zs[laneCount];    // z R / r^2
+        alignas(64) double rhos[laneCount];  // R^2 / r^2
+
+        alignas(64) double sectoralV[laneCount];
+        alignas(64) double sectoralW[laneCount];
+
+        alignas(64) double fieldValues[3][laneCount] = {};  // x, y, z
+        alignas(64) double gradients[6][laneCount] = {};    // xx, xy, xz, yy, yz, zz
+
+        for (Size lane = 0; lane < laneCount; ++lane)
+        {
+            // Unused lanes repeat the last position of the block
+
+            const Vector3d& position = aPositionPtr[blockIndex + std::min(lane, positionCount - 1)];
+
+            const double squaredRadius = position.squaredNorm();
+
+            xs[lane] = position.x() * radius / squaredRadius;
+            ys[lane] = position.y() * radius / squaredRadius;
+            zs[lane] = position.z() * radius / squaredRadius;
+            rhos[lane] = radius * radius / squaredRadius;
+
+            sectoralV[lane] = ScaleFactor * radius / std::sqrt(squaredRadius);  // V_00 = R / r
+            sectoralW[lane] = 0.0;
+        }
+
+        for (Size k = 0; k <= maxOrder; ++k)
+        {
+            // Sectoral terms V_kk, W_kk
+
+            if (k > 0)
+            {
+                const double factor = (k == 1) ? s[3] : (s[2 * k + 1] * is[2 * k]);
+
+                for (Size lane = 0; lane < laneCount; ++lane)
+                {
+                    const double v = factor * (xs[lane] * sectoralV[lane] - ys[lane] * sectoralW[lane]);
+                    const double w = factor * (xs[lane] * sectoralW[lane] + ys[lane] * sectoralV[lane]);
+
+                    sectoralV[lane] = v;
+                    sectoralW[lane] = w;
+                }
+            }
+
+            double* columnV = V(k, 0);
+            double* columnW = W(k, 0);
+
+            std::copy(sectoralV, sectoralV + laneCount, columnV + k * laneCount);
+            std::copy(sectoralW, sectoralW + laneCount, columnW + k * laneCount);
+
+            // Column recursion V_nk, W_nk from V_n-1,k and V_n-2,k
+
+            if (k < maxDegree)
+            {
+                const double alpha = s[2 * k + 3];
+
+                const double* previousV = columnV + k * laneCount;
+                const double* previousW = columnW + k * laneCount;
+
+                double* currentV = columnV + (k + 1) * laneCount;
+                double* currentW = columnW + (k + 1) * laneCount;
+
+                for (Size lane = 0; lane < laneCount; ++lane)
+                {
+                    currentV[lane] = alpha * zs[lane] * previousV[lane];
+                    currentW[lane] = alpha * zs[lane] * previousW[lane];
+                }
+            }
+
+            for (Size n = k + 2; n <= maxDegree; ++n)
+            {
+                const double alpha = s[2 * n - 1] * s[2 * n + 1] * is[n - k] * is[n + k];
+                const double beta =
+                    s[2 * n + 1] * s[n + k - 1] * s[n - k - 1] * is[2 * n - 3] * is[n + k] * is[n - k];
+
+                const double* previousV = columnV + (n - 1) * laneCount;
+                const double* previousW = columnW + (n - 1) * laneCount;
+                const double* secondPreviousV = columnV + (n - 2) * laneCount;
+                const double* secondPreviousW = columnW + (n - 2) * laneCount;
+
+                double* currentV = columnV + n * laneCount;
+                double* currentW = columnW + n * laneCount;
+
+                for (Size lane = 0; lane < laneCount; ++lane)
+                {
+                    currentV[lane] = alpha * zs[lane] * previousV[lane] - beta * rhos[lane] * secondPreviousV[lane];
+                    currentW[lane] = alpha * zs[lane] * previousW[lane] - beta * rhos[lane] * secondPreviousW[lane];
+                }
+            }
+
+            // Coefficients of order m = k - derivative order: all the columns they need are available
+
+            if (k < derivativeOrder)
+            {
+                continue;
+            }
+
+            const Size m = k - derivativeOrder;
+
+            for (Size n = m; n <= degree; ++n)
+            {
+                const double cosine = coefficients.cosineCoefficients[coefficients.cosineIndex(n, m)];
+                const double sine = (m > 0) ? coefficients.sineCoefficients[coefficients.sineIndex(n, m)] : 0.0;
+
+                if ((cosine == 0.0) && (sine == 0.0))
+                {
+                    continue;
+                }
+
+                // Field: first derivatives, of degree n + 1 and orders m - 1 to m + 1
+
+                const DerivativeFactors factors = DerivativeFactorsOf(s, is, n, m);
+
+                {
+                    const double* plusV = V(m + columnCount + 1, n + 1);
+                    const double* plusW = W(m + columnCount + 1, n + 1);
+                    const double* zeroV = V(m + columnCount, n + 1);
+                    const double* zeroW = W(m + columnCount, n + 1);
+
+                    for (Size lane = 0; lane < laneCount; ++lane)
+                    {
+                        fieldValues[0][lane] -= factors.A * (cosine * plusV[lane] + sine * plusW[lane]);
+                        fieldValues[1][lane] += factors.A * (sine * plusV[lane] - cosine * plusW[lane]);
+                        fieldValues[2][lane] -= factors.Z * (cosine * zeroV[lane] + sine * zeroW[lane]);
+                    }
+                }
+
+                if (m > 0)
+                {
+                    const double* minusV = V(m + columnCount - 1, n + 1);
+                    const double* minusW = W(m + columnCount - 1, n + 1);
+
+                    for (Size lane = 0; lane < laneCount; ++lane)
+                    {
+                        fieldValues[0][lane] += factors.B * (cosine * minusV[lane] + sine * minusW[lane]);
+                        fieldValues[1][lane] += factors.B * (sine * minusV[lane] - cosine * minusW[lane]);
+                    }
+                }
+
+                // Gradient: second derivatives, of degree n + 2 and orders m - 2 to m + 2
+
+                if constexpr (hasGradient)
+                {
+                    const DerivativeFactors plusFactors = DerivativeFactorsOf(s, is, n + 1, m + 1);
+                    const DerivativeFactors zeroFactors = DerivativeFactorsOf(s, is, n + 1, m);
+                    const DerivativeFactors minusFactors =
+                        (m > 0) ? DerivativeFactorsOf(s, is, n + 1, m - 1) : DerivativeFactors {0.0, 0.0, 0.0};
+
+                    // First derivative terms (C, S), of degree n + 1
+
+                    const double xPlusCosine = -factors.A * cosine;  // Order m + 1
+                    const double xPlusSine = -factors.A * sine;
+                    const double yPlusCosine = factors.A * sine;
+                    const double yPlusSine = -factors.A * cosine;
+                    const double zCosine = -factors.Z * cosine;  // Order m
+                    const double zSine = -factors.Z * sine;
+                    const double xMinusCosine = factors.B * cosine;  // Order m - 1
+                    const double xMinusSine = (m > 1) ? (factors.B * sine) : 0.0;
+                    const double yMinusCosine = factors.B * sine;
+                    const double yMinusSine = (m > 1) ? (-factors.B * cosine) : 0.0;
+
+                    // Second derivative terms (C, S), of degree n + 2: [xx, xy, xz, yy, yz, zz][order - m + 2]
+
+                    double vFactors[6][5] = {};
+                    double wFactors[6][5] = {};
+
+                    vFactors[0][4] = -plusFactors.A * xPlusCosine;
+                    wFactors[0][4] = -plusFactors.A * xPlusSine;
+                    vFactors[0][2] = plusFactors.B * xPlusCosine - minusFactors.A * xMinusCosine;
+                    wFactors[0][2] = plusFactors.B * xPlusSine - minusFactors.A * xMinusSine;
+                    vFactors[0][0] = minusFactors.B * xMinusCosine;
+                    wFactors[0][0] = minusFactors.B * xMinusSine;
+
+                    vFactors[1][4] = plusFactors.A * xPlusSine;
+                    wFactors[1][4] = -plusFactors.A * xPlusCosine;
+                    vFactors[1][2] = plusFactors.B * xPlusSine + minusFactors.A * xMinusSine;
+                    wFactors[1][2] = -plusFactors.B * xPlusCosine - minusFactors.A * xMinusCosine;
+                    vFactors[1][0] = minusFactors.B * xMinusSine;
+                    wFactors[1][0] = -minusFactors.B * xMinusCosine;
+
+                    vFactors[2][3] = -plusFactors.Z * xPlusCosine;
+                    wFactors[2][3] = -plusFactors.Z * xPlusSine;
+                    vFactors[2][1] = -minusFactors.Z * xMinusCosine;
+                    wFactors[2][1] = -minusFactors.Z * xMinusSine;
+
+                    vFactors[3][4] = plusFactors.A * yPlusSine;
+                    wFactors[3][4] = -plusFactors.A * yPlusCosine;
+                    vFactors[3][2] = plusFactors.B * yPlusSine + minusFactors.A * yMinusSine;
+                    wFactors[3][2] = -plusFactors.B * yPlusCosine - minusFactors.A * yMinusCosine;
+                    vFactors[3][0] = minusFactors.B * yMinusSine;
+                    wFactors[3][0] = -minusFactors.B * yMinusCosine;
+
+                    vFactors[4][3] = -plusFactors.Z * yPlusCosine;
+                    wFactors[4][3] = -plusFactors.Z * yPlusSine;
+                    vFactors[4][1] = -minusFactors.Z * yMinusCosine;
+                    wFactors[4][1] = -minusFactors.Z * yMinusSine;
+
+                    vFactors[5][2] = -zeroFactors.Z * zCosine;
+                    wFactors[5][2] = -zeroFactors.Z * zSine;
+
+                    // xx, xy, yy terms are of orders m - 2, m, m + 2, xz, yz terms of orders m - 1, m + 1, and zz
+                    // terms of order m
+
+                    for (Size offset = ((m < 2) ? (2 - m) : 0); offset < 5; ++offset)
+                    {
+                        const double* v = V(m + offset + columnCount - 2, n + 2);
+                        const double* w = W(m + offset + columnCount - 2, n + 2);
+
+                        if ((offset % 2) == 1)
+                        {
+                            for (Size lane = 0; lane < laneCount; ++lane)
+                            {
+                                gradients[2][lane] += vFactors[2][offset] * v[lane] + wFactors[2][offset] * w[lane];
+                                gradients[4][lane] += vFactors[4][offset] * v[lane] + wFactors[4][offset] * w[lane];
+                            }
+
+                            continue;
+                        }
+
+                        for (Size lane = 0; lane < laneCount; ++lane)
+                        {
+                            gradients[0][lane] += vFactors[0][offset] * v[lane] + wFactors[0][offset] * w[lane];
+                            gradients[1][lane] += vFactors[1][offset] * v[lane] + wFactors[1][offset] * w[lane];
+                            gradients[3][lane] += vFactors[3][offset] * v[lane] + wFactors[3][offset] * w[lane];
+                        }
+
+                        if (offset == 2)
+                        {
+                            for (Size lane = 0; lane < laneCount; ++lane)
+                            {
+                                gradients[5][lane] += vFactors[5][offset] * v[lane] + wFactors[5][offset] * w[lane];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        const double fieldFactor = gravitationalParameter / (radius * radius) / ScaleFactor;
+
+        for (Size lane = 0; lane < positionCount; ++lane)
+        {
+            aFieldValuePtr[blockIndex + lane] = {
+                fieldFactor * fieldValues[0][lane],
+                fieldFactor * fieldValues[1][lane],
+                fieldFactor * fieldValues[2][lane],
+            };
+        }
+
+        if constexpr (hasGradient)
+        {
+            const double gradientFactor = fieldFactor / radius;
+
+            for (Size lane = 0; lane < positionCount; ++lane)
+            {
+                const double xx = gradientFactor * gradients[0][lane];
+                const double xy = gradientFactor * gradients[1][lane];
+                const double xz = gradientFactor * gradients[2][lane];
+                const double yy = gradientFactor * gradients[3][lane];
+                const double yz = gradientFactor * gradients[4][lane];
+                const double zz = gradientFactor * gradients[5][lane];
+
+                aGradientPtr[blockIndex + lane] << xx, xy, xz, xy, yy, yz, xz, yz, zz;
+            }
+        }
+    }
+}
+
+}  // namespace gravitational
+}  // namespace environment
+}  // namespace physics
+}  // namespace ostk
@@ -1,18 +1,28 @@
 /// Apache License 2.0
 
-#include <GeographicLib/Constants.hpp>
-#include <GeographicLib/Geocentric.hpp>
-#include <GeographicLib/MagneticModel.hpp>
-#include <GeographicLib/Utility.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <tuple>
+#include <vector>
 
 #include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
-#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/RotationMatrix.hpp>
-
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/SphericalHarmonics.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Magnetic/Dipole.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Magnetic/Earth.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Magnetic/Earth/Manager.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
 
 namespace ostk
 {
@@ -23,7 +33,12 @@ namespace environment
 namespace magnetic
 {
 
-using GeographicLib::MagneticModel;
+using ostk::core::type::Integer;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+using ostk::core::type::Uint16;
+
+using ostk::physics::environment::gravitational::SphericalHarmonics;
 
 /// @brief                      Coefficients from the 2005 DGRF
 ///
@@ -38,6 +53,327 @@ static const Vector3d EarthMagneticMoment = Vector3d {g_11, h_11, g_01} * (a * a
 
 static const Dipole EarthDipole = {EarthMagneticMoment};
 
+namespace
+{
+
+// Spherical harmonic coefficients of a magnetic potential, fully normalized, stored by order then by degree (as in
+// GeographicLib coefficient files). Coefficients are scaled so that the field is the gradient of the potential, in T:
+// the magnetic potential a sum_n (a / r)^(n + 1) (g_nm cos(m lambda) + h_nm sin(m lambda)) P_nm is evaluated as a
+// gravitational potential of parameter a^2, with B = - grad(V).
+
+struct CoefficientSet
+{
+    Size degree;
+    Size order;
+
+    std::vector<double> cosineCoefficients;
+    std::vector<double> sineCoefficients;
+
+    bool isEmpty() const
+    {
+        return cosineCoefficients.empty();
+    }
+
+    Size cosineIndex(const Size n, const Size m) const
+    {
+        return m * (degree + 1) - (m * (m - 1)) / 2 + (n - m);
+    }
+
+    Size sineIndex(const Size n, const Size m) const
+    {
+        return this->cosineIndex(n, m) - (degree + 1);
+    }
+};
+
+// Loaded magnetic model: main field at each epoch (t_0 + i dt), secular variation after the last epoch, then constant
+// fields (e.g. crustal field)
+
+struct MagneticModelCoefficients
+{
+    double radius;       // [m]
+    double epoch;        // [year]
+    double epochStep;    // [year]
+    double minimumTime;  // [year]
+    double maximumTime;  // [year]
+
+    Size modelCount;
+
+    std::vector<CoefficientSet> coefficientSets;
+};
+
+// Load a magnetic model from GeographicLib files: "<name>.wmm" (WMMF header, then "Key Value" lines), and
+// "<name>.wmm.cof" (8 bytes identifier, then for each coefficient set N and M (int32), C and S coefficients
+// (little-endian doubles))
+
+Shared<const MagneticModelCoefficients> LoadMagneticModelCoefficients(
+    const std::string& aName, const std::string& aDataPath
+)
+{
+    const std::string filePath = aDataPath + "/" + aName + ".wmm";
+
+    MagneticModelCoefficients coefficients = {0.0, 0.0, 1.0, 0.0, 0.0, 1, {}};
+
+    Size constantCount = 0;
+    bool isSchmidtNormalized = true;
+    std::string identifier;
+
+    {
+        std::ifstream fileStream {filePath};
+
+        std::string line;
+
+        if ((!std::getline(fileStream, line)) || (line.rfind("WMMF-", 0) != 0))
+        {
+            throw ostk::core::error::RuntimeError("File [{}] is not a magnetic model file.", filePath);
+        }
+
+        while (std::getline(fileStream, line))
+        {
+            std::istringstream lineStream {line};
+
+            std::string key;
+            std::string value;
+
+            if ((!(lineStream >> key >> value)) || (key[0] == '#'))
+            {
+                continue;
+            }
+
+            if (key == "Radius")
+            {
+                coefficients.radius = std::stod(value);
+            }
+            else if (key == "Epoch")
+            {
+                coefficients.epoch = std::stod(value);
+            }
+            else if (key == "DeltaEpoch")
+            {
+                coefficients.epochStep = std::stod(value);
+            }
+            else if (key == "MinTime")
+            {
+                coefficients.minimumTime = std::stod(value);
+            }
+            else if (key == "MaxTime")
+            {
+                coefficients.maximumTime = std::stod(value);
+            }
+            else if (key == "NumModels")
+            {
+                coefficients.modelCount = static_cast<Size>(std::stoul(value));
+            }
+            else if (key == "NumConstants")
+            {
+                constantCount = static_cast<Size>(std::stoul(value));
+            }
+            else if (key == "Normalization")
+            {
+                isSchmidtNormalized = (value != "full");
+            }
+            else if (key == "ID")
+            {
+                identifier = value;
+            }
+        }
+    }
+
+    if ((coefficients.radius <= 0.0) || (coefficients.epochStep <= 0.0) || (coefficients.modelCount == 0) ||
+        (identifier.size() != 8))
+    {
+        throw ostk::core::error::RuntimeError("Cannot read magnetic model parameters from [{}].", filePath);
+    }
+
+    const std::string coefficientFilePath = filePath + ".cof";
+
+    std::ifstream coefficientStream {coefficientFilePath, std::ios::binary};
+
+    if (!coefficientStream.is_open())
+    {
+        throw ostk::core::error::RuntimeError("Cannot open coefficient file [{}].", coefficientFilePath);
+    }
+
+    char identifierBuffer[8];
+
+    if ((!coefficientStream.read(identifierBuffer, 8)) || (std::string(identifierBuffer, 8) != identifier))
+    {
+        throw ostk::core::error::RuntimeError("Cannot read coefficient file [{}].", coefficientFilePath);
+    }
+
+    const double scale = -1e-9;  // [nT] to [T], and B = - grad(V)
+
+    for (Size setIndex = 0; setIndex < (coefficients.modelCount + 1 + constantCount); ++setIndex)
+    {
+        std::int32_t degreeAndOrder[2];
+
+        if ((!coefficientStream.read(reinterpret_cast<char*>(degreeAndOrder), sizeof(degreeAndOrder))) ||
+            (degreeAndOrder[1] < -1) || (degreeAndOrder[0] < degreeAndOrder[1]))
+        {
+            throw ostk::core::error::RuntimeError("Cannot read coefficient file [{}].", coefficientFilePath);
+        }
+
+        CoefficientSet coefficientSet = {0, 0, {}, {}};
+
+        if (degreeAndOrder[1] >= 0)
+        {
+            coefficientSet.degree = static_cast<Size>(degreeAndOrder[0]);
+            coefficientSet.order = static_cast<Size>(degreeAndOrder[1]);
+
+            const Size degree = coefficientSet.degree;
+            const Size order = coefficientSet.order;
+
+            coefficientSet.cosineCoefficients.resize(((order + 1) * (2 * degree - order + 2)) / 2);
+            coefficientSet.sineCoefficients.resize(coefficientSet.cosineCoefficients.size() - (degree + 1));
+
+            coefficientStream.read(
+                reinterpret_cast<char*>(coefficientSet.cosineCoefficients.data()),
+                static_cast<std::streamsize>(coefficientSet.cosineCoefficients.size() * sizeof(double))
+            );
+            coefficientStream.read(
+                reinterpret_cast<char*>(coefficientSet.sineCoefficients.data()),
+                static_cast<std::streamsize>(coefficientSet.sineCoefficients.size() * sizeof(double))
+            );
+
+            if (!coefficientStream)
+            {
+                throw ostk::core::error::RuntimeError("Cannot read coefficients from [{}].", coefficientFilePath);
+            }
+
+            for (Size m = 0; m <= order; ++m)
+            {
+                for (Size n = m; n <= degree; ++n)
+                {
+                    const double factor =
+                        isSchmidtNormalized ? (scale / std::sqrt(static_cast<double>(2 * n + 1))) : scale;
+
+                    coefficientSet.cosineCoefficients[coefficientSet.cosineIndex(n, m)] *= factor;
+
+                    if (m > 0)
+                    {
+                        coefficientSet.sineCoefficients[coefficientSet.sineIndex(n, m)] *= factor;
+                    }
+                }
+            }
+        }
+
+        coefficients.coefficientSets.push_back(std::move(coefficientSet));
+    }
+
+    return std::make_shared<const MagneticModelCoefficients>(std::move(coefficients));
+}
+
+// Process-wide registry of loaded magnetic models: coefficient files are read once per (model, data path), and loaded
+// models are shared by all instances and copies. Entries expire when no longer referenced.
+
+Shared<const MagneticModelCoefficients> AccessMagneticModelCoefficients(
+    const std::string& aName, const std::string& aDataPath
+)
+{
+    using Key = std::tuple<std::string, std::string>;
+
+    static std::mutex mutex;
+    static std::map<Key, std::weak_ptr<const MagneticModelCoefficients>> magneticModels;
+
+    const std::lock_guard<std::mutex> lock {mutex};
+
+    std::weak_ptr<const MagneticModelCoefficients>& coefficientsWPtr = magneticModels[Key {aName, aDataPath}];
+
+    if (Shared<const MagneticModelCoefficients> coefficientsSPtr = coefficientsWPtr.lock())
+    {
+        return coefficientsSPtr;
+    }
+
+    const Shared<const MagneticModelCoefficients> coefficientsSPtr = LoadMagneticModelCoefficients(aName, aDataPath);
+
+    coefficientsWPtr = coefficientsSPtr;
+
+    return coefficientsSPtr;
+}
+
+// Coefficients at a given time [year]: main field of the epoch, plus its secular variation (interpolated between
+// epochs, or extrapolated after the last one), plus constant fields, as a single expansion
+
+SphericalHarmonics SphericalHarmonicsAt(const MagneticModelCoefficients& aMagneticModelCoefficients, const double aYear)
+{
+    const MagneticModelCoefficients& coefficients = aMagneticModelCoefficients;
+
+    const double time = aYear - coefficients.epoch;
+
+    const Size index = static_cast<Size>(std::clamp(
+        std::floor(time / coefficients.epochStep), 0.0, static_cast<double>(coefficients.modelCount - 1)
+    ));
+
+    const bool isInterpolated = (index + 1) < coefficients.modelCount;
+
+    const double elapsedTime = time - static_cast<double>(index) * coefficients.epochStep;
+
+    std::vector<std::tuple<const CoefficientSet*, double>> terms = {
+        {&coefficients.coefficientSets[index],
+         isInterpolated ? (1.0 - elapsedTime / coefficients.epochStep) : 1.0},
+        {&coefficients.coefficientSets[index + 1],
+         isInterpolated ? (elapsedTime / coefficients.epochStep) : elapsedTime},
+    };
+
+    for (Size setIndex = coefficients.modelCount + 1; setIndex < coefficients.coefficientSets.size(); ++setIndex)
+    {
+        terms.push_back({&coefficients.coefficientSets[setIndex], 1.0});
+    }
+
+    CoefficientSet coefficientSet = {0, 0, {}, {}};
+
+    for (const auto& term : terms)
+    {
+        if (!std::get<0>(term)->isEmpty())
+        {
+            coefficientSet.degree = std::max(coefficientSet.degree, std::get<0>(term)->degree);
+            coefficientSet.order = std::max(coefficientSet.order, std::get<0>(term)->order);
+        }
+    }
+
+    const Size degree = coefficientSet.degree;
+    const Size order = coefficientSet.order;
+
+    coefficientSet.cosineCoefficients.assign(((order + 1) * (2 * degree - order + 2)) / 2, 0.0);
+    coefficientSet.sineCoefficients.assign(coefficientSet.cosineCoefficients.size() - (degree + 1), 0.0);
+
+    for (const auto& term : terms)
+    {
+        const CoefficientSet& termCoefficientSet = *std::get<0>(term);
+        const double weight = std::get<1>(term);
+
+        if (termCoefficientSet.isEmpty() || (weight == 0.0))
+        {
+            continue;
+        }
+
+        for (Size m = 0; m <= termCoefficientSet.order; ++m)
+        {
+            for (Size n = m; n <= termCoefficientSet.degree; ++n)
+            {
+                coefficientSet.cosineCoefficients[coefficientSet.cosineIndex(n, m)] +=
+                    weight * termCoefficientSet.cosineCoefficients[termCoefficientSet.cosineIndex(n, m)];
+
+                if (m > 0)
+                {
+                    coefficientSet.sineCoefficients[coefficientSet.sineIndex(n, m)] +=
+                        weight * termCoefficientSet.sineCoefficients[termCoefficientSet.sineIndex(n, m)];
+                }
+            }
+        }
+    }
+
+    return {
+        coefficients.radius * coefficients.radius,
+        coefficients.radius,
+        Integer(static_cast<Integer::ValueType>(degree)),
+        Integer(static_cast<Integer::ValueType>(order)),
+        coefficientSet.cosineCoefficients,
+        coefficientSet.sineCoefficients
+    };
+}
+
+}  // namespace
+
 class Earth::Impl
 {
    public:
@@ -54,27 +390,56 @@ class Earth::Impl
 
     Vector3d getFieldValueAt(const Vector3d& aPosition, const Instant& anInstant) const;
 
+    Array<Vector3d> getFieldValuesAt(const Array<Vector3d>& aPositionArray, const Instant& anInstant) const;
+
    private:
+    // Expansion at a given instant, with the secular variation applied
+
+    struct EpochHarmonics
+    {
+        Instant instant;
+        SphericalHarmonics harmonics;
+    };
+
     Earth::Type type_;
     Directory dataDirectory_;
 
-    Unique<MagneticModel> magneticModelUPtr_;
+    Shared<const MagneticModelCoefficients> coefficientsSPtr_;
+
+    // Expansions at the last instants evaluated, so that threads at different instants do not evict each other
+
+    static constexpr Size EpochHarmonicsCacheCapacity = 4;
+
+    mutable std::array<std::atomic<Shared<const EpochHarmonics>>, EpochHarmonicsCacheCapacity> epochHarmonicsCache_;
+    mutable std::atomic<Size> epochHarmonicsCacheIndex_;  // Next slot to replace
 
-    static Unique<MagneticModel> MagneticModelFromType(const Earth::Type& aType, const Directory& aDataDirectory);
+    Shared<const EpochHarmonics> accessEpochHarmonics(const Instant& anInstant) const;
+
+    static Shared<const MagneticModelCoefficients> CoefficientsFromType(
+        const Earth::Type& aType, const Directory& aDataDirectory
+    );
 };
 
 Earth::Impl::Impl(const Earth::Type& aType, const Directory& aDataDirectory)
     : type_(aType),
       dataDirectory_(aDataDirectory),
-      magneticModelUPtr_(Earth::Impl::MagneticModelFromType(aType, aDataDirectory))
+      coefficientsSPtr_(Earth::Impl::CoefficientsFromType(aType, aDataDirectory)),
+      epochHarmonicsCache_(),
+      epochHarmonicsCacheIndex_(0)
 {
 }
 
 Earth::Impl::Impl(const Earth::Impl& anImpl)
     : type_(anImpl.getType()),
       dataDirectory_(anImpl.getDataDirectory()),
-      magneticModelUPtr_(Earth::Impl::MagneticModelFromType(anImpl.getType(), anImpl.getDataDirectory()))
+      coefficientsSPtr_(anImpl.coefficientsSPtr_),  // Loaded model is immutable, and shared between copies
+      epochHarmonicsCache_(),
+      epochHarmonicsCacheIndex_(anImpl.epochHarmonicsCacheIndex_.load())
 {
+    for (Size slotIndex = 0; slotIndex < EpochHarmonicsCacheCapacity; ++slotIndex)
+    {
+        epochHarmonicsCache_[slotIndex].store(anImpl.epochHarmonicsCache_[slotIndex].load());
+    }
 }
 
 Earth::Impl::~Impl() {}
@@ -91,77 +456,96 @@ Directory Earth::Impl::getDataDirectory() const
 
 bool Earth::Impl::isDefined() const
 {
-    return magneticModelUPtr_ != nullptr;
+    return coefficientsSPtr_ != nullptr;
 }
 
 Vector3d Earth::Impl::getFieldValueAt(const Vector3d& aPosition, const Instant& anInstant) const
 {
-    using GeographicLib::Geocentric;
+    if (type_ == Earth::Type::Dipole)
+    {
+        return EarthDipole.getFieldValueAt(aPosition, anInstant);
+    }
 
-    using ostk::core::type::Integer;
+    return this->accessEpochHarmonics(anInstant)->harmonics.getFieldValueAt(aPosition);
+}
 
-    using ostk::mathematics::geometry::d3::transformation::rotation::RotationMatrix;
+Array<Vector3d> Earth::Impl::getFieldValuesAt(const Array<Vector3d>& aPositionArray, const Instant& anInstant) const
+{
+    if (type_ == Earth::Type::Dipole)
+    {
+        Array<Vector3d> fieldValues = Array<Vector3d>::Empty();
+        fieldValues.reserve(aPositionArray.getSize());
 
+        for (const auto& position : aPositionArray)
+        {
+            fieldValues.add(EarthDipole.getFieldValueAt(position, anInstant));
+        }
+
+        return fieldValues;
+    }
+
+    return this->accessEpochHarmonics(anInstant)->harmonics.getFieldValuesAt(aPositionArray);
+}
+
+Shared<const Earth::Impl::EpochHarmonics> Earth::Impl::accessEpochHarmonics(const Instant& anInstant) const
+{
+    using ostk::physics::time::DateTime;
     using ostk::physics::time::Scale;
 
-    if (type_ == Earth::Type::Dipole)
+    if (coefficientsSPtr_ == nullptr)
     {
-        return EarthDipole.getFieldValueAt(aPosition, anInstant);
+        throw ostk::core::error::runtime::Undefined("Earth magnetic model");
+    }
+
+    // Instants are typically shared by many consecutive evaluations (e.g. many satellites at a given step)
+
+    for (const auto& epochHarmonicsSlot : epochHarmonicsCache_)
+    {
+        const Shared<const EpochHarmonics> epochHarmonicsSPtr = epochHarmonicsSlot.load();
+
+        if ((epochHarmonicsSPtr != nullptr) && (epochHarmonicsSPtr->instant == anInstant))
+        {
+            return epochHarmonicsSPtr;
+        }
     }
 
     const Integer year = anInstant.getDateTime(Scale::UTC).accessDate().getYear();
 
-    if (((year < static_cast<int>(magneticModelUPtr_->MinTime())) ||
-         (year > static_cast<int>(magneticModelUPtr_->MaxTime()))))
+    if (((year < static_cast<int>(coefficientsSPtr_->minimumTime)) ||
+         (year > static_cast<int>(coefficientsSPtr_->maximumTime))))
     {
         throw ostk::core::error::RuntimeError(
-            "Year [{}] is out of [{}, {}] bounds.", year, magneticModelUPtr_->MinTime(), magneticModelUPtr_->MaxTime()
+            "Year [{}] is out of [{}, {}] bounds.", year, coefficientsSPtr_->minimumTime, coefficientsSPtr_->maximumTime
         );
     }
 
-    static const Geocentric earthGeocentric = Geocentric::WGS84();
-
-    double latitude_deg;   // [deg]
-    double longitude_deg;  // [deg]
-    double altitude_m;     // [m]
-
-    earthGeocentric.Reverse(aPosition.x(), aPosition.y(), aPosition.z(), latitude_deg, longitude_deg, altitude_m);
+    const Uint16 yearValue = static_cast<Uint16>(static_cast<Integer::ValueType>(year));
 
-    double Bx_nT;  // [nT] Easterly component of the magnetic field
-    double By_nT;  // [nT] Northerly component of the magnetic field
-    double Bz_nT;  // [nT] Vertical component of the magnetic field
+    const Instant yearStartInstant = Instant::DateTime(DateTime(yearValue, 1, 1), Scale::UTC);
+    const Instant nextYearStartInstant =
+        Instant::DateTime(DateTime(static_cast<Uint16>(yearValue + 1), 1, 1), Scale::UTC);
 
-    (*magneticModelUPtr_)(year, latitude_deg, longitude_deg, altitude_m, Bx_nT, By_nT, Bz_nT);
+    const double fractionalYear = static_cast<double>(yearValue) +
+                                  static_cast<double>((anInstant - yearStartInstant).inSeconds()) /
+                                      static_cast<double>((nextYearStartInstant - yearStartInstant).inSeconds());
 
-    const Vector3d magneticField_NED = Vector3d {By_nT, Bx_nT, -Bz_nT} / 1e9;  // [T]
+    const Shared<const EpochHarmonics> newEpochHarmonicsSPtr = std::make_shared<const EpochHarmonics>(
+        EpochHarmonics {anInstant, SphericalHarmonicsAt(*coefficientsSPtr_, fractionalYear)}
+    );
 
-    const double latitude_rad = latitude_deg * M_PI / 180.0;    // [rad]
-    const double longitude_rad = longitude_deg * M_PI / 180.0;  // [rad]
+    // Replace the slots in turn, the oldest expansion being evicted first
 
-    const Real cos_lat = std::cos(latitude_rad);
-    const Real sin_lat = std::sin(latitude_rad);
+    const Size slotIndex =
+        epochHarmonicsCacheIndex_.fetch_add(1, std::memory_order_relaxed) % EpochHarmonicsCacheCapacity;
 
-    const Real cos_lon = std::cos(longitude_rad);
-    const Real sin_lon = std::sin(longitude_rad);
+    epochHarmonicsCache_[slotIndex].store(newEpochHarmonicsSPtr);
 
-    const RotationMatrix dcm_ECEF_NED = {
-        -sin_lat * cos_lon,
-        -sin_lon,
-        -cos_lat * cos_lon,
-        -sin_lat * sin_lon,
-        +cos_lon,
-        -cos_lat * sin_lon,
-        +cos_lat,
-        0.0,
-        -sin_lat
-    };
-
-    const Vector3d magneticField = dcm_ECEF_NED * magneticField_NED;  // [T]
-
-    return magneticField;
+    return newEpochHarmonicsSPtr;
 }
 
-Unique<MagneticModel> Earth::Impl::MagneticModelFromType(const Earth::Type& aType, const Directory& aDataDirectory)
+Shared<const MagneticModelCoefficients> Earth::Impl::CoefficientsFromType(
+    const Earth::Type& aType, const Directory& aDataDirectory
+)
 {
     using ostk::core::type::String;
 
@@ -218,25 +602,25 @@ Unique<MagneticModel> Earth::Impl::MagneticModelFromType(const Earth::Type& aTyp
     switch (aType)
     {
         case Earth::Type::EMM2010:
-            return std::make_unique<GeographicLib::MagneticModel>("emm2010", dataPath);
+            return AccessMagneticModelCoefficients("emm2010", dataPath);
 
         case Earth::Type::EMM2015:
-            return std::make_unique<GeographicLib::MagneticModel>("emm2015", dataPath);
+            return AccessMagneticModelCoefficients("emm2015", dataPath);
 
         case Earth::Type::EMM2017:
-            return std::make_unique<GeographicLib::MagneticModel>("emm2017", dataPath);
+            return AccessMagneticModelCoefficients("emm2017", dataPath);
 
         case Earth::Type::IGRF11:
-            return std::make_unique<GeographicLib::MagneticModel>("igrf11", dataPath);
+            return AccessMagneticModelCoefficients("igrf11", dataPath);
 
         case Earth::Type::IGRF12:
-            return std::make_unique<GeographicLib::MagneticModel>("igrf12", dataPath);
+            return AccessMagneticModelCoefficients("igrf12", dataPath);
 
         case Earth::Type::WMM2010:
-            return std::make_unique<GeographicLib::MagneticModel>("wmm2010", dataPath);
+            return AccessMagneticModelCoefficients("wmm2010", dataPath);
 
         case Earth::Type::WMM2015:
-            return std::make_unique<GeographicLib::MagneticModel>("wmm2015", dataPath);
+            return AccessMagneticModelCoefficients("wmm2015", dataPath);
 
         default:
             throw ostk::core::error::runtime::Wrong("Type");
@@ -301,6 +685,11 @@ Vector3d Earth::getFieldValueAt(const Vector3d& aPosition, const Instant& anInst
     return implUPtr_->getFieldValueAt(aPosition, anInstant);
 }
 
+Array<Vector3d> Earth::getFieldValuesAt(const Array<Vector3d>& aPositionArray, const Instant& anInstant) const
+{
+    return implUPtr_->getFieldValuesAt(aPositionArray, anInstant);
+}
+
 }  // namespace magnetic
 }  // namespace environment
 }  // namespace physics
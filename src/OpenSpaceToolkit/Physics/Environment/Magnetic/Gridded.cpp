@@ -0,0 +1,158 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Magnetic/Gridded.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace environment
+{
+namespace magnetic
+{
+
+using ostk::core::container::Array;
+
+const Size Gridded::DefaultMemoryBudget = 256 * 1024 * 1024;
+const Duration Gridded::DefaultValidityDuration = Duration::Days(30.0);
+
+Gridded::Gridded(
+    const Model& aModel,
+    const Instant& anEpoch,
+    const Length& aMinimumRadius,
+    const Length& aMaximumRadius,
+    const Real& aTolerance,
+    const Size& aMemoryBudget,
+    const Duration& aValidityDuration
+)
+    : Gridded(aModel, anEpoch, FieldGrid::Undefined(), aValidityDuration)
+{
+    if (!anEpoch.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Epoch");
+    }
+
+    if (!aMinimumRadius.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Minimum radius");
+    }
+
+    if (!aMaximumRadius.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Maximum radius");
+    }
+
+    const Model* modelPtr = modelSPtr_.get();
+    const double minimumRadius = aMinimumRadius.inMeters();
+
+    // Field values scaled by (r / r_min)^3: the scale is at least one, so the interpolation error of the grid bounds
+    // the error of the field values
+
+    const FieldGrid::FieldFunction scaledFieldFunction = [modelPtr, anEpoch, minimumRadius](
+                                                             const Array<Vector3d>& aPositionArray
+                                                         ) -> Array<Vector3d>
+    {
+        Array<Vector3d> scaledFieldValues = Array<Vector3d>::Empty();
+        scaledFieldValues.reserve(aPositionArray.getSize());
+
+        for (const auto& position : aPositionArray)
+        {
+            const double scale = std::pow(position.norm() / minimumRadius, 3);
+
+            scaledFieldValues.add(scale * modelPtr->getFieldValueAt(position, anEpoch));
+        }
+
+        return scaledFieldValues;
+    };
+
+    fieldGrid_ = FieldGrid(scaledFieldFunction, minimumRadius, aMaximumRadius.inMeters(), aTolerance, aMemoryBudget);
+}
+
+Gridded::Gridded(
+    const Model& aModel, const Instant& anEpoch, const FieldGrid& aFieldGrid, const Duration& aValidityDuration
+)
+    : Model(),
+      modelSPtr_(aModel.clone()),
+      epoch_(anEpoch),
+      fieldGrid_(aFieldGrid),
+      validityDuration_(aValidityDuration)
+{
+    if (!validityDuration_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Validity duration");
+    }
+
+    if (!validityDuration_.isPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Validity duration");
+    }
+}
+
+Gridded* Gridded::clone() const
+{
+    return new Gridded(*this);
+}
+
+bool Gridded::isDefined() const
+{
+    return modelSPtr_->isDefined() && epoch_.isDefined() && fieldGrid_.isDefined() && validityDuration_.isDefined();
+}
+
+const Model& Gridded::accessModel() const
+{
+    return *modelSPtr_;
+}
+
+Instant Gridded::getEpoch() const
+{
+    return epoch_;
+}
+
+Duration Gridded::getValidityDuration() const
+{
+    return validityDuration_;
+}
+
+FieldGrid Gridded::getFieldGrid() const
+{
+    return fieldGrid_;
+}
+
+Real Gridded::getErrorBound() const
+{
+    return fieldGrid_.getErrorBound();
+}
+
+Vector3d Gridded::getFieldValueAt(const Vector3d& aPosition, const Instant& anInstant) const
+{
+    if (!fieldGrid_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Field grid");
+    }
+
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    // The grid is frozen at the epoch: away from it, the secular variation of the model is not captured
+
+    if (!fieldGrid_.contains(aPosition) || ((anInstant - epoch_).getAbsolute() > validityDuration_))
+    {
+        return modelSPtr_->getFieldValueAt(aPosition, anInstant);
+    }
+
+    const double scale = std::pow(aPosition.norm() / static_cast<double>(fieldGrid_.getMinimumRadius()), 3);
+
+    return fieldGrid_.getValueAt(aPosition) / scale;
+}
+
+}  // namespace magnetic
+}  // namespace environment
+}  // namespace physics
+}  // namespace ostk
@@ -251,7 +251,7 @@ Position Celestial::getPositionIn(const Shared<const Frame>& aFrameSPtr, const I
         throw ostk::core::error::runtime::Undefined("Celestial");
     }
 
-    return ephemeris_->accessFrame()->getOriginIn(aFrameSPtr, anInstant);
+    return ephemeris_->getPositionIn(aFrameSPtr, anInstant);
 }
 
 Velocity Celestial::getVelocityIn(const Shared<const Frame>& aFrameSPtr, const Instant& anInstant) const
@@ -1,11 +1,20 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
-#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Segment.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Object.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Utility/Eclipse.hpp>
 
 namespace ostk
@@ -17,18 +26,252 @@ namespace environment
 namespace utilities
 {
 
-Array<Interval> eclipseIntervalsAtPosition(
-    const Interval& anAnalysisInterval, const Position& aPosition, const Environment& anEnvironment
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::physics::environment::object::Celestial;
+
+static const double MinimumStep = 1.0;       // [s]
+static const double StepSafetyFactor = 0.5;  // Fraction of the predicted time to the shadow boundary
+static const Size MaximumRootIterationCount = 100;
+
+static Shared<const Celestial> SunFromEnvironment(const Environment& anEnvironment)
+{
+    const Shared<const Celestial> sunSPtr =
+        std::dynamic_pointer_cast<const Celestial>(anEnvironment.accessObjectWithName("Sun"));
+
+    if (sunSPtr == nullptr)
+    {
+        throw ostk::core::error::RuntimeError("Sun is not a celestial object.");
+    }
+
+    return sunSPtr;
+}
+
+static Array<Shared<const Celestial>> OccultingBodiesFromEnvironment(const Environment& anEnvironment)
+{
+    Array<Shared<const Celestial>> occultingBodies = Array<Shared<const Celestial>>::Empty();
+
+    for (const auto& objectSPtr : anEnvironment.accessObjects())
+    {
+        if (objectSPtr->accessName() == "Sun")
+        {
+            continue;
+        }
+
+        if (const Shared<const Celestial> celestialSPtr = std::dynamic_pointer_cast<const Celestial>(objectSPtr))
+        {
+            occultingBodies.add(celestialSPtr);
+        }
+    }
+
+    return occultingBodies;
+}
+
+static double ShadowFunction(
+    const Instant& anInstant,
+    const Position& aPosition,
+    const Celestial& aSun,
+    const Array<Shared<const Celestial>>& anOccultingBodyArray,
+    const bool includePenumbra
+)
+{
+    using ostk::mathematics::object::Vector3d;
+
+    using ostk::physics::coordinate::Frame;
+
+    const double sunRadius = aSun.getEquatorialRadius().inMeters();
+
+    double shadowFunction = M_PI;  // No occulting body: never in shadow
+
+    for (const auto& bodySPtr : anOccultingBodyArray)
+    {
+        const Shared<const Frame> bodyFrameSPtr = bodySPtr->accessFrame();
+
+        const Vector3d x_OBSERVER_BODY = aPosition.inFrame(bodyFrameSPtr, anInstant).inMeters().getCoordinates();
+        const Vector3d x_SUN_BODY = aSun.getPositionIn(bodyFrameSPtr, anInstant).inMeters().getCoordinates();
+
+        const double sunAngularRadius = std::asin(std::min(1.0, sunRadius / (x_SUN_BODY - x_OBSERVER_BODY).norm()));
+
+        // Stretch the polar axis, so that the body is a sphere of its equatorial radius: lines of sight are preserved
+
+        const double bodyRadius = bodySPtr->getEquatorialRadius().inMeters();
+        const Vector3d polarScaling = {1.0, 1.0, 1.0 / (1.0 - bodySPtr->getFlattening())};
+
+        const Vector3d x_OBSERVER_SCALED = x_OBSERVER_BODY.cwiseProduct(polarScaling);
+        const Vector3d x_SUN_SCALED = x_SUN_BODY.cwiseProduct(polarScaling);
+
+        // Below the surface, the body hides the half-space under the local horizon
+
+        const double observerDistance = x_OBSERVER_SCALED.norm();
+        const double bodyAngularRadius =
+            (observerDistance > bodyRadius) ? std::asin(bodyRadius / observerDistance) : (M_PI / 2.0);
+
+        const Vector3d observerToSunDirection = x_SUN_SCALED - x_OBSERVER_SCALED;
+        const Vector3d observerToBodyDirection = -x_OBSERVER_SCALED;
+
+        const double separation = std::atan2(
+            observerToSunDirection.cross(observerToBodyDirection).norm(),
+            observerToSunDirection.dot(observerToBodyDirection)
+        );
+
+        const double bodyShadowFunction = includePenumbra ? (separation - (bodyAngularRadius + sunAngularRadius))
+                                                          : (separation - (bodyAngularRadius - sunAngularRadius));
+
+        shadowFunction = std::min(shadowFunction, bodyShadowFunction);
+    }
+
+    return shadowFunction;
+}
+
+static double FindRoot(
+    const std::function<double(const double)>& aFunction,
+    const double aLowerBound,
+    const double anUpperBound,
+    const double aLowerValue,
+    const double anUpperValue,
+    const double aTolerance
+)
+{
+    // Brent's method, the root being bracketed by [aLowerBound, anUpperBound]
+
+    static const double epsilon = std::numeric_limits<double>::epsilon();
+
+    double a = aLowerBound;
+    double b = anUpperBound;
+    double c = anUpperBound;
+
+    double fa = aLowerValue;
+    double fb = anUpperValue;
+    double fc = anUpperValue;
+
+    double d = b - a;
+    double e = d;
+
+    for (Size iteration = 0; iteration < MaximumRootIterationCount; ++iteration)
+    {
+        if (((fb > 0.0) && (fc > 0.0)) || ((fb < 0.0) && (fc < 0.0)))
+        {
+            c = a;
+            fc = fa;
+            d = b - a;
+            e = d;
+        }
+
+        if (std::abs(fc) < std::abs(fb))
+        {
+            a = b;
+            b = c;
+            c = a;
+            fa = fb;
+            fb = fc;
+            fc = fa;
+        }
+
+        const double tolerance = 2.0 * epsilon * std::abs(b) + 0.5 * aTolerance;
+        const double midpoint = 0.5 * (c - b);
+
+        if ((std::abs(midpoint) <= tolerance) || (fb == 0.0))
+        {
+            return b;
+        }
+
+        if ((std::abs(e) >= tolerance) && (std::abs(fa) > std::abs(fb)))
+        {
+            // Inverse quadratic interpolation, or secant if only two points are distinct
+
+            const double s = fb / fa;
+
+            double p;
+            double q;
+
+            if (a == c)
+            {
+                p = 2.0 * midpoint * s;
+                q = 1.0 - s;
+            }
+            else
+            {
+                const double r = fb / fc;
+                const double t = fa / fc;
+
+                p = s * (2.0 * midpoint * t * (t - r) - (b - a) * (r - 1.0));
+                q = (t - 1.0) * (r - 1.0) * (s - 1.0);
+            }
+
+            if (p > 0.0)
+            {
+                q = -q;
+            }
+
+            p = std::abs(p);
+
+            if ((2.0 * p) < std::min(3.0 * midpoint * q - std::abs(tolerance * q), std::abs(e * q)))
+            {
+                e = d;
+                d = p / q;
+            }
+            else
+            {
+                d = midpoint;
+                e = d;
+            }
+        }
+        else
+        {
+            // Bisection
+
+            d = midpoint;
+            e = d;
+        }
+
+        a = b;
+        fa = fb;
+
+        b += (std::abs(d) > tolerance) ? d : std::copysign(tolerance, midpoint);
+        fb = aFunction(b);
+    }
+
+    return b;
+}
+
+Real shadowFunctionAtPosition(
+    const Instant& anInstant, const Position& aPosition, const Environment& anEnvironment, const bool& includePenumbra
 )
 {
-    using ostk::core::type::Shared;
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
 
-    using ostk::mathematics::geometry::d3::object::Segment;
+    if (!aPosition.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Position");
+    }
 
-    using ostk::physics::time::Instant;
-    using ostk::physics::time::Duration;
-    using ostk::physics::environment::Object;
+    if (!anEnvironment.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Environment");
+    }
 
+    return ShadowFunction(
+        anInstant,
+        aPosition,
+        *SunFromEnvironment(anEnvironment),
+        OccultingBodiesFromEnvironment(anEnvironment),
+        includePenumbra
+    );
+}
+
+Array<Interval> eclipseIntervalsAtPosition(
+    const Interval& anAnalysisInterval,
+    const Position& aPosition,
+    const Environment& anEnvironment,
+    const bool& includePenumbra,
+    const Duration& aMaximumStep,
+    const Duration& aTolerance
+)
+{
     if (!anAnalysisInterval.isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Analysis interval");
@@ -44,39 +287,90 @@ Array<Interval> eclipseIntervalsAtPosition(
         throw ostk::core::error::runtime::Undefined("Environment");
     }
 
-    Environment environment = anEnvironment;
+    if (!aMaximumStep.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Maximum step");
+    }
 
-    const Duration timeStep = Duration::Minutes(1.0);  // [TBM] Param
+    if (!aTolerance.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Tolerance");
+    }
 
-    Array<Interval> eclipseIntervals = Array<Interval>::Empty();
+    if (!aMaximumStep.isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Maximum step");
+    }
+
+    if (!aTolerance.isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Tolerance");
+    }
 
-    Instant eclipseStartInstant = Instant::Undefined();
-    Instant eclipseEndInstant = Instant::Undefined();
+    const Shared<const Celestial> sunSPtr = SunFromEnvironment(anEnvironment);
+    const Array<Shared<const Celestial>> occultingBodies = OccultingBodiesFromEnvironment(anEnvironment);
 
-    for (const auto& instant : anAnalysisInterval.generateGrid(timeStep))
+    const Instant& startInstant = anAnalysisInterval.accessStart();
+
+    const double duration = anAnalysisInterval.getDuration().inSeconds();
+    const double maximumStep = aMaximumStep.inSeconds();
+    const double minimumStep = std::min(MinimumStep, maximumStep);
+    const double tolerance = aTolerance.inSeconds();
+
+    // Shadow function, against time [s] from the start of the analysis interval
+
+    const std::function<double(const double)> shadowFunction = [&](const double aTime) -> double
     {
-        environment.setInstant(instant);
+        return ShadowFunction(
+            startInstant + Duration::Seconds(aTime), aPosition, *sunSPtr, occultingBodies, includePenumbra
+        );
+    };
+
+    Array<Interval> eclipseIntervals = Array<Interval>::Empty();
 
-        const bool inEclipse = environment.isPositionInEclipse(aPosition);
+    double time = 0.0;
+    double value = shadowFunction(time);
 
-        if (inEclipse && (!eclipseStartInstant.isDefined()))
-        {
-            eclipseStartInstant = instant;
-        }
-        else if ((!inEclipse) && eclipseStartInstant.isDefined())
+    Instant eclipseStartInstant = (value < 0.0) ? startInstant : Instant::Undefined();
+
+    double step = maximumStep;
+
+    while (time < duration)
+    {
+        const double nextTime = std::min(time + step, duration);
+        const double nextValue = shadowFunction(nextTime);
+
+        if ((value < 0.0) != (nextValue < 0.0))
         {
-            eclipseIntervals.add(Interval::Closed(eclipseStartInstant, eclipseEndInstant));
+            const Instant boundaryInstant =
+                startInstant + Duration::Seconds(FindRoot(shadowFunction, time, nextTime, value, nextValue, tolerance));
+
+            if (nextValue < 0.0)
+            {
+                eclipseStartInstant = boundaryInstant;
+            }
+            else
+            {
+                eclipseIntervals.add(Interval::Closed(eclipseStartInstant, boundaryInstant));
 
-            eclipseStartInstant = Instant::Undefined();
-            eclipseEndInstant = Instant::Undefined();
+                eclipseStartInstant = Instant::Undefined();
+            }
         }
 
-        eclipseEndInstant = instant;
+        // Step by a fraction of the time it would take to reach the shadow boundary at the current rate of change
+
+        const double rate = std::abs(nextValue - value) / (nextTime - time);
+
+        step = (rate > 0.0) ? std::clamp(StepSafetyFactor * std::abs(nextValue) / rate, minimumStep, maximumStep)
+                            : maximumStep;
+
+        time = nextTime;
+        value = nextValue;
     }
 
     if (eclipseStartInstant.isDefined())
     {
-        eclipseIntervals.add(Interval::Closed(eclipseStartInstant, eclipseEndInstant));
+        eclipseIntervals.add(Interval::Closed(eclipseStartInstant, anAnalysisInterval.accessEnd()));
     }
 
     return eclipseIntervals;
@@ -0,0 +1,537 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Utility/FieldGrid.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace environment
+{
+namespace utilities
+{
+
+namespace
+{
+
+constexpr char FileSignature[8] = {'O', 'S', 'T', 'K', 'F', 'G', 'R', 'D'};
+constexpr std::uint32_t FileVersion = 1;
+
+// Cell midpoints sampled per axis, to estimate the interpolation error
+
+constexpr Size SampleCount = 4096;
+
+// Cubic Lagrange weights of the nodes 0, 1, 2, 3, at x in [0, 3]
+
+void LagrangeWeightsOf(const double x, double* aWeightArray)
+{
+    const double x0 = x;
+    const double x1 = x - 1.0;
+    const double x2 = x - 2.0;
+    const double x3 = x - 3.0;
+
+    aWeightArray[0] = -x1 * x2 * x3 / 6.0;
+    aWeightArray[1] = x0 * x2 * x3 / 2.0;
+    aWeightArray[2] = -x0 * x1 * x3 / 2.0;
+    aWeightArray[3] = x0 * x1 * x2 / 6.0;
+}
+
+// First node of the stencil of a grid coordinate, and weights of the stencil nodes. Stencils are kept inside bounded
+// axes, and wrap around periodic ones.
+
+std::int64_t StencilOf(const double aCoordinate, const Size aNodeCount, const bool isPeriodic, double* aWeightArray)
+{
+    std::int64_t firstIndex = static_cast<std::int64_t>(std::floor(aCoordinate)) - 1;
+
+    if (!isPeriodic)
+    {
+        firstIndex = std::clamp<std::int64_t>(firstIndex, 0, static_cast<std::int64_t>(aNodeCount) - 4);
+    }
+
+    LagrangeWeightsOf(aCoordinate - static_cast<double>(firstIndex), aWeightArray);
+
+    return firstIndex;
+}
+
+// Grid coordinate offset of the samples along an axis (0: radius, 1: latitude, 2: longitude), for samples at cell
+// midpoints along a given axis (0, 1, 2) or at cell centers (3)
+
+double MidpointOffsetOf(const Size aSampleAxis, const Size anAxis)
+{
+    return ((aSampleAxis == anAxis) || (aSampleAxis == 3)) ? 0.5 : 0.0;
+}
+
+}  // namespace
+
+struct FieldGrid::Nodes
+{
+    double minimumRadius;
+    double maximumRadius;
+    double errorBound;
+
+    Size radiusCount;
+    Size latitudeCount;
+    Size longitudeCount;
+
+    std::vector<double> values;  // [radius][latitude][longitude][x, y, z]
+
+    Vector3d positionOf(const double aRadiusIndex, const double aLatitudeIndex, const double aLongitudeIndex) const
+    {
+        const double radius =
+            minimumRadius + (maximumRadius - minimumRadius) * aRadiusIndex / static_cast<double>(radiusCount - 1);
+        const double latitude = -M_PI / 2.0 + M_PI * aLatitudeIndex / static_cast<double>(latitudeCount - 1);
+        const double longitude = 2.0 * M_PI * aLongitudeIndex / static_cast<double>(longitudeCount);
+
+        return {
+            radius * std::cos(latitude) * std::cos(longitude),
+            radius * std::cos(latitude) * std::sin(longitude),
+            radius * std::sin(latitude),
+        };
+    }
+
+    Vector3d valueAt(const Vector3d& aPosition) const
+    {
+        const double horizontalRadius = std::hypot(aPosition.x(), aPosition.y());
+
+        const double radius = std::hypot(horizontalRadius, aPosition.z());
+        const double latitude = std::atan2(aPosition.z(), horizontalRadius);
+        const double longitude = std::atan2(aPosition.y(), aPosition.x());
+
+        double radiusWeights[4];
+        double latitudeWeights[4];
+        double longitudeWeights[4];
+
+        const std::int64_t firstRadiusIndex = StencilOf(
+            (radius - minimumRadius) / (maximumRadius - minimumRadius) * static_cast<double>(radiusCount - 1),
+            radiusCount,
+            false,
+            radiusWeights
+        );
+        const std::int64_t firstLatitudeIndex = StencilOf(
+            (latitude + M_PI / 2.0) / M_PI * static_cast<double>(latitudeCount - 1),
+            latitudeCount,
+            false,
+            latitudeWeights
+        );
+        const std::int64_t firstLongitudeIndex = StencilOf(
+            ((longitude < 0.0) ? (longitude + 2.0 * M_PI) : longitude) / (2.0 * M_PI) *
+                static_cast<double>(longitudeCount),
+            longitudeCount,
+            true,
+            longitudeWeights
+        );
+
+        Size longitudeIndices[4];
+
+        for (Size c = 0; c < 4; ++c)
+        {
+            const std::int64_t count = static_cast<std::int64_t>(longitudeCount);
+
+            const std::int64_t index = (firstLongitudeIndex + static_cast<std::int64_t>(c)) % count;
+
+            longitudeIndices[c] = static_cast<Size>((index + count) % count);
+        }
+
+        double value[3] = {0.0, 0.0, 0.0};
+
+        for (Size a = 0; a < 4; ++a)
+        {
+            for (Size b = 0; b < 4; ++b)
+            {
+                const double weight = radiusWeights[a] * latitudeWeights[b];
+
+                const Size radiusIndex = static_cast<Size>(firstRadiusIndex) + a;
+                const Size latitudeIndex = static_cast<Size>(firstLatitudeIndex) + b;
+
+                const double* row = values.data() + (radiusIndex * latitudeCount + latitudeIndex) * longitudeCount * 3;
+
+                for (Size c = 0; c < 4; ++c)
+                {
+                    const double* node = row + longitudeIndices[c] * 3;
+
+                    const double nodeWeight = weight * longitudeWeights[c];
+
+                    value[0] += nodeWeight * node[0];
+                    value[1] += nodeWeight * node[1];
+                    value[2] += nodeWeight * node[2];
+                }
+            }
+        }
+
+        return {value[0], value[1], value[2]};
+    }
+};
+
+FieldGrid::FieldGrid(
+    const FieldFunction& aFieldFunction,
+    const Real& aMinimumRadius,
+    const Real& aMaximumRadius,
+    const Real& aTolerance,
+    const Size& aMemoryBudget
+)
+    : nodesSPtr_(nullptr)
+{
+    if (!aFieldFunction)
+    {
+        throw ostk::core::error::runtime::Undefined("Field function");
+    }
+
+    if (!aMinimumRadius.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Minimum radius");
+    }
+
+    if (!aMaximumRadius.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Maximum radius");
+    }
+
+    if (!aTolerance.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Tolerance");
+    }
+
+    if ((aMinimumRadius <= 0.0) || (aMaximumRadius <= aMinimumRadius))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Radii [{}, {}] are not valid.", aMinimumRadius.toString(), aMaximumRadius.toString()
+        );
+    }
+
+    if (aTolerance <= 0.0)
+    {
+        throw ostk::core::error::RuntimeError("Tolerance [{}] is not positive.", aTolerance.toString());
+    }
+
+    const double tolerance = static_cast<double>(aTolerance);
+
+    Nodes nodes = {
+        static_cast<double>(aMinimumRadius), static_cast<double>(aMaximumRadius), 0.0, 4, 9, 16, {}
+    };
+
+    std::minstd_rand generator {1};
+
+    while (true)
+    {
+        const Size nodeCount = nodes.radiusCount * nodes.latitudeCount * nodes.longitudeCount;
+        const Size memorySize = nodeCount * 3 * sizeof(double);
+
+        if (memorySize > aMemoryBudget)
+        {
+            throw ostk::core::error::RuntimeError(
+                "Field grid of [{}] B needed for tolerance [{}] exceeds memory budget [{}] B.",
+                memorySize,
+                aTolerance.toString(),
+                aMemoryBudget
+            );
+        }
+
+        // Nodes, one radius at a time
+
+        nodes.values.resize(nodeCount * 3);
+
+        for (Size i = 0; i < nodes.radiusCount; ++i)
+        {
+            Array<Vector3d> positions = Array<Vector3d>::Empty();
+            positions.reserve(nodes.latitudeCount * nodes.longitudeCount);
+
+            for (Size j = 0; j < nodes.latitudeCount; ++j)
+            {
+                for (Size k = 0; k < nodes.longitudeCount; ++k)
+                {
+                    positions.add(
+                        nodes.positionOf(static_cast<double>(i), static_cast<double>(j), static_cast<double>(k))
+                    );
+                }
+            }
+
+            const Array<Vector3d> fieldValues = aFieldFunction(positions);
+
+            if (fieldValues.getSize() != positions.getSize())
+            {
+                throw ostk::core::error::RuntimeError(
+                    "Field value count [{}] is not [{}].", fieldValues.getSize(), positions.getSize()
+                );
+            }
+
+            double* values = nodes.values.data() + i * nodes.latitudeCount * nodes.longitudeCount * 3;
+
+            for (Size index = 0; index < fieldValues.getSize(); ++index)
+            {
+                values[3 * index + 0] = fieldValues[index].x();
+                values[3 * index + 1] = fieldValues[index].y();
+                values[3 * index + 2] = fieldValues[index].z();
+            }
+        }
+
+        // Interpolation errors at midpoints along each axis, and at cell centers
+
+        Array<Vector3d> samplePositions = Array<Vector3d>::Empty();
+        samplePositions.reserve(4 * SampleCount);
+
+        for (Size axis = 0; axis < 4; ++axis)
+        {
+            std::uniform_int_distribution<Size> radiusIndices {0, nodes.radiusCount - 2};
+            std::uniform_int_distribution<Size> latitudeIndices {0, nodes.latitudeCount - 2};
+            std::uniform_int_distribution<Size> longitudeIndices {0, nodes.longitudeCount - 1};
+
+            for (Size sampleIndex = 0; sampleIndex < SampleCount; ++sampleIndex)
+            {
+                const double i = static_cast<double>(radiusIndices(generator)) + MidpointOffsetOf(axis, 0);
+                const double j = static_cast<double>(latitudeIndices(generator)) + MidpointOffsetOf(axis, 1);
+                const double k = static_cast<double>(longitudeIndices(generator)) + MidpointOffsetOf(axis, 2);
+
+                samplePositions.add(nodes.positionOf(i, j, k));
+            }
+        }
+
+        const Array<Vector3d> sampleFieldValues = aFieldFunction(samplePositions);
+
+        if (sampleFieldValues.getSize() != samplePositions.getSize())
+        {
+            throw ostk::core::error::RuntimeError(
+                "Field value count [{}] is not [{}].", sampleFieldValues.getSize(), samplePositions.getSize()
+            );
+        }
+
+        double errors[4] = {0.0, 0.0, 0.0, 0.0};  // Radius, latitude, longitude, all
+
+        for (Size index = 0; index < samplePositions.getSize(); ++index)
+        {
+            const double error = (nodes.valueAt(samplePositions[index]) - sampleFieldValues[index]).norm();
+
+            errors[index / SampleCount] = std::max(errors[index / SampleCount], error);
+        }
+
+        // Axis errors add up at cell centers: refine the axes above a third of the tolerance
+
+        const bool isWithinTolerance = ((errors[0] + errors[1] + errors[2]) <= tolerance) && (errors[3] <= tolerance);
+
+        if (isWithinTolerance)
+        {
+            nodes.errorBound = *std::max_element(errors, errors + 4);
+            break;
+        }
+
+        bool isRefined = false;
+
+        Size* nodeCounts[3] = {&nodes.radiusCount, &nodes.latitudeCount, &nodes.longitudeCount};
+
+        for (Size axis = 0; axis < 3; ++axis)
+        {
+            if (errors[axis] > (tolerance / 3.0))
+            {
+                *nodeCounts[axis] = (axis == 2) ? (2 * *nodeCounts[axis]) : (2 * *nodeCounts[axis] - 1);
+                isRefined = true;
+            }
+        }
+
+        if (!isRefined)
+        {
+            const Size axis = static_cast<Size>(std::max_element(errors, errors + 3) - errors);
+
+            *nodeCounts[axis] = (axis == 2) ? (2 * *nodeCounts[axis]) : (2 * *nodeCounts[axis] - 1);
+        }
+    }
+
+    nodesSPtr_ = std::make_shared<const Nodes>(std::move(nodes));
+}
+
+bool FieldGrid::isDefined() const
+{
+    return nodesSPtr_ != nullptr;
+}
+
+bool FieldGrid::contains(const Vector3d& aPosition) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Field grid");
+    }
+
+    const double radius = aPosition.norm();
+
+    return (radius >= nodesSPtr_->minimumRadius) && (radius <= nodesSPtr_->maximumRadius);
+}
+
+Real FieldGrid::getMinimumRadius() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Field grid");
+    }
+
+    return nodesSPtr_->minimumRadius;
+}
+
+Real FieldGrid::getMaximumRadius() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Field grid");
+    }
+
+    return nodesSPtr_->maximumRadius;
+}
+
+Real FieldGrid::getErrorBound() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Field grid");
+    }
+
+    return nodesSPtr_->errorBound;
+}
+
+Array<Size> FieldGrid::getNodeCounts() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Field grid");
+    }
+
+    return {nodesSPtr_->radiusCount, nodesSPtr_->latitudeCount, nodesSPtr_->longitudeCount};
+}
+
+Size FieldGrid::getMemorySize() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Field grid");
+    }
+
+    return nodesSPtr_->values.size() * sizeof(double);
+}
+
+Vector3d FieldGrid::getValueAt(const Vector3d& aPosition) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Field grid");
+    }
+
+    return nodesSPtr_->valueAt(aPosition);
+}
+
+void FieldGrid::save(const File& aFile) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Field grid");
+    }
+
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
+
+    // Signature, version, radii and error bound, node counts, then node values (native byte order)
+
+    std::ofstream fileStream {aFile.getPath().toString(), std::ios::binary | std::ios::trunc};
+
+    const double radiiAndErrorBound[3] = {
+        nodesSPtr_->minimumRadius, nodesSPtr_->maximumRadius, nodesSPtr_->errorBound
+    };
+    const std::uint64_t nodeCounts[3] = {
+        nodesSPtr_->radiusCount, nodesSPtr_->latitudeCount, nodesSPtr_->longitudeCount
+    };
+
+    fileStream.write(FileSignature, sizeof(FileSignature));
+    fileStream.write(reinterpret_cast<const char*>(&FileVersion), sizeof(FileVersion));
+    fileStream.write(reinterpret_cast<const char*>(radiiAndErrorBound), sizeof(radiiAndErrorBound));
+    fileStream.write(reinterpret_cast<const char*>(nodeCounts), sizeof(nodeCounts));
+    fileStream.write(
+        reinterpret_cast<const char*>(nodesSPtr_->values.data()),
+        static_cast<std::streamsize>(nodesSPtr_->values.size() * sizeof(double))
+    );
+
+    if (!fileStream)
+    {
+        throw ostk::core::error::RuntimeError("Cannot write field grid to [{}].", aFile.toString());
+    }
+}
+
+FieldGrid FieldGrid::Undefined()
+{
+    return {nullptr};
+}
+
+FieldGrid FieldGrid::Load(const File& aFile)
+{
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
+
+    if (!aFile.exists())
+    {
+        throw ostk::core::error::RuntimeError("File [{}] does not exist.", aFile.toString());
+    }
+
+    std::ifstream fileStream {aFile.getPath().toString(), std::ios::binary};
+
+    char signature[sizeof(FileSignature)];
+    std::uint32_t version = 0;
+    double radiiAndErrorBound[3];
+    std::uint64_t nodeCounts[3];
+
+    if ((!fileStream.read(signature, sizeof(signature))) ||
+        (std::memcmp(signature, FileSignature, sizeof(FileSignature)) != 0) ||
+        (!fileStream.read(reinterpret_cast<char*>(&version), sizeof(version))) || (version != FileVersion) ||
+        (!fileStream.read(reinterpret_cast<char*>(radiiAndErrorBound), sizeof(radiiAndErrorBound))) ||
+        (!fileStream.read(reinterpret_cast<char*>(nodeCounts), sizeof(nodeCounts))))
+    {
+        throw ostk::core::error::RuntimeError("File [{}] is not a field grid file.", aFile.toString());
+    }
+
+    if ((nodeCounts[0] < 4) || (nodeCounts[1] < 4) || (nodeCounts[2] < 4) ||
+        (!(radiiAndErrorBound[0] > 0.0)) || (!(radiiAndErrorBound[1] > radiiAndErrorBound[0])))
+    {
+        throw ostk::core::error::RuntimeError("Field grid file [{}] is not valid.", aFile.toString());
+    }
+
+    Nodes nodes = {
+        radiiAndErrorBound[0],
+        radiiAndErrorBound[1],
+        radiiAndErrorBound[2],
+        static_cast<Size>(nodeCounts[0]),
+        static_cast<Size>(nodeCounts[1]),
+        static_cast<Size>(nodeCounts[2]),
+        {}
+    };
+
+    nodes.values.resize(nodes.radiusCount * nodes.latitudeCount * nodes.longitudeCount * 3);
+
+    if (!fileStream.read(
+            reinterpret_cast<char*>(nodes.values.data()),
+            static_cast<std::streamsize>(nodes.values.size() * sizeof(double))
+        ))
+    {
+        throw ostk::core::error::RuntimeError("Cannot read field grid nodes from [{}].", aFile.toString());
+    }
+
+    return {std::make_shared<const Nodes>(std::move(nodes))};
+}
+
+FieldGrid::FieldGrid(const Shared<const Nodes>& aNodesSPtr)
+    : nodesSPtr_(aNodesSPtr)
+{
+}
+
+}  // namespace utilities
+}  // namespace environment
+}  // namespace physics
+}  // namespace ostk
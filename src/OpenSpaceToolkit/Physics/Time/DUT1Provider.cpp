@@ -0,0 +1,83 @@
+/// Apache License 2.0
+
+#include <atomic>
+#include <mutex>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/DUT1Provider.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace time
+{
+
+namespace
+{
+
+using ostk::core::container::Array;
+
+class Registry
+{
+   public:
+    Registry()
+        : mutex_(),
+          providers_(Array<Shared<const DUT1Provider>>::Empty()),
+          providerPtr_(nullptr)
+    {
+    }
+
+    const DUT1Provider* access() const
+    {
+        return providerPtr_.load(std::memory_order_acquire);
+    }
+
+    void set(const Shared<const DUT1Provider>& aDUT1ProviderSPtr)
+    {
+        const std::lock_guard<std::mutex> lock {mutex_};
+
+        providers_.add(aDUT1ProviderSPtr);
+
+        providerPtr_.store(aDUT1ProviderSPtr.get(), std::memory_order_release);
+    }
+
+   private:
+    std::mutex mutex_;
+    Array<Shared<const DUT1Provider>> providers_;
+    std::atomic<const DUT1Provider*> providerPtr_;
+};
+
+Registry& AccessRegistry()
+{
+    static Registry registry;
+
+    return registry;
+}
+
+}  // namespace
+
+DUT1Provider::DUT1Provider() {}
+
+DUT1Provider::~DUT1Provider() {}
+
+const DUT1Provider* DUT1Provider::Access()
+{
+    return AccessRegistry().access();
+}
+
+void DUT1Provider::Set(const Shared<const DUT1Provider>& aDUT1ProviderSPtr)
+{
+    if (aDUT1ProviderSPtr == nullptr)
+    {
+        throw ostk::core::error::runtime::Undefined("DUT1 provider");
+    }
+
+    AccessRegistry().set(aDUT1ProviderSPtr);
+}
+
+}  // namespace time
+}  // namespace physics
+}  // namespace ostk
@@ -1,15 +1,22 @@
 /// Apache License 2.0
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <functional>
 #include <iomanip>
+#include <limits>
 #include <stdlib.h>
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
-#include <OpenSpaceToolkit/Core/Container/Triple.hpp>
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Physics/Time/DUT1Provider.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/LeapSecondTable.hpp>
+
+#define OSTK_PHYSICS_TIME_INSTANT_DUT1_ITERATION_COUNT 4
 
 namespace ostk
 {
@@ -18,6 +25,51 @@ namespace physics
 namespace time
 {
 
+namespace
+{
+
+// Signed nanosecond count from epoch, saturated beyond the Int64 range (leap seconds are constant out there)
+
+template <class Count>
+Int64 SignedCount(const Count& aCount)
+{
+    static constexpr Uint64 maxCount = static_cast<Uint64>(std::numeric_limits<Int64>::max());
+
+    const Int64 count = static_cast<Int64>(std::min(aCount.countFromEpoch_, maxCount));
+
+    return aCount.postEpoch_ ? count : -count;
+}
+
+// Split a count from J2000 into a signed number of whole days and a nanosecond of day, days starting at an offset
+// from J2000 (noon for Julian Dates, midnight for Modified Julian Dates)
+
+template <class Count>
+Pair<Int64, Uint64> DayCountAndNanosecondOfDay(const Count& aCount, const Uint64 aDayStartOffset)
+{
+    static constexpr Uint64 dayInNanoseconds = 86400000000000;
+
+    Int64 dayCount = static_cast<Int64>(aCount.countFromEpoch_ / dayInNanoseconds);
+    Uint64 nanosecondOfDay = aCount.countFromEpoch_ % dayInNanoseconds;
+
+    if (!aCount.postEpoch_)
+    {
+        dayCount = (nanosecondOfDay != 0) ? (-dayCount - 1) : -dayCount;
+        nanosecondOfDay = (nanosecondOfDay != 0) ? (dayInNanoseconds - nanosecondOfDay) : 0;
+    }
+
+    nanosecondOfDay += aDayStartOffset;
+
+    if (nanosecondOfDay >= dayInNanoseconds)
+    {
+        dayCount += 1;
+        nanosecondOfDay -= dayInNanoseconds;
+    }
+
+    return {dayCount, nanosecondOfDay};
+}
+
+}  // namespace
+
 bool Instant::operator==(const Instant& anInstant) const
 {
     if ((!this->isDefined()) || (!anInstant.isDefined()))
@@ -200,6 +252,21 @@ bool Instant::isPostEpoch() const
     return (*this) >= Instant::J2000();
 }
 
+Size Instant::getRepresentationHash() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    Size hash = std::hash<Uint64> {}(count_.countFromEpoch_);
+
+    hash ^= std::hash<bool> {}(count_.postEpoch_) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    hash ^= std::hash<int> {}(static_cast<int>(scale_)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+
+    return hash;
+}
+
 bool Instant::isNear(const Instant& anInstant, const Duration& aTolerance) const
 {
     if (!anInstant.isDefined())
@@ -311,7 +378,9 @@ Real Instant::getJulianDate(const Scale& aTimeScale) const
         throw ostk::core::error::runtime::Undefined("Instant");
     }
 
-    return this->getDateTime(aTimeScale).getJulianDate();
+    const Pair<Real, Real> julianDateParts = this->getJulianDateParts(aTimeScale);
+
+    return julianDateParts.first + julianDateParts.second;
 }
 
 Real Instant::getModifiedJulianDate(const Scale& aTimeScale) const
@@ -326,7 +395,55 @@ Real Instant::getModifiedJulianDate(const Scale& aTimeScale) const
         throw ostk::core::error::runtime::Undefined("Instant");
     }
 
-    return this->getDateTime(aTimeScale).getModifiedJulianDate();
+    const Pair<Real, Real> modifiedJulianDateParts = this->getModifiedJulianDateParts(aTimeScale);
+
+    return modifiedJulianDateParts.first + modifiedJulianDateParts.second;
+}
+
+Pair<Real, Real> Instant::getJulianDateParts(const Scale& aTimeScale) const
+{
+    if (aTimeScale == Scale::Undefined)
+    {
+        throw ostk::core::error::runtime::Undefined("Scale");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    // J2000 is JD 2451545.0, Julian days start at noon
+
+    const Pair<Int64, Uint64> dayCountAndNanosecondOfDay =
+        DayCountAndNanosecondOfDay(this->inScale(aTimeScale).count_, 0);
+
+    return {
+        Real(static_cast<double>(2451545 + dayCountAndNanosecondOfDay.first)),
+        Real(static_cast<double>(dayCountAndNanosecondOfDay.second) / 86400e9)
+    };
+}
+
+Pair<Real, Real> Instant::getModifiedJulianDateParts(const Scale& aTimeScale) const
+{
+    if (aTimeScale == Scale::Undefined)
+    {
+        throw ostk::core::error::runtime::Undefined("Scale");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    // J2000 is MJD 51544.5, Modified Julian days start at midnight
+
+    const Pair<Int64, Uint64> dayCountAndNanosecondOfDay =
+        DayCountAndNanosecondOfDay(this->inScale(aTimeScale).count_, 43200000000000);
+
+    return {
+        Real(static_cast<double>(51544 + dayCountAndNanosecondOfDay.first)),
+        Real(static_cast<double>(dayCountAndNanosecondOfDay.second) / 86400e9)
+    };
 }
 
 Int64 Instant::getLeapSecondCount() const
@@ -544,6 +661,11 @@ Instant::Instant(const Instant::Count& aCount, const Scale& aTimeScale)
 
 Instant Instant::inScale(const Scale& aTimeScale) const
 {
+    if (scale_ == aTimeScale)
+    {
+        return *this;
+    }
+
     return Instant(Instant::ConvertCountScale(count_, scale_, aTimeScale), aTimeScale);
 }
 
@@ -551,6 +673,38 @@ Instant::Count Instant::ConvertCountScale(
     const Instant::Count& aCount, const Scale& anInputTimeScale, const Scale& anOutputTimeScale
 )
 {
+    using ostk::core::type::Size;
+
+    // Last conversion is cached per thread, as a given instant is usually converted to the same scale several times
+    // in a row (once per frame provider, ephemeris query, ...)
+
+    struct Cache
+    {
+        bool isDefined;
+        Scale inputTimeScale;
+        Scale outputTimeScale;
+        const LeapSecondTable* leapSecondTablePtr;
+        const DUT1Provider* dUT1ProviderPtr;
+        Size revision;
+        Instant::Count inputCount;
+        Instant::Count outputCount;
+    };
+
+    thread_local Cache cache = {false, Scale::Undefined, Scale::Undefined, nullptr, nullptr, 0, {0, true}, {0, true}};
+
+    const bool isUT1 = (anInputTimeScale == Scale::UT1) || (anOutputTimeScale == Scale::UT1);
+
+    const LeapSecondTable* leapSecondTablePtr = &LeapSecondTable::Access();
+    const DUT1Provider* dUT1ProviderPtr = isUT1 ? DUT1Provider::Access() : nullptr;
+    const Size revision = (dUT1ProviderPtr != nullptr) ? dUT1ProviderPtr->getRevision() : 0;
+
+    if (cache.isDefined && (cache.inputTimeScale == anInputTimeScale) && (cache.outputTimeScale == anOutputTimeScale) &&
+        (cache.leapSecondTablePtr == leapSecondTablePtr) && (cache.dUT1ProviderPtr == dUT1ProviderPtr) &&
+        (cache.revision == revision) && (cache.inputCount == aCount))
+    {
+        return cache.outputCount;
+    }
+
     Instant::Count count_TT = {0, true};
 
     switch (anInputTimeScale)
@@ -616,19 +770,25 @@ Instant::Count Instant::ConvertCountScale(
             break;
     }
 
+    Instant::Count outputCount = {0, true};
+
     switch (anOutputTimeScale)
     {
         case Scale::UTC:
-            return Instant::UTC_TAI(Instant::TAI_TT(count_TT));
+            outputCount = Instant::UTC_TAI(Instant::TAI_TT(count_TT));
+            break;
 
         case Scale::TT:
-            return count_TT;
+            outputCount = count_TT;
+            break;
 
         case Scale::TAI:
-            return Instant::TAI_TT(count_TT);
+            outputCount = Instant::TAI_TT(count_TT);
+            break;
 
         case Scale::UT1:
-            return Instant::UT1_UTC(Instant::UTC_TAI(Instant::TAI_TT(count_TT)));
+            outputCount = Instant::UT1_UTC(Instant::UTC_TAI(Instant::TAI_TT(count_TT)));
+            break;
 
         case Scale::TCG:
             throw ostk::core::error::runtime::ToBeImplemented("TCG");
@@ -647,7 +807,8 @@ Instant::Count Instant::ConvertCountScale(
             break;
 
         case Scale::GPST:
-            return Instant::GPST_TAI(Instant::TAI_TT(count_TT));
+            outputCount = Instant::GPST_TAI(Instant::TAI_TT(count_TT));
+            break;
 
         case Scale::GST:
             throw ostk::core::error::runtime::ToBeImplemented("GST");
@@ -674,7 +835,11 @@ Instant::Count Instant::ConvertCountScale(
             break;
     }
 
-    return Instant::Count(0, true);
+    cache = {
+        true, anInputTimeScale, anOutputTimeScale, leapSecondTablePtr, dUT1ProviderPtr, revision, aCount, outputCount
+    };
+
+    return outputCount;
 }
 
 Instant::Count Instant::UTC_TAI(const Instant::Count& aCount_TAI)
@@ -719,226 +884,85 @@ Instant::Count Instant::TAI_GPST(const Instant::Count& aCount_GPST)
 
 Int64 Instant::dAT_UTC(const Instant::Count& aCount_UTC)
 {
-    // [TBI] Implement dAT automatic manager
-
-    using ostk::core::container::Array;
-    using ostk::core::container::Triple;
-
-    if (aCount_UTC.postEpoch_)
-    {
-        static const Array<Triple<Uint64, Uint64, Int64>> dATMap = {
-            {536500800000000000, 999999999999999999, 37000000000
-            },  // December 2016    >   +Inf            : dAT =   37 [s]
-            {488980800000000000, 536500800000000000, 36000000000
-            },  // June 2015        >   December 2016   : dAT =   36 [s]
-            {394372800000000000, 488980800000000000, 35000000000
-            },  // June 2012        >   June 2015       : dAT =   35 [s]
-            {284040000000000000, 394372800000000000, 34000000000
-            },  // December 2008    >   June 2012       : dAT =   34 [s]
-            {189345600000000000, 284040000000000000, 33000000000
-            },  // December 2005    >   December 2008   : dAT =   33 [s]
-            {000000000000000000, 189345600000000000, 32000000000
-            }  // Epoch            >   December 2005   : dAT =   32 [s]
-        };
-
-        if (dATMap.accessFirst().first <= aCount_UTC.countFromEpoch_)
-        {
-            return dATMap.accessFirst().third;
-        }
-
-        for (const auto& dATIt : dATMap)
-        {
-            if ((dATIt.first <= aCount_UTC.countFromEpoch_) && (aCount_UTC.countFromEpoch_ < dATIt.second))
-            {
-                return dATIt.third;
-            }
-        }
-    }
-    else
-    {
-        static const Array<Triple<Uint64, Uint64, Int64>> dATMap = {
-            {000000000000000000, 31579200000000000, 32000000000
-            },  // Epoch            <   December 1998   : dAT =   32 [s]
-            {31579200000000000, 79012800000000000, 31000000000
-            },  // December 1998    <   June 1997       : dAT =   31 [s]
-            {79012800000000000, 126273600000000000, 30000000000
-            },  // June 1997        <   December 1995   : dAT =   30 [s]
-            {126273600000000000, 173707200000000000, 29000000000
-            },  // December 1995    <   June 1994       : dAT =   29 [s]
-            {173707200000000000, 205243200000000000, 28000000000
-            },  // June 1994        <   June 1993       : dAT =   28 [s]
-            {205243200000000000, 236779200000000000, 27000000000
-            },  // June 1993        <   June 1992       : dAT =   27 [s]
-            {236779200000000000, 284040000000000000, 26000000000
-            },  // June 1992        <   December 1990   : dAT =   26 [s]
-            {284040000000000000, 315576000000000000, 25000000000
-            },  // December 1990    <   December 1989   : dAT =   25 [s]
-            {315576000000000000, 378734400000000000, 24000000000
-            },  // December 1989    <   December 1987   : dAT =   24 [s]
-            {378734400000000000, 457704000000000000, 23000000000
-            },  // December 1987    <   June 1985       : dAT =   23 [s]
-            {457704000000000000, 520862400000000000, 22000000000
-            },  // June 1985        <   June 1983       : dAT =   22 [s]
-            {520862400000000000, 552398400000000000, 21000000000
-            },  // June 1983        <   June 1982       : dAT =   21 [s]
-            {552398400000000000, 583934400000000000, 20000000000
-            },  // June 1982        <   June 1981       : dAT =   20 [s]
-            {583934400000000000, 631195200000000000, 19000000000
-            },  // June 1981        <   December 1979   : dAT =   19 [s]
-            {631195200000000000, 662731200000000000, 18000000000
-            },  // December 1979    <   December 1978   : dAT =   18 [s]
-            {662731200000000000, 694267200000000000, 17000000000
-            },  // December 1978    <   December 1977   : dAT =   17 [s]
-            {694267200000000000, 725803200000000000, 16000000000
-            },  // December 1977    <   December 1976   : dAT =   16 [s]
-            {725803200000000000, 757425600000000000, 15000000000
-            },  // December 1976    <   December 1975   : dAT =   15 [s]
-            {757425600000000000, 788961600000000000, 14000000000
-            },  // December 1975    <   December 1974   : dAT =   14 [s]
-            {788961600000000000, 820497600000000000, 13000000000
-            },  // December 1974    <   December 1973   : dAT =   13 [s]
-            {820497600000000000, 852033600000000000, 12000000000
-            },  // December 1973    <   December 1972   : dAT =   12 [s]
-            {852033600000000000, 867931200000000000, 11000000000
-            },  // December 1972    <   June 1972       : dAT =   11 [s]
-            {867931200000000000, 999999999999999999, 10000000000
-            }  // June 1972        <   Start           : dAT =   10 [s]
-        };
-
-        for (const auto& dATIt : dATMap)
-        {
-            if ((dATIt.first < aCount_UTC.countFromEpoch_) && (aCount_UTC.countFromEpoch_ <= dATIt.second))
-            {
-                return dATIt.third;
-            }
-        }
-
-        throw ostk::core::error::RuntimeError("dAT out of bounds.");
-    }
-
-    return 0;
+    return LeapSecondTable::Access().getTAIMinusUTCAtUTC(SignedCount(aCount_UTC));  // dAT = TAI - UTC
 }
 
 Int64 Instant::dAT_TAI(const Instant::Count& aCount_TAI)
 {
-    // [TBI] Implement dAT automatic manager
-
-    using ostk::core::container::Array;
-    using ostk::core::container::Triple;
-
-    if (aCount_TAI.postEpoch_)
-    {
-        static const Array<Triple<Uint64, Uint64, Int64>> dATMap = {
-            {536500800000000000 + 36000000000, 999999999999999999 + 00000000000, 37000000000
-            },  // December 2016    >   +Inf            : dAT =   37 [s]
-            {488980800000000000 + 35000000000, 536500800000000000 + 36000000000, 36000000000
-            },  // June 2015        >   December 2016   : dAT =   36 [s]
-            {394372800000000000 + 34000000000, 488980800000000000 + 35000000000, 35000000000
-            },  // June 2012        >   June 2015       : dAT =   35 [s]
-            {284040000000000000 + 33000000000, 394372800000000000 + 34000000000, 34000000000
-            },  // December 2008    >   June 2012       : dAT =   34 [s]
-            {189345600000000000 + 32000000000, 284040000000000000 + 33000000000, 33000000000
-            },  // December 2005    >   December 2008   : dAT =   33 [s]
-            {000000000000000000 + 31000000000, 189345600000000000 + 32000000000, 32000000000
-            },  // Epoch - 31 [s]   >   December 2005   : dAT =   32 [s]
-            {000000000000000000 + 00000000000, 000000000000000000 + 31000000000, 32000000000
-            }  // Epoch            >   Epoch - 31 [s]  : dAT =   32 [s]
-        };
-
-        if (dATMap.accessFirst().first <= aCount_TAI.countFromEpoch_)
-        {
-            return dATMap.accessFirst().third;
-        }
+    return LeapSecondTable::Access().getTAIMinusUTCAtTAI(SignedCount(aCount_TAI));  // dAT = TAI - UTC
+}
 
-        for (const auto& dATIt : dATMap)
-        {
-            if ((dATIt.first <= aCount_TAI.countFromEpoch_) && (aCount_TAI.countFromEpoch_ < dATIt.second))
-            {
-                return dATIt.third;
-            }
-        }
-    }
-    else
+Int64 Instant::DUT1_UTC(const Instant::Count& aCount_UTC)
+{
+    using ostk::core::type::Size;
+
+    // UT1 - UTC from the active DUT1 provider (IERS bulletins by default)
+    // Last value is cached per thread, as a given instant is usually converted several times in a row
+
+    struct Cache
     {
-        static const Array<Triple<Uint64, Uint64, Int64>> dATMap = {
-            {000000000000000000 - 00000000000, 31579200000000000 - 31000000000, 32000000000
-            },  // Epoch            <   December 1998   : dAT =   32 [s]
-            {31579200000000000 - 31000000000, 79012800000000000 - 30000000000, 31000000000
-            },  // December 1998    <   June 1997       : dAT =   31 [s]
-            {79012800000000000 - 30000000000, 126273600000000000 - 29000000000, 30000000000
-            },  // June 1997        <   December 1995   : dAT =   30 [s]
-            {126273600000000000 - 29000000000, 173707200000000000 - 28000000000, 29000000000
-            },  // December 1995    <   June 1994       : dAT =   29 [s]
-            {173707200000000000 - 28000000000, 205243200000000000 - 27000000000, 28000000000
-            },  // June 1994        <   June 1993       : dAT =   28 [s]
-            {205243200000000000 - 27000000000, 236779200000000000 - 26000000000, 27000000000
-            },  // June 1993        <   June 1992       : dAT =   27 [s]
-            {236779200000000000 - 26000000000, 284040000000000000 - 25000000000, 26000000000
-            },  // June 1992        <   December 1990   : dAT =   26 [s]
-            {284040000000000000 - 25000000000, 315576000000000000 - 24000000000, 25000000000
-            },  // December 1990    <   December 1989   : dAT =   25 [s]
-            {315576000000000000 - 24000000000, 378734400000000000 - 23000000000, 24000000000
-            },  // December 1989    <   December 1987   : dAT =   24 [s]
-            {378734400000000000 - 23000000000, 457704000000000000 - 22000000000, 23000000000
-            },  // December 1987    <   June 1985       : dAT =   23 [s]
-            {457704000000000000 - 22000000000, 520862400000000000 - 21000000000, 22000000000
-            },  // June 1985        <   June 1983       : dAT =   22 [s]
-            {520862400000000000 - 21000000000, 552398400000000000 - 20000000000, 21000000000
-            },  // June 1983        <   June 1982       : dAT =   21 [s]
-            {552398400000000000 - 20000000000, 583934400000000000 - 19000000000, 20000000000
-            },  // June 1982        <   June 1981       : dAT =   20 [s]
-            {583934400000000000 - 19000000000, 631195200000000000 - 18000000000, 19000000000
-            },  // June 1981        <   December 1979   : dAT =   19 [s]
-            {631195200000000000 - 18000000000, 662731200000000000 - 17000000000, 18000000000
-            },  // December 1979    <   December 1978   : dAT =   18 [s]
-            {662731200000000000 - 17000000000, 694267200000000000 - 16000000000, 17000000000
-            },  // December 1978    <   December 1977   : dAT =   17 [s]
-            {694267200000000000 - 16000000000, 725803200000000000 - 15000000000, 16000000000
-            },  // December 1977    <   December 1976   : dAT =   16 [s]
-            {725803200000000000 - 15000000000, 757425600000000000 - 14000000000, 15000000000
-            },  // December 1976    <   December 1975   : dAT =   15 [s]
-            {757425600000000000 - 14000000000, 788961600000000000 - 13000000000, 14000000000
-            },  // December 1975    <   December 1974   : dAT =   14 [s]
-            {788961600000000000 - 13000000000, 820497600000000000 - 12000000000, 13000000000
-            },  // December 1974    <   December 1973   : dAT =   13 [s]
-            {820497600000000000 - 12000000000, 852033600000000000 - 11000000000, 12000000000
-            },  // December 1973    <   December 1972   : dAT =   12 [s]
-            {852033600000000000 - 11000000000, 867931200000000000 - 10000000000, 11000000000
-            },  // December 1972    <   June 1972       : dAT =   11 [s]
-            {867931200000000000 - 10000000000, 999999999999999999, 10000000000
-            }  // June 1972        <   Start           : dAT =   10 [s]
-        };
-
-        for (const auto& dATIt : dATMap)
-        {
-            if ((dATIt.first < aCount_TAI.countFromEpoch_) && (aCount_TAI.countFromEpoch_ <= dATIt.second))
-            {
-                return dATIt.third;
-            }
-        }
+        bool isDefined;
+        const DUT1Provider* dUT1ProviderPtr;
+        Size revision;
+        Instant::Count count_UTC;
+        Int64 dUT1;
+    };
+
+    thread_local Cache cache = {false, nullptr, 0, {0, true}, 0};
 
-        throw ostk::core::error::RuntimeError("dAT out of bounds.");
+    const DUT1Provider* dUT1ProviderPtr = DUT1Provider::Access();
+
+    if (dUT1ProviderPtr == nullptr)
+    {
+        throw ostk::core::error::runtime::Undefined("DUT1 provider");
     }
 
-    return 0;
-}
+    const Size revision = dUT1ProviderPtr->getRevision();
 
-Int64 Instant::DUT1_UTC(const Instant::Count& aCount_UTC)
-{
-    (void)aCount_UTC;
+    if (cache.isDefined && (cache.dUT1ProviderPtr == dUT1ProviderPtr) && (cache.revision == revision) &&
+        (cache.count_UTC == aCount_UTC))
+    {
+        return cache.dUT1;
+    }
+
+    const Instant instant_UTC = {aCount_UTC, Scale::UTC};
+
+    const Real ut1MinusUtc = dUT1ProviderPtr->getUt1MinusUtcAt(instant_UTC);
+
+    if (!ut1MinusUtc.isDefined())
+    {
+        throw ostk::core::error::RuntimeError("Cannot obtain UT1 - UTC at [{}].", instant_UTC.toString(Scale::UTC));
+    }
 
-    throw ostk::core::error::runtime::ToBeImplemented("DUT1_UTC");
+    const Int64 dUT1 = static_cast<Int64>(std::llround(static_cast<double>(ut1MinusUtc) * 1e9));
 
-    return 0;
+    cache = {true, dUT1ProviderPtr, revision, aCount_UTC, dUT1};
+
+    return dUT1;
 }
 
 Int64 Instant::DUT1_UT1(const Instant::Count& aCount_UT1)
 {
-    (void)aCount_UT1;
+    using ostk::core::type::Size;
+
+    // Solve UT1 = UTC + DUT1(UTC) for UTC by fixed-point iteration
+    // DUT1 drifts by a few ms per day: converges to the nanosecond in two iterations (except across leap seconds)
 
-    throw ostk::core::error::runtime::ToBeImplemented("DUT1_UT1");
+    Int64 dUT1 = Instant::DUT1_UTC(aCount_UT1);
+
+    for (Size iteration = 0; iteration < OSTK_PHYSICS_TIME_INSTANT_DUT1_ITERATION_COUNT; ++iteration)
+    {
+        const Int64 nextDUT1 = Instant::DUT1_UTC(aCount_UT1 - dUT1);
+
+        if (nextDUT1 == dUT1)
+        {
+            break;
+        }
+
+        dUT1 = nextDUT1;
+    }
 
-    return 0;
+    return dUT1;
 }
 
 Instant::Count::Count(Uint64 aNanosecondCountFromEpoch, bool isPostEpoch)
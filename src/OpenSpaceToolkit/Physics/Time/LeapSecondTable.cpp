@@ -0,0 +1,360 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <regex>
+#include <sstream>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/LeapSecondTable.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace time
+{
+
+namespace
+{
+
+// Number of days from 2000-01-01 of a proleptic Gregorian date
+// http://howardhinnant.github.io/date_algorithms.html#days_from_civil
+
+Int64 DaysFromJ2000Date(const Date& aDate)
+{
+    const Int64 month = aDate.getMonth();
+    const Int64 year = static_cast<Int64>(aDate.getYear()) - ((month <= 2) ? 1 : 0);
+    const Int64 era = (year >= 0 ? year : year - 399) / 400;
+    const Int64 yearOfEra = year - era * 400;
+    const Int64 dayOfYear = (153 * (month + ((month > 2) ? -3 : 9)) + 2) / 5 + aDate.getDay() - 1;
+    const Int64 dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+
+    return era * 146097 + dayOfEra - 719468 - 10957;  // 10957 days from 1970-01-01 to 2000-01-01
+}
+
+// [ns] UTC count from J2000 of 1970-01-01 00:00:00 UTC, before which TAI - UTC is not an integer number of seconds
+// and lookups are out of bounds
+
+const Int64 UTCLowerBound = -Int64(946728000) * 1000000000;
+
+class Registry
+{
+   public:
+    Registry()
+        : mutex_(),
+          tables_(),
+          tablePtr_(nullptr)
+    {
+        tables_.push_back(LeapSecondTable::Default());
+
+        tablePtr_.store(&tables_.back(), std::memory_order_release);
+    }
+
+    const LeapSecondTable& access() const
+    {
+        return *tablePtr_.load(std::memory_order_acquire);
+    }
+
+    void set(const LeapSecondTable& aLeapSecondTable)
+    {
+        const std::lock_guard<std::mutex> lock {mutex_};
+
+        tables_.push_back(aLeapSecondTable);  // std::deque does not invalidate references on push_back
+
+        tablePtr_.store(&tables_.back(), std::memory_order_release);
+    }
+
+   private:
+    std::mutex mutex_;
+    std::deque<LeapSecondTable> tables_;
+    std::atomic<const LeapSecondTable*> tablePtr_;
+};
+
+Registry& AccessRegistry()
+{
+    static Registry registry;
+
+    return registry;
+}
+
+}  // namespace
+
+LeapSecondTable::LeapSecondTable(const Array<Pair<Date, Integer>>& anEntryArray)
+    : dates_(Array<Date>::Empty()),
+      utcStarts_(),
+      taiStarts_(),
+      values_()
+{
+    for (const auto& entry : anEntryArray)
+    {
+        if ((!entry.first.isDefined()) || (!entry.second.isDefined()))
+        {
+            throw ostk::core::error::runtime::Undefined("Entry");
+        }
+
+        // Dates at 00:00:00 UTC, J2000 being 2000-01-01 12:00:00
+
+        const Int64 utcStart = (DaysFromJ2000Date(entry.first) * 86400 - 43200) * 1000000000;
+
+        if ((!utcStarts_.empty()) && (utcStart <= utcStarts_.back()))
+        {
+            throw ostk::core::error::runtime::Wrong("Entry array");
+        }
+
+        const Int64 value = static_cast<Int64>(static_cast<Integer::ValueType>(entry.second)) * 1000000000;
+
+        // A leap second starts in TAI when the previous TAI - UTC offset is reached
+
+        taiStarts_.push_back(utcStart + (values_.empty() ? value : values_.back()));
+
+        dates_.add(entry.first);
+        utcStarts_.push_back(utcStart);
+        values_.push_back(value);
+    }
+}
+
+bool LeapSecondTable::isDefined() const
+{
+    return !values_.empty();
+}
+
+Size LeapSecondTable::getSize() const
+{
+    return values_.size();
+}
+
+Date LeapSecondTable::getLastDate() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Leap second table");
+    }
+
+    return dates_.accessLast();
+}
+
+Int64 LeapSecondTable::getTAIMinusUTCAtUTC(const Int64& aNanosecondCountFromJ2000_UTC) const
+{
+    thread_local Size hintIndex = 0;
+
+    return LeapSecondTable::Lookup(utcStarts_, values_, aNanosecondCountFromJ2000_UTC, UTCLowerBound, hintIndex);
+}
+
+Int64 LeapSecondTable::getTAIMinusUTCAtTAI(const Int64& aNanosecondCountFromJ2000_TAI) const
+{
+    thread_local Size hintIndex = 0;
+
+    // TAI - UTC is that of the first entry at the lower bound
+
+    const Int64 lowerBound = values_.empty() ? UTCLowerBound : (UTCLowerBound + values_.front());
+
+    return LeapSecondTable::Lookup(taiStarts_, values_, aNanosecondCountFromJ2000_TAI, lowerBound, hintIndex);
+}
+
+LeapSecondTable LeapSecondTable::Undefined()
+{
+    return {Array<Pair<Date, Integer>>::Empty()};
+}
+
+LeapSecondTable LeapSecondTable::BuiltIn()
+{
+    return {{
+        {Date(1972, 1, 1), 10}, {Date(1972, 7, 1), 11}, {Date(1973, 1, 1), 12}, {Date(1974, 1, 1), 13},
+        {Date(1975, 1, 1), 14}, {Date(1976, 1, 1), 15}, {Date(1977, 1, 1), 16}, {Date(1978, 1, 1), 17},
+        {Date(1979, 1, 1), 18}, {Date(1980, 1, 1), 19}, {Date(1981, 7, 1), 20}, {Date(1982, 7, 1), 21},
+        {Date(1983, 7, 1), 22}, {Date(1985, 7, 1), 23}, {Date(1988, 1, 1), 24}, {Date(1990, 1, 1), 25},
+        {Date(1991, 1, 1), 26}, {Date(1992, 7, 1), 27}, {Date(1993, 7, 1), 28}, {Date(1994, 7, 1), 29},
+        {Date(1996, 1, 1), 30}, {Date(1997, 7, 1), 31}, {Date(1999, 1, 1), 32}, {Date(2006, 1, 1), 33},
+        {Date(2009, 1, 1), 34}, {Date(2012, 7, 1), 35}, {Date(2015, 7, 1), 36}, {Date(2017, 1, 1), 37},
+    }};
+}
+
+LeapSecondTable LeapSecondTable::Load(const File& aFile)
+{
+    using ostk::core::type::String;
+    using ostk::core::type::Uint8;
+    using ostk::core::type::Uint16;
+
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
+
+    if (!aFile.exists())
+    {
+        throw ostk::core::error::RuntimeError("File [{}] does not exist.", aFile.toString());
+    }
+
+    std::ifstream fileStream {aFile.getPath().toString()};
+
+    std::stringstream contentStream;
+    contentStream << fileStream.rdbuf();
+
+    const std::string content = contentStream.str();
+
+    // DELTET/DELTA_AT = ( 10, @1972-JAN-1
+    //                     11, @1972-JUL-1
+    //                     ... )
+
+    const std::size_t keyPosition = content.find("DELTET/DELTA_AT");
+    const std::size_t beginPosition =
+        (keyPosition != std::string::npos) ? content.find('(', keyPosition) : std::string::npos;
+    const std::size_t endPosition =
+        (beginPosition != std::string::npos) ? content.find(')', beginPosition) : std::string::npos;
+
+    if (endPosition == std::string::npos)
+    {
+        throw ostk::core::error::RuntimeError("Cannot find DELTET/DELTA_AT in [{}].", aFile.toString());
+    }
+
+    static const std::regex entryRegex {R"((-?\d+)\s*,\s*@(\d{4})-([A-Za-z]{3})-(\d{1,2}))"};
+
+    static const Array<String> monthNames = {
+        "JAN", "FEB", "MAR", "APR", "MAY", "JUN", "JUL", "AUG", "SEP", "OCT", "NOV", "DEC"
+    };
+
+    Array<Pair<Date, Integer>> entries = Array<Pair<Date, Integer>>::Empty();
+
+    const auto begin = content.cbegin() + beginPosition;
+    const auto end = content.cbegin() + endPosition;
+
+    for (std::sregex_iterator matchIt {begin, end, entryRegex}; matchIt != std::sregex_iterator(); ++matchIt)
+    {
+        const std::smatch& match = *matchIt;
+
+        String monthName = match[3].str();
+        std::transform(monthName.begin(), monthName.end(), monthName.begin(), ::toupper);
+
+        const auto monthIt = std::find(monthNames.begin(), monthNames.end(), monthName);
+
+        if (monthIt == monthNames.end())
+        {
+            throw ostk::core::error::RuntimeError("Cannot parse month [{}] in [{}].", monthName, aFile.toString());
+        }
+
+        const Date date(
+            static_cast<Uint16>(std::stoi(match[2].str())),
+            static_cast<Uint8>(std::distance(monthNames.begin(), monthIt) + 1),
+            static_cast<Uint8>(std::stoi(match[4].str()))
+        );
+
+        entries.add({date, Integer(std::stoi(match[1].str()))});
+    }
+
+    if (entries.isEmpty())
+    {
+        throw ostk::core::error::RuntimeError("Cannot load leap seconds from [{}].", aFile.toString());
+    }
+
+    return {entries};
+}
+
+LeapSecondTable LeapSecondTable::Default()
+{
+    LeapSecondTable table = LeapSecondTable::BuiltIn();
+
+    const File file = LeapSecondTable::DefaultFile();
+
+    if (file.isDefined() && file.exists())
+    {
+        const LeapSecondTable fileTable = LeapSecondTable::Load(file);
+
+        // Leap seconds are only ever added: a kernel with fewer entries than the built-in table is outdated
+
+        if (fileTable.getSize() > table.getSize())
+        {
+            table = fileTable;
+        }
+    }
+
+    return table;
+}
+
+const LeapSecondTable& LeapSecondTable::Access()
+{
+    return AccessRegistry().access();
+}
+
+void LeapSecondTable::Set(const LeapSecondTable& aLeapSecondTable)
+{
+    if (!aLeapSecondTable.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Leap second table");
+    }
+
+    AccessRegistry().set(aLeapSecondTable);
+}
+
+File LeapSecondTable::DefaultFile()
+{
+    using ostk::core::filesystem::Path;
+
+    if (const char* filePath = std::getenv("OSTK_PHYSICS_TIME_LEAP_SECOND_TABLE_FILE"))
+    {
+        return File::Path(Path::Parse(filePath));
+    }
+
+    static const ostk::core::type::String defaultFilePath = OSTK_PHYSICS_TIME_LEAP_SECOND_TABLE_FILE;
+
+    if (!defaultFilePath.isEmpty())
+    {
+        return File::Path(Path::Parse(defaultFilePath));
+    }
+
+    return File::Undefined();
+}
+
+Int64 LeapSecondTable::Lookup(
+    const std::vector<Int64>& aStartArray,
+    const std::vector<Int64>& aValueArray,
+    const Int64& aNanosecondCount,
+    const Int64& aLowerBound,
+    Size& aHintIndex
+)
+{
+    const Size size = aStartArray.size();
+
+    if (size == 0)
+    {
+        throw ostk::core::error::runtime::Undefined("Leap second table");
+    }
+
+    // Entry k applies over [start k, start k + 1), the first one back to the lower bound and the last one up to +Inf
+
+    if (aNanosecondCount < aLowerBound)
+    {
+        throw ostk::core::error::RuntimeError("TAI - UTC out of bounds.");
+    }
+
+    if (aHintIndex < size)
+    {
+        const bool isAfterStart = (aHintIndex == 0) || (aStartArray[aHintIndex] <= aNanosecondCount);
+        const bool isBeforeEnd = ((aHintIndex + 1) == size) || (aNanosecondCount < aStartArray[aHintIndex + 1]);
+
+        if (isAfterStart && isBeforeEnd)
+        {
+            return aValueArray[aHintIndex];
+        }
+    }
+
+    const auto startIt = std::upper_bound(aStartArray.begin(), aStartArray.end(), aNanosecondCount);
+
+    aHintIndex =
+        (startIt == aStartArray.begin()) ? 0 : static_cast<Size>(std::distance(aStartArray.begin(), startIt) - 1);
+
+    return aValueArray[aHintIndex];
+}
+
+}  // namespace time
+}  // namespace physics
+}  // namespace ostk
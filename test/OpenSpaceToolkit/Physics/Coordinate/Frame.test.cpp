@@ -12,8 +12,10 @@
 namespace iau = ostk::physics::coordinate::frame::provider::iau;
 
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::Real;
 using ostk::core::type::String;
+using ostk::core::container::Array;
 
 using ostk::mathematics::object::Vector3d;
 using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
@@ -25,6 +27,7 @@ using ostk::physics::unit::Length;
 using ostk::physics::time::Scale;
 using ostk::physics::time::Instant;
 using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
 using ostk::physics::coordinate::Transform;
 using ostk::physics::coordinate::Frame;
 using ostk::physics::coordinate::Position;
@@ -375,6 +378,27 @@ TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame, GetName)
     }
 }
 
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame, GetId)
+{
+    {
+        EXPECT_EQ(Frame::GCRF()->getId(), Frame::GCRF()->getId());
+        EXPECT_NE(Frame::GCRF()->getId(), Frame::ITRF()->getId());
+        EXPECT_NE(customFrameSPtr_->getId(), Frame::GCRF()->getId());
+    }
+
+    {
+        const Size id = Frame::Construct("Other", true, Frame::GCRF(), Frame::GCRF()->accessProvider())->getId();
+
+        Frame::Destruct("Other");
+
+        // Identifiers are never reused, even for a frame constructed with the same name
+
+        EXPECT_NE(id, Frame::Construct("Other", true, Frame::GCRF(), Frame::GCRF()->accessProvider())->getId());
+
+        Frame::Destruct("Other");
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame, GetOriginIn)
 {
     {
@@ -622,6 +646,57 @@ TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame, GetTransformTo)
     }
 }
 
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame, GetTransformsTo)
+{
+    {
+        const Array<Instant> instants = {Instant::J2000(), Instant::J2000() + Duration::Hours(1.0)};
+
+        const Array<Transform> transforms = Frame::GCRF()->getTransformsTo(Frame::GCRF(), instants);
+
+        EXPECT_EQ(2, transforms.getSize());
+
+        for (const Transform& transform : transforms)
+        {
+            EXPECT_TRUE(transform.isIdentity());
+        }
+    }
+
+    {
+        const Shared<const Frame> temeSPtr = Frame::TEME();
+        const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+
+        Array<Instant> instants = Array<Instant>::Empty();
+
+        for (Size index = 0; index < 100; ++index)
+        {
+            instants.add(Instant::J2000() + Duration::Minutes(static_cast<double>(index)));
+        }
+
+        for (const Size threadCount : {1, 4})
+        {
+            const Array<Transform> transforms = temeSPtr->getTransformsTo(gcrfSPtr, instants, threadCount);
+
+            ASSERT_EQ(instants.getSize(), transforms.getSize());
+
+            for (Size index = 0; index < instants.getSize(); ++index)
+            {
+                EXPECT_EQ(instants[index], transforms[index].getInstant());
+                EXPECT_EQ(temeSPtr->getTransformTo(gcrfSPtr, instants[index]), transforms[index]);
+            }
+        }
+    }
+
+    {
+        EXPECT_TRUE(Frame::GCRF()->getTransformsTo(Frame::ITRF(), Array<Instant>::Empty()).isEmpty());
+    }
+
+    {
+        EXPECT_ANY_THROW(Frame::Undefined()->getTransformsTo(Frame::GCRF(), {Instant::J2000()}));
+        EXPECT_ANY_THROW(Frame::GCRF()->getTransformsTo(Frame::Undefined(), {Instant::J2000()}));
+        EXPECT_ANY_THROW(Frame::GCRF()->getTransformsTo(Frame::ITRF(), {Instant::J2000(), Instant::Undefined()}));
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame, Undefined)
 {
     {
@@ -0,0 +1,333 @@
+/// Apache License 2.0
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Manager.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+using ostk::core::container::Array;
+
+using ostk::physics::time::Instant;
+using ostk::physics::time::Duration;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::frame::Manager;
+
+class OpenSpaceToolkit_Physics_Coordinate_Frame_Manager : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        manager_.setTransformCacheEnabled(true);
+        manager_.setTransformCacheCapacity(Manager::DefaultTransformCacheCapacity());
+        manager_.setTransformCacheByteBudget(Manager::DefaultTransformCacheByteBudget());
+        manager_.clearTransformCache();
+    }
+
+    void TearDown() override
+    {
+        manager_.setTransformCacheEnabled(true);
+        manager_.setTransformCacheCapacity(Manager::DefaultTransformCacheCapacity());
+        manager_.setTransformCacheByteBudget(Manager::DefaultTransformCacheByteBudget());
+        manager_.clearTransformCache();
+    }
+
+    Manager& manager_ = Manager::Get();
+};
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Manager, AccessProviderChain)
+{
+    {
+        const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+        const Shared<const Frame> itrfSPtr = Frame::ITRF();
+
+        gcrfSPtr->getTransformTo(itrfSPtr, Instant::J2000());
+
+        const Shared<const Manager::ProviderChain> providerChainSPtr =
+            manager_.accessProviderChain(gcrfSPtr, itrfSPtr);
+
+        ASSERT_NE(nullptr, providerChainSPtr);
+
+        EXPECT_TRUE(providerChainSPtr->originProviders.isEmpty());
+        EXPECT_EQ(3, providerChainSPtr->destinationProviders.getSize());
+        EXPECT_EQ(itrfSPtr->accessProvider(), providerChainSPtr->destinationProviders[0]);
+        EXPECT_EQ(Frame::TIRF()->accessProvider(), providerChainSPtr->destinationProviders[1]);
+        EXPECT_EQ(Frame::CIRF()->accessProvider(), providerChainSPtr->destinationProviders[2]);
+    }
+
+    {
+        const Shared<const Frame> customFrameSPtr =
+            Frame::Construct("Custom", true, Frame::GCRF(), Frame::GCRF()->accessProvider());
+
+        customFrameSPtr->getTransformTo(Frame::ITRF(), Instant::J2000());
+
+        EXPECT_NE(nullptr, manager_.accessProviderChain(customFrameSPtr, Frame::ITRF()));
+
+        Frame::Destruct("Custom");
+
+        // Frame still referenced after removal from the registry: its chain stays valid
+
+        EXPECT_NE(nullptr, manager_.accessProviderChain(customFrameSPtr, Frame::ITRF()));
+    }
+
+    {
+        Shared<const Frame> customFrameSPtr =
+            Frame::Construct("Custom", true, Frame::GCRF(), Frame::GCRF()->accessProvider());
+
+        customFrameSPtr->getTransformTo(Frame::TEME(), Instant::J2000());
+
+        const std::weak_ptr<const Manager::ProviderChain> providerChainWPtr =
+            manager_.accessProviderChain(customFrameSPtr, Frame::TEME());
+
+        EXPECT_FALSE(providerChainWPtr.expired());
+
+        Frame::Destruct("Custom");
+        customFrameSPtr.reset();
+
+        // Chains of destructed frames are pruned once another chain is memoized
+
+        EXPECT_FALSE(providerChainWPtr.expired());
+
+        const Shared<const Frame> otherFrameSPtr =
+            Frame::Construct("Other", true, Frame::GCRF(), Frame::GCRF()->accessProvider());
+
+        otherFrameSPtr->getTransformTo(Frame::TEME(), Instant::J2000());
+
+        EXPECT_TRUE(providerChainWPtr.expired());
+
+        Frame::Destruct("Other");
+    }
+
+    {
+        Shared<const Frame> customFrameSPtr =
+            Frame::Construct("Custom", true, Frame::GCRF(), Frame::GCRF()->accessProvider());
+
+        Frame::Destruct("Custom");
+
+        // Frame still referenced after removal from the registry: chain and transform are memoized again
+
+        const Transform transform = customFrameSPtr->getTransformTo(Frame::ITRF(), Instant::J2000());
+
+        EXPECT_FALSE(transform.isIdentity());
+        EXPECT_NE(nullptr, manager_.accessProviderChain(customFrameSPtr, Frame::ITRF()));
+
+        customFrameSPtr.reset();
+
+        // A new frame, possibly allocated at the same address, does not inherit them
+
+        const Shared<const Frame> otherFrameSPtr =
+            Frame::Construct("Custom", true, Frame::ITRF(), Frame::GCRF()->accessProvider());
+
+        EXPECT_EQ(nullptr, manager_.accessProviderChain(otherFrameSPtr, Frame::ITRF()));
+        EXPECT_TRUE(otherFrameSPtr->getTransformTo(Frame::ITRF(), Instant::J2000()).isIdentity());
+
+        Frame::Destruct("Custom");
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Manager, GetCachedTransform)
+{
+    {
+        const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+        const Shared<const Frame> itrfSPtr = Frame::ITRF();
+
+        const Instant instant = Instant::J2000();
+
+        EXPECT_FALSE(manager_.getCachedTransform(gcrfSPtr, itrfSPtr, instant).isDefined());
+        EXPECT_EQ(1, manager_.getTransformCacheMissCount());
+
+        const Transform transform = gcrfSPtr->getTransformTo(itrfSPtr, instant);
+
+        const Transform cachedTransform = manager_.getCachedTransform(gcrfSPtr, itrfSPtr, instant);
+
+        EXPECT_TRUE(cachedTransform.isDefined());
+        EXPECT_EQ(transform, cachedTransform);
+        EXPECT_EQ(1, manager_.getTransformCacheHitCount());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Manager, TransformCacheEviction)
+{
+    {
+        const Size capacity = 10;
+
+        manager_.setTransformCacheCapacity(capacity);
+
+        EXPECT_EQ(capacity, manager_.getTransformCacheCapacity());
+
+        const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+        const Shared<const Frame> itrfSPtr = Frame::ITRF();
+
+        for (Size index = 0; index < 3 * capacity; ++index)
+        {
+            gcrfSPtr->getTransformTo(itrfSPtr, Instant::J2000() + Duration::Seconds(static_cast<double>(index)));
+        }
+
+        EXPECT_GE(capacity, manager_.getTransformCacheSize());
+        EXPECT_LT(0, manager_.getTransformCacheSize());
+        EXPECT_EQ(3 * capacity, manager_.getTransformCacheSize() + manager_.getTransformCacheEvictionCount());
+
+        const Instant lastInstant = Instant::J2000() + Duration::Seconds(static_cast<double>(3 * capacity - 1));
+
+        EXPECT_TRUE(manager_.getCachedTransform(gcrfSPtr, itrfSPtr, lastInstant).isDefined());
+    }
+
+    {
+        manager_.setTransformCacheByteBudget(4 * Manager::TransformCacheEntryByteSize());
+
+        EXPECT_EQ(0, manager_.getTransformCacheSize());
+
+        const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+        const Shared<const Frame> itrfSPtr = Frame::ITRF();
+
+        for (Size index = 0; index < 10; ++index)
+        {
+            gcrfSPtr->getTransformTo(itrfSPtr, Instant::J2000() + Duration::Seconds(static_cast<double>(index)));
+        }
+
+        EXPECT_GE(4, manager_.getTransformCacheSize());
+    }
+
+    {
+        manager_.setTransformCacheByteBudget(Manager::DefaultTransformCacheByteBudget());
+        manager_.setTransformCacheCapacity(6400);
+        manager_.clearTransformCache();
+
+        const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+        const Shared<const Frame> itrfSPtr = Frame::ITRF();
+
+        for (Size index = 0; index < 1000; ++index)
+        {
+            gcrfSPtr->getTransformTo(itrfSPtr, Instant::J2000() + Duration::Seconds(static_cast<double>(index)));
+        }
+
+        EXPECT_EQ(1000, manager_.getTransformCacheSize());
+
+        // Shrinking the capacity evicts down to it, without flushing the cache
+
+        manager_.setTransformCacheCapacity(640);
+
+        EXPECT_GE(640, manager_.getTransformCacheSize());
+        EXPECT_LT(0, manager_.getTransformCacheSize());
+        EXPECT_EQ(1000, manager_.getTransformCacheSize() + manager_.getTransformCacheEvictionCount());
+
+        for (Size index = 0; index < 1000; ++index)
+        {
+            const Instant instant = Instant::J2000() + Duration::Seconds(static_cast<double>(index));
+
+            const Transform cachedTransform = manager_.getCachedTransform(gcrfSPtr, itrfSPtr, instant);
+
+            if (cachedTransform.isDefined())
+            {
+                EXPECT_EQ(gcrfSPtr->getTransformsTo(itrfSPtr, {instant})[0], cachedTransform);
+            }
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Manager, ConcurrentAccess)
+{
+    {
+        const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+        const Shared<const Frame> itrfSPtr = Frame::ITRF();
+
+        const Size instantCount = 100;
+        const Size threadCount = 8;
+
+        Array<Transform> referenceTransforms = Array<Transform>::Empty();
+
+        for (Size index = 0; index < instantCount; ++index)
+        {
+            referenceTransforms.add(
+                gcrfSPtr->getTransformTo(itrfSPtr, Instant::J2000() + Duration::Minutes(static_cast<double>(index)))
+            );
+        }
+
+        manager_.setTransformCacheCapacity(instantCount / 2);
+
+        std::atomic<Size> mismatchCount {0};
+
+        Array<std::thread> threads = Array<std::thread>::Empty();
+
+        for (Size threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.add(std::thread(
+                [&, threadIndex]() -> void
+                {
+                    for (Size iteration = 0; iteration < 10 * instantCount; ++iteration)
+                    {
+                        const Size index = (iteration * (threadIndex + 1)) % instantCount;
+
+                        const Transform transform = Frame::GCRF()->getTransformTo(
+                            Frame::ITRF(), Instant::J2000() + Duration::Minutes(static_cast<double>(index))
+                        );
+
+                        if (transform != referenceTransforms[index])
+                        {
+                            mismatchCount++;
+                        }
+                    }
+                }
+            ));
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(0, mismatchCount.load());
+        EXPECT_GE(instantCount / 2, manager_.getTransformCacheSize());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Manager, SetTransformCacheEnabled)
+{
+    {
+        const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+        const Shared<const Frame> itrfSPtr = Frame::ITRF();
+
+        gcrfSPtr->getTransformTo(itrfSPtr, Instant::J2000());
+
+        EXPECT_EQ(1, manager_.getTransformCacheSize());
+
+        manager_.setTransformCacheEnabled(false);
+
+        EXPECT_FALSE(manager_.isTransformCacheEnabled());
+        EXPECT_EQ(0, manager_.getTransformCacheSize());
+
+        gcrfSPtr->getTransformTo(itrfSPtr, Instant::J2000());
+
+        EXPECT_EQ(0, manager_.getTransformCacheSize());
+        EXPECT_FALSE(manager_.getCachedTransform(gcrfSPtr, itrfSPtr, Instant::J2000()).isDefined());
+
+        manager_.setTransformCacheEnabled(true);
+
+        EXPECT_TRUE(manager_.isTransformCacheEnabled());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Manager, ClearTransformCache)
+{
+    {
+        Frame::GCRF()->getTransformTo(Frame::ITRF(), Instant::J2000());
+
+        EXPECT_EQ(1, manager_.getTransformCacheSize());
+
+        manager_.clearTransformCache();
+
+        EXPECT_EQ(0, manager_.getTransformCacheSize());
+        EXPECT_EQ(0, manager_.getTransformCacheHitCount());
+        EXPECT_EQ(0, manager_.getTransformCacheMissCount());
+        EXPECT_EQ(0, manager_.getTransformCacheEvictionCount());
+    }
+}
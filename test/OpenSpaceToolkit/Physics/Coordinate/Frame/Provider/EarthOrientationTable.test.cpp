@@ -0,0 +1,157 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/CIRF.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/EarthOrientationTable.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/Manager.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/ITRF.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+
+using ostk::mathematics::object::Vector2d;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::unit::Angle;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Interval;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::coordinate::frame::provider::EarthOrientationTable;
+using ostk::physics::coordinate::frame::provider::CIRF;
+using ostk::physics::coordinate::frame::provider::ITRF;
+
+using IersManager = ostk::physics::coordinate::frame::provider::iers::Manager;
+
+class OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_EarthOrientationTable : public ::testing::Test
+{
+   protected:
+    const Interval interval_ = Interval::Closed(Instant::J2000(), Instant::J2000() + Duration::Days(10.0));
+};
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_EarthOrientationTable, Constructor)
+{
+    {
+        EXPECT_NO_THROW(EarthOrientationTable(interval_, Duration::Days(1.0)));
+        EXPECT_NO_THROW(
+            EarthOrientationTable(interval_, Duration::Days(1.0), EarthOrientationTable::Interpolation::Hermite)
+        );
+    }
+
+    {
+        EXPECT_ANY_THROW(EarthOrientationTable(interval_, Duration::Zero()));
+        EXPECT_ANY_THROW(EarthOrientationTable(interval_, Duration::Days(-1.0)));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_EarthOrientationTable, IsDefined)
+{
+    {
+        EXPECT_TRUE(EarthOrientationTable(interval_, Duration::Days(1.0)).isDefined());
+    }
+
+    {
+        EXPECT_FALSE(EarthOrientationTable::Undefined().isDefined());
+        EXPECT_FALSE(EarthOrientationTable(Interval::Undefined(), Duration::Days(1.0)).isDefined());
+        EXPECT_FALSE(EarthOrientationTable(interval_, Duration::Undefined()).isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_EarthOrientationTable, Covers)
+{
+    {
+        const EarthOrientationTable table = {interval_, Duration::Days(1.0)};
+
+        EXPECT_TRUE(table.covers(interval_.accessStart()));
+        EXPECT_TRUE(table.covers(interval_.accessEnd()));
+        EXPECT_TRUE(table.covers(interval_.getCenter()));
+
+        EXPECT_FALSE(table.covers(interval_.accessStart() - Duration::Seconds(1.0)));
+        EXPECT_FALSE(table.covers(interval_.accessEnd() + Duration::Seconds(1.0)));
+    }
+
+    {
+        EXPECT_ANY_THROW(EarthOrientationTable::Undefined().covers(Instant::J2000()));
+        EXPECT_ANY_THROW(EarthOrientationTable(interval_, Duration::Days(1.0)).covers(Instant::Undefined()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_EarthOrientationTable, GetCipCoordinatesAt)
+{
+    for (const auto interpolation :
+         {EarthOrientationTable::Interpolation::Hermite, EarthOrientationTable::Interpolation::Chebyshev})
+    {
+        const EarthOrientationTable table = {interval_, Duration::Days(1.0), interpolation};
+
+        const Real tolerance =
+            (interpolation == EarthOrientationTable::Interpolation::Hermite) ? 1e-9 : 1e-11;  // [rad]
+
+        EXPECT_GT(tolerance, table.getCipAccuracy());
+
+        const Shared<const CIRF> interpolatedProviderSPtr =
+            std::make_shared<const CIRF>(std::make_shared<const EarthOrientationTable>(table));
+
+        for (Instant instant = interval_.accessStart(); instant <= interval_.accessEnd();
+             instant += Duration::Hours(7.0))
+        {
+            const Transform exactTransform = CIRF().getTransformAt(instant);
+            const Transform interpolatedTransform = interpolatedProviderSPtr->getTransformAt(instant);
+
+            EXPECT_TRUE(interpolatedTransform.getOrientation().isNear(
+                exactTransform.getOrientation(), Angle::Radians(2.0 * tolerance)
+            )) << EarthOrientationTable::StringFromInterpolation(interpolation) << " @ " << instant.toString();
+        }
+    }
+
+    {
+        const EarthOrientationTable table = {interval_, Duration::Days(1.0)};
+
+        EXPECT_ANY_THROW(table.getCipCoordinatesAt(interval_.accessEnd() + Duration::Days(1.0)));
+        EXPECT_ANY_THROW(EarthOrientationTable::Undefined().getCipCoordinatesAt(Instant::J2000()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_EarthOrientationTable, GetPolarMotionAt)
+{
+    {
+        const EarthOrientationTable table = {interval_, Duration::Days(1.0)};
+
+        for (Instant instant = interval_.accessStart(); instant <= interval_.accessEnd();
+             instant += Duration::Hours(7.0))
+        {
+            const Vector2d polarMotion = IersManager::Get().getPolarMotionAt(instant);
+
+            EXPECT_TRUE(table.getPolarMotionAt(instant).isNear(polarMotion, 1e-4)) << instant.toString();
+        }
+
+        const Transform exactTransform = ITRF().getTransformAt(interval_.getCenter());
+        const Transform interpolatedTransform =
+            ITRF(std::make_shared<const EarthOrientationTable>(table)).getTransformAt(interval_.getCenter());
+
+        EXPECT_TRUE(
+            interpolatedTransform.getOrientation().isNear(exactTransform.getOrientation(), Angle::Arcseconds(1e-4))
+        );
+    }
+
+    {
+        const EarthOrientationTable table = {interval_, Duration::Days(1.0)};
+
+        EXPECT_ANY_THROW(table.getPolarMotionAt(interval_.accessStart() - Duration::Days(1.0)));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_EarthOrientationTable, StringFromInterpolation)
+{
+    {
+        EXPECT_EQ(
+            "Hermite", EarthOrientationTable::StringFromInterpolation(EarthOrientationTable::Interpolation::Hermite)
+        );
+        EXPECT_EQ(
+            "Chebyshev", EarthOrientationTable::StringFromInterpolation(EarthOrientationTable::Interpolation::Chebyshev)
+        );
+    }
+}
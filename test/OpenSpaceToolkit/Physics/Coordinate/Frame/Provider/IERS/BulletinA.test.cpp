@@ -6,8 +6,10 @@
 
 using ostk::core::filesystem::File;
 using ostk::core::filesystem::Path;
+using ostk::core::type::String;
 
 using ostk::physics::coordinate::frame::provider::iers::BulletinA;
+using ostk::physics::coordinate::frame::provider::iers::EOPTable;
 using ostk::physics::time::Date;
 using ostk::physics::time::DateTime;
 using ostk::physics::time::Duration;
@@ -178,6 +180,52 @@ TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_BulletinA, GetObs
     }
 }
 
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_BulletinA, AccessObservationTable)
+{
+    {
+        const EOPTable& table = bulletinA_.accessObservationTable();
+
+        EXPECT_TRUE(table.isDefined());
+
+        for (const String& dateTimeString :
+             {"2018-06-22 00:00:00", "2018-06-25 06:00:00", "2018-06-28 00:00:00", "2018-06-28 12:00:00"})
+        {
+            const Instant instant = Instant::DateTime(DateTime::Parse(dateTimeString), Scale::UTC);
+
+            const BulletinA::Observation observation = bulletinA_.getObservationAt(instant);
+
+            EXPECT_TRUE(table.covers(instant));
+
+            EXPECT_NEAR(observation.x, table.getPolarMotionAt(instant).x(), 1e-12);
+            EXPECT_NEAR(observation.y, table.getPolarMotionAt(instant).y(), 1e-12);
+            EXPECT_NEAR(observation.ut1MinusUtc, table.getUt1MinusUtcAt(instant), 1e-12);
+
+            EXPECT_FALSE(table.getLodAt(instant).isDefined());
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(BulletinA::Undefined().accessObservationTable());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_BulletinA, AccessPredictionTable)
+{
+    {
+        const Instant instant = Instant::DateTime(DateTime::Parse("2018-09-01 18:00:00"), Scale::UTC);
+
+        const BulletinA::Prediction prediction = bulletinA_.getPredictionAt(instant);
+
+        EXPECT_NEAR(prediction.x, bulletinA_.accessPredictionTable().getPolarMotionAt(instant).x(), 1e-12);
+        EXPECT_NEAR(prediction.y, bulletinA_.accessPredictionTable().getPolarMotionAt(instant).y(), 1e-12);
+        EXPECT_NEAR(prediction.ut1MinusUtc, bulletinA_.accessPredictionTable().getUt1MinusUtcAt(instant), 1e-12);
+    }
+
+    {
+        EXPECT_ANY_THROW(BulletinA::Undefined().accessPredictionTable());
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_BulletinA, GetPredictionInterval)
 {
     {
@@ -0,0 +1,222 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/EOPTable.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Integer;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Vector2d;
+
+using ostk::physics::coordinate::frame::provider::iers::EOPTable;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+
+class OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_EOPTable : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        Array<Real> xArray = Array<Real>::Empty();
+        Array<Real> yArray = Array<Real>::Empty();
+        Array<Real> ut1MinusUtcArray = Array<Real>::Empty();
+        Array<Real> lodArray = Array<Real>::Empty();
+
+        for (Size index = 0; index < dayCount_; ++index)
+        {
+            const double t = static_cast<double>(index);
+
+            xArray.add(Cubic(t));
+            yArray.add(0.4 - 0.001 * t);
+            ut1MinusUtcArray.add((index < 5) ? (0.1 - 0.002 * t) : (1.1 - 0.002 * t));  // Leap second after day 4
+            lodArray.add((index == 7) ? Real::Undefined() : Real(1.0 + 0.01 * t));
+        }
+
+        table_ = {firstMjd_, xArray, yArray, ut1MinusUtcArray, lodArray};
+    }
+
+    static double Cubic(const double& aDayCount)
+    {
+        return 0.1 + 1e-3 * aDayCount - 2e-5 * aDayCount * aDayCount + 3e-7 * aDayCount * aDayCount * aDayCount;
+    }
+
+    static Instant InstantAt(const double& anElapsedDayCount)
+    {
+        return Instant::ModifiedJulianDate(58000.0 + anElapsedDayCount, Scale::UTC);
+    }
+
+    const Integer firstMjd_ = 58000;
+    const Size dayCount_ = 10;
+
+    EOPTable table_ = EOPTable::Undefined();
+};
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_EOPTable, Constructor)
+{
+    {
+        EXPECT_NO_THROW(EOPTable(58000, {0.1, 0.2, 0.3}, {0.4, 0.5, 0.6}, Array<Real>::Empty(), Array<Real>::Empty()));
+    }
+
+    {
+        EXPECT_ANY_THROW(EOPTable(58000, {0.1, 0.2, 0.3}, {0.4, 0.5}, Array<Real>::Empty(), Array<Real>::Empty()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_EOPTable, IsDefined)
+{
+    {
+        EXPECT_TRUE(table_.isDefined());
+    }
+
+    {
+        EXPECT_FALSE(EOPTable::Undefined().isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_EOPTable, Getters)
+{
+    {
+        EXPECT_EQ(58000, table_.getFirstMjd());
+        EXPECT_EQ(58009, table_.getLastMjd());
+        EXPECT_EQ(10, table_.getSize());
+    }
+
+    {
+        EXPECT_ANY_THROW(EOPTable::Undefined().getFirstMjd());
+        EXPECT_ANY_THROW(EOPTable::Undefined().getLastMjd());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_EOPTable, Covers)
+{
+    {
+        EXPECT_TRUE(table_.covers(InstantAt(0.0)));
+        EXPECT_TRUE(table_.covers(InstantAt(4.5)));
+        EXPECT_TRUE(table_.covers(InstantAt(9.0)));
+
+        EXPECT_FALSE(table_.covers(InstantAt(-0.5)));
+        EXPECT_FALSE(table_.covers(InstantAt(9.5)));
+    }
+
+    {
+        EXPECT_FALSE(EOPTable::Undefined().covers(InstantAt(0.0)));
+    }
+
+    {
+        EXPECT_ANY_THROW(table_.covers(Instant::Undefined()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_EOPTable, GetPolarMotionAt)
+{
+    {
+        const Vector2d polarMotion = table_.getPolarMotionAt(InstantAt(3.0));
+
+        EXPECT_NEAR(Cubic(3.0), polarMotion.x(), 1e-12);
+        EXPECT_NEAR(0.397, polarMotion.y(), 1e-12);
+    }
+
+    {
+        const Vector2d polarMotion = table_.getPolarMotionAt(InstantAt(3.25), EOPTable::Interpolation::Linear);
+
+        EXPECT_NEAR(Cubic(3.0) + 0.25 * (Cubic(4.0) - Cubic(3.0)), polarMotion.x(), 1e-9);
+        EXPECT_NEAR(0.39675, polarMotion.y(), 1e-9);
+    }
+
+    // Lagrange interpolation is exact for cubic polynomials, including at the table edges
+
+    {
+        for (const double elapsedDayCount : {0.25, 3.25, 8.75})
+        {
+            const Vector2d polarMotion =
+                table_.getPolarMotionAt(InstantAt(elapsedDayCount), EOPTable::Interpolation::Lagrange);
+
+            EXPECT_NEAR(Cubic(elapsedDayCount), polarMotion.x(), 1e-9);
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(table_.getPolarMotionAt(InstantAt(9.5)));
+        EXPECT_ANY_THROW(EOPTable::Undefined().getPolarMotionAt(InstantAt(0.0)));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_EOPTable, GetUt1MinusUtcAt)
+{
+    {
+        EXPECT_NEAR(0.1 - 0.002 * 2.5, table_.getUt1MinusUtcAt(InstantAt(2.5)), 1e-9);
+        EXPECT_NEAR(
+            0.1 - 0.002 * 2.5, table_.getUt1MinusUtcAt(InstantAt(2.5), EOPTable::Interpolation::Lagrange), 1e-9
+        );
+    }
+
+    // Leap second between day 4 and day 5: Lagrange interpolation stays on the day of the instant
+
+    {
+        EXPECT_NEAR(
+            0.1 - 0.002 * 3.5, table_.getUt1MinusUtcAt(InstantAt(3.5), EOPTable::Interpolation::Lagrange), 1e-9
+        );
+        EXPECT_NEAR(
+            1.1 - 0.002 * 5.5, table_.getUt1MinusUtcAt(InstantAt(5.5), EOPTable::Interpolation::Lagrange), 1e-9
+        );
+    }
+
+    {
+        EXPECT_ANY_THROW(table_.getUt1MinusUtcAt(InstantAt(-0.5)));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_EOPTable, GetLodAt)
+{
+    {
+        EXPECT_NEAR(1.025, table_.getLodAt(InstantAt(2.5)), 1e-9);
+    }
+
+    {
+        EXPECT_FALSE(table_.getLodAt(InstantAt(6.5)).isDefined());
+        EXPECT_FALSE(table_.getLodAt(InstantAt(5.5), EOPTable::Interpolation::Lagrange).isDefined());
+    }
+
+    {
+        const EOPTable table = {58000, {0.1, 0.2}, {0.3, 0.4}, {0.5, 0.6}, Array<Real>::Empty()};
+
+        EXPECT_FALSE(table.getLodAt(InstantAt(0.5)).isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_EOPTable, StringFromInterpolation)
+{
+    {
+        EXPECT_EQ("Linear", EOPTable::StringFromInterpolation(EOPTable::Interpolation::Linear));
+        EXPECT_EQ("Lagrange", EOPTable::StringFromInterpolation(EOPTable::Interpolation::Lagrange));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_EOPTable, OceanTidalPolarMotionCorrectionAt)
+{
+    {
+        // Reference values from the PMUT1_OCEANS test case [µas]
+
+        const Vector2d correction =
+            EOPTable::OceanTidalPolarMotionCorrectionAt(Instant::ModifiedJulianDate(47100.0, Scale::UTC));
+
+        EXPECT_NEAR(-162.8386373279636530e-6, correction.x(), 1e-6);
+        EXPECT_NEAR(117.7907525842668974e-6, correction.y(), 1e-6);
+    }
+
+    {
+        for (Size index = 0; index < 96; ++index)
+        {
+            const Vector2d correction = EOPTable::OceanTidalPolarMotionCorrectionAt(InstantAt(index / 96.0));
+
+            EXPECT_GT(1e-3, correction.norm());
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(EOPTable::OceanTidalPolarMotionCorrectionAt(Instant::Undefined()));
+    }
+}
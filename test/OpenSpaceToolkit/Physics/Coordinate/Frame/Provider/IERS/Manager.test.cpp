@@ -1,5 +1,9 @@
 /// Apache License 2.0
 
+#include <atomic>
+#include <filesystem>
+#include <thread>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Table.hpp>
 #include <OpenSpaceToolkit/Core/Container/Tuple.hpp>
@@ -20,6 +24,7 @@ using ostk::core::filesystem::Directory;
 using ostk::core::filesystem::File;
 using ostk::core::filesystem::Path;
 using ostk::core::type::Real;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
 using ostk::io::URL;
@@ -27,6 +32,7 @@ using ostk::io::URL;
 using ostk::mathematics::object::Vector2d;
 
 using ostk::physics::coordinate::frame::provider::iers::BulletinA;
+using ostk::physics::coordinate::frame::provider::iers::EOPTable;
 using ostk::physics::coordinate::frame::provider::iers::Finals2000A;
 using ostk::physics::coordinate::frame::provider::iers::Manager;
 using ostk::physics::time::DateTime;
@@ -82,6 +88,8 @@ class OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager : public :
 
         manager_.setLocalRepository(localRepositoryDirectory);
         manager_.setMode(Manager::Mode::Automatic);
+        manager_.setInterpolation(Manager::DefaultInterpolation());
+        manager_.setOceanTidalCorrectionEnabled(false);
         manager_.reset();
     }
 
@@ -172,6 +180,42 @@ TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager, GetBulle
     }
 }
 
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager, GetBulletinA_Missing)
+{
+    {
+        manager_.reset();
+        manager_.setMode(Manager::Mode::Manual);
+        Directory newDirectory = Directory::Path(
+            Path::Parse("/app/test/OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/Manager/Missing")
+        );
+        manager_.setLocalRepository(newDirectory);
+
+        const Instant instant = bulletinA_.accessObservationInterval().accessStart();
+
+        EXPECT_THROW(manager_.getPolarMotionAt(instant), ostk::core::error::RuntimeError);
+        EXPECT_THROW(manager_.getUt1MinusUtcAt(instant), ostk::core::error::RuntimeError);
+        EXPECT_THROW(manager_.getLodAt(instant), ostk::core::error::RuntimeError);
+
+        // Missing bulletin is not looked up again, until the manager is reset
+
+        std::filesystem::copy_file(
+            std::string(bulletinAFile_.getPath().toString()),
+            std::string((manager_.getBulletinADirectory().getPath() + Path::Parse("ser7.dat")).toString())
+        );
+
+        EXPECT_THROW(manager_.getBulletinA(), ostk::core::error::RuntimeError);
+
+        manager_.reset();
+
+        EXPECT_NO_THROW(manager_.getBulletinA());
+        EXPECT_NO_THROW(manager_.getPolarMotionAt(instant));
+
+        manager_.setMode(Manager::Mode::Automatic);
+        manager_.setLocalRepository(localRepositoryDirectory);
+        newDirectory.remove();
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager, GetBulletinAFetch)
 {
     // This test is not deterministic, as it depends on the remote server
@@ -388,6 +432,68 @@ TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager, GetUt1Mi
 
 // }
 
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager, ConcurrentAccess)
+{
+    {
+        manager_.loadBulletinA(bulletinA_);
+        manager_.loadFinals2000A(finals2000A_);
+
+        const Instant startInstant = bulletinA_.accessObservationInterval().accessStart();
+
+        Array<Instant> instants = Array<Instant>::Empty();
+        Array<Vector2d> referencePolarMotions = Array<Vector2d>::Empty();
+        Array<Real> referenceUt1MinusUtcs = Array<Real>::Empty();
+
+        for (Size index = 0; index < 100; ++index)
+        {
+            const Instant instant = startInstant + Duration::Hours(static_cast<double>(index));
+
+            instants.add(instant);
+            referencePolarMotions.add(manager_.getPolarMotionAt(instant));
+            referenceUt1MinusUtcs.add(manager_.getUt1MinusUtcAt(instant));
+        }
+
+        std::atomic<Size> mismatchCount {0};
+
+        Array<std::thread> threads = Array<std::thread>::Empty();
+
+        for (Size threadIndex = 0; threadIndex < 8; ++threadIndex)
+        {
+            threads.add(std::thread(
+                [&]() -> void
+                {
+                    for (Size iteration = 0; iteration < 10; ++iteration)
+                    {
+                        for (Size index = 0; index < instants.getSize(); ++index)
+                        {
+                            if ((manager_.getPolarMotionAt(instants[index]) != referencePolarMotions[index]) ||
+                                (manager_.getUt1MinusUtcAt(instants[index]) != referenceUt1MinusUtcs[index]))
+                            {
+                                mismatchCount++;
+                            }
+                        }
+                    }
+                }
+            ));
+        }
+
+        // Reloading swaps snapshots while lookups are in flight
+
+        for (Size iteration = 0; iteration < 10; ++iteration)
+        {
+            manager_.loadBulletinA(bulletinA_);
+            manager_.loadFinals2000A(finals2000A_);
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(0, mismatchCount.load());
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager, SetMode)
 {
     {
@@ -420,6 +526,56 @@ TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager, SetLocal
     }
 }
 
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager, SetInterpolation)
+{
+    {
+        manager_.loadBulletinA(bulletinA_);
+
+        const Instant instant = bulletinA_.accessObservationInterval().accessStart() + Duration::Hours(36.0);
+
+        EXPECT_EQ(EOPTable::Interpolation::Linear, manager_.getInterpolation());
+
+        const Size revision = manager_.getRevision();
+
+        manager_.setInterpolation(EOPTable::Interpolation::Lagrange);
+
+        EXPECT_EQ(EOPTable::Interpolation::Lagrange, manager_.getInterpolation());
+        EXPECT_LT(revision, manager_.getRevision());
+
+        EXPECT_EQ(
+            bulletinA_.accessObservationTable().getPolarMotionAt(instant, EOPTable::Interpolation::Lagrange),
+            manager_.getPolarMotionAt(instant)
+        );
+        EXPECT_EQ(
+            bulletinA_.accessObservationTable().getUt1MinusUtcAt(instant, EOPTable::Interpolation::Lagrange),
+            manager_.getUt1MinusUtcAt(instant)
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager, SetOceanTidalCorrectionEnabled)
+{
+    {
+        manager_.loadBulletinA(bulletinA_);
+
+        const Instant instant = bulletinA_.accessObservationInterval().accessStart() + Duration::Hours(36.0);
+
+        EXPECT_FALSE(manager_.isOceanTidalCorrectionEnabled());
+
+        const Vector2d polarMotion = manager_.getPolarMotionAt(instant);
+        const Real ut1MinusUtc = manager_.getUt1MinusUtcAt(instant);
+
+        manager_.setOceanTidalCorrectionEnabled(true);
+
+        EXPECT_TRUE(manager_.isOceanTidalCorrectionEnabled());
+
+        EXPECT_TRUE(manager_.getPolarMotionAt(instant).isNear(
+            polarMotion + EOPTable::OceanTidalPolarMotionCorrectionAt(instant), 1e-12
+        ));
+        EXPECT_EQ(ut1MinusUtc, manager_.getUt1MinusUtcAt(instant));
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager, LoadBulletinA)
 {
     {
@@ -7,6 +7,8 @@
 
 using ostk::core::type::Shared;
 using ostk::core::type::Real;
+using ostk::core::type::Size;
+using ostk::core::container::Array;
 
 using ostk::mathematics::object::Vector3d;
 
@@ -217,6 +219,53 @@ TEST_F(OpenSpaceToolkit_Physics_Coordinate_Position, InFrame)
     }
 }
 
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Position, InFrame_Array)
+{
+    using ostk::physics::time::Instant;
+    using ostk::physics::time::Duration;
+
+    const Array<Instant> instants = {Instant::J2000(), Instant::J2000() + Duration::Hours(1.0)};
+
+    {
+        const Array<Position> positions = {
+            {{7000e3, 1000e3, 500e3}, Position::Unit::Meter, Frame::GCRF()},
+            {{1000e3, 7000e3, 500e3}, Position::Unit::Meter, Frame::GCRF()},
+        };
+
+        const Array<Position> positions_ITRF = Position::InFrame(positions, Frame::ITRF(), instants);
+
+        ASSERT_EQ(positions.getSize(), positions_ITRF.getSize());
+
+        for (Size index = 0; index < positions.getSize(); ++index)
+        {
+            EXPECT_EQ(positions[index].inFrame(Frame::ITRF(), instants[index]), positions_ITRF[index]);
+        }
+    }
+
+    {
+        const Array<Position> positions = {
+            {{7000e3, 1000e3, 500e3}, Position::Unit::Meter, Frame::GCRF()},
+            {{1000e3, 7000e3, 500e3}, Position::Unit::Meter, Frame::TEME()},
+        };
+
+        const Array<Position> positions_ITRF = Position::InFrame(positions, Frame::ITRF(), instants);
+
+        ASSERT_EQ(positions.getSize(), positions_ITRF.getSize());
+
+        for (Size index = 0; index < positions.getSize(); ++index)
+        {
+            EXPECT_EQ(positions[index].inFrame(Frame::ITRF(), instants[index]), positions_ITRF[index]);
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(Position::InFrame({Position::Undefined()}, Frame::ITRF(), {Instant::J2000()}));
+        EXPECT_ANY_THROW(Position::InFrame({positionGCRF_}, Frame::Undefined(), {Instant::J2000()}));
+        EXPECT_ANY_THROW(Position::InFrame({positionGCRF_}, Frame::ITRF(), {Instant::Undefined()}));
+        EXPECT_ANY_THROW(Position::InFrame({positionGCRF_}, Frame::ITRF(), Array<Instant>::Empty()));
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Physics_Coordinate_Position, ToString)
 {
     {
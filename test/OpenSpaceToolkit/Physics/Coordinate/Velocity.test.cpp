@@ -0,0 +1,110 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+using ostk::core::container::Array;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+
+class OpenSpaceToolkit_Physics_Coordinate_Velocity : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        for (Index index = 0; index < 16; ++index)
+        {
+            const double angle = 0.4 * static_cast<double>(index);
+
+            instants_.add(Instant::J2000() + Duration::Minutes(7.0 * static_cast<double>(index)));
+            positions_.add(
+                {{7000e3 * std::cos(angle), 7000e3 * std::sin(angle), 500e3}, Position::Unit::Meter, Frame::GCRF()}
+            );
+            velocities_.add(
+                {{-7.5e3 * std::sin(angle), 7.5e3 * std::cos(angle), 10.0},
+                 Velocity::Unit::MeterPerSecond,
+                 Frame::GCRF()}
+            );
+        }
+    }
+
+    Array<Instant> instants_ = Array<Instant>::Empty();
+    Array<Position> positions_ = Array<Position>::Empty();
+    Array<Velocity> velocities_ = Array<Velocity>::Empty();
+};
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Velocity, InFrame)
+{
+    {
+        for (const Size threadCount : {1, 2, 4, 32})
+        {
+            const Array<Velocity> velocities_ITRF =
+                Velocity::InFrame(velocities_, positions_, Frame::ITRF(), instants_, threadCount);
+
+            ASSERT_EQ(velocities_.getSize(), velocities_ITRF.getSize());
+
+            for (Index index = 0; index < velocities_.getSize(); ++index)
+            {
+                const Velocity velocity_ITRF =
+                    velocities_[index].inFrame(positions_[index], Frame::ITRF(), instants_[index]);
+
+                EXPECT_TRUE(velocities_ITRF[index].accessCoordinates().isNear(velocity_ITRF.accessCoordinates(), 1e-9))
+                    << threadCount << " | " << index << " | " << velocities_ITRF[index] << " | " << velocity_ITRF;
+                EXPECT_EQ(Velocity::Unit::MeterPerSecond, velocities_ITRF[index].getUnit());
+                EXPECT_EQ(Frame::ITRF(), velocities_ITRF[index].accessFrame());
+            }
+        }
+    }
+
+    {
+        Array<Velocity> velocities = velocities_;
+
+        velocities[1] = {{100.0, 200.0, 300.0}, Velocity::Unit::MeterPerSecond, Frame::TEME()};
+
+        const Array<Velocity> velocities_ITRF = Velocity::InFrame(velocities, positions_, Frame::ITRF(), instants_, 2);
+
+        ASSERT_EQ(velocities.getSize(), velocities_ITRF.getSize());
+
+        for (Index index = 0; index < velocities.getSize(); ++index)
+        {
+            EXPECT_EQ(
+                velocities[index].inFrame(positions_[index], Frame::ITRF(), instants_[index]), velocities_ITRF[index]
+            );
+        }
+    }
+
+    {
+        const Array<Velocity> velocities = Velocity::InFrame(
+            Array<Velocity>::Empty(), Array<Position>::Empty(), Frame::ITRF(), Array<Instant>::Empty(), 4
+        );
+
+        EXPECT_TRUE(velocities.isEmpty());
+    }
+
+    {
+        const Velocity undefinedVelocity = {Vector3d::Zero(), Velocity::Unit::Undefined, Frame::GCRF()};
+
+        EXPECT_ANY_THROW(Velocity::InFrame(velocities_, positions_, Frame::Undefined(), instants_));
+        EXPECT_ANY_THROW(Velocity::InFrame(velocities_, positions_, nullptr, instants_));
+        EXPECT_ANY_THROW(Velocity::InFrame({undefinedVelocity}, {positions_[0]}, Frame::ITRF(), {instants_[0]}));
+        EXPECT_ANY_THROW(Velocity::InFrame({velocities_[0]}, {Position::Undefined()}, Frame::ITRF(), {instants_[0]}));
+        EXPECT_ANY_THROW(Velocity::InFrame({velocities_[0]}, {positions_[0]}, Frame::ITRF(), {Instant::Undefined()}));
+        EXPECT_ANY_THROW(Velocity::InFrame(velocities_, Array<Position>::Empty(), Frame::ITRF(), instants_));
+        EXPECT_ANY_THROW(Velocity::InFrame(velocities_, positions_, Frame::ITRF(), Array<Instant>::Empty()));
+    }
+}
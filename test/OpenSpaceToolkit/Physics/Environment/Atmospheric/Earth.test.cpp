@@ -19,6 +19,7 @@
 
 using ostk::core::error::RuntimeError;
 using ostk::core::type::Real;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 using ostk::core::container::Tuple;
 using ostk::core::container::Array;
@@ -142,6 +143,12 @@ TEST(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth, GetType)
             EarthAtmosphericModel(EarthAtmosphericModel::Type::NRLMSISE00).getType()
         );
     }
+    {
+        EXPECT_EQ(
+            EarthAtmosphericModel::Type::HarrisPriester,
+            EarthAtmosphericModel(EarthAtmosphericModel::Type::HarrisPriester).getType()
+        );
+    }
 }
 
 TEST(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth, GetInputDataType)
@@ -185,6 +192,8 @@ TEST(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth, IsDefined)
         EXPECT_TRUE(EarthAtmosphericModel(EarthAtmosphericModel::Type::Exponential).isDefined());
 
         EXPECT_TRUE(EarthAtmosphericModel(EarthAtmosphericModel::Type::NRLMSISE00).isDefined());
+
+        EXPECT_TRUE(EarthAtmosphericModel(EarthAtmosphericModel::Type::HarrisPriester).isDefined());
     }
 }
 
@@ -274,7 +283,12 @@ TEST(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth, GetDensityAt_LLA)
              LLA(Angle::Degrees(0.0), Angle::Degrees(0.0), Length::Kilometers(500.0)),
              Instant::DateTime(DateTime::Parse("2021-01-01 00:00:00"), Scale::UTC),
              6.7647e-14,
-             1e-15}
+             1e-15},
+            {EarthAtmosphericModel::Type::HarrisPriester,
+             LLA(Angle::Degrees(35.076832), Angle::Degrees(-92.546296), Length::Kilometers(123.0)),
+             Instant::J2000(),
+             1.79651e-08,
+             1e-13}
         };
 
         for (const auto& testCase : testCases)
@@ -448,3 +462,57 @@ TEST(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth, GetDensityAt_Solar)
         }
     }
 }
+
+TEST(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth, GetDensitiesAt)
+{
+    {
+        const Array<LLA> llas = {
+            LLA(Angle::Degrees(0.0), Angle::Degrees(0.0), Length::Kilometers(500.0)),
+            LLA(Angle::Degrees(35.076832), Angle::Degrees(-92.546296), Length::Kilometers(350.0)),
+            LLA(Angle::Degrees(-60.0), Angle::Degrees(170.0), Length::Kilometers(250.0)),
+        };
+
+        Array<Position> positions = Array<Position>::Empty();
+
+        for (const auto& lla : llas)
+        {
+            positions.add(Position(
+                lla.toCartesian(
+                    EarthGravitationalModel::EGM2008.equatorialRadius_, EarthGravitationalModel::EGM2008.flattening_
+                ),
+                Position::Unit::Meter,
+                Frame::ITRF()
+            ));
+        }
+
+        const Array<Instant> instants = {
+            Instant::DateTime(DateTime::Parse("2021-01-01 00:00:00"), Scale::UTC),
+            Instant::DateTime(DateTime::Parse("2021-01-01 01:00:00"), Scale::UTC),
+            Instant::DateTime(DateTime::Parse("2021-01-01 04:00:00"), Scale::UTC),
+        };
+
+        for (const auto& type :
+             {EarthAtmosphericModel::Type::Exponential,
+              EarthAtmosphericModel::Type::NRLMSISE00,
+              EarthAtmosphericModel::Type::HarrisPriester})
+        {
+            const EarthAtmosphericModel earthAtmosphericModel = {type};
+
+            const Array<Real> densitiesAtInstant = earthAtmosphericModel.getDensitiesAt(positions, instants[0]);
+            const Array<Real> densitiesAtInstants = earthAtmosphericModel.getDensitiesAt(positions, instants);
+
+            ASSERT_EQ(positions.getSize(), densitiesAtInstant.getSize());
+            ASSERT_EQ(positions.getSize(), densitiesAtInstants.getSize());
+
+            for (Size index = 0; index < positions.getSize(); ++index)
+            {
+                EXPECT_EQ(earthAtmosphericModel.getDensityAt(positions[index], instants[0]), densitiesAtInstant[index]);
+                EXPECT_EQ(
+                    earthAtmosphericModel.getDensityAt(positions[index], instants[index]), densitiesAtInstants[index]
+                );
+            }
+
+            EXPECT_THROW(earthAtmosphericModel.getDensitiesAt(positions, Array<Instant> {instants[0]}), RuntimeError);
+        }
+    }
+}
@@ -4,8 +4,11 @@
 
 #include <Global.test.hpp>
 
+using ostk::core::container::Array;
 using ostk::core::filesystem::Path;
 using ostk::core::filesystem::File;
+using ostk::core::type::Integer;
+using ostk::core::type::Real;
 
 using ostk::physics::time::Date;
 using ostk::physics::time::Scale;
@@ -463,6 +466,111 @@ TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_CSSISpaceWeather,
     }
 }
 
+TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_CSSISpaceWeather, AccessNRLMSISE00ApInterval)
+{
+    {
+        // Test file has missing days
+        EXPECT_FALSE(CSSISpaceWeather_.accessNRLMSISE00ApInterval().isDefined());
+    }
+
+    {
+        const CSSISpaceWeather spaceWeather = CSSISpaceWeather::Load(
+            File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/"
+                                   "NRLMSISE00/SW-Last5Years.csv"))
+        );
+
+        EXPECT_EQ(
+            Interval(
+                Instant::DateTime(DateTime::Parse("2018-01-03 09:00:00"), Scale::UTC),
+                Instant::DateTime(DateTime::Parse("2023-08-17 00:00:00"), Scale::UTC),
+                Interval::Type::HalfOpenRight
+            ),
+            spaceWeather.accessNRLMSISE00ApInterval()
+        );
+    }
+
+    {
+        EXPECT_THROW(CSSISpaceWeather::Undefined().accessNRLMSISE00ApInterval(), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_CSSISpaceWeather, GetNRLMSISE00ApValuesAt)
+{
+    const CSSISpaceWeather spaceWeather = CSSISpaceWeather::Load(
+        File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/"
+                               "NRLMSISE00/SW-Last5Years.csv"))
+    );
+
+    {
+        const Array<Real> apValues =
+            spaceWeather.getNRLMSISE00ApValuesAt(Instant::DateTime(DateTime::Parse("2022-03-13 10:30:00"), Scale::UTC));
+
+        EXPECT_EQ(7, apValues.getSize());
+
+        EXPECT_EQ(40.0, apValues[0]);
+        EXPECT_EQ(27.0, apValues[1]);
+        EXPECT_EQ(2.0, apValues[2]);
+        EXPECT_EQ(3.0, apValues[3]);
+        EXPECT_EQ(5.0, apValues[4]);
+        EXPECT_EQ(99.0 / 8.0, apValues[5]);
+        EXPECT_EQ(158.0 / 8.0, apValues[6]);
+    }
+
+    {
+        // Values match the 3-hourly Ap indices of the readings
+
+        const Instant startInstant = Instant::DateTime(DateTime::Parse("2021-06-01 00:00:00"), Scale::UTC);
+
+        for (Instant instant = startInstant; instant < startInstant + Duration::Days(10.0);
+             instant += Duration::Hours(1.0))
+        {
+            const CSSISpaceWeather::Reading& reading = spaceWeather.accessReadingAt(instant);
+
+            const Array<Integer> readingApValues = {
+                reading.Ap1, reading.Ap2, reading.Ap3, reading.Ap4, reading.Ap5, reading.Ap6, reading.Ap7, reading.Ap8
+            };
+
+            const Array<Real> apValues = spaceWeather.getNRLMSISE00ApValuesAt(instant);
+
+            EXPECT_EQ(Real::Integer(reading.ApAvg), apValues[0]);
+            EXPECT_EQ(
+                Real::Integer(readingApValues[instant.getDateTime(Scale::UTC).getTime().getHour() / 3]), apValues[1]
+            );
+        }
+    }
+
+    {
+        EXPECT_THROW(
+            spaceWeather.getNRLMSISE00ApValuesAt(
+                Instant::DateTime(DateTime::Parse("2018-01-03 08:00:00"), Scale::UTC)
+            ),
+            ostk::core::error::RuntimeError
+        );
+        EXPECT_THROW(
+            spaceWeather.getNRLMSISE00ApValuesAt(
+                Instant::DateTime(DateTime::Parse("2023-09-15 00:00:00"), Scale::UTC)
+            ),
+            ostk::core::error::RuntimeError
+        );
+    }
+
+    {
+        EXPECT_THROW(
+            CSSISpaceWeather_.getNRLMSISE00ApValuesAt(
+                Instant::DateTime(DateTime::Parse("2023-06-19 12:00:00"), Scale::UTC)
+            ),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(spaceWeather.getNRLMSISE00ApValuesAt(Instant::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(
+            CSSISpaceWeather::Undefined().getNRLMSISE00ApValuesAt(
+                Instant::DateTime(DateTime::Parse("2023-06-19 12:00:00"), Scale::UTC)
+            ),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_CSSISpaceWeather, Load)
 {
     {
@@ -475,6 +583,112 @@ TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_CSSISpaceWeather,
     }
 }
 
+TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_CSSISpaceWeather, LoadParsing)
+{
+    // Expected values are those of the previous table-based parser: blank fields are undefined, and malformed
+    // numbers fail the load
+
+    const File file = File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/"
+                                             "CSSISpaceWeather/SW-parser.test.csv"));
+
+    const CSSISpaceWeather spaceWeather = CSSISpaceWeather::Load(file);
+
+    {
+        // Blank fields
+
+        const CSSISpaceWeather::Reading observation =
+            spaceWeather.accessObservationAt(Instant::DateTime(DateTime::Parse("2023-06-18 12:00:00"), Scale::UTC));
+
+        EXPECT_EQ(Date::Parse("2023-06-18", Date::Format::Standard), observation.date);
+
+        EXPECT_EQ(2589, observation.BSRN);
+        EXPECT_EQ(17, observation.ND);
+        EXPECT_FALSE(observation.Kp1.isDefined());
+        EXPECT_FALSE(observation.Kp8.isDefined());
+        EXPECT_FALSE(observation.KpSum.isDefined());
+        EXPECT_FALSE(observation.Ap1.isDefined());
+        EXPECT_FALSE(observation.Ap8.isDefined());
+        EXPECT_FALSE(observation.ApAvg.isDefined());
+        EXPECT_FALSE(observation.Cp.isDefined());
+        EXPECT_FALSE(observation.C9.isDefined());
+        EXPECT_EQ(138, observation.ISN);
+        EXPECT_EQ("OBS", observation.F107DataType);
+
+        EXPECT_NEAR(166.8, observation.F107Obs, 1e-15);
+        EXPECT_NEAR(156.0, observation.F107AdjLast81, 1e-15);
+    }
+
+    {
+        // Observed and interpolated readings, then daily predictions
+
+        EXPECT_EQ(Date::Parse("2023-06-19", Date::Format::Standard), spaceWeather.accessLastObservationDate());
+
+        EXPECT_EQ(
+            Interval(
+                Instant::DateTime(DateTime::Parse("2023-06-17 00:00:00"), Scale::UTC),
+                Instant::DateTime(DateTime::Parse("2023-06-20 00:00:00"), Scale::UTC),
+                Interval::Type::HalfOpenRight
+            ),
+            spaceWeather.accessObservationInterval()
+        );
+        EXPECT_EQ(
+            Interval(
+                Instant::DateTime(DateTime::Parse("2023-06-20 00:00:00"), Scale::UTC),
+                Instant::DateTime(DateTime::Parse("2023-06-22 00:00:00"), Scale::UTC),
+                Interval::Type::HalfOpenRight
+            ),
+            spaceWeather.accessDailyPredictionInterval()
+        );
+
+        const CSSISpaceWeather::Reading lastObservation =
+            spaceWeather.accessReadingAt(Instant::DateTime(DateTime::Parse("2023-06-19 23:59:59"), Scale::UTC));
+
+        EXPECT_EQ("INT", lastObservation.F107DataType);
+        EXPECT_EQ(20, lastObservation.Kp1);
+        EXPECT_EQ(7, lastObservation.ApAvg);
+        EXPECT_NEAR(0.3, lastObservation.Cp, 1e-15);
+
+        const CSSISpaceWeather::Reading firstDailyPrediction =
+            spaceWeather.accessReadingAt(Instant::DateTime(DateTime::Parse("2023-06-20 00:00:00"), Scale::UTC));
+
+        EXPECT_EQ(Date::Parse("2023-06-20", Date::Format::Standard), firstDailyPrediction.date);
+        EXPECT_EQ("PRD", firstDailyPrediction.F107DataType);
+        EXPECT_EQ(27, firstDailyPrediction.Kp1);
+        EXPECT_EQ(40, firstDailyPrediction.Kp8);
+        EXPECT_EQ(27, firstDailyPrediction.Ap8);
+        EXPECT_NEAR(164.6, firstDailyPrediction.F107Obs, 1e-15);
+    }
+
+    {
+        // Monthly predictions
+
+        const CSSISpaceWeather::Reading monthlyPrediction = spaceWeather.accessMonthlyPredictionAt(
+            Instant::DateTime(DateTime::Parse("2023-07-01 12:00:00"), Scale::UTC)
+        );
+
+        EXPECT_EQ(Date::Parse("2023-07-01", Date::Format::Standard), monthlyPrediction.date);
+        EXPECT_EQ("PRM", monthlyPrediction.F107DataType);
+        EXPECT_FALSE(monthlyPrediction.Kp1.isDefined());
+        EXPECT_FALSE(monthlyPrediction.ApAvg.isDefined());
+        EXPECT_EQ(124, monthlyPrediction.ISN);
+        EXPECT_NEAR(151.3, monthlyPrediction.F107Obs, 1e-15);
+    }
+
+    {
+        // Malformed numbers
+
+        const File malformedIntegerFile =
+            File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/"
+                                   "CSSISpaceWeather/SW-parser_malformed_integer.test.csv"));
+        const File malformedRealFile =
+            File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/"
+                                   "CSSISpaceWeather/SW-parser_malformed_real.test.csv"));
+
+        EXPECT_THROW(CSSISpaceWeather::Load(malformedIntegerFile), ostk::core::error::RuntimeError);
+        EXPECT_THROW(CSSISpaceWeather::Load(malformedRealFile), ostk::core::error::RuntimeError);
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_CSSISpaceWeather, LoadLegacy)
 {
     {
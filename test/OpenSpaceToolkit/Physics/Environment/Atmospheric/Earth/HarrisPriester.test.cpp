@@ -0,0 +1,184 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Spherical/LLA.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/HarrisPriester.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Sun.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::spherical::LLA;
+using ostk::physics::environment::atmospheric::earth::HarrisPriester;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::environment::object::celestial::Sun;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+
+TEST(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_HarrisPriester, Constructor)
+{
+    {
+        EXPECT_NO_THROW(HarrisPriester());
+    }
+
+    {
+        EXPECT_NO_THROW(HarrisPriester(6.0, Frame::ITRF(), std::make_shared<Celestial>(Sun::Default())));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_HarrisPriester, Clone)
+{
+    {
+        const HarrisPriester harrisPriester = {};
+
+        EXPECT_NO_THROW(const HarrisPriester* harrisPriesterPtr = harrisPriester.clone(); delete harrisPriesterPtr;);
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_HarrisPriester, IsDefined)
+{
+    {
+        EXPECT_TRUE(HarrisPriester().isDefined());
+
+        EXPECT_FALSE(HarrisPriester(Real::Undefined()).isDefined());
+        EXPECT_FALSE(HarrisPriester(4.0, nullptr).isDefined());
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_HarrisPriester, GetCosineExponent)
+{
+    {
+        EXPECT_EQ(4.0, HarrisPriester().getCosineExponent());
+        EXPECT_EQ(2.0, HarrisPriester(2.0).getCosineExponent());
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_HarrisPriester, GetDensityAt)
+{
+    {
+        const HarrisPriester harrisPriester = {};
+
+        const LLA lla = LLA(Angle::Degrees(35.076832), Angle::Degrees(-92.546296), Length::Kilometers(123.0));
+
+        const Real density = harrisPriester.getDensityAt(lla, Instant::J2000());
+
+        const Real referenceDensity = 1.79651e-08;
+        const Real tolerance = 1e-13;
+
+        EXPECT_TRUE(density.isNear(referenceDensity, tolerance)) << String::Format(
+            "{} ≈ {} Δ {} [T]", density.toString(), referenceDensity.toString(), (density - referenceDensity)
+        );
+    }
+
+    // Density lies within the tabulated bounds, and peaks on the day side
+
+    {
+        const HarrisPriester harrisPriester = {};
+
+        const Instant instant = Instant::J2000();
+
+        const Real dayDensity = harrisPriester.getDensityAt(
+            LLA(Angle::Degrees(0.0), Angle::Degrees(0.0), Length::Kilometers(500.0)), instant
+        );
+        const Real nightDensity = harrisPriester.getDensityAt(
+            LLA(Angle::Degrees(0.0), Angle::Degrees(180.0), Length::Kilometers(500.0)), instant
+        );
+
+        EXPECT_GT(dayDensity, nightDensity);
+
+        EXPECT_LE(0.3916e-12, nightDensity);
+        EXPECT_GE(2.042e-12, dayDensity);
+    }
+
+    // Sun celestial and analytical Sun agree closely
+
+    {
+        const HarrisPriester analyticalHarrisPriester = {};
+        const HarrisPriester celestialHarrisPriester = {
+            HarrisPriester::DefaultCosineExponent, Frame::ITRF(), std::make_shared<Celestial>(Sun::Default())
+        };
+
+        const Instant instant = Instant::DateTime(DateTime::Parse("2021-01-01 00:00:00"), Scale::UTC);
+        const LLA lla = LLA(Angle::Degrees(35.076832), Angle::Degrees(-92.546296), Length::Kilometers(350.0));
+
+        const Real analyticalDensity = analyticalHarrisPriester.getDensityAt(lla, instant);
+        const Real celestialDensity = celestialHarrisPriester.getDensityAt(lla, instant);
+
+        EXPECT_TRUE(celestialDensity.isNear(analyticalDensity, 1e-2 * analyticalDensity)) << String::Format(
+            "{} ≈ {} Δ {} [T]",
+            celestialDensity.toString(),
+            analyticalDensity.toString(),
+            (celestialDensity - analyticalDensity)
+        );
+    }
+
+    {
+        const HarrisPriester harrisPriester = {};
+
+        EXPECT_ANY_THROW(harrisPriester.getDensityAt(
+            LLA(Angle::Degrees(0.0), Angle::Degrees(0.0), Length::Kilometers(50.0)), Instant::J2000()
+        ));
+        EXPECT_ANY_THROW(harrisPriester.getDensityAt(
+            LLA(Angle::Degrees(0.0), Angle::Degrees(0.0), Length::Kilometers(1500.0)), Instant::J2000()
+        ));
+        EXPECT_ANY_THROW(harrisPriester.getDensityAt(
+            LLA(Angle::Degrees(0.0), Angle::Degrees(0.0), Length::Kilometers(500.0)), Instant::Undefined()
+        ));
+        EXPECT_ANY_THROW(HarrisPriester(Real::Undefined())
+                             .getDensityAt(
+                                 LLA(Angle::Degrees(0.0), Angle::Degrees(0.0), Length::Kilometers(500.0)),
+                                 Instant::J2000()
+                             ));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_HarrisPriester, GetDensitiesAt)
+{
+    {
+        const HarrisPriester harrisPriester = {};
+
+        const Instant instant = Instant::DateTime(DateTime::Parse("2021-01-01 00:00:00"), Scale::UTC);
+
+        Array<LLA> llas = Array<LLA>::Empty();
+
+        for (Size index = 0; index < 50; ++index)
+        {
+            llas.add(LLA(
+                Angle::Degrees(-80.0 + 3.2 * static_cast<double>(index)),
+                Angle::Degrees(-175.0 + 7.0 * static_cast<double>(index)),
+                Length::Kilometers(100.0 + 18.0 * static_cast<double>(index))
+            ));
+        }
+
+        const Array<Real> densities = harrisPriester.getDensitiesAt(llas, instant);
+
+        ASSERT_EQ(llas.getSize(), densities.getSize());
+
+        for (Size index = 0; index < llas.getSize(); ++index)
+        {
+            EXPECT_EQ(harrisPriester.getDensityAt(llas[index], instant), densities[index]);
+        }
+    }
+
+    {
+        const HarrisPriester harrisPriester = {};
+
+        EXPECT_TRUE(harrisPriester.getDensitiesAt(Array<LLA>::Empty(), Instant::J2000()).isEmpty());
+    }
+}
@@ -1,5 +1,8 @@
 /// Apache License 2.0
 
+#include <atomic>
+#include <thread>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Table.hpp>
 #include <OpenSpaceToolkit/Core/Container/Tuple.hpp>
@@ -14,6 +17,8 @@
 
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 using ostk::core::container::Tuple;
 using ostk::core::container::Array;
@@ -133,6 +138,41 @@ TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_Manager, GetCSSISp
     }
 }
 
+TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_Manager, AccessCSSISpaceWeatherAt)
+{
+    {
+        const Instant instant = spaceWeather_.accessObservationInterval().accessStart();
+
+        const Shared<const CSSISpaceWeather> CSSISpaceWeatherSPtr = manager_.accessCSSISpaceWeatherAt(instant);
+
+        ASSERT_NE(nullptr, CSSISpaceWeatherSPtr);
+
+        EXPECT_EQ(spaceWeather_.accessLastObservationDate(), CSSISpaceWeatherSPtr->accessLastObservationDate());
+
+        // Lookups share the same snapshot
+
+        EXPECT_EQ(CSSISpaceWeatherSPtr, manager_.accessCSSISpaceWeatherAt(instant));
+
+        // The snapshot outlives a reset
+
+        manager_.reset();
+
+        EXPECT_FALSE(manager_.getLoadedCSSISpaceWeather().isDefined());
+        EXPECT_TRUE(CSSISpaceWeatherSPtr->isDefined());
+        EXPECT_EQ(spaceWeather_.accessLastObservationDate(), CSSISpaceWeatherSPtr->accessLastObservationDate());
+    }
+
+    {
+        manager_.setMode(Manager::Mode::Manual);
+
+        EXPECT_THROW(manager_.accessCSSISpaceWeatherAt(Instant::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(
+            manager_.accessCSSISpaceWeatherAt(Instant::DateTime(DateTime::Parse("2010-01-01 00:00:00"), Scale::UTC)),
+            ostk::core::error::RuntimeError
+        );
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_Manager, GetKp3HourSolarIndicesAt)
 {
     {
@@ -241,6 +281,46 @@ TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_Manager, GetAp3Hou
     }
 }
 
+TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_Manager, AccessAp3HourSolarIndexReadingAt)
+{
+    {
+        const Instant instant = Instant::DateTime(DateTime::Parse("2023-06-18 12:34:56"), Scale::UTC);
+
+        const Shared<const CSSISpaceWeather::Reading> readingSPtr =
+            manager_.accessAp3HourSolarIndexReadingAt(instant);
+
+        ASSERT_NE(nullptr, readingSPtr);
+
+        // Points into the loaded snapshot, and keeps it alive
+
+        EXPECT_EQ(&manager_.accessCSSISpaceWeatherAt(instant)->accessReadingAt(instant), readingSPtr.get());
+
+        manager_.reset();
+
+        EXPECT_EQ(
+            Array<Integer>({12, 7, 5, 7, 6, 6, 12, 7}),
+            Array<Integer>(
+                {readingSPtr->Ap1,
+                 readingSPtr->Ap2,
+                 readingSPtr->Ap3,
+                 readingSPtr->Ap4,
+                 readingSPtr->Ap5,
+                 readingSPtr->Ap6,
+                 readingSPtr->Ap7,
+                 readingSPtr->Ap8}
+            )
+        );
+    }
+
+    {
+        manager_.setMode(Manager::Mode::Manual);
+
+        EXPECT_THROW(
+            manager_.accessAp3HourSolarIndexReadingAt(Instant::Undefined()), ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_Manager, GetApDailySolarIndexAt)
 {
     {
@@ -407,6 +487,57 @@ TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_Manager, GetF107So
     }
 }
 
+TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_Manager, ConcurrentAccess)
+{
+    {
+        const Instant startInstant = Instant::DateTime(DateTime::Parse("2023-06-01 00:00:00"), Scale::UTC);
+
+        Array<Instant> instants = Array<Instant>::Empty();
+        Array<Array<Integer>> referenceApIndices = Array<Array<Integer>>::Empty();
+        Array<Real> referenceF107SolarFluxes = Array<Real>::Empty();
+
+        for (Size index = 0; index < 100; ++index)
+        {
+            const Instant instant = startInstant + Duration::Hours(3.0 * static_cast<double>(index));
+
+            instants.add(instant);
+            referenceApIndices.add(manager_.getAp3HourSolarIndicesAt(instant));
+            referenceF107SolarFluxes.add(manager_.getF107SolarFluxAt(instant));
+        }
+
+        std::atomic<Size> mismatchCount {0};
+
+        Array<std::thread> threads = Array<std::thread>::Empty();
+
+        for (Size threadIndex = 0; threadIndex < 8; ++threadIndex)
+        {
+            threads.add(std::thread(
+                [&]() -> void
+                {
+                    for (Size iteration = 0; iteration < 10; ++iteration)
+                    {
+                        for (Size index = 0; index < instants.getSize(); ++index)
+                        {
+                            if ((manager_.getAp3HourSolarIndicesAt(instants[index]) != referenceApIndices[index]) ||
+                                (manager_.getF107SolarFluxAt(instants[index]) != referenceF107SolarFluxes[index]))
+                            {
+                                mismatchCount++;
+                            }
+                        }
+                    }
+                }
+            ));
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(0, mismatchCount.load());
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_Manager, SetMode)
 {
     {
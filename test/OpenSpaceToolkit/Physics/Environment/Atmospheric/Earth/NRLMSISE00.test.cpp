@@ -980,3 +980,85 @@ TEST(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_NRLMSISE00, GetDensi
         }
     }
 }
+
+TEST(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_NRLMSISE00, GetDensitiesAt)
+{
+    const Array<LLA> llas = {
+        LLA(Angle::Degrees(0.0), Angle::Degrees(0.0), Length::Kilometers(500.0)),
+        LLA(Angle::Degrees(35.076832), Angle::Degrees(-92.546296), Length::Kilometers(350.0)),
+        LLA(Angle::Degrees(-60.0), Angle::Degrees(170.0), Length::Kilometers(250.0)),
+        LLA(Angle::Degrees(80.0), Angle::Degrees(-10.0), Length::Kilometers(800.0)),
+    };
+
+    const Array<Instant> instants = {
+        Instant::DateTime(DateTime::Parse("2021-01-01 00:00:00"), Scale::UTC),
+        Instant::DateTime(DateTime::Parse("2021-01-01 02:59:59"), Scale::UTC),
+        Instant::DateTime(DateTime::Parse("2021-01-01 03:00:00"), Scale::UTC),
+        Instant::DateTime(DateTime::Parse("2021-01-02 03:30:00"), Scale::UTC),
+    };
+
+    const Array<NRLMSISE00> models = {
+        NRLMSISE00(),
+        NRLMSISE00(
+            NRLMSISE00::InputDataType::CSSISpaceWeatherFile,
+            Real::Undefined(),
+            Real::Undefined(),
+            Real::Undefined(),
+            Frame::ITRF(),
+            EarthGravitationalModel::WGS84.equatorialRadius_,
+            EarthGravitationalModel::WGS84.flattening_,
+            std::make_shared<Celestial>(Sun::Default())
+        ),
+        NRLMSISE00(NRLMSISE00::InputDataType::ConstantFluxAndGeoMag, 200.0, 205.0, 3.0),
+    };
+
+    for (const auto& nrlmsise : models)
+    {
+        {
+            const Instant& instant = instants[0];
+
+            const Array<Real> densities = nrlmsise.getDensitiesAt(llas, instant);
+
+            ASSERT_EQ(llas.getSize(), densities.getSize());
+
+            for (Size index = 0; index < llas.getSize(); ++index)
+            {
+                EXPECT_EQ(nrlmsise.getDensityAt(llas[index], instant), densities[index]);
+            }
+        }
+
+        {
+            const Array<Real> densities = nrlmsise.getDensitiesAt(llas, instants);
+
+            ASSERT_EQ(llas.getSize(), densities.getSize());
+
+            for (Size index = 0; index < llas.getSize(); ++index)
+            {
+                EXPECT_EQ(nrlmsise.getDensityAt(llas[index], instants[index]), densities[index]);
+            }
+        }
+
+        {
+            // Concurrent evaluations match sequential ones
+
+            const Array<Real> densities = nrlmsise.getDensitiesAt(llas, instants);
+            const Array<Real> instantDensities = nrlmsise.getDensitiesAt(llas, instants[0]);
+
+            for (const Size threadCount : {2, 4, 32})
+            {
+                EXPECT_EQ(densities, nrlmsise.getDensitiesAt(llas, instants, threadCount)) << threadCount;
+                EXPECT_EQ(instantDensities, nrlmsise.getDensitiesAt(llas, instants[0], threadCount)) << threadCount;
+            }
+        }
+
+        {
+            EXPECT_TRUE(nrlmsise.getDensitiesAt(Array<LLA>::Empty(), instants[0]).isEmpty());
+            EXPECT_TRUE(nrlmsise.getDensitiesAt(Array<LLA>::Empty(), Array<Instant>::Empty()).isEmpty());
+            EXPECT_TRUE(nrlmsise.getDensitiesAt(Array<LLA>::Empty(), instants[0], 4).isEmpty());
+        }
+
+        {
+            EXPECT_ANY_THROW(nrlmsise.getDensitiesAt(llas, Array<Instant> {instants[0]}));
+        }
+    }
+}
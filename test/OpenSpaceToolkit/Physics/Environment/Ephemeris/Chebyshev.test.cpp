@@ -0,0 +1,273 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Ephemeris/Analytical.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Ephemeris/Chebyshev.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Ephemeris/SPICE.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::String;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::environment::ephemeris::Analytical;
+using ostk::physics::environment::ephemeris::Chebyshev;
+using ostk::physics::environment::ephemeris::SPICE;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+
+class OpenSpaceToolkit_Physics_Environment_Ephemeris_Chebyshev : public ::testing::Test
+{
+   protected:
+    const Instant startInstant_ = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+    const Interval interval_ = Interval::Closed(startInstant_, startInstant_ + Duration::Days(2.0));
+
+    const Analytical analytical_ = Analytical(Frame::ITRF());
+};
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Ephemeris_Chebyshev, Constructor)
+{
+    {
+        EXPECT_NO_THROW(Chebyshev(analytical_, interval_, Duration::Hours(6.0)));
+        EXPECT_NO_THROW(Chebyshev(analytical_, interval_, Duration::Hours(6.0), 8));
+    }
+
+    {
+        EXPECT_ANY_THROW(Chebyshev(analytical_, interval_, Duration::Zero()));
+        EXPECT_ANY_THROW(Chebyshev(analytical_, interval_, Duration::Hours(-6.0)));
+        EXPECT_ANY_THROW(Chebyshev(analytical_, interval_, Duration::Hours(6.0), 0));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Ephemeris_Chebyshev, Clone)
+{
+    {
+        const Chebyshev chebyshev = {analytical_, interval_, Duration::Hours(6.0)};
+
+        const Chebyshev* chebyshevPtr = chebyshev.clone();
+
+        EXPECT_TRUE(chebyshevPtr->isDefined());
+        EXPECT_EQ(chebyshev.accessFrame(), chebyshevPtr->accessFrame());
+
+        delete chebyshevPtr;
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Ephemeris_Chebyshev, IsDefined)
+{
+    {
+        EXPECT_TRUE(Chebyshev(analytical_, interval_, Duration::Hours(6.0)).isDefined());
+    }
+
+    {
+        EXPECT_FALSE(Chebyshev(SPICE(SPICE::Object::Undefined), interval_).isDefined());
+        EXPECT_FALSE(Chebyshev(analytical_, Interval::Undefined()).isDefined());
+        EXPECT_FALSE(Chebyshev(analytical_, interval_, Duration::Undefined()).isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Ephemeris_Chebyshev, AccessFrame)
+{
+    {
+        const Chebyshev chebyshev = {analytical_, interval_, Duration::Hours(6.0)};
+
+        EXPECT_NE(nullptr, chebyshev.accessFrame());
+        EXPECT_EQ(Frame::GCRF(), chebyshev.accessFrame()->accessParent());
+
+        // Fits with the same parameters share their frame
+
+        EXPECT_EQ(chebyshev.accessFrame(), Chebyshev(analytical_, interval_, Duration::Hours(6.0)).accessFrame());
+        EXPECT_NE(chebyshev.accessFrame(), Chebyshev(analytical_, interval_, Duration::Hours(3.0)).accessFrame());
+    }
+
+    {
+        // The frame is released along with the last ephemeris sharing it
+
+        Shared<const Frame> frameSPtr = nullptr;
+        String frameName = String::Empty();
+
+        {
+            const Chebyshev chebyshev = {analytical_, interval_, Duration::Hours(6.0)};
+
+            frameSPtr = chebyshev.accessFrame();
+            frameName = frameSPtr->getName();
+
+            {
+                const Chebyshev otherChebyshev = {analytical_, interval_, Duration::Hours(6.0)};
+
+                EXPECT_EQ(frameSPtr, otherChebyshev.accessFrame());
+            }
+
+            EXPECT_TRUE(Frame::Exists(frameName));
+        }
+
+        EXPECT_FALSE(Frame::Exists(frameName));
+
+        // Frames held elsewhere fall back to the wrapped ephemeris
+
+        const Instant instant = interval_.accessStart() + Duration::Hours(7.0);
+
+        EXPECT_GT(
+            1e-12,
+            Frame::GCRF()
+                ->getTransformTo(Frame::ITRF(), instant)
+                .getOrientation()
+                .angularDifferenceWith(Frame::GCRF()->getTransformTo(frameSPtr, instant).getOrientation())
+                .inRadians()
+        );
+
+        // A new fit with the same parameters registers a new frame
+
+        const Chebyshev chebyshev = {analytical_, interval_, Duration::Hours(6.0)};
+
+        EXPECT_TRUE(Frame::Exists(frameName));
+        EXPECT_NE(frameSPtr, chebyshev.accessFrame());
+    }
+
+    {
+        EXPECT_ANY_THROW(Chebyshev(analytical_, Interval::Undefined()).accessFrame());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Ephemeris_Chebyshev, Getters)
+{
+    {
+        const Chebyshev chebyshev = {analytical_, interval_, Duration::Hours(6.0), 10};
+
+        EXPECT_EQ(interval_, chebyshev.accessInterval());
+        EXPECT_EQ(Duration::Hours(6.0), chebyshev.getStep());
+        EXPECT_EQ(10, chebyshev.getDegree());
+
+        EXPECT_TRUE(chebyshev.covers(interval_.accessStart()));
+        EXPECT_TRUE(chebyshev.covers(interval_.accessEnd()));
+        EXPECT_FALSE(chebyshev.covers(interval_.accessEnd() + Duration::Seconds(1.0)));
+
+        EXPECT_GT(1e-6, chebyshev.getPositionAccuracy());
+        EXPECT_GT(1e-12, chebyshev.getOrientationAccuracy());
+    }
+
+    {
+        const Chebyshev chebyshev = {analytical_, Interval::Undefined()};
+
+        EXPECT_ANY_THROW(chebyshev.accessInterval());
+        EXPECT_ANY_THROW(chebyshev.getStep());
+        EXPECT_ANY_THROW(chebyshev.getDegree());
+        EXPECT_ANY_THROW(chebyshev.getPositionAccuracy());
+        EXPECT_ANY_THROW(chebyshev.getOrientationAccuracy());
+        EXPECT_ANY_THROW(chebyshev.covers(Instant::J2000()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Ephemeris_Chebyshev, GetPositionIn)
+{
+    {
+        const SPICE spice = {SPICE::Object::Sun};
+
+        const Chebyshev chebyshev = {spice, interval_};
+
+        for (const Instant& instant : interval_.generateGrid(Duration::Minutes(97.0)))
+        {
+            const Position position = chebyshev.getPositionIn(Frame::GCRF(), instant);
+            const Position referencePosition = spice.getPositionIn(Frame::GCRF(), instant);
+
+            EXPECT_EQ(Frame::GCRF(), position.accessFrame());
+            EXPECT_GT(1e-3, (position.accessCoordinates() - referencePosition.accessCoordinates()).norm())
+                << instant.toString();
+        }
+
+        EXPECT_EQ(0.0, chebyshev.getPositionIn(chebyshev.accessFrame(), startInstant_).accessCoordinates().norm());
+
+        // Outside of the interval, the wrapped ephemeris is used
+
+        {
+            const Instant instant = interval_.accessEnd() + Duration::Hours(1.0);
+
+            EXPECT_GT(
+                1e-3,
+                (chebyshev.getPositionIn(Frame::GCRF(), instant).accessCoordinates() -
+                 spice.getPositionIn(Frame::GCRF(), instant).accessCoordinates())
+                    .norm()
+            );
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(Chebyshev(analytical_, interval_).getPositionIn(Frame::GCRF(), Instant::Undefined()));
+        EXPECT_ANY_THROW(Chebyshev(analytical_, Interval::Undefined()).getPositionIn(Frame::GCRF(), Instant::J2000()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Ephemeris_Chebyshev, GetTransformAt)
+{
+    // Analytical (Earth rotation)
+
+    {
+        const Chebyshev chebyshev = {analytical_, interval_, Duration::Hours(6.0)};
+
+        for (const Instant& instant : interval_.generateGrid(Duration::Minutes(17.0)))
+        {
+            const Transform transform = chebyshev.getTransformAt(instant);
+            const Transform referenceTransform = Frame::GCRF()->getTransformTo(Frame::ITRF(), instant);
+
+            EXPECT_GT(
+                1e-9, transform.getOrientation().angularDifferenceWith(referenceTransform.getOrientation()).inRadians()
+            ) << instant.toString();
+            EXPECT_TRUE(transform.getAngularVelocity().isNear(referenceTransform.getAngularVelocity(), 1e-15))
+                << instant.toString();
+        }
+
+        // Outside of the interval, the wrapped ephemeris is used
+
+        {
+            const Instant instant = interval_.accessEnd() + Duration::Hours(1.0);
+
+            EXPECT_EQ(
+                Frame::GCRF()->getTransformTo(Frame::ITRF(), instant).getOrientation(),
+                chebyshev.getTransformAt(instant).getOrientation()
+            );
+        }
+    }
+
+    // SPICE (Moon)
+
+    {
+        const SPICE spice = {SPICE::Object::Moon};
+
+        const Chebyshev chebyshev = {spice, interval_};
+
+        EXPECT_GT(1e-3, chebyshev.getPositionAccuracy());
+
+        for (const Instant& instant : interval_.generateGrid(Duration::Minutes(97.0)))
+        {
+            const Position position = Position::Meters({0.0, 0.0, 0.0}, chebyshev.accessFrame()).inFrame(
+                Frame::GCRF(), instant
+            );
+            const Position referencePosition =
+                Position::Meters({0.0, 0.0, 0.0}, spice.accessFrame()).inFrame(Frame::GCRF(), instant);
+
+            EXPECT_GT(1e-3, (position.accessCoordinates() - referencePosition.accessCoordinates()).norm())
+                << instant.toString();
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(Chebyshev(analytical_, interval_).getTransformAt(Instant::Undefined()));
+        EXPECT_ANY_THROW(Chebyshev(analytical_, Interval::Undefined()).getTransformAt(Instant::J2000()));
+    }
+}
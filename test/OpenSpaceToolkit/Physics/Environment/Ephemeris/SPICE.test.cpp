@@ -213,6 +213,33 @@ TEST(OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE, AccessFrame)
     }
 }
 
+TEST(OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE, GetPositionIn)
+{
+    {
+        const Instant instant = Instant::DateTime(DateTime(2019, 7, 8, 9, 10, 11, 123), Scale::UTC);
+
+        for (const auto& object : {SPICE::Object::Sun, SPICE::Object::Moon, SPICE::Object::Earth})
+        {
+            const SPICE spice = {object};
+
+            const Position position = spice.getPositionIn(Frame::GCRF(), instant);
+            const Position referencePosition = spice.accessFrame()->getOriginIn(Frame::GCRF(), instant);
+
+            EXPECT_EQ(Frame::GCRF(), position.accessFrame());
+            EXPECT_GT(1e-3, (position.accessCoordinates() - referencePosition.accessCoordinates()).norm())
+                << SPICE::StringFromObject(object);
+
+            EXPECT_EQ(0.0, spice.getPositionIn(spice.accessFrame(), instant).accessCoordinates().norm());
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(SPICE(SPICE::Object::Undefined).getPositionIn(Frame::GCRF(), Instant::J2000()));
+        EXPECT_ANY_THROW(SPICE(SPICE::Object::Sun).getPositionIn(nullptr, Instant::J2000()));
+        EXPECT_ANY_THROW(SPICE(SPICE::Object::Sun).getPositionIn(Frame::GCRF(), Instant::Undefined()));
+    }
+}
+
 TEST(OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE, StringFromObject)
 {
     {
@@ -7,21 +7,28 @@
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Ephemeris/SPICE/Engine.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Ephemeris/SPICE/Kernel.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
 
 using ostk::core::container::Array;
 using ostk::core::filesystem::File;
 using ostk::core::filesystem::Path;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
 using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
 using ostk::physics::environment::ephemeris::SPICE;
 using ostk::physics::environment::ephemeris::spice::Engine;
 using ostk::physics::environment::ephemeris::spice::Kernel;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
 
 class OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Engine : public ::testing::Test
 {
@@ -76,6 +83,17 @@ TEST_F(OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Engine, GetMode)
     EXPECT_EQ(engine_.getMode(), Engine::Mode::Manual);
 }
 
+TEST_F(OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Engine, IsReaderEnabled)
+{
+    EXPECT_TRUE(engine_.isReaderEnabled());
+
+    engine_.setReaderEnabled(false);
+    EXPECT_FALSE(engine_.isReaderEnabled());
+
+    engine_.setReaderEnabled(true);
+    EXPECT_TRUE(engine_.isReaderEnabled());
+}
+
 TEST_F(OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Engine, GetFrameOf)
 {
     {
@@ -96,6 +114,35 @@ TEST_F(OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Engine, GetFrameOf)
     }
 }
 
+TEST_F(OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Engine, GetPositionOf)
+{
+    {
+        const Instant instant = Instant::J2000() + Duration::Days(7305.123);
+
+        for (const bool isReaderEnabled : {true, false})
+        {
+            engine_.setReaderEnabled(isReaderEnabled);
+
+            const Position position = engine_.getPositionOf(SPICE::Object::Moon, instant);
+
+            EXPECT_EQ(Frame::GCRF(), position.accessFrame());
+            EXPECT_NEAR(3.84e8, position.getCoordinates().norm(), 3e7);
+        }
+
+        const Position position = engine_.getPositionOf(SPICE::Object::Moon, instant);
+        const Position referencePosition =
+            engine_.getFrameOf(SPICE::Object::Moon)->getOriginIn(Frame::GCRF(), instant);
+
+        EXPECT_GT(1e-3, (position.accessCoordinates() - referencePosition.accessCoordinates()).norm());
+
+        engine_.setReaderEnabled(true);
+    }
+
+    {
+        EXPECT_ANY_THROW(engine_.getPositionOf(SPICE::Object::Moon, Instant::Undefined()));
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Engine, LoadKernel)
 {
     {
@@ -152,3 +199,45 @@ TEST_F(OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Engine, DefaultKerne
         EXPECT_TRUE(kernel.isDefined());
     }
 }
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Engine, GetKernelCounts)
+{
+    {
+        const Size loadCount = engine_.getKernelLoadCount();
+        const Size unloadCount = engine_.getKernelUnloadCount();
+
+        engine_.unloadKernel(kernel_);
+
+        EXPECT_EQ(loadCount, engine_.getKernelLoadCount());
+        EXPECT_EQ(unloadCount + 1, engine_.getKernelUnloadCount());
+
+        engine_.loadKernel(kernel_);
+        engine_.loadKernel(kernel_);
+
+        EXPECT_EQ(loadCount + 1, engine_.getKernelLoadCount());
+        EXPECT_EQ(unloadCount + 1, engine_.getKernelUnloadCount());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Engine, PrefetchKernels)
+{
+    {
+        engine_.setMode(Engine::Mode::Manual);
+
+        const Size loadCount = engine_.getKernelLoadCount();
+        const Size fetchCount = engine_.getKernelFetchCount();
+
+        EXPECT_NO_THROW(engine_.prefetchKernels(
+            Interval::Closed(Instant::J2000(), Instant::J2000() + Duration::Days(7305.0))
+        ));
+
+        // Nothing is fetched in manual mode
+
+        EXPECT_EQ(loadCount, engine_.getKernelLoadCount());
+        EXPECT_EQ(fetchCount, engine_.getKernelFetchCount());
+    }
+
+    {
+        EXPECT_ANY_THROW(engine_.prefetchKernels(Interval::Undefined()));
+    }
+}
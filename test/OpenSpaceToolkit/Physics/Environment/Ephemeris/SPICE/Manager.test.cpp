@@ -1,5 +1,7 @@
 /// Apache License 2.0
 
+#include <filesystem>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Table.hpp>
 #include <OpenSpaceToolkit/Core/Container/Tuple.hpp>
@@ -231,6 +233,68 @@ TEST_F(OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Manager, FindKernel)
     manager_.getLocalRepository().remove();
 }
 
+TEST_F(OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Manager, FindKernel_Catalog)
+{
+    manager_.setLocalRepository(Directory::Path(
+        Path::Parse("/app/.open-space-toolkit/physics/environment/ephemeris/spice/") +
+        Path::Parse("FindKernelCatalogTest/")
+    ));
+    if (manager_.getLocalRepository().exists())
+    {
+        manager_.getLocalRepository().remove();
+    }
+    manager_.getLocalRepository().create();
+
+    const Path dataPath = Path::Parse("/app/test/OpenSpaceToolkit/Physics/Environment/Ephemeris/SPICE");
+
+    const auto copyKernel = [&dataPath](const String& aKernelName) -> File
+    {
+        const File kernelFile = File::Path(Manager::Get().getLocalRepository().getPath() + Path::Parse(aKernelName));
+
+        std::filesystem::copy_file(
+            std::string((dataPath + Path::Parse(aKernelName)).toString()), std::string(kernelFile.getPath().toString())
+        );
+
+        return kernelFile;
+    };
+
+    // The first lookup builds the catalog
+
+    {
+        const File expectedKernelFile = copyKernel("moon_080317.tf");
+
+        const Kernel foundKernel = manager_.findKernel("^moon_[0-9]*\\.tf$");
+
+        EXPECT_TRUE(foundKernel.isDefined());
+        EXPECT_EQ(
+            expectedKernelFile.getPath().getNormalizedPath(), foundKernel.getFile().getPath().getNormalizedPath()
+        );
+    }
+
+    // Files added after the catalog was built are found
+
+    {
+        const File expectedKernelFile = copyKernel("moon_assoc_me.tf");
+
+        const Kernel foundKernel = manager_.findKernel("^moon_assoc_me\\.tf$");
+
+        EXPECT_TRUE(foundKernel.isDefined());
+        EXPECT_EQ(
+            expectedKernelFile.getPath().getNormalizedPath(), foundKernel.getFile().getPath().getNormalizedPath()
+        );
+    }
+
+    // Refresh drops the catalog, which is rebuilt on the next lookup
+
+    {
+        EXPECT_NO_THROW(manager_.refresh());
+
+        EXPECT_EQ("moon_080317.tf", manager_.findKernel("^moon_[0-9]*\\.tf$").getName());
+    }
+
+    manager_.getLocalRepository().remove();
+}
+
 TEST_F(OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Manager, Get)
 {
     {
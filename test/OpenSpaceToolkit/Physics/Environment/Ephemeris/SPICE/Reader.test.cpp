@@ -0,0 +1,280 @@
+/// Apache License 2.0
+
+#include <gtest/gtest.h>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Tuple.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+#include <OpenSpaceToolkit/Core/Type/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Ephemeris/SPICE/Engine.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Ephemeris/SPICE/Kernel.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Ephemeris/SPICE/Reader.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::container::Tuple;
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+using ostk::core::type::Integer;
+using ostk::core::type::Shared;
+using ostk::core::type::String;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::environment::ephemeris::SPICE;
+using ostk::physics::environment::ephemeris::spice::Engine;
+using ostk::physics::environment::ephemeris::spice::Kernel;
+using ostk::physics::environment::ephemeris::spice::Reader;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+
+static const Path DataPath = Path::Parse("/app/test/OpenSpaceToolkit/Physics/Environment/Ephemeris/SPICE");
+
+static Kernel KernelWithName(const String& aName)
+{
+    return Kernel::File(File::Path(DataPath + Path::Parse(aName)));
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Reader, Constructor)
+{
+    {
+        EXPECT_NO_THROW(Reader());
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Reader, IsEmpty)
+{
+    {
+        EXPECT_TRUE(Reader().isEmpty());
+    }
+
+    {
+        Reader reader;
+
+        reader.loadKernel(KernelWithName("de430.bsp"));
+
+        EXPECT_FALSE(reader.isEmpty());
+    }
+
+    {
+        Reader reader;
+
+        // Leap seconds kernels are not read
+
+        reader.loadKernel(KernelWithName("naif0012.tls"));
+
+        EXPECT_TRUE(reader.isEmpty());
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Reader, LoadKernel)
+{
+    {
+        const Kernel kernel = KernelWithName("de430.bsp");
+
+        Reader reader;
+
+        EXPECT_FALSE(reader.isKernelLoaded(kernel));
+
+        EXPECT_NO_THROW(reader.loadKernel(kernel));
+
+        EXPECT_TRUE(reader.isKernelLoaded(kernel));
+
+        EXPECT_NO_THROW(reader.loadKernel(kernel));
+
+        EXPECT_TRUE(reader.isKernelLoaded(kernel));
+    }
+
+    {
+        EXPECT_ANY_THROW(Reader().loadKernel(Kernel::Undefined()));
+        EXPECT_ANY_THROW(Reader().loadKernel(KernelWithName("does_not_exist.bsp")));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Reader, UnloadKernel)
+{
+    {
+        const Kernel kernel = KernelWithName("de430.bsp");
+
+        Reader reader;
+
+        reader.loadKernel(kernel);
+
+        const Reader readerCopy = reader;
+
+        EXPECT_NO_THROW(reader.unloadKernel(kernel));
+
+        EXPECT_FALSE(reader.isKernelLoaded(kernel));
+        EXPECT_TRUE(reader.isEmpty());
+
+        // Copies are independent snapshots
+
+        EXPECT_TRUE(readerCopy.isKernelLoaded(kernel));
+    }
+
+    {
+        EXPECT_ANY_THROW(Reader().unloadKernel(Kernel::Undefined()));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Reader, GetTransformAt)
+{
+    const Array<String> kernelNames = {
+        "naif0012.tls",
+        "de430.bsp",
+        "pck00010.tpc",
+        "earth_assoc_itrf93.tf",
+        "earth_200101_990628_predict.bpc",
+        "moon_080317.tf",
+        "moon_assoc_me.tf",
+        "moon_pa_de421_1900-2050.bpc"
+    };
+
+    Reader reader;
+
+    Engine& engine = Engine::Get();
+
+    engine.setMode(Engine::Mode::Manual);
+
+    for (const auto& kernelName : kernelNames)
+    {
+        reader.loadKernel(KernelWithName(kernelName));
+        engine.loadKernel(KernelWithName(kernelName));
+    }
+
+    // Reference: CSPICE
+
+    engine.setReaderEnabled(false);
+
+    {
+        const Array<Tuple<SPICE::Object, Integer, String>> testCases = {
+            {SPICE::Object::Sun, 10, "IAU_SUN"},
+            {SPICE::Object::Earth, 399, "ITRF93"},
+            {SPICE::Object::Moon, 301, "MOON_ME"},
+        };
+
+        // Instants which are not used by other tests, to avoid frame caches
+
+        const Instant startInstant = Instant::DateTime(DateTime(2021, 3, 4, 5, 6, 7, 891), Scale::UTC);
+
+        for (const auto& testCase : testCases)
+        {
+            const SPICE::Object object = std::get<0>(testCase);
+            const Integer identifier = std::get<1>(testCase);
+            const String frameName = std::get<2>(testCase);
+
+            const Shared<const Frame> frameSPtr = engine.getFrameOf(object);
+
+            for (int step = 0; step < 10; ++step)
+            {
+                const Instant instant = startInstant + Duration::Hours(37.3 * step);
+
+                const Transform transform = reader.getTransformAt(identifier, frameName, instant);
+
+                ASSERT_TRUE(transform.isDefined()) << frameName << " @ " << instant.toString();
+
+                const Transform referenceTransform = Frame::GCRF()->getTransformTo(frameSPtr, instant);
+
+                EXPECT_TRUE(transform.getTranslation().isNear(referenceTransform.getTranslation(), 1e-3))
+                    << frameName << " @ " << instant.toString() << ": "
+                    << (transform.getTranslation() - referenceTransform.getTranslation()).norm() << " [m]";
+
+                EXPECT_TRUE(transform.getVelocity().isNear(referenceTransform.getVelocity(), 1e-6))
+                    << frameName << " @ " << instant.toString() << ": "
+                    << (transform.getVelocity() - referenceTransform.getVelocity()).norm() << " [m/s]";
+
+                EXPECT_GT(
+                    1e-3,
+                    transform.getOrientation()
+                        .angularDifferenceWith(referenceTransform.getOrientation())
+                        .inArcseconds()
+                ) << frameName
+                  << " @ " << instant.toString();
+
+                EXPECT_TRUE(transform.getAngularVelocity().isNear(referenceTransform.getAngularVelocity(), 1e-12))
+                    << frameName << " @ " << instant.toString() << ": "
+                    << (transform.getAngularVelocity() - referenceTransform.getAngularVelocity()).norm()
+                    << " [rad/s]";
+            }
+        }
+    }
+
+    engine.setReaderEnabled(true);
+    engine.setMode(Engine::Mode::Automatic);
+    engine.reset();
+
+    // Bodies and frames that cannot be evaluated from the loaded kernels
+
+    {
+        const Instant instant = Instant::J2000();
+
+        EXPECT_FALSE(reader.getTransformAt(10, "UNKNOWN_FRAME", instant).isDefined());
+        EXPECT_FALSE(reader.getTransformAt(123456, "J2000", instant).isDefined());
+        EXPECT_FALSE(Reader().getTransformAt(10, "IAU_SUN", instant).isDefined());
+    }
+
+    {
+        EXPECT_ANY_THROW(reader.getTransformAt(Integer::Undefined(), "IAU_SUN", Instant::J2000()));
+        EXPECT_ANY_THROW(reader.getTransformAt(10, "IAU_SUN", Instant::Undefined()));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Ephemeris_SPICE_Reader, GetTranslationAtAndGetRotationAt)
+{
+    Reader reader;
+
+    for (const auto& kernelName : Array<String> {"de430.bsp", "pck00010.tpc"})
+    {
+        reader.loadKernel(KernelWithName(kernelName));
+    }
+
+    {
+        const Instant instant = Instant::DateTime(DateTime(2021, 3, 4, 5, 6, 7, 891), Scale::UTC);
+
+        const Transform translation = reader.getTranslationAt(10, instant);
+        const Transform rotation = reader.getRotationAt("IAU_SUN", instant);
+        const Transform transform = reader.getTransformAt(10, "IAU_SUN", instant);
+
+        ASSERT_TRUE(translation.isDefined());
+        ASSERT_TRUE(rotation.isDefined());
+        ASSERT_TRUE(transform.isDefined());
+
+        EXPECT_EQ(transform.getTranslation(), translation.getTranslation());
+        EXPECT_EQ(transform.getVelocity(), translation.getVelocity());
+        EXPECT_EQ(transform.getOrientation(), rotation.getOrientation());
+        EXPECT_EQ(transform.getAngularVelocity(), rotation.getAngularVelocity());
+
+        EXPECT_EQ(0.0, translation.getAngularVelocity().norm());
+        EXPECT_EQ(0.0, rotation.getTranslation().norm());
+        EXPECT_EQ(0.0, rotation.getVelocity().norm());
+    }
+
+    // Position-only queries do not require orientation kernels
+
+    {
+        Reader spkReader;
+
+        spkReader.loadKernel(KernelWithName("de430.bsp"));
+
+        EXPECT_TRUE(spkReader.getTranslationAt(301, Instant::J2000()).isDefined());
+        EXPECT_FALSE(spkReader.getRotationAt("IAU_SUN", Instant::J2000()).isDefined());
+        EXPECT_FALSE(spkReader.getTransformAt(10, "IAU_SUN", Instant::J2000()).isDefined());
+    }
+
+    {
+        EXPECT_ANY_THROW(reader.getTranslationAt(Integer::Undefined(), Instant::J2000()));
+        EXPECT_ANY_THROW(reader.getTranslationAt(10, Instant::Undefined()));
+        EXPECT_ANY_THROW(reader.getRotationAt("IAU_SUN", Instant::Undefined()));
+    }
+}
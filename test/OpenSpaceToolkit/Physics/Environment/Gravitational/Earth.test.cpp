@@ -20,8 +20,10 @@ using ostk::core::filesystem::Directory;
 using ostk::core::filesystem::Path;
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
+using ostk::mathematics::object::Matrix3d;
 using ostk::mathematics::object::Vector3d;
 
 using ostk::physics::coordinate::Frame;
@@ -179,6 +181,40 @@ TEST(OpenSpaceToolkit_Physics_Environment_Gravitational_Earth, Constructor)
     }
 }
 
+TEST(OpenSpaceToolkit_Physics_Environment_Gravitational_Earth, CopyConstructor)
+{
+    {
+        const Directory dataDirectory =
+            Directory::Path(Path::Parse("/app/test/OpenSpaceToolkit/Physics/Environment/Gravitational/Earth"));
+
+        const EarthGravitationalModel earthGravitationalModel = {
+            EarthGravitationalModel::Type::EGM96, dataDirectory, 20, 20
+        };
+
+        const EarthGravitationalModel copiedEarthGravitationalModel = earthGravitationalModel;
+        const EarthGravitationalModel otherEarthGravitationalModel = {
+            EarthGravitationalModel::Type::EGM96, dataDirectory, 20, 20
+        };
+
+        EarthGravitationalModel assignedEarthGravitationalModel = {EarthGravitationalModel::Type::Spherical};
+        assignedEarthGravitationalModel = earthGravitationalModel;
+
+        const Vector3d position = {7000e3, 0.0, 0.0};
+        const Instant instant = Instant::J2000();
+
+        const Vector3d fieldValue = earthGravitationalModel.getFieldValueAt(position, instant);
+
+        for (const auto& sharingEarthGravitationalModel :
+             {copiedEarthGravitationalModel, otherEarthGravitationalModel, assignedEarthGravitationalModel})
+        {
+            EXPECT_EQ(EarthGravitationalModel::Type::EGM96, sharingEarthGravitationalModel.getType());
+            EXPECT_EQ(20, sharingEarthGravitationalModel.getDegree());
+            EXPECT_EQ(20, sharingEarthGravitationalModel.getOrder());
+            EXPECT_EQ(fieldValue, sharingEarthGravitationalModel.getFieldValueAt(position, instant));
+        }
+    }
+}
+
 TEST(OpenSpaceToolkit_Physics_Environment_Gravitational_Earth, IsDefined)
 {
     {
@@ -791,3 +827,209 @@ TEST(OpenSpaceToolkit_Physics_Environment_Gravitational_Earth, GetFieldValueAtST
         ));
     }
 }
+
+TEST(OpenSpaceToolkit_Physics_Environment_Gravitational_Earth, GetFieldValuesAt)
+{
+    {
+        EarthGravitationalModelManager::Get().setLocalRepository(
+            Directory::Path(Path::Parse("/app/test/OpenSpaceToolkit/Physics/Environment/Gravitational/Earth"))
+        );
+
+        const Array<Vector3d> positions = {
+            {6378137.0, 0.0, 0.0},
+            {7000e3, 0.0, 0.0},
+            {0.0, 7000e3, 0.0},
+            {0.0, 0.0, 7000e3},
+            {4000e3, -3000e3, 5000e3},
+            {-5000e3, 2000e3, -4500e3},
+            {1000e3, 6500e3, 2000e3},
+            {-2500e3, -2500e3, 6000e3},
+            {6700e3, 1200e3, -800e3},
+            {-100e3, 200e3, -6900e3},
+        };
+
+        for (const auto& type :
+             {EarthGravitationalModel::Type::Spherical,
+              EarthGravitationalModel::Type::WGS84,
+              EarthGravitationalModel::Type::EGM96})
+        {
+            const EarthGravitationalModel earthGravitationalModel = {type};
+
+            const Array<Vector3d> fieldValues = earthGravitationalModel.getFieldValuesAt(positions, Instant::J2000());
+
+            ASSERT_EQ(positions.getSize(), fieldValues.getSize());
+
+            for (Size index = 0; index < positions.getSize(); ++index)
+            {
+                const Vector3d fieldValue = earthGravitationalModel.getFieldValueAt(positions[index], Instant::J2000());
+
+                EXPECT_TRUE(fieldValues[index].isNear(fieldValue, 1e-13));
+            }
+        }
+
+        EarthGravitationalModelManager::Get().setLocalRepository(EarthGravitationalModelManager::DefaultLocalRepository(
+        ));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Gravitational_Earth, GetFieldValueAndGradientAt)
+{
+    {
+        EarthGravitationalModelManager::Get().setLocalRepository(
+            Directory::Path(Path::Parse("/app/test/OpenSpaceToolkit/Physics/Environment/Gravitational/Earth"))
+        );
+
+        const Vector3d position = {4000e3, -3000e3, 5000e3};
+
+        for (const auto& type :
+             {EarthGravitationalModel::Type::Spherical,
+              EarthGravitationalModel::Type::WGS84,
+              EarthGravitationalModel::Type::EGM96})
+        {
+            const EarthGravitationalModel earthGravitationalModel = {type, Directory::Undefined(), 20, 0};
+
+            const auto fieldValueAndGradient =
+                earthGravitationalModel.getFieldValueAndGradientAt(position, Instant::J2000());
+
+            EXPECT_TRUE(fieldValueAndGradient.first.isNear(
+                earthGravitationalModel.getFieldValueAt(position, Instant::J2000()), 1e-13
+            ));
+
+            // Central differences of the field
+
+            Matrix3d referenceGradient = Matrix3d::Zero();
+
+            for (Size axis = 0; axis < 3; ++axis)
+            {
+                Vector3d offset = Vector3d::Zero();
+                offset[axis] = 1.0;
+
+                referenceGradient.col(axis) =
+                    (earthGravitationalModel.getFieldValueAt(position + offset, Instant::J2000()) -
+                     earthGravitationalModel.getFieldValueAt(position - offset, Instant::J2000())) /
+                    2.0;
+            }
+
+            EXPECT_TRUE(fieldValueAndGradient.second.isApprox(referenceGradient, 1e-6));
+        }
+
+        EarthGravitationalModelManager::Get().setLocalRepository(EarthGravitationalModelManager::DefaultLocalRepository(
+        ));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Gravitational_Earth, GetFieldValueAtWithTruncationDegree)
+{
+    {
+        EarthGravitationalModelManager::Get().setLocalRepository(
+            Directory::Path(Path::Parse("/app/test/OpenSpaceToolkit/Physics/Environment/Gravitational/Earth"))
+        );
+
+        const EarthGravitationalModel earthGravitationalModel = {EarthGravitationalModel::Type::EGM96};
+
+        const Vector3d position = {4000e3, -3000e3, 5000e3};
+
+        for (const auto& degreeAndOrder : Array<Tuple<Integer, Integer>> {{0, 0}, {2, 0}, {20, 0}, {20, 20}, {70, 70}})
+        {
+            const Integer degree = std::get<0>(degreeAndOrder);
+            const Integer order = std::get<1>(degreeAndOrder);
+
+            const Vector3d fieldValue =
+                earthGravitationalModel.getFieldValueAt(position, Instant::J2000(), degree, order);
+            const Vector3d referenceFieldValue =
+                EarthGravitationalModel(EarthGravitationalModel::Type::EGM96, Directory::Undefined(), degree, order)
+                    .getFieldValueAt(position, Instant::J2000());
+
+            EXPECT_TRUE(fieldValue.isNear(referenceFieldValue, 1e-15 * referenceFieldValue.norm()));
+        }
+
+        EXPECT_TRUE(earthGravitationalModel.getFieldValueAt(position, Instant::J2000(), 360)
+                        .isNear(earthGravitationalModel.getFieldValueAt(position, Instant::J2000()), 1e-15));
+
+        EXPECT_ANY_THROW(earthGravitationalModel.getFieldValueAt(position, Instant::J2000(), 361));
+        EXPECT_ANY_THROW(earthGravitationalModel.getFieldValueAt(position, Instant::J2000(), 20, 21));
+
+        EarthGravitationalModelManager::Get().setLocalRepository(EarthGravitationalModelManager::DefaultLocalRepository(
+        ));
+    }
+
+    {
+        const EarthGravitationalModel earthGravitationalModel = {EarthGravitationalModel::Type::Spherical};
+
+        const Vector3d position = {4000e3, -3000e3, 5000e3};
+
+        EXPECT_EQ(
+            earthGravitationalModel.getFieldValueAt(position, Instant::J2000()),
+            earthGravitationalModel.getFieldValueAt(position, Instant::J2000(), 20, 20)
+        );
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Gravitational_Earth, GetFieldValueAtWithTruncationTolerance)
+{
+    {
+        EarthGravitationalModelManager::Get().setLocalRepository(
+            Directory::Path(Path::Parse("/app/test/OpenSpaceToolkit/Physics/Environment/Gravitational/Earth"))
+        );
+
+        const Real tolerance = 1e-8;
+
+        const EarthGravitationalModel earthGravitationalModel = {EarthGravitationalModel::Type::EGM96};
+        const EarthGravitationalModel adaptiveEarthGravitationalModel = {
+            EarthGravitationalModel::Type::EGM96, Directory::Undefined(), 360, 360, tolerance
+        };
+
+        EXPECT_EQ(tolerance, adaptiveEarthGravitationalModel.getTruncationTolerance());
+        EXPECT_EQ(tolerance, EarthGravitationalModel(adaptiveEarthGravitationalModel).getTruncationTolerance());
+        EXPECT_FALSE(earthGravitationalModel.getTruncationTolerance().isDefined());
+
+        // LEO to GEO: the truncation error is of the order of the tolerance (root mean square over the sphere)
+
+        Array<Vector3d> positions = Array<Vector3d>::Empty();
+
+        for (const auto& radius : {6778137.0, 7078137.0, 8378137.0, 26560000.0, 42164000.0})
+        {
+            positions.add({0.6 * radius, -0.48 * radius, 0.64 * radius});
+            positions.add({-0.8 * radius, 0.0, -0.6 * radius});
+        }
+
+        const Array<Vector3d> fieldValues =
+            adaptiveEarthGravitationalModel.getFieldValuesAt(positions, Instant::J2000());
+
+        for (Size index = 0; index < positions.getSize(); ++index)
+        {
+            const Vector3d referenceFieldValue =
+                earthGravitationalModel.getFieldValueAt(positions[index], Instant::J2000());
+
+            EXPECT_TRUE(adaptiveEarthGravitationalModel.getFieldValueAt(positions[index], Instant::J2000())
+                            .isNear(referenceFieldValue, 10.0 * tolerance));
+            EXPECT_TRUE(fieldValues[index].isNear(referenceFieldValue, 10.0 * tolerance));
+        }
+
+        // Truncation has no effect with a zero tolerance
+
+        const EarthGravitationalModel exactEarthGravitationalModel = {
+            EarthGravitationalModel::Type::EGM96, Directory::Undefined(), 360, 360, 0.0
+        };
+
+        EXPECT_EQ(
+            earthGravitationalModel.getFieldValueAt(positions[0], Instant::J2000()),
+            exactEarthGravitationalModel.getFieldValueAt(positions[0], Instant::J2000())
+        );
+
+        EXPECT_ANY_THROW(EarthGravitationalModel(
+            EarthGravitationalModel::Type::EGM96, Directory::Undefined(), 360, 360, -1e-8
+        ));
+
+        EarthGravitationalModelManager::Get().setLocalRepository(EarthGravitationalModelManager::DefaultLocalRepository(
+        ));
+    }
+
+    {
+        const EarthGravitationalModel earthGravitationalModel = {
+            EarthGravitationalModel::Type::Spherical, Directory::Undefined(), 0, 0, 1e-8
+        };
+
+        EXPECT_FALSE(earthGravitationalModel.getTruncationTolerance().isDefined());
+    }
+}
@@ -0,0 +1,206 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Directory.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth/Manager.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Gridded.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Spherical.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Utility/FieldGrid.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::filesystem::Directory;
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::environment::gravitational::Gridded;
+using ostk::physics::environment::gravitational::Spherical;
+using ostk::physics::environment::utilities::FieldGrid;
+using ostk::physics::time::Instant;
+using ostk::physics::unit::Length;
+using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
+using EarthGravitationalModelManager = ostk::physics::environment::gravitational::earth::Manager;
+
+class OpenSpaceToolkit_Physics_Environment_Gravitational_Gridded : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        EarthGravitationalModelManager::Get().setLocalRepository(
+            Directory::Path(Path::Parse("/app/test/OpenSpaceToolkit/Physics/Environment/Gravitational/Earth"))
+        );
+
+        this->positions_ = Array<Vector3d>::Empty();
+
+        for (Size index = 0; index < 500; ++index)
+        {
+            const double latitude = 1.5 * std::sin(0.37 * static_cast<double>(index));
+            const double longitude = 0.11 * static_cast<double>(index);
+            const double radius = 6678137.0 + 400.0 * static_cast<double>(index);
+
+            this->positions_.add(
+                {radius * std::cos(latitude) * std::cos(longitude),
+                 radius * std::cos(latitude) * std::sin(longitude),
+                 radius * std::sin(latitude)}
+            );
+        }
+    }
+
+    void TearDown() override
+    {
+        EarthGravitationalModelManager::Get().setLocalRepository(
+            EarthGravitationalModelManager::DefaultLocalRepository()
+        );
+    }
+
+    const Length minimumRadius_ = Length::Meters(6678137.0);
+    const Length maximumRadius_ = Length::Meters(6878137.0);
+
+    Array<Vector3d> positions_ = Array<Vector3d>::Empty();
+};
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Gravitational_Gridded, Constructor)
+{
+    {
+        const Spherical spherical = {EarthGravitationalModel::Spherical};
+
+        EXPECT_NO_THROW(Gridded(spherical, minimumRadius_, maximumRadius_, 1e-9));
+    }
+
+    {
+        const EarthGravitationalModel earth = {EarthGravitationalModel::Type::EGM96, 10, 10};
+
+        EXPECT_NO_THROW(Gridded(earth, minimumRadius_, maximumRadius_, 1e-7));
+    }
+
+    {
+        const EarthGravitationalModel earth = {EarthGravitationalModel::Type::EGM96, 10, 10};
+
+        EXPECT_ANY_THROW(Gridded(earth, Length::Undefined(), maximumRadius_, 1e-7));
+        EXPECT_ANY_THROW(Gridded(earth, minimumRadius_, Length::Undefined(), 1e-7));
+        EXPECT_ANY_THROW(Gridded(earth, maximumRadius_, minimumRadius_, 1e-7));
+        EXPECT_ANY_THROW(Gridded(earth, minimumRadius_, maximumRadius_, Real::Undefined()));
+        EXPECT_ANY_THROW(Gridded(earth, minimumRadius_, maximumRadius_, 1e-7, 1024));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Gravitational_Gridded, Clone)
+{
+    {
+        const Spherical spherical = {EarthGravitationalModel::Spherical};
+
+        const Gridded gridded = {spherical, minimumRadius_, maximumRadius_, 1e-9};
+
+        EXPECT_NO_THROW(const Gridded* griddedPtr = gridded.clone(); delete griddedPtr;);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Gravitational_Gridded, IsDefined)
+{
+    {
+        const Spherical spherical = {EarthGravitationalModel::Spherical};
+
+        EXPECT_TRUE(Gridded(spherical, minimumRadius_, maximumRadius_, 1e-9).isDefined());
+        EXPECT_FALSE(Gridded(spherical, FieldGrid::Undefined()).isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Gravitational_Gridded, GetFieldValueAt)
+{
+    {
+        const Spherical spherical = {EarthGravitationalModel::Spherical};
+
+        const Gridded gridded = {spherical, minimumRadius_, maximumRadius_, 1e-9};
+
+        for (const auto& position : positions_)
+        {
+            EXPECT_GT(
+                1e-9,
+                (gridded.getFieldValueAt(position, Instant::J2000()) -
+                 spherical.getFieldValueAt(position, Instant::J2000()))
+                    .norm()
+            );
+        }
+    }
+
+    {
+        const EarthGravitationalModel earth = {EarthGravitationalModel::Type::EGM96, 10, 10};
+
+        const Gridded gridded = {earth, minimumRadius_, maximumRadius_, 1e-7};
+
+        EXPECT_GT(1e-7, gridded.getErrorBound());
+
+        for (const auto& position : positions_)
+        {
+            EXPECT_GT(
+                2e-7,
+                (gridded.getFieldValueAt(position, Instant::J2000()) -
+                 earth.getFieldValueAt(position, Instant::J2000()))
+                    .norm()
+            );
+        }
+
+        // Outside of the altitude band, the original model is used
+
+        const Vector3d lowPosition = {6578137.0, 0.0, 0.0};
+        const Vector3d highPosition = {0.0, 0.0, 42164000.0};
+
+        EXPECT_EQ(
+            earth.getFieldValueAt(lowPosition, Instant::J2000()),
+            gridded.getFieldValueAt(lowPosition, Instant::J2000())
+        );
+        EXPECT_EQ(
+            earth.getFieldValueAt(highPosition, Instant::J2000()),
+            gridded.getFieldValueAt(highPosition, Instant::J2000())
+        );
+    }
+
+    {
+        const Spherical spherical = {EarthGravitationalModel::Spherical};
+
+        EXPECT_ANY_THROW(
+            Gridded(spherical, FieldGrid::Undefined()).getFieldValueAt({6778137.0, 0.0, 0.0}, Instant::J2000())
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Gravitational_Gridded, GetFieldGrid)
+{
+    {
+        const EarthGravitationalModel earth = {EarthGravitationalModel::Type::EGM96, 10, 10};
+
+        const Gridded gridded = {earth, minimumRadius_, maximumRadius_, 1e-7};
+
+        const File file =
+            File::Path(Path::Parse("/tmp/OpenSpaceToolkit_Physics_Environment_Gravitational_Gridded.bin"));
+
+        gridded.getFieldGrid().save(file);
+
+        const Gridded loadedGridded = {earth, FieldGrid::Load(file)};
+
+        EXPECT_EQ(gridded.getErrorBound(), loadedGridded.getErrorBound());
+
+        for (const auto& position : positions_)
+        {
+            EXPECT_EQ(
+                gridded.getFieldValueAt(position, Instant::J2000()),
+                loadedGridded.getFieldValueAt(position, Instant::J2000())
+            );
+        }
+
+        file.remove();
+    }
+}
@@ -0,0 +1,456 @@
+/// Apache License 2.0
+
+#include <cmath>
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/SphericalHarmonics.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+using ostk::core::type::Integer;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Matrix3d;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::environment::gravitational::SphericalHarmonics;
+
+static const double GravitationalParameter = 398600441800000.0;
+static const double ReferenceRadius = 6378137.0;
+
+// Synthetic model of degree 8 and order 6, with a unit central term and small pseudo-random coefficients, or its
+// truncation to a lower degree and order
+
+static SphericalHarmonics SyntheticModel(const Size aDegree = 8, const Size anOrder = 6)
+{
+    const Size degree = aDegree;
+    const Size order = anOrder;
+
+    std::vector<double> cosineCoefficients;
+    std::vector<double> sineCoefficients;
+
+    for (Size m = 0; m <= order; ++m)
+    {
+        for (Size n = m; n <= degree; ++n)
+        {
+            cosineCoefficients.push_back((n == 0) ? 1.0 : 1e-4 * std::sin(static_cast<double>(3 * n + 7 * m)));
+
+            if (m > 0)
+            {
+                sineCoefficients.push_back(1e-4 * std::cos(static_cast<double>(5 * n + 2 * m)));
+            }
+        }
+    }
+
+    return {
+        GravitationalParameter,
+        ReferenceRadius,
+        static_cast<Integer::ValueType>(degree),
+        static_cast<Integer::ValueType>(order),
+        cosineCoefficients,
+        sineCoefficients
+    };
+}
+
+static Array<Vector3d> TestPositions()
+{
+    Array<Vector3d> positions = Array<Vector3d>::Empty();
+
+    for (Size index = 0; index < 13; ++index)
+    {
+        const double latitude = -1.5 + 0.25 * static_cast<double>(index);
+        const double longitude = 0.9 * static_cast<double>(index);
+        const double radius = ReferenceRadius + 300e3 + 500e3 * static_cast<double>(index);
+
+        positions.add(
+            {radius * std::cos(latitude) * std::cos(longitude),
+             radius * std::cos(latitude) * std::sin(longitude),
+             radius * std::sin(latitude)}
+        );
+    }
+
+    positions.add({0.0, 0.0, 7000e3});  // Pole
+
+    return positions;
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Gravitational_SphericalHarmonics, Constructor)
+{
+    {
+        EXPECT_NO_THROW(SyntheticModel());
+        EXPECT_NO_THROW(SphericalHarmonics(GravitationalParameter, ReferenceRadius, 0, 0, {1.0}, {}));
+        EXPECT_NO_THROW(SphericalHarmonics(GravitationalParameter, ReferenceRadius, 2, 0, {1.0, 0.0, -4e-4}, {}));
+    }
+
+    {
+        EXPECT_ANY_THROW(SphericalHarmonics(GravitationalParameter, ReferenceRadius, 2, 0, {1.0, 0.0}, {}));
+        EXPECT_ANY_THROW(SphericalHarmonics(GravitationalParameter, ReferenceRadius, 1, 1, {1.0, 0.0, 0.0}, {}));
+        EXPECT_ANY_THROW(SphericalHarmonics(GravitationalParameter, ReferenceRadius, 1, 2, {1.0, 0.0, 0.0}, {0.0}));
+        EXPECT_ANY_THROW(SphericalHarmonics(GravitationalParameter, ReferenceRadius, -1, 0, {1.0}, {}));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Gravitational_SphericalHarmonics, IsDefined)
+{
+    {
+        EXPECT_TRUE(SyntheticModel().isDefined());
+        EXPECT_FALSE(SphericalHarmonics::Undefined().isDefined());
+        EXPECT_FALSE(SphericalHarmonics(Real::Undefined(), ReferenceRadius, 0, 0, {1.0}, {}).isDefined());
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Gravitational_SphericalHarmonics, Getters)
+{
+    {
+        const SphericalHarmonics model = SyntheticModel();
+
+        EXPECT_EQ(8, model.getDegree());
+        EXPECT_EQ(6, model.getOrder());
+        EXPECT_EQ(GravitationalParameter, model.getGravitationalParameter());
+        EXPECT_EQ(ReferenceRadius, model.getReferenceRadius());
+
+        EXPECT_EQ(1.0, model.getCosineCoefficient(0, 0));
+        EXPECT_EQ(1e-4 * std::sin(3.0 * 5.0 + 7.0 * 4.0), model.getCosineCoefficient(5, 4));
+        EXPECT_EQ(1e-4 * std::cos(5.0 * 8.0 + 2.0 * 6.0), model.getSineCoefficient(8, 6));
+        EXPECT_EQ(0.0, model.getSineCoefficient(3, 0));
+
+        EXPECT_ANY_THROW(model.getCosineCoefficient(9, 0));
+        EXPECT_ANY_THROW(model.getCosineCoefficient(7, 7));
+        EXPECT_ANY_THROW(model.getSineCoefficient(2, 3));
+    }
+
+    {
+        EXPECT_ANY_THROW(SphericalHarmonics::Undefined().getCosineCoefficient(0, 0));
+        EXPECT_ANY_THROW(SphericalHarmonics::Undefined().getSineCoefficient(1, 1));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Gravitational_SphericalHarmonics, GetFieldValueAt)
+{
+    // Point mass
+
+    {
+        const SphericalHarmonics model = {GravitationalParameter, ReferenceRadius, 0, 0, {1.0}, {}};
+
+        for (const auto& position : TestPositions())
+        {
+            const Vector3d expectedFieldValue = -GravitationalParameter / std::pow(position.norm(), 3) * position;
+
+            EXPECT_TRUE(model.getFieldValueAt(position).isNear(expectedFieldValue, 1e-14 * expectedFieldValue.norm()));
+        }
+    }
+
+    // J2: C_20 = - J2 / sqrt(5)
+
+    {
+        const double J2 = 1.08262668e-3;
+
+        const SphericalHarmonics model = {
+            GravitationalParameter, ReferenceRadius, 2, 0, {1.0, 0.0, -J2 / std::sqrt(5.0)}, {}
+        };
+
+        for (const auto& position : TestPositions())
+        {
+            const double r = position.norm();
+            const double z2 = (position.z() * position.z()) / (r * r);
+            const double factor = 1.5 * J2 * (ReferenceRadius * ReferenceRadius) / (r * r);
+
+            const Vector3d expectedFieldValue = {
+                -GravitationalParameter / (r * r * r) * position.x() * (1.0 + factor * (1.0 - 5.0 * z2)),
+                -GravitationalParameter / (r * r * r) * position.y() * (1.0 + factor * (1.0 - 5.0 * z2)),
+                -GravitationalParameter / (r * r * r) * position.z() * (1.0 + factor * (3.0 - 5.0 * z2)),
+            };
+
+            EXPECT_TRUE(model.getFieldValueAt(position).isNear(expectedFieldValue, 1e-13 * expectedFieldValue.norm()));
+        }
+    }
+
+    // Truncation: same values as the model of truncated coefficients
+
+    {
+        const SphericalHarmonics model = SyntheticModel();
+
+        for (const auto& position : TestPositions())
+        {
+            const Vector3d fieldValue = model.getFieldValueAt(position, 5, 3);
+            const Vector3d expectedFieldValue = SyntheticModel(5, 3).getFieldValueAt(position);
+
+            EXPECT_TRUE(fieldValue.isNear(expectedFieldValue, 1e-15 * expectedFieldValue.norm()));
+
+            EXPECT_TRUE(model.getFieldValueAt(position, 4).isNear(
+                SyntheticModel(4, 4).getFieldValueAt(position), 1e-15 * expectedFieldValue.norm()
+            ));
+            EXPECT_TRUE(model.getFieldValueAt(position, 8, 6).isNear(
+                model.getFieldValueAt(position), 1e-15 * expectedFieldValue.norm()
+            ));
+        }
+
+        EXPECT_ANY_THROW(model.getFieldValueAt({7000e3, 0.0, 0.0}, 9));
+        EXPECT_ANY_THROW(model.getFieldValueAt({7000e3, 0.0, 0.0}, 8, 7));
+        EXPECT_ANY_THROW(model.getFieldValueAt({7000e3, 0.0, 0.0}, 4, 5));
+        EXPECT_ANY_THROW(model.getFieldValueAt({7000e3, 0.0, 0.0}, -1));
+    }
+
+    {
+        EXPECT_ANY_THROW(SphericalHarmonics::Undefined().getFieldValueAt({7000e3, 0.0, 0.0}));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Gravitational_SphericalHarmonics, GetFieldValuesAt)
+{
+    const SphericalHarmonics model = SyntheticModel();
+
+    {
+        EXPECT_TRUE(model.getFieldValuesAt(Array<Vector3d>::Empty()).isEmpty());
+    }
+
+    // Partial and full blocks of positions give the same values as single positions
+
+    {
+        const Array<Vector3d> positions = TestPositions();
+
+        const Array<Vector3d> fieldValues = model.getFieldValuesAt(positions);
+
+        ASSERT_EQ(positions.getSize(), fieldValues.getSize());
+
+        for (Size index = 0; index < positions.getSize(); ++index)
+        {
+            const Vector3d fieldValue = model.getFieldValueAt(positions[index]);
+
+            EXPECT_TRUE(fieldValues[index].isNear(fieldValue, 1e-15 * fieldValue.norm()));
+        }
+    }
+
+    {
+        const Array<Vector3d> positions = TestPositions();
+
+        const Array<Vector3d> fieldValues = model.getFieldValuesAt(positions, 5, 3);
+
+        ASSERT_EQ(positions.getSize(), fieldValues.getSize());
+
+        for (Size index = 0; index < positions.getSize(); ++index)
+        {
+            const Vector3d fieldValue = model.getFieldValueAt(positions[index], 5, 3);
+
+            EXPECT_TRUE(fieldValues[index].isNear(fieldValue, 1e-15 * fieldValue.norm()));
+        }
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Gravitational_SphericalHarmonics, GetFieldValueAndGradientAt)
+{
+    // Point mass: G = GM / r^3 (3 u u^T - I)
+
+    {
+        const SphericalHarmonics model = {GravitationalParameter, ReferenceRadius, 0, 0, {1.0}, {}};
+
+        const Vector3d position = {4000e3, -3000e3, 5000e3};
+        const Vector3d direction = position.normalized();
+
+        const Matrix3d expectedGradient = GravitationalParameter / std::pow(position.norm(), 3) *
+                                          (3.0 * direction * direction.transpose() - Matrix3d::Identity());
+
+        const auto fieldValueAndGradient = model.getFieldValueAndGradientAt(position);
+
+        EXPECT_TRUE(fieldValueAndGradient.first.isApprox(model.getFieldValueAt(position), 1e-15));
+        EXPECT_TRUE(fieldValueAndGradient.second.isApprox(expectedGradient, 1e-13));
+    }
+
+    // Gradient matches central differences of the field, and is symmetric
+
+    {
+        const SphericalHarmonics model = SyntheticModel();
+
+        const double step = 1.0;
+
+        for (const auto& position : TestPositions())
+        {
+            const auto fieldValueAndGradient = model.getFieldValueAndGradientAt(position);
+
+            const Matrix3d& gradient = fieldValueAndGradient.second;
+
+            Matrix3d expectedGradient = Matrix3d::Zero();
+
+            for (Size axis = 0; axis < 3; ++axis)
+            {
+                Vector3d offset = Vector3d::Zero();
+                offset[axis] = step;
+
+                expectedGradient.col(axis) =
+                    (model.getFieldValueAt(position + offset) - model.getFieldValueAt(position - offset)) /
+                    (2.0 * step);
+            }
+
+            EXPECT_TRUE(fieldValueAndGradient.first.isApprox(model.getFieldValueAt(position), 1e-15));
+            EXPECT_TRUE(gradient.isApprox(expectedGradient, 1e-6));
+            EXPECT_TRUE(gradient.isApprox(gradient.transpose(), 1e-15));
+        }
+    }
+
+    {
+        const SphericalHarmonics model = SyntheticModel();
+
+        const Array<Vector3d> positions = TestPositions();
+
+        const auto fieldValuesAndGradients = model.getFieldValuesAndGradientsAt(positions);
+
+        ASSERT_EQ(positions.getSize(), fieldValuesAndGradients.first.getSize());
+        ASSERT_EQ(positions.getSize(), fieldValuesAndGradients.second.getSize());
+
+        for (Size index = 0; index < positions.getSize(); ++index)
+        {
+            const auto fieldValueAndGradient = model.getFieldValueAndGradientAt(positions[index]);
+
+            EXPECT_TRUE(fieldValuesAndGradients.first[index].isApprox(fieldValueAndGradient.first, 1e-15));
+            EXPECT_TRUE(fieldValuesAndGradients.second[index].isApprox(fieldValueAndGradient.second, 1e-15));
+        }
+    }
+
+    {
+        const SphericalHarmonics model = SyntheticModel();
+
+        for (const auto& position : TestPositions())
+        {
+            const auto fieldValueAndGradient = model.getFieldValueAndGradientAt(position, 5, 3);
+            const auto expectedFieldValueAndGradient = SyntheticModel(5, 3).getFieldValueAndGradientAt(position);
+
+            EXPECT_TRUE(fieldValueAndGradient.first.isApprox(expectedFieldValueAndGradient.first, 1e-15));
+            EXPECT_TRUE(fieldValueAndGradient.second.isApprox(expectedFieldValueAndGradient.second, 1e-15));
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(SphericalHarmonics::Undefined().getFieldValueAndGradientAt({7000e3, 0.0, 0.0}));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Gravitational_SphericalHarmonics, GetTruncationErrorAt)
+{
+    // Single C_20 term: error of the truncation to degree 1 is sqrt(3 x 5) GM / r^2 (R / r)^2 |C_20|
+
+    {
+        const double cosineCoefficient = -4.84e-4;
+
+        const SphericalHarmonics model = {
+            GravitationalParameter, ReferenceRadius, 2, 0, {1.0, 0.0, cosineCoefficient}, {}
+        };
+
+        const double radius = 7000e3;
+
+        const double expectedError = std::sqrt(15.0) * GravitationalParameter / (radius * radius) *
+                                     std::pow(ReferenceRadius / radius, 2) * std::abs(cosineCoefficient);
+
+        EXPECT_NEAR(expectedError, model.getTruncationErrorAt(radius, 1), 1e-15 * expectedError);
+        EXPECT_NEAR(expectedError, model.getTruncationErrorAt(radius, 0), 1e-15 * expectedError);
+        EXPECT_EQ(0.0, model.getTruncationErrorAt(radius, 2));
+    }
+
+    // Decreasing with degree and radius
+
+    {
+        const SphericalHarmonics model = SyntheticModel();
+
+        for (int degree = 0; degree < 8; ++degree)
+        {
+            EXPECT_GT(model.getTruncationErrorAt(7000e3, degree), model.getTruncationErrorAt(7000e3, degree + 1));
+            EXPECT_GT(model.getTruncationErrorAt(7000e3, degree), model.getTruncationErrorAt(8000e3, degree));
+        }
+
+        EXPECT_EQ(0.0, model.getTruncationErrorAt(7000e3, 8));
+        EXPECT_EQ(0.0, model.getTruncationErrorAt(7000e3, 20));
+    }
+
+    {
+        EXPECT_ANY_THROW(SyntheticModel().getTruncationErrorAt(Real::Undefined(), 2));
+        EXPECT_ANY_THROW(SyntheticModel().getTruncationErrorAt(7000e3, Integer::Undefined()));
+        EXPECT_ANY_THROW(SyntheticModel().getTruncationErrorAt(0.0, 2));
+        EXPECT_ANY_THROW(SyntheticModel().getTruncationErrorAt(7000e3, -1));
+        EXPECT_ANY_THROW(SphericalHarmonics::Undefined().getTruncationErrorAt(7000e3, 2));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Gravitational_SphericalHarmonics, GetTruncationDegreeAt)
+{
+    // Lowest degree meeting the tolerance
+
+    {
+        const SphericalHarmonics model = SyntheticModel();
+
+        for (const auto& radius : {ReferenceRadius, 7000e3, 10000e3, 42164e3})
+        {
+            for (const auto& tolerance : {1e-6, 1e-8, 1e-10})
+            {
+                const Integer degree = model.getTruncationDegreeAt(radius, tolerance);
+
+                EXPECT_LE(model.getTruncationErrorAt(radius, degree), tolerance);
+
+                if (degree > 0)
+                {
+                    EXPECT_GT(model.getTruncationErrorAt(radius, degree - 1), tolerance);
+                }
+            }
+        }
+
+        EXPECT_EQ(8, model.getTruncationDegreeAt(ReferenceRadius, 0.0));
+        EXPECT_EQ(0, model.getTruncationDegreeAt(ReferenceRadius, 1.0));
+        EXPECT_GE(model.getTruncationDegreeAt(7000e3, 1e-8), model.getTruncationDegreeAt(42164e3, 1e-8));
+    }
+
+    {
+        EXPECT_ANY_THROW(SyntheticModel().getTruncationDegreeAt(Real::Undefined(), 1e-8));
+        EXPECT_ANY_THROW(SyntheticModel().getTruncationDegreeAt(7000e3, Real::Undefined()));
+        EXPECT_ANY_THROW(SyntheticModel().getTruncationDegreeAt(-7000e3, 1e-8));
+        EXPECT_ANY_THROW(SyntheticModel().getTruncationDegreeAt(7000e3, -1e-8));
+        EXPECT_ANY_THROW(SphericalHarmonics::Undefined().getTruncationDegreeAt(7000e3, 1e-8));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Gravitational_SphericalHarmonics, Load)
+{
+    const File file =
+        File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Physics/Environment/Gravitational/Earth/egm96.egm"));
+
+    {
+        const SphericalHarmonics model = SphericalHarmonics::Load(file);
+
+        EXPECT_EQ(360, model.getDegree());
+        EXPECT_EQ(360, model.getOrder());
+        EXPECT_EQ(398600441500000.0, model.getGravitationalParameter());
+        EXPECT_EQ(6378136.3, model.getReferenceRadius());
+
+        const Vector3d fieldValue = model.getFieldValueAt({7000e3, 0.0, 0.0});
+
+        EXPECT_TRUE(fieldValue.isNear({-8.14574567850702, -2.19120214388815e-05, 3.01312644719760e-05}, 1e-13));
+    }
+
+    {
+        const SphericalHarmonics model = SphericalHarmonics::Load(file, 20);
+
+        EXPECT_EQ(20, model.getDegree());
+        EXPECT_EQ(20, model.getOrder());
+
+        EXPECT_EQ(SphericalHarmonics::Load(file).getCosineCoefficient(20, 20), model.getCosineCoefficient(20, 20));
+        EXPECT_EQ(SphericalHarmonics::Load(file).getSineCoefficient(12, 7), model.getSineCoefficient(12, 7));
+    }
+
+    {
+        const SphericalHarmonics model = SphericalHarmonics::Load(file, 20, 0);
+
+        EXPECT_EQ(20, model.getDegree());
+        EXPECT_EQ(0, model.getOrder());
+    }
+
+    {
+        EXPECT_ANY_THROW(SphericalHarmonics::Load(File::Undefined()));
+        EXPECT_ANY_THROW(SphericalHarmonics::Load(File::Path(Path::Parse("/does/not/exist.egm"))));
+        EXPECT_ANY_THROW(SphericalHarmonics::Load(file, 2, 3));
+    }
+}
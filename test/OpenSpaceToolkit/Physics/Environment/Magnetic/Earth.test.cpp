@@ -1,5 +1,8 @@
 /// Apache License 2.0
 
+#include <cmath>
+#include <future>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Tuple.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
@@ -18,6 +21,7 @@ using ostk::core::container::Tuple;
 using ostk::core::filesystem::Directory;
 using ostk::core::filesystem::Path;
 using ostk::core::type::Real;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
 using ostk::mathematics::object::Vector3d;
@@ -402,3 +406,154 @@ TEST(OpenSpaceToolkit_Physics_Environment_Magnetic_Earth, GetFieldValueAt)
         EarthMagneticModelManager::Get().setLocalRepository(EarthMagneticModelManager::DefaultLocalRepository());
     }
 }
+
+TEST(OpenSpaceToolkit_Physics_Environment_Magnetic_Earth, GetFieldValueAtWithSecularVariation)
+{
+    {
+        EarthMagneticModelManager::Get().setLocalRepository(
+            Directory::Path(Path::Parse("/app/test/OpenSpaceToolkit/Physics/Environment/Magnetic/Earth"))
+        );
+
+        const EarthMagneticModel earthMagneticModel = {EarthMagneticModel::Type::WMM2015};
+
+        const Vector3d position = {7000e3, 0.0, 0.0};
+
+        const Instant startInstant = Instant::DateTime(DateTime(2015, 1, 1, 0, 0, 0), Scale::UTC);
+        const Instant middleInstant = Instant::DateTime(DateTime(2015, 7, 2, 12, 0, 0), Scale::UTC);
+        const Instant endInstant = Instant::DateTime(DateTime(2016, 1, 1, 0, 0, 0), Scale::UTC);
+
+        const Vector3d startFieldValue = earthMagneticModel.getFieldValueAt(position, startInstant);
+        const Vector3d middleFieldValue = earthMagneticModel.getFieldValueAt(position, middleInstant);
+        const Vector3d endFieldValue = earthMagneticModel.getFieldValueAt(position, endInstant);
+
+        // Secular variation is linear in time within a model
+
+        EXPECT_LT(1e-10, (endFieldValue - startFieldValue).norm());
+        EXPECT_TRUE(middleFieldValue.isNear((startFieldValue + endFieldValue) / 2.0, 1e-15));
+
+        // Evaluations at an instant do not depend on the instant evaluated previously
+
+        EXPECT_EQ(startFieldValue, earthMagneticModel.getFieldValueAt(position, startInstant));
+
+        // Instants evaluated concurrently from several threads share the cached expansions
+
+        Array<Instant> instants = Array<Instant>::Empty();
+
+        for (int index = 0; index < 12; ++index)
+        {
+            instants.add(startInstant + (endInstant - startInstant) * (static_cast<double>(index) / 12.0));
+        }
+
+        const EarthMagneticModel referenceEarthMagneticModel = {EarthMagneticModel::Type::WMM2015};
+
+        Array<Vector3d> referenceFieldValues = Array<Vector3d>::Empty();
+
+        for (const auto& instant : instants)
+        {
+            referenceFieldValues.add(referenceEarthMagneticModel.getFieldValueAt(position, instant));
+        }
+
+        Array<std::future<Array<Vector3d>>> futures = Array<std::future<Array<Vector3d>>>::Empty();
+
+        for (int threadIndex = 0; threadIndex < 4; ++threadIndex)
+        {
+            futures.add(std::async(
+                std::launch::async,
+                [&earthMagneticModel, &instants, &position]() -> Array<Vector3d>
+                {
+                    Array<Vector3d> fieldValues = Array<Vector3d>::Empty();
+
+                    for (int iteration = 0; iteration < 10; ++iteration)
+                    {
+                        for (const auto& instant : instants)
+                        {
+                            fieldValues.add(earthMagneticModel.getFieldValueAt(position, instant));
+                        }
+                    }
+
+                    return fieldValues;
+                }
+            ));
+        }
+
+        for (auto& future : futures)
+        {
+            const Array<Vector3d> fieldValues = future.get();
+
+            ASSERT_EQ(10 * instants.getSize(), fieldValues.getSize());
+
+            for (Size index = 0; index < fieldValues.getSize(); ++index)
+            {
+                EXPECT_EQ(referenceFieldValues[index % instants.getSize()], fieldValues[index]);
+            }
+        }
+
+        EarthMagneticModelManager::Get().setLocalRepository(EarthMagneticModelManager::DefaultLocalRepository());
+    }
+
+    {
+        EarthMagneticModelManager::Get().setLocalRepository(
+            Directory::Path(Path::Parse("/app/test/OpenSpaceToolkit/Physics/Environment/Magnetic/Earth"))
+        );
+
+        const EarthMagneticModel earthMagneticModel = {EarthMagneticModel::Type::WMM2015};
+
+        EXPECT_ANY_THROW(earthMagneticModel.getFieldValueAt(
+            {7000e3, 0.0, 0.0}, Instant::DateTime(DateTime(2030, 1, 1, 0, 0, 0), Scale::UTC)
+        ));
+
+        EarthMagneticModelManager::Get().setLocalRepository(EarthMagneticModelManager::DefaultLocalRepository());
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Magnetic_Earth, GetFieldValuesAt)
+{
+    {
+        EarthMagneticModelManager::Get().setLocalRepository(
+            Directory::Path(Path::Parse("/app/test/OpenSpaceToolkit/Physics/Environment/Magnetic/Earth"))
+        );
+
+        const Instant instant = Instant::DateTime(DateTime(2016, 3, 4, 5, 6, 7), Scale::UTC);
+
+        Array<Vector3d> positions = Array<Vector3d>::Empty();
+
+        for (int index = 0; index < 100; ++index)
+        {
+            const double latitude = 1.5 * std::sin(0.37 * index);
+            const double longitude = 0.11 * index;
+            const double radius = 6678137.0 + 10000.0 * index;
+
+            positions.add(
+                {radius * std::cos(latitude) * std::cos(longitude),
+                 radius * std::cos(latitude) * std::sin(longitude),
+                 radius * std::sin(latitude)}
+            );
+        }
+
+        for (const auto& type :
+             {EarthMagneticModel::Type::Dipole, EarthMagneticModel::Type::IGRF12, EarthMagneticModel::Type::WMM2015})
+        {
+            const EarthMagneticModel earthMagneticModel = {type};
+
+            const Array<Vector3d> fieldValues = earthMagneticModel.getFieldValuesAt(positions, instant);
+
+            ASSERT_EQ(positions.getSize(), fieldValues.getSize());
+
+            for (Size index = 0; index < positions.getSize(); ++index)
+            {
+                const Vector3d referenceFieldValue = earthMagneticModel.getFieldValueAt(positions[index], instant);
+
+                EXPECT_TRUE(fieldValues[index].isNear(referenceFieldValue, 1e-18))
+                    << String::Format("{} ≈ {}", fieldValues[index].toString(), referenceFieldValue.toString());
+            }
+
+            // Copies share the loaded model, and evaluate identically
+
+            const EarthMagneticModel earthMagneticModelCopy = earthMagneticModel;
+
+            EXPECT_EQ(fieldValues, earthMagneticModelCopy.getFieldValuesAt(positions, instant));
+        }
+
+        EarthMagneticModelManager::Get().setLocalRepository(EarthMagneticModelManager::DefaultLocalRepository());
+    }
+}
@@ -0,0 +1,177 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Magnetic/Dipole.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Magnetic/Gridded.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Utility/FieldGrid.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::environment::magnetic::Dipole;
+using ostk::physics::environment::magnetic::Gridded;
+using ostk::physics::environment::utilities::FieldGrid;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::unit::Length;
+
+class OpenSpaceToolkit_Physics_Environment_Magnetic_Gridded : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        this->positions_ = Array<Vector3d>::Empty();
+
+        for (Size index = 0; index < 500; ++index)
+        {
+            const double latitude = 1.5 * std::sin(0.37 * static_cast<double>(index));
+            const double longitude = 0.11 * static_cast<double>(index);
+            const double radius = 6678137.0 + 400.0 * static_cast<double>(index);
+
+            this->positions_.add(
+                {radius * std::cos(latitude) * std::cos(longitude),
+                 radius * std::cos(latitude) * std::sin(longitude),
+                 radius * std::sin(latitude)}
+            );
+        }
+    }
+
+    const Dipole dipole_ = {{1e21, 2e21, -8e22}};
+
+    const Instant epoch_ = Instant::J2000();
+
+    const Length minimumRadius_ = Length::Meters(6678137.0);
+    const Length maximumRadius_ = Length::Meters(6878137.0);
+
+    Array<Vector3d> positions_ = Array<Vector3d>::Empty();
+};
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Magnetic_Gridded, Constructor)
+{
+    {
+        EXPECT_NO_THROW(Gridded(dipole_, epoch_, minimumRadius_, maximumRadius_, 1e-10));
+    }
+
+    {
+        EXPECT_ANY_THROW(Gridded(dipole_, Instant::Undefined(), minimumRadius_, maximumRadius_, 1e-10));
+        EXPECT_ANY_THROW(Gridded(dipole_, epoch_, Length::Undefined(), maximumRadius_, 1e-10));
+        EXPECT_ANY_THROW(Gridded(dipole_, epoch_, minimumRadius_, Length::Undefined(), 1e-10));
+        EXPECT_ANY_THROW(Gridded(dipole_, epoch_, maximumRadius_, minimumRadius_, 1e-10));
+        EXPECT_ANY_THROW(Gridded(dipole_, epoch_, minimumRadius_, maximumRadius_, Real::Undefined()));
+        EXPECT_ANY_THROW(Gridded(dipole_, epoch_, minimumRadius_, maximumRadius_, 1e-10, 1024));
+        EXPECT_ANY_THROW(Gridded(dipole_, epoch_, FieldGrid::Undefined(), Duration::Undefined()));
+        EXPECT_ANY_THROW(Gridded(dipole_, epoch_, FieldGrid::Undefined(), Duration::Days(-1.0)));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Magnetic_Gridded, Clone)
+{
+    {
+        const Gridded gridded = {dipole_, epoch_, minimumRadius_, maximumRadius_, 1e-10};
+
+        EXPECT_NO_THROW(const Gridded* griddedPtr = gridded.clone(); delete griddedPtr;);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Magnetic_Gridded, IsDefined)
+{
+    {
+        EXPECT_TRUE(Gridded(dipole_, epoch_, minimumRadius_, maximumRadius_, 1e-10).isDefined());
+        EXPECT_FALSE(Gridded(dipole_, epoch_, FieldGrid::Undefined()).isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Magnetic_Gridded, Getters)
+{
+    {
+        const Gridded gridded = {dipole_, epoch_, minimumRadius_, maximumRadius_, 1e-10};
+
+        EXPECT_EQ(epoch_, gridded.getEpoch());
+        EXPECT_EQ(Gridded::DefaultValidityDuration, gridded.getValidityDuration());
+        EXPECT_TRUE(gridded.getFieldGrid().isDefined());
+        EXPECT_GT(1e-10, gridded.getErrorBound());
+        EXPECT_TRUE(gridded.accessModel().isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Magnetic_Gridded, GetFieldValueAt)
+{
+    {
+        const Gridded gridded = {dipole_, epoch_, minimumRadius_, maximumRadius_, 1e-10};
+
+        for (const auto& position : positions_)
+        {
+            EXPECT_GT(
+                2e-10, (gridded.getFieldValueAt(position, epoch_) - dipole_.getFieldValueAt(position, epoch_)).norm()
+            );
+        }
+
+        // Within the altitude band, the field is frozen at the epoch
+
+        const Vector3d position = positions_[0];
+        const Instant instant = epoch_ + Duration::Days(10.0);
+
+        EXPECT_EQ(gridded.getFieldValueAt(position, epoch_), gridded.getFieldValueAt(position, instant));
+
+        // Outside of the altitude band, the original model is used
+
+        const Vector3d highPosition = {0.0, 0.0, 42164000.0};
+
+        EXPECT_EQ(dipole_.getFieldValueAt(highPosition, instant), gridded.getFieldValueAt(highPosition, instant));
+
+        // Away from the epoch, the original model is used
+
+        const Vector3d offGridPosition = positions_[7];
+
+        const Instant laterInstant = epoch_ + Duration::Days(365.0);
+        const Instant earlierInstant = epoch_ - Duration::Days(365.0);
+
+        EXPECT_NE(dipole_.getFieldValueAt(offGridPosition, epoch_), gridded.getFieldValueAt(offGridPosition, epoch_));
+        EXPECT_EQ(
+            dipole_.getFieldValueAt(offGridPosition, laterInstant),
+            gridded.getFieldValueAt(offGridPosition, laterInstant)
+        );
+        EXPECT_EQ(
+            dipole_.getFieldValueAt(offGridPosition, earlierInstant),
+            gridded.getFieldValueAt(offGridPosition, earlierInstant)
+        );
+    }
+
+    {
+        const Gridded gridded = {
+            dipole_, epoch_, minimumRadius_, maximumRadius_, 1e-10, Gridded::DefaultMemoryBudget, Duration::Days(400.0)
+        };
+
+        const Vector3d offGridPosition = positions_[7];
+
+        const Instant laterInstant = epoch_ + Duration::Days(365.0);
+        const Instant distantInstant = epoch_ + Duration::Days(500.0);
+
+        EXPECT_EQ(
+            gridded.getFieldValueAt(offGridPosition, epoch_), gridded.getFieldValueAt(offGridPosition, laterInstant)
+        );
+        EXPECT_EQ(
+            dipole_.getFieldValueAt(offGridPosition, distantInstant),
+            gridded.getFieldValueAt(offGridPosition, distantInstant)
+        );
+    }
+
+    {
+        EXPECT_ANY_THROW(
+            Gridded(dipole_, epoch_, FieldGrid::Undefined()).getFieldValueAt({6778137.0, 0.0, 0.0}, epoch_)
+        );
+        EXPECT_ANY_THROW(Gridded(dipole_, epoch_, minimumRadius_, maximumRadius_, 1e-10)
+                             .getFieldValueAt({6778137.0, 0.0, 0.0}, Instant::Undefined()));
+    }
+}
@@ -40,6 +40,7 @@ using ostk::physics::coordinate::spherical::LLA;
 using ostk::physics::Environment;
 using ostk::physics::environment::object::celestial::Earth;
 using ostk::physics::environment::utilities::eclipseIntervalsAtPosition;
+using ostk::physics::environment::utilities::shadowFunctionAtPosition;
 using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
 
 TEST(OpenSpaceToolkit_Physics_Environment_Utility_Eclipse, EclipseIntervalsAtPosition)
@@ -148,3 +149,134 @@ TEST(OpenSpaceToolkit_Physics_Environment_Utility_Eclipse, EclipseIntervalsAtPos
         }
     }
 }
+
+TEST(OpenSpaceToolkit_Physics_Environment_Utility_Eclipse, ShadowFunctionAtPosition)
+{
+    const Position position_ITRF = Position::Meters(
+        LLA(Angle::Degrees(0.0), Angle::Degrees(0.0), Length::Meters(10.0))
+            .toCartesian(
+                EarthGravitationalModel::EGM2008.equatorialRadius_, EarthGravitationalModel::EGM2008.flattening_
+            ),
+        Frame::ITRF()
+    );
+    const Environment environment = Environment::Default();
+
+    {
+        // Night (umbra) and day
+
+        const Instant nightInstant = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+        const Instant dayInstant = Instant::DateTime(DateTime(2018, 1, 1, 12, 0, 0), Scale::UTC);
+
+        EXPECT_GT(0.0, shadowFunctionAtPosition(nightInstant, position_ITRF, environment));
+        EXPECT_GT(0.0, shadowFunctionAtPosition(nightInstant, position_ITRF, environment, true));
+
+        EXPECT_LT(0.0, shadowFunctionAtPosition(dayInstant, position_ITRF, environment));
+        EXPECT_LT(0.0, shadowFunctionAtPosition(dayInstant, position_ITRF, environment, true));
+    }
+
+    {
+        // Penumbra (sunset, per reference data)
+
+        const Instant penumbraInstant = Instant::DateTime(DateTime(2018, 1, 1, 18, 3, 40), Scale::UTC);
+
+        EXPECT_LT(0.0, shadowFunctionAtPosition(penumbraInstant, position_ITRF, environment));
+        EXPECT_GT(0.0, shadowFunctionAtPosition(penumbraInstant, position_ITRF, environment, true));
+    }
+
+    {
+        EXPECT_ANY_THROW(shadowFunctionAtPosition(Instant::Undefined(), position_ITRF, environment));
+        EXPECT_ANY_THROW(shadowFunctionAtPosition(Instant::J2000(), Position::Undefined(), environment));
+        EXPECT_ANY_THROW(shadowFunctionAtPosition(Instant::J2000(), position_ITRF, Environment::Undefined()));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Utility_Eclipse, EclipseIntervalsAtPosition_Boundaries)
+{
+    const Interval analysisInterval = Interval::Closed(
+        Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC),
+        Instant::DateTime(DateTime(2018, 1, 2, 0, 0, 0), Scale::UTC)
+    );
+    const Position position_ITRF = Position::Meters(
+        LLA(Angle::Degrees(0.0), Angle::Degrees(0.0), Length::Meters(10.0))
+            .toCartesian(
+                EarthGravitationalModel::EGM2008.equatorialRadius_, EarthGravitationalModel::EGM2008.flattening_
+            ),
+        Frame::ITRF()
+    );
+    const Environment environment = Environment::Default();
+
+    const Duration durationTolerance = Duration::Seconds(15.0);
+
+    const auto instantFromString = [](const String& aString) -> Instant
+    {
+        return Instant::DateTime(DateTime::Parse(aString), Scale::UTC);
+    };
+
+    // Umbra (reference: Target_1)
+
+    {
+        const Array<Interval> eclipseIntervals =
+            eclipseIntervalsAtPosition(analysisInterval, position_ITRF, environment);
+
+        ASSERT_EQ(2, eclipseIntervals.getSize());
+
+        EXPECT_EQ(analysisInterval.getStart(), eclipseIntervals.at(0).getStart());
+        EXPECT_TRUE(eclipseIntervals.at(0).getEnd().isNear(
+            instantFromString("2018-01-01 06:02:18.211"), durationTolerance
+        )) << eclipseIntervals.at(0).toString();
+        EXPECT_TRUE(eclipseIntervals.at(1).getStart().isNear(
+            instantFromString("2018-01-01 18:04:52.262"), durationTolerance
+        )) << eclipseIntervals.at(1).toString();
+        EXPECT_EQ(analysisInterval.getEnd(), eclipseIntervals.at(1).getEnd());
+    }
+
+    // Umbra and penumbra
+
+    {
+        const Array<Interval> eclipseIntervals =
+            eclipseIntervalsAtPosition(analysisInterval, position_ITRF, environment, true);
+
+        ASSERT_EQ(2, eclipseIntervals.getSize());
+
+        EXPECT_TRUE(eclipseIntervals.at(0).getEnd().isNear(
+            instantFromString("2018-01-01 06:04:39.519"), durationTolerance
+        )) << eclipseIntervals.at(0).toString();
+        EXPECT_TRUE(eclipseIntervals.at(1).getStart().isNear(
+            instantFromString("2018-01-01 18:02:30.998"), durationTolerance
+        )) << eclipseIntervals.at(1).toString();
+    }
+
+    // Boundaries do not depend on the search step
+
+    {
+        const Array<Interval> eclipseIntervals = eclipseIntervalsAtPosition(
+            analysisInterval, position_ITRF, environment, false, Duration::Minutes(1.0), Duration::Microseconds(1.0)
+        );
+        const Array<Interval> referenceEclipseIntervals =
+            eclipseIntervalsAtPosition(analysisInterval, position_ITRF, environment);
+
+        ASSERT_EQ(referenceEclipseIntervals.getSize(), eclipseIntervals.getSize());
+
+        for (Index index = 0; index < eclipseIntervals.getSize(); ++index)
+        {
+            EXPECT_TRUE(eclipseIntervals.at(index).getStart().isNear(
+                referenceEclipseIntervals.at(index).getStart(), Duration::Milliseconds(2.0)
+            ));
+            EXPECT_TRUE(eclipseIntervals.at(index).getEnd().isNear(
+                referenceEclipseIntervals.at(index).getEnd(), Duration::Milliseconds(2.0)
+            ));
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(eclipseIntervalsAtPosition(
+            analysisInterval, position_ITRF, environment, false, Duration::Zero(), Duration::Milliseconds(1.0)
+        ));
+        EXPECT_ANY_THROW(eclipseIntervalsAtPosition(
+            analysisInterval, position_ITRF, environment, false, Duration::Minutes(1.0), Duration::Zero()
+        ));
+        EXPECT_ANY_THROW(eclipseIntervalsAtPosition(
+            analysisInterval, position_ITRF, environment, false, Duration::Undefined(), Duration::Milliseconds(1.0)
+        ));
+    }
+}
@@ -0,0 +1,218 @@
+/// Apache License 2.0
+
+#include <cmath>
+#include <random>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Utility/FieldGrid.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::environment::utilities::FieldGrid;
+
+// Dipole-like field, with a longitude dependence, of unit magnitude on the unit sphere
+
+static Array<Vector3d> DipoleFieldValuesAt(const Array<Vector3d>& aPositionArray)
+{
+    Array<Vector3d> fieldValues = Array<Vector3d>::Empty();
+
+    const Vector3d moment = {0.1, 0.2, 1.0};
+
+    for (const auto& position : aPositionArray)
+    {
+        const double r = position.norm();
+
+        fieldValues.add((3.0 * position * position.dot(moment) / (r * r) - moment) / (r * r * r));
+    }
+
+    return fieldValues;
+}
+
+static Array<Vector3d> RandomPositionsBetween(const double aMinimumRadius, const double aMaximumRadius)
+{
+    std::mt19937 generator {42};
+    std::uniform_real_distribution<double> radii {aMinimumRadius, aMaximumRadius};
+    std::normal_distribution<double> directions {0.0, 1.0};
+
+    Array<Vector3d> positions = Array<Vector3d>::Empty();
+
+    for (Size index = 0; index < 1000; ++index)
+    {
+        const Vector3d direction = {directions(generator), directions(generator), directions(generator)};
+
+        positions.add(radii(generator) * direction.normalized());
+    }
+
+    return positions;
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Utility_FieldGrid, Constructor)
+{
+    {
+        EXPECT_NO_THROW(FieldGrid(DipoleFieldValuesAt, 1.0, 1.1, 1e-6, 64 * 1024 * 1024));
+    }
+
+    {
+        EXPECT_ANY_THROW(FieldGrid(FieldGrid::FieldFunction(), 1.0, 1.1, 1e-6, 64 * 1024 * 1024));
+        EXPECT_ANY_THROW(FieldGrid(DipoleFieldValuesAt, Real::Undefined(), 1.1, 1e-6, 64 * 1024 * 1024));
+        EXPECT_ANY_THROW(FieldGrid(DipoleFieldValuesAt, 1.0, Real::Undefined(), 1e-6, 64 * 1024 * 1024));
+        EXPECT_ANY_THROW(FieldGrid(DipoleFieldValuesAt, 1.0, 1.1, Real::Undefined(), 64 * 1024 * 1024));
+    }
+
+    {
+        EXPECT_ANY_THROW(FieldGrid(DipoleFieldValuesAt, 0.0, 1.1, 1e-6, 64 * 1024 * 1024));
+        EXPECT_ANY_THROW(FieldGrid(DipoleFieldValuesAt, 1.1, 1.0, 1e-6, 64 * 1024 * 1024));
+        EXPECT_ANY_THROW(FieldGrid(DipoleFieldValuesAt, 1.0, 1.1, 0.0, 64 * 1024 * 1024));
+    }
+
+    {
+        EXPECT_ANY_THROW(FieldGrid(DipoleFieldValuesAt, 1.0, 1.1, 1e-9, 1024 * 1024));
+    }
+
+    {
+        const FieldGrid::FieldFunction fieldFunction = [](const Array<Vector3d>& aPositionArray) -> Array<Vector3d>
+        {
+            (void)aPositionArray;
+
+            return Array<Vector3d>::Empty();
+        };
+
+        EXPECT_ANY_THROW(FieldGrid(fieldFunction, 1.0, 1.1, 1e-6, 64 * 1024 * 1024));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Utility_FieldGrid, IsDefined)
+{
+    {
+        const FieldGrid fieldGrid = {DipoleFieldValuesAt, 1.0, 1.1, 1e-6, 64 * 1024 * 1024};
+
+        EXPECT_TRUE(fieldGrid.isDefined());
+    }
+
+    {
+        EXPECT_FALSE(FieldGrid::Undefined().isDefined());
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Utility_FieldGrid, Contains)
+{
+    {
+        const FieldGrid fieldGrid = {DipoleFieldValuesAt, 1.0, 1.1, 1e-6, 64 * 1024 * 1024};
+
+        EXPECT_TRUE(fieldGrid.contains({1.0, 0.0, 0.0}));
+        EXPECT_TRUE(fieldGrid.contains({0.0, 0.0, -1.05}));
+        EXPECT_TRUE(fieldGrid.contains({0.0, 1.1, 0.0}));
+
+        EXPECT_FALSE(fieldGrid.contains({0.99, 0.0, 0.0}));
+        EXPECT_FALSE(fieldGrid.contains({0.0, 0.0, 1.11}));
+        EXPECT_FALSE(fieldGrid.contains(Vector3d::Zero()));
+    }
+
+    {
+        EXPECT_ANY_THROW(FieldGrid::Undefined().contains({1.0, 0.0, 0.0}));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Utility_FieldGrid, Getters)
+{
+    {
+        const FieldGrid fieldGrid = {DipoleFieldValuesAt, 1.0, 1.1, 1e-6, 64 * 1024 * 1024};
+
+        EXPECT_EQ(1.0, fieldGrid.getMinimumRadius());
+        EXPECT_EQ(1.1, fieldGrid.getMaximumRadius());
+
+        EXPECT_LT(0.0, fieldGrid.getErrorBound());
+        EXPECT_GT(1e-6, fieldGrid.getErrorBound());
+
+        const Array<Size> nodeCounts = fieldGrid.getNodeCounts();
+
+        EXPECT_EQ(3, nodeCounts.getSize());
+        EXPECT_EQ(nodeCounts[0] * nodeCounts[1] * nodeCounts[2] * 3 * sizeof(double), fieldGrid.getMemorySize());
+    }
+
+    {
+        EXPECT_ANY_THROW(FieldGrid::Undefined().getMinimumRadius());
+        EXPECT_ANY_THROW(FieldGrid::Undefined().getMaximumRadius());
+        EXPECT_ANY_THROW(FieldGrid::Undefined().getErrorBound());
+        EXPECT_ANY_THROW(FieldGrid::Undefined().getNodeCounts());
+        EXPECT_ANY_THROW(FieldGrid::Undefined().getMemorySize());
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Utility_FieldGrid, GetValueAt)
+{
+    {
+        const FieldGrid fieldGrid = {DipoleFieldValuesAt, 1.0, 1.1, 1e-6, 64 * 1024 * 1024};
+
+        const Array<Vector3d> positions = RandomPositionsBetween(1.0, 1.1);
+        const Array<Vector3d> fieldValues = DipoleFieldValuesAt(positions);
+
+        for (Size index = 0; index < positions.getSize(); ++index)
+        {
+            EXPECT_GT(2e-6, (fieldGrid.getValueAt(positions[index]) - fieldValues[index]).norm());
+        }
+    }
+
+    {
+        const FieldGrid fieldGrid = {DipoleFieldValuesAt, 1.0, 1.1, 1e-6, 64 * 1024 * 1024};
+
+        const Array<Vector3d> positions = {{0.0, 0.0, 1.05}, {0.0, 0.0, -1.05}, {1.0, 0.0, 0.0}, {0.0, 0.0, 1.1}};
+        const Array<Vector3d> fieldValues = DipoleFieldValuesAt(positions);
+
+        for (Size index = 0; index < positions.getSize(); ++index)
+        {
+            EXPECT_GT(2e-6, (fieldGrid.getValueAt(positions[index]) - fieldValues[index]).norm());
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(FieldGrid::Undefined().getValueAt({1.0, 0.0, 0.0}));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Utility_FieldGrid, SaveAndLoad)
+{
+    {
+        const FieldGrid fieldGrid = {DipoleFieldValuesAt, 1.0, 1.1, 1e-6, 64 * 1024 * 1024};
+
+        const File file = File::Path(Path::Parse("/tmp/OpenSpaceToolkit_Physics_Environment_Utility_FieldGrid.bin"));
+
+        fieldGrid.save(file);
+
+        const FieldGrid loadedFieldGrid = FieldGrid::Load(file);
+
+        EXPECT_TRUE(loadedFieldGrid.isDefined());
+
+        EXPECT_EQ(fieldGrid.getMinimumRadius(), loadedFieldGrid.getMinimumRadius());
+        EXPECT_EQ(fieldGrid.getMaximumRadius(), loadedFieldGrid.getMaximumRadius());
+        EXPECT_EQ(fieldGrid.getErrorBound(), loadedFieldGrid.getErrorBound());
+        EXPECT_EQ(fieldGrid.getNodeCounts(), loadedFieldGrid.getNodeCounts());
+
+        for (const auto& position : RandomPositionsBetween(1.0, 1.1))
+        {
+            EXPECT_EQ(fieldGrid.getValueAt(position), loadedFieldGrid.getValueAt(position));
+        }
+
+        file.remove();
+    }
+
+    {
+        EXPECT_ANY_THROW(FieldGrid::Undefined().save(File::Path(Path::Parse("/tmp/FieldGrid.bin"))));
+    }
+
+    {
+        EXPECT_ANY_THROW(FieldGrid::Load(File::Undefined()));
+        EXPECT_ANY_THROW(FieldGrid::Load(File::Path(Path::Parse("/does/not/exist.bin"))));
+    }
+}
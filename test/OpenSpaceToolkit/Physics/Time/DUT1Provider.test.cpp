@@ -0,0 +1,81 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Physics/Time/DUT1Provider.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::physics::time::DateTime;
+using ostk::physics::time::DUT1Provider;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+
+class ConstantDUT1Provider : public DUT1Provider
+{
+   public:
+    ConstantDUT1Provider(const Real& aUt1MinusUtc)
+        : ut1MinusUtc_(aUt1MinusUtc)
+    {
+    }
+
+    virtual Real getUt1MinusUtcAt([[maybe_unused]] const Instant& anInstant) const override
+    {
+        return ut1MinusUtc_;
+    }
+
+    virtual Size getRevision() const override
+    {
+        return 0;
+    }
+
+   private:
+    Real ut1MinusUtc_;
+};
+
+TEST(OpenSpaceToolkit_Physics_Time_DUT1Provider, Access)
+{
+    {
+        EXPECT_NE(nullptr, DUT1Provider::Access());
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Time_DUT1Provider, Set)
+{
+    {
+        EXPECT_ANY_THROW(DUT1Provider::Set(nullptr));
+    }
+
+    {
+        const DUT1Provider* previousDUT1ProviderPtr = DUT1Provider::Access();
+
+        const Shared<const DUT1Provider> dUT1ProviderSPtr = std::make_shared<const ConstantDUT1Provider>(0.25);
+
+        DUT1Provider::Set(dUT1ProviderSPtr);
+
+        EXPECT_EQ(dUT1ProviderSPtr.get(), DUT1Provider::Access());
+
+        const Instant instant = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+
+        EXPECT_EQ(DateTime(2020, 1, 1, 0, 0, 0, 250), instant.getDateTime(Scale::UT1));
+        EXPECT_TRUE(Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0, 250), Scale::UT1)
+                        .isNear(instant, Duration::Nanoseconds(1.0)));
+
+        // Cached conversions are not reused across providers
+
+        DUT1Provider::Set(std::make_shared<const ConstantDUT1Provider>(-0.5));
+
+        EXPECT_EQ(DateTime(2019, 12, 31, 23, 59, 59, 500), instant.getDateTime(Scale::UT1));
+
+        // Restore the IERS provider for subsequent tests
+
+        DUT1Provider::Set(Shared<const DUT1Provider>(previousDUT1ProviderPtr, [](const DUT1Provider*) {}));
+    }
+}
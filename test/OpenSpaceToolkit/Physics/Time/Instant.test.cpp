@@ -1,8 +1,11 @@
 /// Apache License 2.0
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/Manager.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
 #include <Global.test.hpp>
@@ -1121,6 +1124,32 @@ TEST(OpenSpaceToolkit_Physics_Time_Instant, IsNear)
     }
 }
 
+TEST(OpenSpaceToolkit_Physics_Time_Instant, GetRepresentationHash)
+{
+    using ostk::physics::time::Scale;
+    using ostk::physics::time::DateTime;
+    using ostk::physics::time::Instant;
+    using ostk::physics::time::Duration;
+
+    {
+        const Instant instant = Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC);
+
+        EXPECT_EQ(
+            instant.getRepresentationHash(),
+            Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC).getRepresentationHash()
+        );
+        EXPECT_NE(instant.getRepresentationHash(), (instant + Duration::Seconds(1.0)).getRepresentationHash());
+        EXPECT_NE(
+            instant.getRepresentationHash(),
+            Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::TAI).getRepresentationHash()
+        );
+    }
+
+    {
+        EXPECT_ANY_THROW(Instant::Undefined().getRepresentationHash());
+    }
+}
+
 TEST(OpenSpaceToolkit_Physics_Time_Instant, GetDateTime)
 {
     using ostk::physics::time::Scale;
@@ -1220,6 +1249,123 @@ TEST(OpenSpaceToolkit_Physics_Time_Instant, GetModifiedJulianDate)
     }
 }
 
+TEST(OpenSpaceToolkit_Physics_Time_Instant, GetJulianDateParts)
+{
+    using ostk::core::container::Pair;
+    using ostk::core::type::Real;
+
+    using ostk::physics::time::Scale;
+    using ostk::physics::time::DateTime;
+    using ostk::physics::time::Duration;
+    using ostk::physics::time::Instant;
+
+    {
+        for (auto const& scale : scales)
+        {
+            EXPECT_EQ(
+                Pair<Real, Real>(2451545.0, 0.0),
+                Instant::DateTime(DateTime(2000, 1, 1, 12, 0, 0), scale).getJulianDateParts(scale)
+            );
+            EXPECT_EQ(
+                Pair<Real, Real>(2451545.0, 0.25),
+                Instant::DateTime(DateTime(2000, 1, 1, 18, 0, 0), scale).getJulianDateParts(scale)
+            );
+            EXPECT_EQ(
+                Pair<Real, Real>(2451544.0, 0.75),
+                Instant::DateTime(DateTime(2000, 1, 1, 6, 0, 0), scale).getJulianDateParts(scale)
+            );
+            EXPECT_EQ(
+                Pair<Real, Real>(2444970.0, 0.5),
+                Instant::DateTime(DateTime(1982, 1, 1, 0, 0, 0), scale).getJulianDateParts(scale)
+            );
+        }
+    }
+
+    // Fraction keeps the nanosecond resolution
+
+    {
+        const Instant instant =
+            Instant::DateTime(DateTime(2030, 6, 20, 12, 0, 0), Scale::TT) + Duration::Nanoseconds(1.0);
+
+        const Pair<Real, Real> julianDateParts = instant.getJulianDateParts(Scale::TT);
+
+        EXPECT_EQ(2462673.0, julianDateParts.first);
+        EXPECT_NEAR(1e-9 / 86400.0, julianDateParts.second, 1e-24);
+    }
+
+    // Consistent with date-time
+
+    {
+        for (auto const& scale : scales)
+        {
+            for (const auto year : years)
+            {
+                for (const auto hour : hours)
+                {
+                    const DateTime dateTime = DateTime(year, 6, 20, hour, 30, 59, 500);
+
+                    const Pair<Real, Real> julianDateParts =
+                        Instant::DateTime(dateTime, scale).getJulianDateParts(scale);
+
+                    EXPECT_NEAR(dateTime.getJulianDate(), julianDateParts.first + julianDateParts.second, 1e-9);
+                    EXPECT_LE(0.0, julianDateParts.second);
+                    EXPECT_GT(1.0, julianDateParts.second);
+                }
+            }
+        }
+    }
+
+    {
+        for (auto const& scale : scales)
+        {
+            EXPECT_ANY_THROW(Instant::Undefined().getJulianDateParts(scale));
+        }
+
+        EXPECT_ANY_THROW(Instant::J2000().getJulianDateParts(Scale::Undefined));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Time_Instant, GetModifiedJulianDateParts)
+{
+    using ostk::core::container::Pair;
+    using ostk::core::type::Real;
+
+    using ostk::physics::time::Scale;
+    using ostk::physics::time::DateTime;
+    using ostk::physics::time::Instant;
+
+    {
+        for (auto const& scale : scales)
+        {
+            EXPECT_EQ(
+                Pair<Real, Real>(51544.0, 0.5),
+                Instant::DateTime(DateTime(2000, 1, 1, 12, 0, 0), scale).getModifiedJulianDateParts(scale)
+            );
+            EXPECT_EQ(
+                Pair<Real, Real>(51544.0, 0.0),
+                Instant::DateTime(DateTime(2000, 1, 1, 0, 0, 0), scale).getModifiedJulianDateParts(scale)
+            );
+            EXPECT_EQ(
+                Pair<Real, Real>(54000.0, 0.75),
+                Instant::DateTime(DateTime(2006, 9, 22, 18, 0, 0), scale).getModifiedJulianDateParts(scale)
+            );
+            EXPECT_EQ(
+                Pair<Real, Real>(44969.0, 0.25),
+                Instant::DateTime(DateTime(1981, 12, 31, 6, 0, 0), scale).getModifiedJulianDateParts(scale)
+            );
+        }
+    }
+
+    {
+        for (auto const& scale : scales)
+        {
+            EXPECT_ANY_THROW(Instant::Undefined().getModifiedJulianDateParts(scale));
+        }
+
+        EXPECT_ANY_THROW(Instant::J2000().getModifiedJulianDateParts(Scale::Undefined));
+    }
+}
+
 TEST(OpenSpaceToolkit_Physics_Time_Instant, GetLeapSecondCount)
 {
     using ostk::physics::time::Scale;
@@ -1531,6 +1677,44 @@ TEST(OpenSpaceToolkit_Physics_Time_Instant, GetLeapSecondCount)
     );
 }
 
+TEST(OpenSpaceToolkit_Physics_Time_Instant, UT1)
+{
+    using ostk::core::filesystem::File;
+    using ostk::core::filesystem::Path;
+    using ostk::core::type::Real;
+
+    using ostk::physics::coordinate::frame::provider::iers::BulletinA;
+    using ostk::physics::coordinate::frame::provider::iers::Manager;
+    using ostk::physics::time::DateTime;
+    using ostk::physics::time::Duration;
+    using ostk::physics::time::Instant;
+    using ostk::physics::time::Scale;
+
+    Manager& manager = Manager::Get();
+
+    manager.loadBulletinA(BulletinA::Load(File::Path(
+        Path::Parse("/app/test/OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/bulletin-A/ser7.dat")
+    )));
+
+    {
+        for (const auto& dateTimeString : {"2018-06-22 00:00:00", "2018-06-25 12:34:56.789", "2018-09-01 18:00:00"})
+        {
+            const Instant instant = Instant::DateTime(DateTime::Parse(dateTimeString), Scale::UTC);
+
+            const Real ut1MinusUtc = manager.getUt1MinusUtcAt(instant);
+
+            const DateTime dateTime_UT1 = instant.getDateTime(Scale::UT1);
+
+            EXPECT_NEAR(ut1MinusUtc, (Instant::DateTime(dateTime_UT1, Scale::UTC) - instant).inSeconds(), 2e-9);
+
+            EXPECT_TRUE(Instant::DateTime(dateTime_UT1, Scale::UT1).isNear(instant, Duration::Nanoseconds(1.0)));
+            EXPECT_EQ(dateTime_UT1, Instant::DateTime(dateTime_UT1, Scale::UT1).getDateTime(Scale::UT1));
+        }
+    }
+
+    manager.reset();
+}
+
 TEST(OpenSpaceToolkit_Physics_Time_Instant, ToString)
 {
     using ostk::core::type::String;
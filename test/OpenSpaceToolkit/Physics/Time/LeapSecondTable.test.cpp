@@ -0,0 +1,211 @@
+/// Apache License 2.0
+
+#include <cstdlib>
+#include <limits>
+#include <string>
+
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/LeapSecondTable.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+using ostk::core::type::Int64;
+
+using ostk::physics::time::Date;
+using ostk::physics::time::LeapSecondTable;
+
+static const Int64 SecondInNanoseconds = 1000000000;
+
+TEST(OpenSpaceToolkit_Physics_Time_LeapSecondTable, Constructor)
+{
+    {
+        EXPECT_NO_THROW(LeapSecondTable({{Date(1972, 1, 1), 10}, {Date(1972, 7, 1), 11}}));
+    }
+
+    {
+        EXPECT_ANY_THROW(LeapSecondTable({{Date(1972, 7, 1), 11}, {Date(1972, 1, 1), 10}}));
+        EXPECT_ANY_THROW(LeapSecondTable({{Date(1972, 1, 1), 10}, {Date(1972, 1, 1), 11}}));
+        EXPECT_ANY_THROW(LeapSecondTable({{Date::Undefined(), 10}}));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Time_LeapSecondTable, IsDefined)
+{
+    {
+        EXPECT_TRUE(LeapSecondTable::BuiltIn().isDefined());
+        EXPECT_FALSE(LeapSecondTable::Undefined().isDefined());
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Time_LeapSecondTable, GetTAIMinusUTCAtUTC)
+{
+    const LeapSecondTable table = LeapSecondTable::BuiltIn();
+
+    {
+        EXPECT_EQ(28, table.getSize());
+        EXPECT_EQ(Date(2017, 1, 1), table.getLastDate());
+    }
+
+    // 2017-01-01 00:00:00 UTC is 536500800 [s] after J2000
+
+    {
+        const Int64 leapSecondCount = 536500800 * SecondInNanoseconds;
+
+        EXPECT_EQ(36 * SecondInNanoseconds, table.getTAIMinusUTCAtUTC(leapSecondCount - 1));
+        EXPECT_EQ(37 * SecondInNanoseconds, table.getTAIMinusUTCAtUTC(leapSecondCount));
+        EXPECT_EQ(37 * SecondInNanoseconds, table.getTAIMinusUTCAtUTC(std::numeric_limits<Int64>::max()));
+    }
+
+    // 1999-01-01 00:00:00 UTC is 31579200 [s] before J2000
+
+    {
+        const Int64 leapSecondCount = -31579200 * SecondInNanoseconds;
+
+        EXPECT_EQ(31 * SecondInNanoseconds, table.getTAIMinusUTCAtUTC(leapSecondCount - 1));
+        EXPECT_EQ(32 * SecondInNanoseconds, table.getTAIMinusUTCAtUTC(leapSecondCount));
+        EXPECT_EQ(32 * SecondInNanoseconds, table.getTAIMinusUTCAtUTC(0));
+    }
+
+    // 1970-01-01 00:00:00 UTC is 946728000 [s] before J2000: first entry applies back to it, out of bounds before
+
+    {
+        const Int64 lowerBoundCount = -946728000 * SecondInNanoseconds;
+
+        EXPECT_EQ(10 * SecondInNanoseconds, table.getTAIMinusUTCAtUTC(lowerBoundCount));
+        EXPECT_ANY_THROW(table.getTAIMinusUTCAtUTC(lowerBoundCount - 1));
+        EXPECT_ANY_THROW(table.getTAIMinusUTCAtUTC(std::numeric_limits<Int64>::min()));
+    }
+
+    // Increasing and decreasing sequences of queries give the same results
+
+    {
+        Array<Int64> counts = Array<Int64>::Empty();
+        Array<Int64> values = Array<Int64>::Empty();
+
+        for (Int64 count = -900000000 * SecondInNanoseconds; count < 600000000 * SecondInNanoseconds;
+             count += 86400 * SecondInNanoseconds)
+        {
+            counts.add(count);
+            values.add(table.getTAIMinusUTCAtUTC(count));
+        }
+
+        for (auto index = counts.getSize(); index > 0; --index)
+        {
+            EXPECT_EQ(values[index - 1], table.getTAIMinusUTCAtUTC(counts[index - 1]));
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(LeapSecondTable::Undefined().getTAIMinusUTCAtUTC(0));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Time_LeapSecondTable, GetTAIMinusUTCAtTAI)
+{
+    const LeapSecondTable table = LeapSecondTable::BuiltIn();
+
+    // Leap second starts in TAI at 2017-01-01 00:00:00 UTC + 36 [s]
+
+    {
+        const Int64 leapSecondCount = (536500800 + 36) * SecondInNanoseconds;
+
+        EXPECT_EQ(36 * SecondInNanoseconds, table.getTAIMinusUTCAtTAI(leapSecondCount - 1));
+        EXPECT_EQ(37 * SecondInNanoseconds, table.getTAIMinusUTCAtTAI(leapSecondCount));
+    }
+
+    {
+        EXPECT_EQ(32 * SecondInNanoseconds, table.getTAIMinusUTCAtTAI(0));
+    }
+
+    // Lower bound is 1970-01-01 00:00:00 UTC + 10 [s]
+
+    {
+        const Int64 lowerBoundCount = (-946728000 + 10) * SecondInNanoseconds;
+
+        EXPECT_EQ(10 * SecondInNanoseconds, table.getTAIMinusUTCAtTAI(lowerBoundCount));
+        EXPECT_ANY_THROW(table.getTAIMinusUTCAtTAI(lowerBoundCount - 1));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Time_LeapSecondTable, Load)
+{
+    {
+        const LeapSecondTable table = LeapSecondTable::Load(
+            File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Physics/Environment/Ephemeris/SPICE/naif0012.tls"))
+        );
+
+        const LeapSecondTable builtInTable = LeapSecondTable::BuiltIn();
+
+        EXPECT_EQ(builtInTable.getSize(), table.getSize());
+        EXPECT_EQ(builtInTable.getLastDate(), table.getLastDate());
+
+        for (Int64 count = -900000000 * SecondInNanoseconds; count < 600000000 * SecondInNanoseconds;
+             count += 43200 * SecondInNanoseconds)
+        {
+            EXPECT_EQ(builtInTable.getTAIMinusUTCAtUTC(count), table.getTAIMinusUTCAtUTC(count));
+            EXPECT_EQ(builtInTable.getTAIMinusUTCAtTAI(count), table.getTAIMinusUTCAtTAI(count));
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(LeapSecondTable::Load(File::Undefined()));
+        EXPECT_ANY_THROW(LeapSecondTable::Load(File::Path(Path::Parse("/does/not/exist.tls"))));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Time_LeapSecondTable, Default)
+{
+    {
+        const LeapSecondTable table = LeapSecondTable::Default();
+
+        EXPECT_TRUE(table.isDefined());
+        EXPECT_LE(LeapSecondTable::BuiltIn().getSize(), table.getSize());
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Time_LeapSecondTable, DefaultFile)
+{
+    {
+        if (std::getenv("OSTK_PHYSICS_TIME_LEAP_SECOND_TABLE_FILE") == nullptr)
+        {
+            EXPECT_FALSE(LeapSecondTable::DefaultFile().isDefined());
+        }
+    }
+
+    {
+        const char* previousFilePath = std::getenv("OSTK_PHYSICS_TIME_LEAP_SECOND_TABLE_FILE");
+        const std::string previousFilePathString = (previousFilePath != nullptr) ? previousFilePath : "";
+
+        setenv("OSTK_PHYSICS_TIME_LEAP_SECOND_TABLE_FILE", "/tmp/latest_leapseconds.tls", 1);
+
+        const File file = LeapSecondTable::DefaultFile();
+
+        EXPECT_TRUE(file.isDefined());
+        EXPECT_EQ("latest_leapseconds.tls", file.getName());
+
+        if (previousFilePath != nullptr)
+        {
+            setenv("OSTK_PHYSICS_TIME_LEAP_SECOND_TABLE_FILE", previousFilePathString.c_str(), 1);
+        }
+        else
+        {
+            unsetenv("OSTK_PHYSICS_TIME_LEAP_SECOND_TABLE_FILE");
+        }
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Time_LeapSecondTable, Access)
+{
+    {
+        EXPECT_TRUE(LeapSecondTable::Access().isDefined());
+    }
+
+    {
+        EXPECT_ANY_THROW(LeapSecondTable::Set(LeapSecondTable::Undefined()));
+    }
+}